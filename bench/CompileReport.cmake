@@ -0,0 +1,84 @@
+# Collates -ftime-trace output (or wall time recorded by CompileTime.cmake) and object sizes of the bench_compile_* targets.
+#   MANIFESTS  comma separated list of <config>=<file listing object files>
+#   REPORT     path of the markdown report to write
+#   NM         optional nm tool, lists sizes of bench* functions per config
+
+cmake_minimum_required(VERSION 3.15)
+
+if(NOT MANIFESTS OR NOT REPORT)
+    message(FATAL_ERROR "usage: cmake -DMANIFESTS=... -DREPORT=... -P CompileReport.cmake")
+endif()
+
+# reads duration (in ms) of a "Total <event>" entry from a clang time trace
+function(read_trace_total TRACE EVENT OUT)
+    set(${OUT} "n/a" PARENT_SCOPE)
+    if(NOT EXISTS ${TRACE})
+        return()
+    endif()
+    file(READ ${TRACE} content)
+    string(REGEX MATCH "\"dur\":([0-9]+),\"name\":\"Total ${EVENT}\"" match "${content}")
+    if(match)
+        math(EXPR ms "${CMAKE_MATCH_1} / 1000")
+        set(${OUT} ${ms} PARENT_SCOPE)
+    endif()
+endfunction()
+
+set(report "# Compile time report\n\n")
+set(symbols)
+string(APPEND report "| config | unit | frontend (ms) | instantiate class (ms) | instantiate function (ms) | total (ms) | object (bytes) |\n")
+string(APPEND report "|---|---|---:|---:|---:|---:|---:|\n")
+
+string(REPLACE "," ";" MANIFESTS "${MANIFESTS}")
+foreach(entry ${MANIFESTS})
+    string(REGEX MATCH "^([^=]+)=(.+)$" match "${entry}")
+    set(cfg ${CMAKE_MATCH_1})
+    set(manifest ${CMAKE_MATCH_2})
+
+    file(STRINGS ${manifest} objects)
+    foreach(obj ${objects})
+        get_filename_component(unit ${obj} NAME)
+        string(REGEX REPLACE "\\.(o|obj)$" "" unit "${unit}")
+        string(REGEX REPLACE "\\.(o|obj)$" ".json" trace "${obj}")
+
+        read_trace_total(${trace} "Frontend" frontend)
+        read_trace_total(${trace} "InstantiateClass" instClass)
+        read_trace_total(${trace} "InstantiateFunction" instFunc)
+        read_trace_total(${trace} "ExecuteCompiler" total)
+        if(total STREQUAL "n/a" AND EXISTS ${obj}.ms)
+            file(READ ${obj}.ms total)
+            string(STRIP "${total}" total)
+        endif()
+
+        set(size "n/a")
+        if(EXISTS ${obj})
+            file(SIZE ${obj} size)
+        endif()
+
+        string(APPEND report "| ${cfg} | ${unit} | ${frontend} | ${instClass} | ${instFunc} | ${total} | ${size} |\n")
+
+        if(NM AND EXISTS ${obj})
+            execute_process(COMMAND ${NM} -S -C --defined-only ${obj}
+                            OUTPUT_VARIABLE nm_out
+                            ERROR_QUIET)
+            string(REPLACE "\n" ";" nm_lines "${nm_out}")
+            foreach(line ${nm_lines})
+                # <address> <size> <type> <name>
+                if(line MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tTwW] (bench[A-Za-z0-9_]*)")
+                    math(EXPR fsize "0x${CMAKE_MATCH_1}" OUTPUT_FORMAT DECIMAL)
+                    string(APPEND symbols "| ${cfg} | ${CMAKE_MATCH_2} | ${fsize} |\n")
+                endif()
+            endforeach()
+        endif()
+    endforeach()
+endforeach()
+
+if(symbols)
+    string(APPEND report "\n# Function size\n\n")
+    string(APPEND report "| config | function | size (bytes) |\n")
+    string(APPEND report "|---|---|---:|\n")
+    string(APPEND report "${symbols}")
+endif()
+
+file(WRITE ${REPORT} "${report}")
+message("${report}")
+message("Report written to: ${REPORT}")
@@ -0,0 +1,53 @@
+# Compiler launcher of the bench_compile_* targets for compilers without -ftime-trace.
+# Runs the compile command REPEAT times and writes the fastest wall time (in ms) to <object>.ms,
+# CompileReport.cmake reports it as total.
+#   cmake [-DREPEAT=<n>] -P CompileTime.cmake -- <compiler> [args...]
+
+cmake_minimum_required(VERSION 3.23)
+
+set(command)
+set(object)
+set(found OFF)
+set(next_is_object OFF)
+math(EXPR last "${CMAKE_ARGC} - 1")
+foreach(i RANGE ${last})
+    set(arg "${CMAKE_ARGV${i}}")
+    if(found)
+        list(APPEND command "${arg}")
+        if(next_is_object)
+            set(object "${arg}")
+            set(next_is_object OFF)
+        elseif(arg STREQUAL "-o")
+            set(next_is_object ON)
+        elseif(arg MATCHES "^[-/]Fo(.+)$")
+            set(object "${CMAKE_MATCH_1}")
+        endif()
+    elseif(arg STREQUAL "--")
+        set(found ON)
+    endif()
+endforeach()
+
+if(NOT command)
+    message(FATAL_ERROR "usage: cmake [-DREPEAT=<n>] -P CompileTime.cmake -- <compiler> [args...]")
+endif()
+if(NOT REPEAT OR REPEAT LESS 1)
+    set(REPEAT 1)
+endif()
+
+set(best)
+foreach(run RANGE 1 ${REPEAT})
+    string(TIMESTAMP start "%s%f" UTC)
+    execute_process(COMMAND ${command} RESULT_VARIABLE result)
+    string(TIMESTAMP end "%s%f" UTC)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "compile failed: ${result}")
+    endif()
+    math(EXPR ms "(${end} - ${start}) / 1000")
+    if(NOT best OR ms LESS best)
+        set(best ${ms})
+    endif()
+endforeach()
+
+if(object)
+    file(WRITE "${object}.ms" "${best}")
+endif()
@@ -0,0 +1,42 @@
+# Lists the enumerators of generated enum classes, for checks that have to cover every one of them.
+#   HEADER  generated vulkan_enums.hpp
+#   ENUMS   comma separated enum class names
+#   OUTPUT  file to write, one VKGEN_ENUM( Type, enumerator ) per line,
+#           preprocessor conditions inside the enum bodies are kept
+
+cmake_minimum_required(VERSION 3.15)
+
+if(NOT HEADER OR NOT ENUMS OR NOT OUTPUT)
+    message(FATAL_ERROR "usage: cmake -DHEADER=... -DENUMS=... -DOUTPUT=... -P EnumList.cmake")
+endif()
+
+string(REPLACE "," ";" ENUMS "${ENUMS}")
+file(STRINGS ${HEADER} lines)
+
+set(content "")
+set(current "")
+foreach(line IN LISTS lines)
+    if(current STREQUAL "")
+        if(line MATCHES "^  enum class ([A-Za-z0-9_]+)")
+            if(CMAKE_MATCH_1 IN_LIST ENUMS)
+                set(current ${CMAKE_MATCH_1})
+                list(REMOVE_ITEM ENUMS ${current})
+            endif()
+        endif()
+        continue()
+    endif()
+
+    if(line MATCHES "^  };")
+        set(current "")
+    elseif(line MATCHES "^#")
+        string(APPEND content "${line}\n")
+    elseif(line MATCHES "^ +(e[A-Za-z0-9_]+) = ")
+        string(APPEND content "VKGEN_ENUM( ${current}, ${CMAKE_MATCH_1} )\n")
+    endif()
+endforeach()
+
+if(ENUMS)
+    message(FATAL_ERROR "enum class not found in ${HEADER}: ${ENUMS}")
+endif()
+
+file(WRITE ${OUTPUT} "${content}")
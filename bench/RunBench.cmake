@@ -0,0 +1,45 @@
+# Runs a benchmark with the revision of the source tree appended to its arguments.
+# The revision is read when the benchmark runs, not when the project is configured.
+#   cmake -DSOURCE_DIR=<repo> [-DGIT=<git>] -P RunBench.cmake -- <program> [args...]
+
+cmake_minimum_required(VERSION 3.15)
+
+set(command)
+set(found OFF)
+math(EXPR last "${CMAKE_ARGC} - 1")
+foreach(i RANGE ${last})
+    if(found)
+        list(APPEND command "${CMAKE_ARGV${i}}")
+    elseif("${CMAKE_ARGV${i}}" STREQUAL "--")
+        set(found ON)
+    endif()
+endforeach()
+
+if(NOT command)
+    message(FATAL_ERROR "usage: cmake -DSOURCE_DIR=... -P RunBench.cmake -- <program> [args...]")
+endif()
+
+set(revision "local")
+if(GIT AND SOURCE_DIR)
+    execute_process(COMMAND ${GIT} rev-parse --short HEAD
+                    WORKING_DIRECTORY ${SOURCE_DIR}
+                    OUTPUT_VARIABLE head
+                    OUTPUT_STRIP_TRAILING_WHITESPACE
+                    RESULT_VARIABLE result
+                    ERROR_QUIET)
+    if(result EQUAL 0 AND head)
+        set(revision ${head})
+        execute_process(COMMAND ${GIT} diff --quiet HEAD
+                        WORKING_DIRECTORY ${SOURCE_DIR}
+                        RESULT_VARIABLE dirty
+                        ERROR_QUIET)
+        if(NOT dirty EQUAL 0)
+            string(APPEND revision "-dirty")
+        endif()
+    endif()
+endif()
+
+execute_process(COMMAND ${command} ${revision} RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${command} failed: ${result}")
+endif()
@@ -0,0 +1,145 @@
+// Shared body of chains_tuple.cpp and chains_flat.cpp.
+// Instantiates PhysicalDeviceFeatures2 chains of growing length with the chain
+// template given as BENCH_CHAIN, so both units compile the same amount of user code:
+// every prefix of Chain51 with at least two extending structures, 49 chains with Chain4, Chain16 and Chain51 among them.
+#include <vulkan/vulkan.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+namespace bench {
+
+    template <typename... Ts>
+    using Chain = BENCH_CHAIN<vk::PhysicalDeviceFeatures2, Ts...>;
+
+    using Chain4 = Chain<vk::PhysicalDeviceVulkan11Features, vk::PhysicalDeviceVulkan12Features, vk::PhysicalDeviceVulkan13Features>;
+
+    using Chain16 = Chain<vk::PhysicalDeviceVulkan11Features,
+                          vk::PhysicalDeviceVulkan12Features,
+                          vk::PhysicalDeviceVulkan13Features,
+                          vk::PhysicalDevice16BitStorageFeatures,
+                          vk::PhysicalDeviceMultiviewFeatures,
+                          vk::PhysicalDeviceVariablePointersFeatures,
+                          vk::PhysicalDeviceProtectedMemoryFeatures,
+                          vk::PhysicalDeviceSamplerYcbcrConversionFeatures,
+                          vk::PhysicalDeviceShaderDrawParametersFeatures,
+                          vk::PhysicalDevice8BitStorageFeatures,
+                          vk::PhysicalDeviceShaderAtomicInt64Features,
+                          vk::PhysicalDeviceShaderFloat16Int8Features,
+                          vk::PhysicalDeviceDescriptorIndexingFeatures,
+                          vk::PhysicalDeviceScalarBlockLayoutFeatures,
+                          vk::PhysicalDeviceVulkanMemoryModelFeatures>;
+
+    // extending structures of Chain51, in chain order
+    using Features = std::tuple<vk::PhysicalDeviceVulkan11Features,
+                                vk::PhysicalDeviceVulkan12Features,
+                                vk::PhysicalDeviceVulkan13Features,
+                                vk::PhysicalDevice16BitStorageFeatures,
+                                vk::PhysicalDeviceMultiviewFeatures,
+                                vk::PhysicalDeviceVariablePointersFeatures,
+                                vk::PhysicalDeviceProtectedMemoryFeatures,
+                                vk::PhysicalDeviceSamplerYcbcrConversionFeatures,
+                                vk::PhysicalDeviceShaderDrawParametersFeatures,
+                                vk::PhysicalDevice8BitStorageFeatures,
+                                vk::PhysicalDeviceShaderAtomicInt64Features,
+                                vk::PhysicalDeviceShaderFloat16Int8Features,
+                                vk::PhysicalDeviceDescriptorIndexingFeatures,
+                                vk::PhysicalDeviceScalarBlockLayoutFeatures,
+                                vk::PhysicalDeviceVulkanMemoryModelFeatures,
+                                vk::PhysicalDeviceImagelessFramebufferFeatures,
+                                vk::PhysicalDeviceUniformBufferStandardLayoutFeatures,
+                                vk::PhysicalDeviceShaderSubgroupExtendedTypesFeatures,
+                                vk::PhysicalDeviceSeparateDepthStencilLayoutsFeatures,
+                                vk::PhysicalDeviceHostQueryResetFeatures,
+                                vk::PhysicalDeviceTimelineSemaphoreFeatures,
+                                vk::PhysicalDeviceBufferDeviceAddressFeatures,
+                                vk::PhysicalDeviceImageRobustnessFeatures,
+                                vk::PhysicalDeviceInlineUniformBlockFeatures,
+                                vk::PhysicalDevicePipelineCreationCacheControlFeatures,
+                                vk::PhysicalDevicePrivateDataFeatures,
+                                vk::PhysicalDeviceShaderDemoteToHelperInvocationFeatures,
+                                vk::PhysicalDeviceShaderTerminateInvocationFeatures,
+                                vk::PhysicalDeviceSubgroupSizeControlFeatures,
+                                vk::PhysicalDeviceSynchronization2Features,
+                                vk::PhysicalDeviceTextureCompressionASTCHDRFeatures,
+                                vk::PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures,
+                                vk::PhysicalDeviceDynamicRenderingFeatures,
+                                vk::PhysicalDeviceShaderIntegerDotProductFeatures,
+                                vk::PhysicalDeviceMaintenance4Features,
+                                vk::PhysicalDeviceTransformFeedbackFeaturesEXT,
+                                vk::PhysicalDeviceMeshShaderFeaturesEXT,
+                                vk::PhysicalDeviceRobustness2FeaturesEXT,
+                                vk::PhysicalDeviceConditionalRenderingFeaturesEXT,
+                                vk::PhysicalDeviceDepthClipEnableFeaturesEXT,
+                                vk::PhysicalDeviceCustomBorderColorFeaturesEXT,
+                                vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT,
+                                vk::PhysicalDeviceExtendedDynamicState2FeaturesEXT,
+                                vk::PhysicalDeviceFragmentDensityMapFeaturesEXT,
+                                vk::PhysicalDeviceLineRasterizationFeaturesEXT,
+                                vk::PhysicalDeviceIndexTypeUint8FeaturesEXT,
+                                vk::PhysicalDeviceAccelerationStructureFeaturesKHR,
+                                vk::PhysicalDeviceRayTracingPipelineFeaturesKHR,
+                                vk::PhysicalDeviceRayQueryFeaturesKHR,
+                                vk::PhysicalDeviceFragmentShadingRateFeaturesKHR>;
+
+    template <typename Seq>
+    struct PrefixOf;
+
+    template <size_t... Is>
+    struct PrefixOf<std::index_sequence<Is...>>
+    {
+        using type = Chain<std::tuple_element_t<Is, Features>...>;
+    };
+
+    // PhysicalDeviceFeatures2 and the first N structures of Features
+    template <size_t N>
+    using PrefixChain = typename PrefixOf<std::make_index_sequence<N>>::type;
+
+    using Chain51 = PrefixChain<std::tuple_size_v<Features>>;
+
+    template <typename C>
+    uint32_t useChain(C &chain) {
+        auto &features = chain.template get<vk::PhysicalDeviceFeatures2>();
+        auto &v12      = chain.template get<vk::PhysicalDeviceVulkan12Features>();
+
+        chain.template unlink<vk::PhysicalDeviceVulkan11Features>();
+        uint32_t linked = chain.template isLinked<vk::PhysicalDeviceVulkan11Features>() ? 1 : 0;
+        chain.template relink<vk::PhysicalDeviceVulkan11Features>();
+
+        C copy = chain;
+        auto [f, v11] = copy.template get<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceVulkan11Features>();
+        return linked + features.features.robustBufferAccess + v12.timelineSemaphore + f.features.geometryShader + v11.multiview;
+    }
+
+    template <size_t N>
+    uint32_t usePrefixChain() {
+        PrefixChain<N> chain;
+        return useChain(chain);
+    }
+
+    template <size_t... Ns>
+    uint32_t usePrefixChains(std::index_sequence<Ns...>) {
+        return (usePrefixChain<Ns + 2>() + ...);
+    }
+
+}  // namespace bench
+
+uint32_t benchChain4(bench::Chain4 &chain) {
+    return bench::useChain(chain);
+}
+
+uint32_t benchChain16(bench::Chain16 &chain) {
+    return bench::useChain(chain);
+}
+
+uint32_t benchPrefixChains() {
+    return bench::usePrefixChains(std::make_index_sequence<std::tuple_size_v<bench::Features> - 1>{});
+}
+
+uint32_t benchChain51(bench::Chain51 &chain) {
+    chain.get<vk::PhysicalDeviceMeshShaderFeaturesEXT>().meshShader = true;
+    chain.unlink<vk::PhysicalDeviceRayQueryFeaturesKHR>();
+    return bench::useChain(chain) + chain.isLinked<vk::PhysicalDeviceRayQueryFeaturesKHR>();
+}
@@ -0,0 +1,3 @@
+// Structure chains through vk::FlatStructureChain (flat_struct_chain config).
+#define BENCH_CHAIN vk::FlatStructureChain
+#include "chain_usage.hpp"
@@ -0,0 +1,3 @@
+// Structure chains through the std::tuple based vk::StructureChain.
+#define BENCH_CHAIN vk::StructureChain
+#include "chain_usage.hpp"
@@ -0,0 +1,101 @@
+// Pipeline descriptions built entirely at compile time. Global mode structs are aggregates,
+// they are built with designated initializers and member assignment in constexpr functions,
+// ArrayProxy views the constexpr arrays. Fails to compile if any of them is not constexpr.
+#include <vulkan/vulkan.hpp>
+
+#include <array>
+
+namespace
+{
+    constexpr vk::PipelineColorBlendAttachmentState alphaBlend() {
+        vk::PipelineColorBlendAttachmentState state{};
+        state.blendEnable         = VK_TRUE;
+        state.srcColorBlendFactor = vk::BlendFactor::eSrcAlpha;
+        state.dstColorBlendFactor = vk::BlendFactor::eOneMinusSrcAlpha;
+        state.colorBlendOp        = vk::BlendOp::eAdd;
+        state.srcAlphaBlendFactor = vk::BlendFactor::eOne;
+        state.dstAlphaBlendFactor = vk::BlendFactor::eZero;
+        state.alphaBlendOp        = vk::BlendOp::eAdd;
+        state.colorWriteMask =
+          vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG | vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA;
+        return state;
+    }
+
+    constexpr std::array<vk::PipelineColorBlendAttachmentState, 2> blendAttachments = {
+        alphaBlend(),
+        vk::PipelineColorBlendAttachmentState{ .colorWriteMask = vk::ColorComponentFlagBits::eR },
+    };
+
+    constexpr vk::VertexInputBindingDescription bindings[] = {
+        { 0, 32, vk::VertexInputRate::eVertex },
+        { 1, 16, vk::VertexInputRate::eInstance },
+    };
+
+    constexpr vk::VertexInputAttributeDescription attributes[] = {
+        { 0, 0, vk::Format::eR32G32B32Sfloat, 0 },
+        { 1, 0, vk::Format::eR32G32Sfloat, 12 },
+        { 2, 0, vk::Format::eR32G32B32Sfloat, 20 },
+        { 3, 1, vk::Format::eR32G32B32A32Sfloat, 0 },
+    };
+
+    constexpr vk::ArrayProxy<const vk::VertexInputBindingDescription>   bindingProxy   = bindings;
+    constexpr vk::ArrayProxy<const vk::VertexInputAttributeDescription> attributeProxy = attributes;
+
+    constexpr vk::PipelineVertexInputStateCreateInfo vertexInput{
+        .vertexBindingDescriptionCount   = bindingProxy.size(),
+        .pVertexBindingDescriptions      = bindingProxy.data(),
+        .vertexAttributeDescriptionCount = attributeProxy.size(),
+        .pVertexAttributeDescriptions    = attributeProxy.data(),
+    };
+
+    constexpr vk::PipelineColorBlendStateCreateInfo blendState{
+        .attachmentCount = static_cast<uint32_t>(blendAttachments.size()),
+        .pAttachments    = blendAttachments.data(),
+        .blendConstants  = { 0.f, 0.f, 0.f, 1.f },
+    };
+
+    constexpr std::array<vk::SamplerCreateInfo, 3> samplerPresets = {
+        vk::SamplerCreateInfo{
+          .magFilter  = vk::Filter::eLinear,
+          .minFilter  = vk::Filter::eLinear,
+          .mipmapMode = vk::SamplerMipmapMode::eLinear,
+          .maxLod     = VK_LOD_CLAMP_NONE,
+        },
+        vk::SamplerCreateInfo{
+          .magFilter    = vk::Filter::eNearest,
+          .minFilter    = vk::Filter::eNearest,
+          .addressModeU = vk::SamplerAddressMode::eClampToEdge,
+          .addressModeV = vk::SamplerAddressMode::eClampToEdge,
+          .addressModeW = vk::SamplerAddressMode::eClampToEdge,
+        },
+        vk::SamplerCreateInfo{
+          .magFilter        = vk::Filter::eLinear,
+          .minFilter        = vk::Filter::eLinear,
+          .mipmapMode       = vk::SamplerMipmapMode::eLinear,
+          .addressModeU     = vk::SamplerAddressMode::eRepeat,
+          .addressModeV     = vk::SamplerAddressMode::eRepeat,
+          .addressModeW     = vk::SamplerAddressMode::eRepeat,
+          .anisotropyEnable = VK_TRUE,
+          .maxAnisotropy    = 16.f,
+        },
+    };
+
+    static_assert(blendAttachments[0].blendEnable == VK_TRUE, "");
+    static_assert(vertexInput.vertexBindingDescriptionCount == 2 && vertexInput.pVertexBindingDescriptions == bindings, "");
+    static_assert(vertexInput.vertexAttributeDescriptionCount == 4, "");
+    static_assert(blendState.attachmentCount == 2 && blendState.blendConstants[3] == 1.f, "");
+    static_assert(samplerPresets[2].maxAnisotropy == 16.f && samplerPresets[0].sType == vk::StructureType::eSamplerCreateInfo, "");
+
+}  // namespace
+
+const vk::SamplerCreateInfo &benchConstexprSampler(size_t index) {
+    return samplerPresets[index % samplerPresets.size()];
+}
+
+const vk::PipelineVertexInputStateCreateInfo &benchConstexprVertexInput() {
+    return vertexInput;
+}
+
+const vk::PipelineColorBlendStateCreateInfo &benchConstexprBlendState() {
+    return blendState;
+}
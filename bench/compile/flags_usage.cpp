@@ -0,0 +1,32 @@
+// Combines, masks and inverts flags of several bitmask types, compares FlagTraits with compact_flags.
+#include <vulkan/vulkan.hpp>
+
+#include <cstdint>
+
+uint64_t benchFlagsUsage(vk::BufferUsageFlags bufferUsage, vk::ImageUsageFlags imageUsage, vk::PipelineStageFlags stages) {
+    vk::BufferUsageFlags buffer = vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eIndexBuffer;
+    buffer |= bufferUsage & ~vk::BufferUsageFlagBits::eTransferSrc;
+    buffer ^= vk::BufferUsageFlagBits::eTransferDst;
+
+    vk::ImageUsageFlags image = vk::ImageUsageFlagBits::eColorAttachment | imageUsage;
+    image &= ~(vk::ImageUsageFlagBits::eStorage | vk::ImageUsageFlagBits::eTransientAttachment);
+
+    vk::PipelineStageFlags stage = vk::PipelineStageFlagBits::eVertexShader ^ vk::PipelineStageFlagBits::eFragmentShader;
+    stage |= stages;
+
+    vk::AccessFlags         access = ~vk::AccessFlags{};
+    vk::ShaderStageFlags    shader = vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment;
+    vk::MemoryPropertyFlags memory = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+    vk::QueueFlags          queue  = ~vk::QueueFlagBits::eSparseBinding;
+
+    uint64_t result = 0;
+    if (buffer & vk::BufferUsageFlagBits::eStorageBuffer) {
+        result |= 1;
+    }
+    if (!(image & vk::ImageUsageFlagBits::eSampled) || stage == vk::PipelineStageFlagBits::eVertexShader) {
+        result |= 2;
+    }
+    result += static_cast<VkBufferUsageFlags>(buffer) + static_cast<VkImageUsageFlags>(image) + static_cast<VkPipelineStageFlags>(stage);
+    result += static_cast<VkAccessFlags>(access) + static_cast<VkShaderStageFlags>(shader) + static_cast<VkMemoryPropertyFlags>(memory) + static_cast<VkQueueFlags>(queue);
+    return result;
+}
@@ -0,0 +1,20 @@
+// Exercises the global command wrappers on a typical create-and-record path.
+#include <vulkan/vulkan.hpp>
+
+vk::Buffer benchCreateBuffer(vk::DeviceSize size) {
+    vk::BufferCreateInfo info{};
+    info.size  = size;
+    info.usage = vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eTransferDst;
+    return vk::createBuffer(info);
+}
+
+void benchRecord(vk::CommandBuffer cmd, vk::Pipeline pipeline, vk::Buffer vertices) {
+    vk::CommandBufferBeginInfo begin{};
+    begin.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
+    vk::beginCommandBuffer(cmd, begin);
+    vk::cmdBindPipeline(cmd, vk::PipelineBindPoint::eGraphics, pipeline);
+    vk::DeviceSize offset = 0;
+    vk::cmdBindVertexBuffers(cmd, 0, vertices, offset);
+    vk::cmdDraw(cmd, 3, 1, 0, 0);
+    vk::endCommandBuffer(cmd);
+}
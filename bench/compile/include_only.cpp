@@ -0,0 +1,6 @@
+// Measures the cost of including the generated bindings without using them.
+#include <vulkan/vulkan.hpp>
+
+int benchIncludeOnly() {
+    return static_cast<int>(sizeof(vk::Instance));
+}
@@ -0,0 +1,26 @@
+// One function per command with result check, object size of each is listed in the report.
+#include <vulkan/vulkan.hpp>
+
+vk::Fence benchCreateFence(vk::FenceCreateInfo const &info) {
+    return vk::createFence(info);
+}
+
+vk::DeviceMemory benchAllocateMemory(vk::MemoryAllocateInfo const &info) {
+    return vk::allocateMemory(info);
+}
+
+void benchQueueSubmit(vk::Queue queue, vk::SubmitInfo const &submit, vk::Fence fence) {
+    vk::queueSubmit(queue, submit, fence);
+}
+
+vk::Result benchWaitForFences(vk::Fence fence) {
+    return vk::waitForFences(fence, VK_TRUE, UINT64_MAX);
+}
+
+vk::Result benchGetEventStatus(vk::Event event) {
+    return vk::getEventStatus(event);
+}
+
+void benchResetFences(vk::Fence fence) {
+    vk::resetFences(fence);
+}
@@ -0,0 +1,84 @@
+// Instantiates and copies a representative set of create-info structs.
+#include <vulkan/vulkan.hpp>
+
+#include <array>
+
+vk::GraphicsPipelineCreateInfo benchStructHeavy(vk::PipelineLayout layout, vk::RenderPass renderPass) {
+    static std::array<vk::PipelineShaderStageCreateInfo, 2> stages{};
+    stages[0].stage  = vk::ShaderStageFlagBits::eVertex;
+    stages[0].pName  = "main";
+    stages[1].stage  = vk::ShaderStageFlagBits::eFragment;
+    stages[1].pName  = "main";
+
+    static vk::VertexInputBindingDescription   binding{};
+    static vk::VertexInputAttributeDescription attribute{};
+    binding.stride     = 16;
+    attribute.format   = vk::Format::eR32G32B32A32Sfloat;
+
+    static vk::PipelineVertexInputStateCreateInfo vertexInput{};
+    vertexInput.vertexBindingDescriptionCount   = 1;
+    vertexInput.pVertexBindingDescriptions      = &binding;
+    vertexInput.vertexAttributeDescriptionCount = 1;
+    vertexInput.pVertexAttributeDescriptions    = &attribute;
+
+    static vk::PipelineInputAssemblyStateCreateInfo inputAssembly{};
+    inputAssembly.topology = vk::PrimitiveTopology::eTriangleList;
+
+    static vk::PipelineViewportStateCreateInfo viewport{};
+    viewport.viewportCount = 1;
+    viewport.scissorCount  = 1;
+
+    static vk::PipelineRasterizationStateCreateInfo rasterization{};
+    rasterization.cullMode  = vk::CullModeFlagBits::eBack;
+    rasterization.lineWidth = 1.0f;
+
+    static vk::PipelineMultisampleStateCreateInfo multisample{};
+    multisample.rasterizationSamples = vk::SampleCountFlagBits::e1;
+
+    static vk::PipelineDepthStencilStateCreateInfo depthStencil{};
+    depthStencil.depthTestEnable  = true;
+    depthStencil.depthWriteEnable = true;
+    depthStencil.depthCompareOp   = vk::CompareOp::eLessOrEqual;
+
+    static vk::PipelineColorBlendAttachmentState attachment{};
+    attachment.colorWriteMask = vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG |
+                                vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA;
+
+    static vk::PipelineColorBlendStateCreateInfo colorBlend{};
+    colorBlend.attachmentCount = 1;
+    colorBlend.pAttachments    = &attachment;
+
+    static std::array<vk::DynamicState, 2> dynamicStates{ vk::DynamicState::eViewport, vk::DynamicState::eScissor };
+    static vk::PipelineDynamicStateCreateInfo dynamic{};
+    dynamic.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
+    dynamic.pDynamicStates    = dynamicStates.data();
+
+    vk::GraphicsPipelineCreateInfo info{};
+    info.stageCount          = static_cast<uint32_t>(stages.size());
+    info.pStages             = stages.data();
+    info.pVertexInputState   = &vertexInput;
+    info.pInputAssemblyState = &inputAssembly;
+    info.pViewportState      = &viewport;
+    info.pRasterizationState = &rasterization;
+    info.pMultisampleState   = &multisample;
+    info.pDepthStencilState  = &depthStencil;
+    info.pColorBlendState    = &colorBlend;
+    info.pDynamicState       = &dynamic;
+    info.layout              = layout;
+    info.renderPass          = renderPass;
+    return info;
+}
+
+vk::SamplerCreateInfo benchSampler(float anisotropy) {
+    vk::SamplerCreateInfo info{};
+    info.magFilter        = vk::Filter::eLinear;
+    info.minFilter        = vk::Filter::eLinear;
+    info.mipmapMode       = vk::SamplerMipmapMode::eLinear;
+    info.addressModeU     = vk::SamplerAddressMode::eRepeat;
+    info.addressModeV     = vk::SamplerAddressMode::eRepeat;
+    info.addressModeW     = vk::SamplerAddressMode::eRepeat;
+    info.anisotropyEnable = anisotropy > 1.0f;
+    info.maxAnisotropy    = anisotropy;
+    info.maxLod           = 16.0f;
+    return info;
+}
@@ -0,0 +1,68 @@
+// Checks the cached_dispatcher option against a stub driver, exits with 1 when a case fails:
+// global command buffer wrappers have to call through vk::device without a dispatcher argument,
+// and through the one passed to them otherwise, so a recording loop can keep its own.
+// With dispatch_template (on by default) that may be any type with the PFN members the wrapper calls.
+// usage: bench_cached_dispatcher_check
+#include "stub_device.hpp"
+
+#include <cstdio>
+
+namespace
+{
+    int deviceDraws = 0;
+    int cachedDraws = 0;
+    int customDraws = 0;
+
+    // holds only what vk::cmdDraw calls
+    struct DrawDispatcher
+    {
+        PFN_vkCmdDraw vkCmdDraw = nullptr;
+    };
+
+    VKAPI_ATTR void VKAPI_CALL stubDeviceDraw(VkCommandBuffer, uint32_t, uint32_t, uint32_t, uint32_t) {
+        ++deviceDraws;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL stubCachedDraw(VkCommandBuffer, uint32_t, uint32_t, uint32_t, uint32_t) {
+        ++cachedDraws;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL stubCustomDraw(VkCommandBuffer, uint32_t, uint32_t, uint32_t, uint32_t) {
+        ++customDraws;
+    }
+
+    bool expect(const char *name, bool ok) {
+        std::printf("%-34s %s\n", name, ok ? "ok" : "FAIL");
+        return ok;
+    }
+
+}  // namespace
+
+int main() {
+    if (!bench::initStubDevice()) {
+        std::printf("stub driver failed to load\n");
+        return 1;
+    }
+
+    const_cast<vk::DeviceDispatcher *>(vk::device.getDispatcher())->vkCmdDraw = &stubDeviceDraw;
+
+    vk::DeviceDispatcher cached = *vk::device.getDispatcher();
+    cached.vkCmdDraw            = &stubCachedDraw;
+
+    const vk::CommandBuffer commandBuffer{};
+
+    bool ok = true;
+    vk::cmdDraw(commandBuffer, 3, 1, 0, 0);
+    ok &= expect("draw through vk::device", deviceDraws == 1 && cachedDraws == 0);
+
+    vk::DeviceDispatcher const *dispatcher = &cached;
+    for (int i = 0; i < 4; ++i) {
+        vk::cmdDraw(commandBuffer, 3, 1, 0, 0, dispatcher);
+    }
+    ok &= expect("draw through passed dispatcher", deviceDraws == 1 && cachedDraws == 4);
+
+    const DrawDispatcher custom{ &stubCustomDraw };
+    vk::cmdDraw(commandBuffer, 3, 1, 0, 0, &custom);
+    ok &= expect("draw through custom dispatcher", deviceDraws == 1 && cachedDraws == 4 && customDraws == 1);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,64 @@
+// Checks the struct_chain_visitor option, exits with 1 when a case fails:
+// a PhysicalDeviceProperties2 -> PhysicalDeviceVulkan11Properties chain (core sType values given by value=)
+// must be visited with its typed structures, sized and deep copied.
+// usage: bench_chain_visitor_check
+#include <vulkan/vulkan.hpp>
+
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    bool expect(const char *name, bool ok) {
+        std::printf("%-34s %s\n", name, ok ? "ok" : "FAIL");
+        return ok;
+    }
+
+}  // namespace
+
+int main() {
+    vk::PhysicalDeviceVulkan11Properties vulkan11{};
+    vulkan11.sType                 = vk::StructureType::ePhysicalDeviceVulkan11Properties;
+    vulkan11.maxMultiviewViewCount = 6;
+    vk::PhysicalDeviceProperties2 properties{};
+    properties.sType = vk::StructureType::ePhysicalDeviceProperties2;
+    properties.pNext = &vulkan11;
+
+    int visitedProperties = 0;
+    int visitedVulkan11   = 0;
+    int visitedUnknown    = 0;
+    vk::visitChain(static_cast<void *>(&properties),
+                   [&](auto &s) {
+                       using T = std::remove_cvref_t<decltype(s)>;
+                       if constexpr (std::is_same_v<T, vk::PhysicalDeviceProperties2>) {
+                           ++visitedProperties;
+                       }
+                       else if constexpr (std::is_same_v<T, vk::PhysicalDeviceVulkan11Properties>) {
+                           visitedVulkan11 += s.maxMultiviewViewCount == 6;
+                       }
+                       else {
+                           ++visitedUnknown;
+                       }
+                   });
+
+    bool ok = true;
+    ok &= expect("visit typed structures", visitedProperties == 1 && visitedVulkan11 == 1 && visitedUnknown == 0);
+    ok &= expect("sizeof core structure types",
+                 vk::sizeofStructureType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES) == sizeof(VkPhysicalDeviceVulkan11Properties) &&
+                   vk::sizeofStructureType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2) == sizeof(VkPhysicalDeviceProperties2) &&
+                   vk::sizeofStructureType(VK_STRUCTURE_TYPE_APPLICATION_INFO) == sizeof(VkApplicationInfo));
+    ok &= expect("sizeof unknown structure type", vk::sizeofStructureType(static_cast<VkStructureType>(0x7ffffff0)) == 0);
+
+    alignas(std::max_align_t) unsigned char arena[1024];
+    const size_t needed = vk::deepCopyChainSize(&properties);
+    size_t       used   = 0;
+    auto        *copy   = vk::deepCopyChain(&properties, arena, sizeof(arena), &used);
+    const auto  *first  = reinterpret_cast<const VkPhysicalDeviceProperties2 *>(copy);
+    const auto  *second = first ? static_cast<const VkPhysicalDeviceVulkan11Properties *>(first->pNext) : nullptr;
+    ok &= expect("deep copy chain",
+                 copy && needed >= used && first->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2 && second != nullptr &&
+                   static_cast<const void *>(second) != &vulkan11 && second->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES &&
+                   second->maxMultiviewViewCount == 6 && second->pNext == nullptr);
+    ok &= expect("deep copy into small arena", vk::deepCopyChain(&properties, arena, sizeof(VkPhysicalDeviceProperties2)) == nullptr);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,174 @@
+// Throughput of vk::CommandStream (command_stream option) against a stub driver:
+// direct recording through the global vk::cmd* wrappers, encoding on one and on several threads, and replay.
+// usage: bench_command_stream [csv file] [revision]
+#include "stub_device.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr size_t frames           = 1'000;
+    constexpr size_t drawsPerFrame    = 512;
+    constexpr size_t commandsPerDraw  = 8;
+    constexpr size_t commandsPerFrame = drawsPerFrame * commandsPerDraw;
+
+    struct Sample
+    {
+        std::string mode;
+        double      ns;
+    };
+
+    struct Inputs
+    {
+        // handles are never dereferenced by the stub
+        vk::Pipeline          pipeline{ (VkPipeline)uintptr_t{ 0x10 } };
+        vk::PipelineLayout    layout{ (VkPipelineLayout)uintptr_t{ 0x20 } };
+        vk::DescriptorSet     set{ (VkDescriptorSet)uintptr_t{ 0x30 } };
+        vk::Buffer            buffer{ (VkBuffer)uintptr_t{ 0x40 } };
+        vk::DeviceSize        offset = 0;
+        vk::Viewport          viewport{ 0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f };
+        vk::Rect2D            scissor{ { 0, 0 }, { 1920, 1080 } };
+        std::array<float, 16> constants{};
+    };
+
+    // global wrappers with CommandStream method names, so both go through the same record()
+    struct Direct
+    {
+        vk::CommandBuffer cmd;
+
+        void bindPipeline(vk::PipelineBindPoint bindPoint, vk::Pipeline pipeline) const {
+            vk::cmdBindPipeline(cmd, bindPoint, pipeline);
+        }
+
+        void bindDescriptorSets(vk::PipelineBindPoint                          bindPoint,
+                                vk::PipelineLayout                             layout,
+                                uint32_t                                       firstSet,
+                                vk::ArrayProxy<const vk::DescriptorSet> const &sets,
+                                vk::ArrayProxy<const uint32_t> const          &dynamicOffsets) const {
+            vk::cmdBindDescriptorSets(cmd, bindPoint, layout, firstSet, sets, dynamicOffsets);
+        }
+
+        void bindVertexBuffers(uint32_t firstBinding, vk::ArrayProxy<const vk::Buffer> const &buffers, vk::ArrayProxy<const vk::DeviceSize> const &offsets) const {
+            vk::cmdBindVertexBuffers(cmd, firstBinding, buffers, offsets);
+        }
+
+        void bindIndexBuffer(vk::Buffer buffer, vk::DeviceSize offset, vk::IndexType indexType) const {
+            vk::cmdBindIndexBuffer(cmd, buffer, offset, indexType);
+        }
+
+        template <typename T>
+        void pushConstants(vk::PipelineLayout layout, vk::ShaderStageFlags stages, uint32_t offset, vk::ArrayProxy<const T> const &values) const {
+            vk::cmdPushConstants<const T>(cmd, layout, stages, offset, values);
+        }
+
+        void setViewport(uint32_t first, vk::ArrayProxy<const vk::Viewport> const &viewports) const {
+            vk::cmdSetViewport(cmd, first, viewports);
+        }
+
+        void setScissor(uint32_t first, vk::ArrayProxy<const vk::Rect2D> const &scissors) const {
+            vk::cmdSetScissor(cmd, first, scissors);
+        }
+
+        void drawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) const {
+            vk::cmdDrawIndexed(cmd, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+        }
+    };
+
+    // same calls for Direct and CommandStream
+    template <typename Recorder>
+    void record(Recorder &r, const Inputs &in, size_t draws) {
+        for (size_t d = 0; d < draws; ++d) {
+            r.bindPipeline(vk::PipelineBindPoint::eGraphics, in.pipeline);
+            r.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, in.layout, 0, in.set, {});
+            r.bindVertexBuffers(0, in.buffer, in.offset);
+            r.bindIndexBuffer(in.buffer, 0, vk::IndexType::eUint32);
+            r.template pushConstants<float>(in.layout, vk::ShaderStageFlagBits::eVertex, 0, in.constants);
+            r.setViewport(0, in.viewport);
+            r.setScissor(0, in.scissor);
+            r.drawIndexed(36, 1, 0, 0, 0);
+        }
+    }
+
+    template <typename F>
+    double measure(size_t commands, F &&f) {
+        double total = 0.0;
+        for (size_t i = 0; i < frames; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            auto end = std::chrono::steady_clock::now();
+            total += std::chrono::duration<double, std::nano>(end - start).count();
+        }
+        return total / (frames * commands);
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::string csvPath  = argc > 1 ? argv[1] : "";
+    const std::string revision = argc > 2 ? argv[2] : "local";
+
+    try {
+        if (!bench::initStubDevice()) {
+            std::cerr << "Failed to load the stub driver\n";
+            return 1;
+        }
+        const vk::CommandBuffer cmd = bench::allocateCommandBuffer();
+        Direct                  direct{ cmd };
+
+        const Inputs        in;
+        std::vector<Sample> samples;
+
+        samples.push_back({ "direct", measure(commandsPerFrame, [&] { record(direct, in, drawsPerFrame); }) });
+
+        vk::CommandStream stream;
+        samples.push_back({ "encode", measure(commandsPerFrame, [&] {
+                                stream.clear();
+                                record(stream, in, drawsPerFrame);
+                            }) });
+
+        samples.push_back({ "replay", measure(commandsPerFrame, [&] { stream.replay(cmd); }) });
+
+        // frame split between workers with one stream each, includes thread start up
+        const size_t threads = std::max(2u, std::thread::hardware_concurrency());
+        std::vector<vk::CommandStream> streams(threads);
+        const size_t drawsPerThread = drawsPerFrame / threads;
+        const double encodeMt       = measure(drawsPerThread * threads * commandsPerDraw, [&] {
+            std::vector<std::thread> workers;
+            for (auto &s : streams) {
+                workers.emplace_back([&] {
+                    s.clear();
+                    record(s, in, drawsPerThread);
+                });
+            }
+            for (auto &w : workers) {
+                w.join();
+            }
+        });
+        samples.push_back({ "encode_x" + std::to_string(threads), encodeMt });
+
+        for (const auto &s : samples) {
+            std::printf("%-12s %8.3f ns/command\n", s.mode.c_str(), s.ns);
+        }
+        std::printf("stream: %u commands, %zu bytes\n", stream.commandCount(), stream.size());
+
+        if (!csvPath.empty()) {
+            std::ofstream csv{ csvPath, std::ios::app };
+            for (const auto &s : samples) {
+                csv << revision << ',' << s.mode << ',' << s.ns << '\n';
+            }
+        }
+    }
+    catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+// Checks the enum_string_tables option, exits with 1 when a case fails:
+// every enumerator of Result, StructureType and Format must have a name that to_string, to_string_view
+// and from_string agree on, aliases resolve to the name of the value they alias.
+// usage: bench_enum_string_check
+#include <vulkan/vulkan_impl.cpp>
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    struct Counts
+    {
+        int enumerators = 0;
+        int aliases     = 0;
+        int failures    = 0;
+    };
+
+    template <typename T>
+    Counts countsOf;
+
+    template <typename T>
+    void check(Counts &counts, T value, std::string_view enumerator) {
+        counts.enumerators++;
+        const std::string_view view    = vk::to_string_view(value);
+        const std::string      str     = vk::to_string(value);
+        const auto             parsed  = vk::from_string<T>(view);
+        const auto             ownName = vk::from_string<T>(enumerator.substr(1));
+
+        bool ok = !view.empty() && str == view && parsed == value;
+        if (view == enumerator.substr(1)) {
+            ok = ok && ownName == value;
+        } else {
+            // alias of another enumerator, its own name is not in the tables
+            counts.aliases++;
+            ok = ok && !ownName;
+        }
+        if (!ok) {
+            counts.failures++;
+            std::printf("  %.*s: to_string_view \"%.*s\", to_string \"%s\"\n",
+                        static_cast<int>(enumerator.size()),
+                        enumerator.data(),
+                        static_cast<int>(view.size()),
+                        view.data(),
+                        str.c_str());
+        }
+    }
+
+    bool expect(const char *name, const Counts &counts) {
+        const bool ok = counts.failures == 0 && counts.enumerators != 0;
+        std::printf("%-16s %-4s (%d enumerators, %d aliases, %d failures)\n", name, ok ? "ok" : "FAIL", counts.enumerators, counts.aliases, counts.failures);
+        return ok;
+    }
+
+}  // namespace
+
+int main() {
+#define VKGEN_ENUM(Type, enumerator) check(countsOf<vk::Type>, vk::Type::enumerator, #enumerator);
+#include "enum_list.inc"
+#undef VKGEN_ENUM
+
+    bool ok = true;
+    ok &= expect("Result", countsOf<vk::Result>);
+    ok &= expect("StructureType", countsOf<vk::StructureType>);
+    ok &= expect("Format", countsOf<vk::Format>);
+    ok &= expect("unknown value", Counts{ 1, 0, vk::to_string_view(static_cast<vk::Result>(0x7ffffff0)).empty() ? 0 : 1 });
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+// Checks the expected_result option against a stub driver, exits with 1 when a case fails:
+// global wrappers must hand errors of the driver to the caller in their Result or ResultValue, none may throw.
+// usage: bench_expected_result_check
+#include "stub_device.hpp"
+
+#include <cstdint>
+#include <cstdio>
+
+namespace
+{
+    VkResult stubResult = VK_SUCCESS;
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubCreateFence(VkDevice, const VkFenceCreateInfo *, const VkAllocationCallbacks *, VkFence *pFence) {
+        *pFence = reinterpret_cast<VkFence>(uintptr_t{ 0x1000 });
+        return stubResult;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubAllocateCommandBuffers(VkDevice, const VkCommandBufferAllocateInfo *, VkCommandBuffer *) {
+        return stubResult;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubQueueWaitIdle(VkQueue) {
+        return stubResult;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubWaitForFences(VkDevice, uint32_t, const VkFence *, VkBool32, uint64_t) {
+        return stubResult;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubEnumerateInstanceVersion(uint32_t *pApiVersion) {
+        *pApiVersion = VK_API_VERSION_1_3;
+        return stubResult;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubCreateDevice(VkPhysicalDevice, const VkDeviceCreateInfo *, const VkAllocationCallbacks *, VkDevice *) {
+        return stubResult;
+    }
+
+    // true when check accepts what f returns with the stub returning result, false when f throws
+    template <typename F, typename C>
+    bool returns(VkResult result, F &&f, C &&check) {
+        stubResult = result;
+        try {
+            return check(f());
+        } catch (...) {
+            return false;
+        }
+    }
+
+    bool expect(const char *name, bool ok) {
+        std::printf("%-40s %s\n", name, ok ? "ok" : "FAIL");
+        return ok;
+    }
+
+}  // namespace
+
+int main() {
+    if (!bench::initStubDevice()) {
+        std::printf("stub driver failed to load\n");
+        return 1;
+    }
+
+    auto *dispatcher                     = const_cast<vk::DeviceDispatcher *>(vk::device.getDispatcher());
+    dispatcher->vkCreateFence            = &stubCreateFence;
+    dispatcher->vkAllocateCommandBuffers = &stubAllocateCommandBuffers;
+    dispatcher->vkQueueWaitIdle          = &stubQueueWaitIdle;
+    dispatcher->vkWaitForFences          = &stubWaitForFences;
+
+    const auto createFence           = [] { return vk::createFence(vk::FenceCreateInfo{}); };
+    const auto allocateCommandBuffer = [] {
+        vk::CommandBufferAllocateInfo info{};
+        info.commandBufferCount = 1;
+        return vk::allocateCommandBuffer(info);
+    };
+    const auto queueWaitIdle = [] { return vk::queueWaitIdle(vk::Queue{}); };
+    const auto waitForFences = [] { return vk::waitForFences(vk::Fence{}, VK_TRUE, UINT64_MAX); };
+
+    const auto holds = [](VkResult error) {
+        return [error](auto const &value) { return value.has_value() == (error == VK_SUCCESS) && value.error() == error; };
+    };
+    const auto is = [](vk::Result expected) { return [expected](vk::Result result) { return result == expected; }; };
+
+    bool ok = true;
+    ok &= expect("createFence success", returns(VK_SUCCESS, createFence, [](auto const &fence) {
+                     return fence.has_value() && static_cast<VkFence>(*fence) == reinterpret_cast<VkFence>(uintptr_t{ 0x1000 });
+                 }));
+    ok &= expect("createFence out of device memory", returns(VK_ERROR_OUT_OF_DEVICE_MEMORY, createFence, holds(VK_ERROR_OUT_OF_DEVICE_MEMORY)));
+    ok &= expect("allocateCommandBuffer out of memory", returns(VK_ERROR_OUT_OF_HOST_MEMORY, allocateCommandBuffer, holds(VK_ERROR_OUT_OF_HOST_MEMORY)));
+    ok &= expect("queueWaitIdle success", returns(VK_SUCCESS, queueWaitIdle, is(vk::Result::eSuccess)));
+    ok &= expect("queueWaitIdle device lost", returns(VK_ERROR_DEVICE_LOST, queueWaitIdle, is(vk::Result::eErrorDeviceLost)));
+    ok &= expect("waitForFences timeout", returns(VK_TIMEOUT, waitForFences, is(vk::Result::eTimeout)));
+    ok &= expect("waitForFences device lost", returns(VK_ERROR_DEVICE_LOST, waitForFences, is(vk::Result::eErrorDeviceLost)));
+    const_cast<vk::ContextDispatcher *>(vk::context.getDispatcher())->vkEnumerateInstanceVersion = &stubEnumerateInstanceVersion;
+    ok &= expect("enumerateInstanceVersion success", returns(VK_SUCCESS, vk::enumerateInstanceVersion, [](auto const &version) {
+                     return version.has_value() && *version == VK_API_VERSION_1_3;
+                 }));
+    ok &= expect("enumerateInstanceVersion out of memory", returns(VK_ERROR_OUT_OF_HOST_MEMORY, vk::enumerateInstanceVersion, holds(VK_ERROR_OUT_OF_HOST_MEMORY)));
+
+    // last, initDevice reinitializes vk::device
+    const_cast<vk::InstanceDispatcher *>(vk::instance.getDispatcher())->vkCreateDevice = &stubCreateDevice;
+    ok &= expect("initDevice initialization failed", returns(VK_ERROR_INITIALIZATION_FAILED, [] {
+                     return vk::initDevice(vk::PhysicalDevice{}, vk::DeviceCreateInfo{});
+                 }, is(vk::Result::eErrorInitializationFailed)));
+    return ok ? 0 : 1;
+}
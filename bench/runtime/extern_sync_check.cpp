@@ -0,0 +1,126 @@
+// Checks the extern_sync_check option against a stub driver, exits with 1 when a case fails:
+// a second thread submitting to a queue while another thread is inside vkQueueSubmit2, or recording into
+// a command buffer while another thread is inside vkCmdDraw on it, must be reported,
+// the same on a different queue and recording into separate command buffers must not.
+// usage: bench_extern_sync_check
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+    std::atomic<int> reports{ 0 };
+}  // namespace
+
+#define VULKAN_HPP_EXTERN_SYNC_CHECK
+#define VULKAN_HPP_EXTERN_SYNC_REPORT(command) ((void)(command), reports.fetch_add(1))
+#include "stub_device.hpp"
+
+namespace
+{
+    // first caller waits inside the driver until a second call reached it
+    std::atomic<bool> entered{ false };
+    std::atomic<bool> inside{ false };
+    std::atomic<bool> released{ false };
+
+    void blockFirstCall() {
+        if (!entered.exchange(true)) {
+            inside = true;
+            const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (!released && std::chrono::steady_clock::now() < timeout) {
+                std::this_thread::yield();
+            }
+        } else {
+            released = true;
+        }
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL blockingSubmit2(VkQueue, uint32_t, const VkSubmitInfo2 *, VkFence) {
+        blockFirstCall();
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL blockingDraw(VkCommandBuffer, uint32_t, uint32_t, uint32_t, uint32_t) {
+        blockFirstCall();
+    }
+
+    // second call starts once the first one is inside the driver
+    template <typename F>
+    int overlappingCalls(F &&first, F &&second) {
+        entered  = false;
+        inside   = false;
+        released = false;
+        reports  = 0;
+
+        std::thread owner{ first };
+        while (!inside) {
+            std::this_thread::yield();
+        }
+        second();
+        owner.join();
+        return reports;
+    }
+
+    int overlappingSubmits(vk::Queue first, vk::Queue second) {
+        const auto submit = [](vk::Queue queue) { return [queue] { vk::queueSubmit2(queue, nullptr, {}); }; };
+        return overlappingCalls(submit(first), submit(second));
+    }
+
+    int overlappingDraws(vk::CommandBuffer first, vk::CommandBuffer second) {
+        const auto draw = [](vk::CommandBuffer cmd) { return [cmd] { vk::cmdDraw(cmd, 3, 1, 0, 0); }; };
+        return overlappingCalls(draw(first), draw(second));
+    }
+
+    int separateCommandBuffers() {
+        reports = 0;
+
+        const auto record = [](vk::CommandBuffer cmd) {
+            for (int i = 0; i < 100'000; ++i) {
+                vk::cmdDraw(cmd, 3, 1, 0, 0);
+            }
+        };
+        std::thread other{ record, bench::allocateCommandBuffer() };
+        record(bench::allocateCommandBuffer());
+        other.join();
+        return reports;
+    }
+
+    bool expect(const char *name, int reported, bool expected) {
+        const bool ok = (reported != 0) == expected;
+        std::printf("%-26s %-4s (%d reports, expected %s)\n", name, ok ? "ok" : "FAIL", reported, expected ? "some" : "none");
+        return ok;
+    }
+
+}  // namespace
+
+int main() {
+    try {
+        if (!bench::initStubDevice()) {
+            std::cerr << "Failed to load the stub driver\n";
+            return 1;
+        }
+        auto *dispatcher           = const_cast<vk::DeviceDispatcher *>(vk::device.getDispatcher());
+        dispatcher->vkQueueSubmit2 = &blockingSubmit2;
+
+        // the stub returns a new handle for every vkGetDeviceQueue
+        const vk::Queue queue = vk::getDeviceQueue(0, 0);
+        const vk::Queue other = vk::getDeviceQueue(0, 0);
+
+        bool ok = true;
+        ok &= expect("same queue", overlappingSubmits(queue, queue), true);
+        ok &= expect("different queues", overlappingSubmits(queue, other), false);
+        ok &= expect("separate command buffers", separateCommandBuffers(), false);
+
+        const vk::CommandBuffer cmd = bench::allocateCommandBuffer();
+        dispatcher->vkCmdDraw       = &blockingDraw;
+        ok &= expect("same command buffer", overlappingDraws(cmd, cmd), true);
+        ok &= expect("other command buffer", overlappingDraws(cmd, bench::allocateCommandBuffer()), false);
+        return ok ? 0 : 1;
+    }
+    catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,54 @@
+// Checks the struct_format option, exits with 1 when a case fails:
+// formatTo has to write members in declaration order, char arrays as strings, other arrays as lists
+// and structs in the pNext chain through their own formatTo.
+// usage: bench_format_check
+#include <vulkan/vulkan_format.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    template <typename T>
+    std::string formatted(T const &value) {
+        std::string str;
+        vk::formatTo(std::back_inserter(str), value);
+        return str;
+    }
+
+    bool expect(const char *name, std::string const &str, std::string_view part) {
+        const bool ok = str.find(part) != std::string::npos;
+        std::printf("%-34s %s\n", name, ok ? "ok" : "FAIL");
+        if (!ok) {
+            std::printf("  %s\n", str.c_str());
+        }
+        return ok;
+    }
+
+}  // namespace
+
+int main() {
+    vk::ExtensionProperties extension{};
+    std::strcpy(extension.extensionName, "VK_KHR_swapchain");
+    extension.specVersion = 70;
+
+    vk::PhysicalDeviceVulkan11Properties v11{};
+    for (uint8_t i = 0; i < VK_UUID_SIZE; ++i) {
+        v11.deviceUUID[i] = i;
+    }
+    vk::PhysicalDeviceProperties2 properties{};
+    std::strcpy(properties.properties.deviceName, "stub");
+    properties.pNext = &v11;
+
+    const std::string chain = formatted(properties);
+
+    bool ok = true;
+    ok &= expect("Extent2D", formatted(vk::Extent2D{ 640, 480 }), "{ width: 640, height: 480 }");
+    ok &= expect("char array", formatted(extension), R"({ extensionName: "VK_KHR_swapchain", specVersion: 70 })");
+    ok &= expect("nested char array", chain, R"(deviceName: "stub")");
+    ok &= expect("array in pNext chain", chain, "deviceUUID: [ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ]");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+// Generated std::hash of structs compared with hashing the raw bytes.
+// Each struct is built in several copies with equal content in separate storage,
+// "unique" column shows how many distinct hashes the copies produce (1 means dedup works).
+// usage: bench_hash [csv file] [revision]
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_hash.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    constexpr size_t iterations = 200'000;
+    constexpr size_t copies     = 8;
+
+    struct Sample
+    {
+        const char *type;
+        const char *method;
+        double      ns;
+        size_t      unique;
+    };
+
+    size_t sink = 0;
+
+    template <typename F>
+    double measure(F &&f) {
+        for (size_t i = 0; i < iterations / 10; ++i) {
+            f();
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            f();
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+
+    template <typename T>
+    size_t rawHash(T const &value) {
+        return std::hash<std::string_view>{}(std::string_view(reinterpret_cast<char const *>(&value), sizeof(T)));
+    }
+
+    template <typename T>
+    void run(std::vector<Sample> &samples, const char *type, std::vector<T> const &values) {
+        std::set<size_t> deep, raw;
+        for (const auto &v : values) {
+            deep.insert(std::hash<T>{}(v));
+            raw.insert(rawHash(v));
+        }
+        samples.push_back({ type, "std::hash", measure([&] { sink += std::hash<T>{}(values[0]); }), deep.size() });
+        samples.push_back({ type, "raw bytes", measure([&] { sink += rawHash(values[0]); }), raw.size() });
+    }
+
+    // storage referenced by the create infos, one per copy
+    struct PipelineStorage
+    {
+        std::array<vk::PipelineShaderStageCreateInfo, 2> stages{};
+        std::string                                       entry{ "main" };
+        vk::VertexInputBindingDescription                 binding{ 0, 16 };
+        vk::VertexInputAttributeDescription               attribute{ 0, 0, vk::Format::eR32G32B32A32Sfloat };
+        vk::PipelineVertexInputStateCreateInfo            vertexInput{};
+        vk::PipelineInputAssemblyStateCreateInfo          inputAssembly{};
+        vk::PipelineRasterizationStateCreateInfo          rasterization{};
+        vk::PipelineColorBlendAttachmentState             blendAttachment{};
+        vk::PipelineColorBlendStateCreateInfo             blend{};
+        std::array<vk::DescriptorSetLayoutBinding, 4>     bindings{};
+    };
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::string csvPath  = argc > 1 ? argv[1] : "";
+    const std::string revision = argc > 2 ? argv[2] : "local";
+
+    std::vector<PipelineStorage>                   storage(copies);
+    std::vector<vk::SamplerCreateInfo>             samplers(copies);
+    std::vector<vk::DescriptorSetLayoutCreateInfo> layouts(copies);
+    std::vector<vk::GraphicsPipelineCreateInfo>    pipelines(copies);
+
+    for (size_t i = 0; i < copies; ++i) {
+        auto &s = storage[i];
+
+        samplers[i].magFilter     = vk::Filter::eLinear;
+        samplers[i].minFilter     = vk::Filter::eLinear;
+        samplers[i].maxAnisotropy = 16.f;
+
+        for (uint32_t b = 0; b < s.bindings.size(); ++b) {
+            s.bindings[b].binding         = b;
+            s.bindings[b].descriptorType  = vk::DescriptorType::eCombinedImageSampler;
+            s.bindings[b].descriptorCount = 1;
+            s.bindings[b].stageFlags      = vk::ShaderStageFlagBits::eFragment;
+        }
+        layouts[i].bindingCount = static_cast<uint32_t>(s.bindings.size());
+        layouts[i].pBindings    = s.bindings.data();
+
+        s.stages[0].stage                             = vk::ShaderStageFlagBits::eVertex;
+        s.stages[0].pName                             = s.entry.c_str();
+        s.stages[1].stage                             = vk::ShaderStageFlagBits::eFragment;
+        s.stages[1].pName                             = s.entry.c_str();
+        s.vertexInput.vertexBindingDescriptionCount   = 1;
+        s.vertexInput.pVertexBindingDescriptions      = &s.binding;
+        s.vertexInput.vertexAttributeDescriptionCount = 1;
+        s.vertexInput.pVertexAttributeDescriptions    = &s.attribute;
+        s.inputAssembly.topology                      = vk::PrimitiveTopology::eTriangleList;
+        s.rasterization.lineWidth                     = 1.f;
+        s.blend.attachmentCount                       = 1;
+        s.blend.pAttachments                          = &s.blendAttachment;
+
+        pipelines[i].stageCount          = static_cast<uint32_t>(s.stages.size());
+        pipelines[i].pStages             = s.stages.data();
+        pipelines[i].pVertexInputState   = &s.vertexInput;
+        pipelines[i].pInputAssemblyState = &s.inputAssembly;
+        pipelines[i].pRasterizationState = &s.rasterization;
+        pipelines[i].pColorBlendState    = &s.blend;
+    }
+
+    std::vector<Sample> samples;
+    run(samples, "SamplerCreateInfo", samplers);
+    run(samples, "DescriptorSetLayoutCreateInfo", layouts);
+    run(samples, "GraphicsPipelineCreateInfo", pipelines);
+
+    for (const auto &s : samples) {
+        std::printf("%-30s %-10s %10.1f ns  unique %zu/%zu\n", s.type, s.method, s.ns, s.unique, copies);
+    }
+
+    if (!csvPath.empty()) {
+        std::ofstream csv{ csvPath, std::ios::app };
+        for (const auto &s : samples) {
+            csv << revision << ',' << s.type << ',' << s.method << ',' << s.ns << ',' << s.unique << '\n';
+        }
+    }
+    return sink == 0;
+}
@@ -0,0 +1,93 @@
+// Checks the host_allocators option against a stub driver, exits with 1 when a case fails:
+// global wrappers have to pass Context::setDefaultAllocator when called without allocator,
+// CountingAllocator has to count what the driver allocates through it, ArenaAllocator and PoolAllocator
+// have to reuse their memory and hand out aligned blocks.
+// usage: bench_host_allocators_check
+#include "stub_device.hpp"
+
+#include <cstdint>
+#include <cstdio>
+
+namespace
+{
+    VkAllocationCallbacks const *passedAllocator = nullptr;
+
+    // object scope allocation through the callbacks, like a driver creating its fence object
+    VKAPI_ATTR VkResult VKAPI_CALL stubCreateFence(VkDevice, const VkFenceCreateInfo *, const VkAllocationCallbacks *pAllocator, VkFence *pFence) {
+        passedAllocator = pAllocator;
+        void *object    = pAllocator ? pAllocator->pfnAllocation(pAllocator->pUserData, 48, 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT) : nullptr;
+        *pFence         = reinterpret_cast<VkFence>(object);
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL stubDestroyFence(VkDevice, VkFence fence, const VkAllocationCallbacks *pAllocator) {
+        passedAllocator = pAllocator;
+        if (pAllocator) {
+            pAllocator->pfnFree(pAllocator->pUserData, reinterpret_cast<void *>(fence));
+        }
+    }
+
+    template <typename T>
+    VkAllocationCallbacks const &callbacksOf(T const &allocator) {
+        return *reinterpret_cast<VkAllocationCallbacks const *>(&allocator.callbacks());
+    }
+
+    void *allocate(VkAllocationCallbacks const &callbacks, size_t size, size_t alignment, VkSystemAllocationScope scope) {
+        return callbacks.pfnAllocation(callbacks.pUserData, size, alignment, scope);
+    }
+
+    bool aligned(void *memory, size_t alignment) {
+        return memory && reinterpret_cast<uintptr_t>(memory) % alignment == 0;
+    }
+
+    bool expect(const char *name, bool ok) {
+        std::printf("%-34s %s\n", name, ok ? "ok" : "FAIL");
+        return ok;
+    }
+
+}  // namespace
+
+int main() {
+    if (!bench::initStubDevice()) {
+        std::printf("stub driver failed to load\n");
+        return 1;
+    }
+
+    auto *dispatcher           = const_cast<vk::DeviceDispatcher *>(vk::device.getDispatcher());
+    dispatcher->vkCreateFence  = &stubCreateFence;
+    dispatcher->vkDestroyFence = &stubDestroyFence;
+
+    bool ok = true;
+    vk::destroyFence(bench::valueOf(vk::createFence(vk::FenceCreateInfo{})));
+    ok &= expect("no default allocator", passedAllocator == nullptr);
+
+    vk::CountingAllocator counting;
+    vk::Context::setDefaultAllocator(counting);
+    const vk::Fence fence = bench::valueOf(vk::createFence(vk::FenceCreateInfo{}));
+    ok &= expect("create uses default allocator", passedAllocator == &callbacksOf(counting));
+    ok &= expect("object allocation counted", counting.counters(vk::SystemAllocationScope::eObject).bytes == 48);
+    vk::destroyFence(fence);
+    ok &= expect("destroy uses default allocator", passedAllocator == &callbacksOf(counting));
+    const auto object = counting.counters(vk::SystemAllocationScope::eObject);
+    ok &= expect("object free counted", object.allocations == 1 && object.frees == 1 && object.bytes == 0 && object.peakBytes == 48);
+
+    vk::CountingAllocator explicitAllocator;
+    vk::destroyFence(bench::valueOf(vk::createFence(vk::FenceCreateInfo{}, explicitAllocator.callbacks())), explicitAllocator.callbacks());
+    ok &= expect("explicit allocator wins", passedAllocator == &callbacksOf(explicitAllocator) && counting.total().allocations == 1);
+    vk::Context::setDefaultAllocator(nullptr);
+
+    vk::ArenaAllocator arena;
+    void *first = allocate(callbacksOf(arena), 100, 64, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    callbacksOf(arena).pfnFree(callbacksOf(arena).pUserData, first);
+    void *again = allocate(callbacksOf(arena), 100, 64, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    ok &= expect("arena aligned and rewound", aligned(first, 64) && again == first);
+    callbacksOf(arena).pfnFree(callbacksOf(arena).pUserData, again);
+
+    vk::PoolAllocator pool;
+    void *block = allocate(callbacksOf(pool), 40, 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    callbacksOf(pool).pfnFree(callbacksOf(pool).pUserData, block);
+    void *reused = allocate(callbacksOf(pool), 48, 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    ok &= expect("pool reuses size class", aligned(block, 8) && reused == block);
+    callbacksOf(pool).pfnFree(callbacksOf(pool).pUserData, reused);
+    return ok ? 0 : 1;
+}
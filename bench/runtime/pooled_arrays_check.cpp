@@ -0,0 +1,109 @@
+// Checks the pooled_arrays option against a stub driver, exits with 1 when a case fails:
+// vk::PooledCommandBuffers and vk::PooledDescriptorSets have to free their whole allocation with one call,
+// once after a move, never after release(), resetPool() or a failed allocation.
+// usage: bench_pooled_arrays_check
+#include "stub_device.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+
+namespace
+{
+    VkResult stubResult = VK_SUCCESS;
+    uint32_t freeCalls  = 0;
+    uint32_t freedCount = 0;
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubAllocateCommandBuffers(VkDevice, const VkCommandBufferAllocateInfo *pInfo, VkCommandBuffer *pCommandBuffers) {
+        for (uint32_t i = 0; i < pInfo->commandBufferCount; ++i) {
+            pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>(uintptr_t{ 0x100 } + i);
+        }
+        return stubResult;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL stubFreeCommandBuffers(VkDevice, VkCommandPool, uint32_t count, const VkCommandBuffer *) {
+        ++freeCalls;
+        freedCount += count;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubAllocateDescriptorSets(VkDevice, const VkDescriptorSetAllocateInfo *pInfo, VkDescriptorSet *pDescriptorSets) {
+        for (uint32_t i = 0; i < pInfo->descriptorSetCount; ++i) {
+            pDescriptorSets[i] = reinterpret_cast<VkDescriptorSet>(uintptr_t{ 0x200 } + i);
+        }
+        return stubResult;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubFreeDescriptorSets(VkDevice, VkDescriptorPool, uint32_t count, const VkDescriptorSet *) {
+        ++freeCalls;
+        freedCount += count;
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubResetDescriptorPool(VkDevice, VkDescriptorPool, VkDescriptorPoolResetFlags) {
+        return VK_SUCCESS;
+    }
+
+    // true when the scope frees calls times count handles in total
+    template <typename F>
+    bool frees(uint32_t calls, uint32_t count, F &&scope) {
+        freeCalls  = 0;
+        freedCount = 0;
+        try {
+            scope();
+        } catch (...) {
+        }
+        return freeCalls == calls && freedCount == count;
+    }
+
+    bool expect(const char *name, bool ok) {
+        std::printf("%-34s %s\n", name, ok ? "ok" : "FAIL");
+        return ok;
+    }
+
+}  // namespace
+
+int main() {
+    if (!bench::initStubDevice()) {
+        std::printf("stub driver failed to load\n");
+        return 1;
+    }
+
+    auto *dispatcher                     = const_cast<vk::DeviceDispatcher *>(vk::device.getDispatcher());
+    dispatcher->vkAllocateCommandBuffers = &stubAllocateCommandBuffers;
+    dispatcher->vkFreeCommandBuffers     = &stubFreeCommandBuffers;
+    dispatcher->vkAllocateDescriptorSets = &stubAllocateDescriptorSets;
+    dispatcher->vkFreeDescriptorSets     = &stubFreeDescriptorSets;
+    dispatcher->vkResetDescriptorPool    = &stubResetDescriptorPool;
+
+    vk::CommandBufferAllocateInfo commandInfo{};
+    commandInfo.commandPool        = vk::CommandPool{ reinterpret_cast<VkCommandPool>(uintptr_t{ 0x10 }) };
+    commandInfo.commandBufferCount = 3;
+
+    vk::DescriptorSetAllocateInfo descriptorInfo{};
+    descriptorInfo.descriptorPool     = vk::DescriptorPool{ reinterpret_cast<VkDescriptorPool>(uintptr_t{ 0x20 }) };
+    descriptorInfo.descriptorSetCount = 4;
+
+    bool ok = true;
+    ok &= expect("command buffers freed at once", frees(1, 3, [&] {
+                     vk::PooledCommandBuffers buffers(commandInfo);
+                     ok &= buffers.size() == 3 && static_cast<VkCommandBuffer>(buffers[2]) == reinterpret_cast<VkCommandBuffer>(uintptr_t{ 0x102 });
+                 }));
+    ok &= expect("command buffers moved", frees(1, 3, [&] {
+                     vk::PooledCommandBuffers buffers(commandInfo);
+                     vk::PooledCommandBuffers moved(std::move(buffers));
+                     ok &= buffers.empty() && moved.getCommandPool() == commandInfo.commandPool;
+                 }));
+    ok &= expect("command buffers released", frees(0, 0, [&] {
+                     vk::PooledCommandBuffers buffers(commandInfo);
+                     ok &= buffers.release().size() == 3;
+                 }));
+    ok &= expect("descriptor sets freed at once", frees(1, 4, [&] { vk::PooledDescriptorSets sets(descriptorInfo); }));
+    ok &= expect("descriptor pool reset", frees(0, 0, [&] {
+                     vk::PooledDescriptorSets sets(descriptorInfo);
+                     sets.resetPool();
+                     ok &= sets.empty();
+                 }));
+    stubResult = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    ok &= expect("failed allocation", frees(0, 0, [&] { vk::PooledDescriptorSets sets(descriptorInfo); }));
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+// Command recording throughput of the global vk::cmd* wrappers against a stub driver.
+// Built once per config (VKGEN_BENCH_VARIANT), so the dispatcher layout is the only difference.
+// "cold" frames evict caches before recording, as application work between frames would.
+// usage: bench_recording_<variant> [csv file] [revision]
+#include "stub_device.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef VKGEN_BENCH_VARIANT
+#    define VKGEN_BENCH_VARIANT "local"
+#endif
+
+namespace
+{
+    constexpr size_t frames          = 2'000;
+    constexpr size_t commandBuffers  = 8;
+    constexpr size_t drawsPerBuffer  = 64;
+    constexpr size_t commandsPerDraw = 8;
+    constexpr size_t evictBytes      = 32 * 1024 * 1024;
+
+    struct Sample
+    {
+        const char *mode;
+        double      ns;
+    };
+
+    std::vector<unsigned char> evictBuffer(evictBytes);
+    unsigned                   sink = 0;
+
+    void evict() {
+        for (size_t i = 0; i < evictBuffer.size(); i += 64) {
+            evictBuffer[i] += 1;
+            sink += evictBuffer[i];
+        }
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::string csvPath  = argc > 1 ? argv[1] : "";
+    const std::string revision = argc > 2 ? argv[2] : "local";
+
+    try {
+        if (!bench::initStubDevice()) {
+            std::cerr << "Failed to load the stub driver\n";
+            return 1;
+        }
+
+        std::array<vk::CommandBuffer, commandBuffers> cmds;
+        for (auto &cmd : cmds) {
+            cmd = bench::allocateCommandBuffer();
+        }
+
+        // handles are never dereferenced by the stub
+        const auto pipeline = vk::Pipeline{ (VkPipeline)uintptr_t{ 0x10 } };
+        const auto layout   = vk::PipelineLayout{ (VkPipelineLayout)uintptr_t{ 0x20 } };
+        const auto set      = vk::DescriptorSet{ (VkDescriptorSet)uintptr_t{ 0x30 } };
+        const auto buffer   = vk::Buffer{ (VkBuffer)uintptr_t{ 0x40 } };
+
+        const vk::DeviceSize  offset = 0;
+        const vk::Viewport    viewport{ 0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f };
+        const vk::Rect2D      scissor{ { 0, 0 }, { 1920, 1080 } };
+        std::array<float, 16> constants{};
+
+        const auto record = [&] {
+            for (const auto &cmd : cmds) {
+                for (size_t d = 0; d < drawsPerBuffer; ++d) {
+                    vk::cmdBindPipeline(cmd, vk::PipelineBindPoint::eGraphics, pipeline);
+                    vk::cmdBindDescriptorSets(cmd, vk::PipelineBindPoint::eGraphics, layout, 0, set, {});
+                    vk::cmdBindVertexBuffers(cmd, 0, buffer, offset);
+                    vk::cmdBindIndexBuffer(cmd, buffer, 0, vk::IndexType::eUint32);
+                    vk::cmdPushConstants<const float>(cmd, layout, vk::ShaderStageFlagBits::eVertex, 0, constants);
+                    vk::cmdSetViewport(cmd, 0, viewport);
+                    vk::cmdSetScissor(cmd, 0, scissor);
+                    vk::cmdDrawIndexed(cmd, 36, 1, 0, 0, 0);
+                }
+            }
+        };
+
+        constexpr size_t commandsPerFrame = commandBuffers * drawsPerBuffer * commandsPerDraw;
+
+        std::vector<Sample> samples;
+        for (const bool cold : { false, true }) {
+            double total = 0.0;
+            for (size_t f = 0; f < frames; ++f) {
+                if (cold) {
+                    evict();
+                }
+                auto start = std::chrono::steady_clock::now();
+                record();
+                auto end = std::chrono::steady_clock::now();
+                total += std::chrono::duration<double, std::nano>(end - start).count();
+            }
+            samples.push_back({ cold ? "cold" : "warm", total / (frames * commandsPerFrame) });
+        }
+
+        for (const auto &s : samples) {
+            std::printf("%-18s %-6s %8.3f ns/command\n", VKGEN_BENCH_VARIANT, s.mode, s.ns);
+        }
+
+        if (!csvPath.empty()) {
+            std::ofstream csv{ csvPath, std::ios::app };
+            for (const auto &s : samples) {
+                csv << revision << ',' << VKGEN_BENCH_VARIANT << ',' << s.mode << ',' << s.ns << '\n';
+            }
+        }
+    }
+    catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return sink == 0xffffffff;
+}
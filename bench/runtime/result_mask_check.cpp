@@ -0,0 +1,85 @@
+// Checks the cold_error_paths option against a stub driver, exits with 1 when a case fails:
+// global wrappers returning Result for several success codes must pass those codes through,
+// and throw for error codes and for success codes of other commands.
+// usage: bench_result_mask_check
+#include "stub_device.hpp"
+
+#include <cstdio>
+
+namespace
+{
+    VkResult stubResult = VK_SUCCESS;
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubWaitForFences(VkDevice, uint32_t, const VkFence *, VkBool32, uint64_t) {
+        return stubResult;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubGetEventStatus(VkDevice, VkEvent) {
+        return stubResult;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL stubCreateFence(VkDevice, const VkFenceCreateInfo *, const VkAllocationCallbacks *, VkFence *) {
+        return stubResult;
+    }
+
+    // true when f returns expected with the stub returning result
+    template <typename F>
+    bool passes(VkResult result, F &&f, vk::Result expected) {
+        stubResult = result;
+        try {
+            return f() == expected;
+        } catch (...) {
+            return false;
+        }
+    }
+
+    // true when f throws E with the stub returning result
+    template <typename E, typename F>
+    bool throws(VkResult result, F &&f) {
+        stubResult = result;
+        try {
+            static_cast<void>(f());
+        } catch (E const &) {
+            return true;
+        } catch (...) {
+        }
+        return false;
+    }
+
+    bool expect(const char *name, bool ok) {
+        std::printf("%-34s %s\n", name, ok ? "ok" : "FAIL");
+        return ok;
+    }
+
+}  // namespace
+
+int main() {
+    if (!bench::initStubDevice()) {
+        std::printf("stub driver failed to load\n");
+        return 1;
+    }
+
+    auto *dispatcher             = const_cast<vk::DeviceDispatcher *>(vk::device.getDispatcher());
+    dispatcher->vkWaitForFences  = &stubWaitForFences;
+    dispatcher->vkGetEventStatus = &stubGetEventStatus;
+    dispatcher->vkCreateFence    = &stubCreateFence;
+
+    const auto waitForFences  = [] { return vk::waitForFences(vk::Fence{}, VK_TRUE, UINT64_MAX); };
+    const auto getEventStatus = [] { return vk::getEventStatus(vk::Event{}); };
+    const auto createFence    = [] {
+        static_cast<void>(vk::createFence(vk::FenceCreateInfo{}));
+        return vk::Result::eSuccess;
+    };
+
+    bool ok = true;
+    ok &= expect("waitForFences success", passes(VK_SUCCESS, waitForFences, vk::Result::eSuccess));
+    ok &= expect("waitForFences timeout", passes(VK_TIMEOUT, waitForFences, vk::Result::eTimeout));
+    ok &= expect("waitForFences device lost", throws<vk::DeviceLostError>(VK_ERROR_DEVICE_LOST, waitForFences));
+    ok &= expect("waitForFences not ready", throws<vk::SystemError>(VK_NOT_READY, waitForFences));
+    ok &= expect("getEventStatus set", passes(VK_EVENT_SET, getEventStatus, vk::Result::eEventSet));
+    ok &= expect("getEventStatus reset", passes(VK_EVENT_RESET, getEventStatus, vk::Result::eEventReset));
+    ok &= expect("getEventStatus timeout", throws<vk::SystemError>(VK_TIMEOUT, getEventStatus));
+    ok &= expect("createFence success", passes(VK_SUCCESS, createFence, vk::Result::eSuccess));
+    ok &= expect("createFence out of host memory", throws<vk::OutOfHostMemoryError>(VK_ERROR_OUT_OF_HOST_MEMORY, createFence));
+    return ok ? 0 : 1;
+}
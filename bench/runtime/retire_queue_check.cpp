@@ -0,0 +1,69 @@
+// Checks the deferred_destroy option against a stub driver, exits with 1 when a case fails:
+// vk::retire hands handles to a RetireQueue, collect() has to destroy exactly those retired with a value
+// it passed, in retire order, and call the destroy command with the pool of a command buffer.
+// usage: bench_retire_queue_check
+#include "stub_device.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    std::vector<uintptr_t> destroyed;
+    VkCommandPool         freedFrom = VK_NULL_HANDLE;
+
+    VKAPI_ATTR void VKAPI_CALL stubDestroyBuffer(VkDevice, VkBuffer buffer, const VkAllocationCallbacks *) {
+        destroyed.push_back(reinterpret_cast<uintptr_t>(buffer));
+    }
+
+    VKAPI_ATTR void VKAPI_CALL stubFreeCommandBuffers(VkDevice, VkCommandPool pool, uint32_t count, const VkCommandBuffer *pCommandBuffers) {
+        freedFrom = pool;
+        for (uint32_t i = 0; i < count; ++i) {
+            destroyed.push_back(reinterpret_cast<uintptr_t>(pCommandBuffers[i]));
+        }
+    }
+
+    template <typename T>
+    T handle(uintptr_t value) {
+        return T{ reinterpret_cast<typename T::CType>(value) };
+    }
+
+    bool expect(const char *name, bool ok) {
+        std::printf("%-34s %s\n", name, ok ? "ok" : "FAIL");
+        return ok;
+    }
+
+}  // namespace
+
+int main() {
+    if (!bench::initStubDevice()) {
+        std::printf("stub driver failed to load\n");
+        return 1;
+    }
+
+    auto *dispatcher                 = const_cast<vk::DeviceDispatcher *>(vk::device.getDispatcher());
+    dispatcher->vkDestroyBuffer      = &stubDestroyBuffer;
+    dispatcher->vkFreeCommandBuffers = &stubFreeCommandBuffers;
+
+    bool ok = true;
+    {
+        vk::RetireQueue queue;
+        queue.setRetireValue(1);
+        vk::retire(queue, handle<vk::Buffer>(0x10));
+        queue.setRetireValue(2);
+        vk::retire(queue, handle<vk::Buffer>(0x20));
+        vk::retire(queue, handle<vk::CommandPool>(0x40), handle<vk::CommandBuffer>(0x30));
+
+        ok &= expect("collect before retire value", queue.collect(0) == 0 && destroyed.empty());
+        ok &= expect("collect first value", queue.collect(1) == 1 && destroyed == std::vector<uintptr_t>{ 0x10 });
+        ok &= expect("collect in retire order", queue.collect(2) == 2 && destroyed == std::vector<uintptr_t>{ 0x10, 0x20, 0x30 });
+        ok &= expect("command buffer freed from pool", freedFrom == reinterpret_cast<VkCommandPool>(uintptr_t{ 0x40 }));
+
+        destroyed.clear();
+        queue.setRetireValue(3);
+        vk::retire(queue, handle<vk::Buffer>(0x50));
+    }
+    ok &= expect("destructor flushes", destroyed == std::vector<uintptr_t>{ 0x50 });
+    return ok ? 0 : 1;
+}
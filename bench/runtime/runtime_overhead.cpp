@@ -0,0 +1,126 @@
+// Per-call cost of the global command wrappers compared with the vk::device dispatcher and raw PFNs.
+// usage: bench_runtime_overhead [csv file] [revision]
+#include "stub_device.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr size_t iterations = 10'000'000;
+
+    struct Sample
+    {
+        const char *command;
+        const char *variant;
+        double      ns;
+    };
+
+    template <typename F>
+    double measure(F &&f) {
+        for (size_t i = 0; i < iterations / 10; ++i) {
+            f();
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            f();
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::string csvPath  = argc > 1 ? argv[1] : "";
+    const std::string revision = argc > 2 ? argv[2] : "local";
+
+    try {
+        if (!bench::initStubDevice()) {
+            std::cerr << "Failed to load the stub driver\n";
+            return 1;
+        }
+
+        const vk::CommandBuffer cmd = bench::allocateCommandBuffer();
+
+        // handles are never dereferenced by the stub
+        const auto layout = vk::PipelineLayout{ (VkPipelineLayout)uintptr_t{ 0x10 } };
+        const auto set    = vk::DescriptorSet{ (VkDescriptorSet)uintptr_t{ 0x20 } };
+
+        std::array<float, 16> constants{};
+
+        vk::DescriptorBufferInfo bufferInfo{};
+        bufferInfo.range = VK_WHOLE_SIZE;
+        vk::WriteDescriptorSet write{};
+        write.dstSet          = set;
+        write.descriptorCount = 1;
+        write.descriptorType  = vk::DescriptorType::eUniformBuffer;
+        write.pBufferInfo     = &bufferInfo;
+
+        const VkCommandBuffer      rawCmd     = static_cast<VkCommandBuffer>(cmd);
+        const VkDevice             rawDevice  = static_cast<VkDevice>(*vk::device);
+        const VkPipelineLayout     rawLayout  = static_cast<VkPipelineLayout>(layout);
+        const VkDescriptorSet      rawSet     = static_cast<VkDescriptorSet>(set);
+        const VkWriteDescriptorSet *rawWrite  = reinterpret_cast<const VkWriteDescriptorSet *>(&write);
+
+        // raw PFNs are resolved once, the dispatcher variant reads them from vk::device on every call
+        const auto getProcAddr             = vk::instance.getDispatcher()->vkGetDeviceProcAddr;
+        const auto pfnDraw                 = reinterpret_cast<PFN_vkCmdDraw>(getProcAddr(rawDevice, "vkCmdDraw"));
+        const auto pfnBindDescriptorSets   = reinterpret_cast<PFN_vkCmdBindDescriptorSets>(getProcAddr(rawDevice, "vkCmdBindDescriptorSets"));
+        const auto pfnPushConstants        = reinterpret_cast<PFN_vkCmdPushConstants>(getProcAddr(rawDevice, "vkCmdPushConstants"));
+        const auto pfnUpdateDescriptorSets = reinterpret_cast<PFN_vkUpdateDescriptorSets>(getProcAddr(rawDevice, "vkUpdateDescriptorSets"));
+
+        std::vector<Sample> samples;
+
+        samples.push_back({ "draw", "wrapper", measure([&] { vk::cmdDraw(cmd, 3, 1, 0, 0); }) });
+        samples.push_back({ "draw", "dispatcher", measure([&] { vk::device.getDispatcher()->vkCmdDraw(rawCmd, 3, 1, 0, 0); }) });
+        samples.push_back({ "draw", "raw", measure([&] { pfnDraw(rawCmd, 3, 1, 0, 0); }) });
+
+        samples.push_back({ "bindDescriptorSets", "wrapper", measure([&] {
+                                vk::cmdBindDescriptorSets(cmd, vk::PipelineBindPoint::eGraphics, layout, 0, set, {});
+                            }) });
+        samples.push_back({ "bindDescriptorSets", "dispatcher", measure([&] {
+                                vk::device.getDispatcher()->vkCmdBindDescriptorSets(rawCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, rawLayout, 0, 1, &rawSet, 0, nullptr);
+                            }) });
+        samples.push_back({ "bindDescriptorSets", "raw", measure([&] {
+                                pfnBindDescriptorSets(rawCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, rawLayout, 0, 1, &rawSet, 0, nullptr);
+                            }) });
+
+        samples.push_back({ "pushConstants", "wrapper", measure([&] {
+                                vk::cmdPushConstants<const float>(cmd, layout, vk::ShaderStageFlagBits::eVertex, 0, constants);
+                            }) });
+        samples.push_back({ "pushConstants", "dispatcher", measure([&] {
+                                vk::device.getDispatcher()->vkCmdPushConstants(rawCmd, rawLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(constants), constants.data());
+                            }) });
+        samples.push_back({ "pushConstants", "raw", measure([&] {
+                                pfnPushConstants(rawCmd, rawLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(constants), constants.data());
+                            }) });
+
+        samples.push_back({ "updateDescriptorSets", "wrapper", measure([&] { vk::updateDescriptorSets(write, nullptr); }) });
+        samples.push_back({ "updateDescriptorSets", "dispatcher", measure([&] {
+                                vk::device.getDispatcher()->vkUpdateDescriptorSets(rawDevice, 1, rawWrite, 0, nullptr);
+                            }) });
+        samples.push_back({ "updateDescriptorSets", "raw", measure([&] { pfnUpdateDescriptorSets(rawDevice, 1, rawWrite, 0, nullptr); }) });
+
+        for (const auto &s : samples) {
+            std::printf("%-22s %-12s %8.3f ns\n", s.command, s.variant, s.ns);
+        }
+
+        if (!csvPath.empty()) {
+            std::ofstream csv{ csvPath, std::ios::app };
+            for (const auto &s : samples) {
+                csv << revision << ',' << s.command << ',' << s.variant << ',' << s.ns << '\n';
+            }
+        }
+    }
+    catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+// Loads the generated stub driver (stub_driver option) into vk::context and creates vk::instance and vk::device on it.
+// Defines the global handles, include from one translation unit per executable.
+#ifndef VKGEN_BENCH_STUB_DEVICE_HPP
+#define VKGEN_BENCH_STUB_DEVICE_HPP
+
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_global.hpp>
+
+#include <type_traits>
+
+namespace bench
+{
+    // init functions return their result with the expected_result option and throw without it
+    template <typename F>
+    bool succeeds(F &&init) {
+        if constexpr (std::is_void_v<std::invoke_result_t<F>>) {
+            init();
+            return true;
+        } else {
+            return init() == vk::Result::eSuccess;
+        }
+    }
+
+    // value of a creating wrapper, which is wrapped in ResultValue with the expected_result option
+    template <typename T>
+    T valueOf(T value) {
+        return value;
+    }
+
+    template <typename T>
+    T valueOf(vk::ResultValue<T> value) {
+        return value.value;
+    }
+
+    inline bool initStubDevice() {
+        if (!vk::context.loadStub()) {
+            return false;
+        }
+
+        vk::InstanceCreateInfo instanceInfo{};
+        if (!succeeds([&] { return vk::initInstance(instanceInfo); })) {
+            return false;
+        }
+
+        uint32_t           count = 1;
+        vk::PhysicalDevice physicalDevice{};
+        if (vk::enumeratePhysicalDevices(&count, &physicalDevice) != vk::Result::eSuccess || count == 0) {
+            return false;
+        }
+
+        float                     priority = 1.0f;
+        vk::DeviceQueueCreateInfo queueInfo{};
+        queueInfo.queueCount       = 1;
+        queueInfo.pQueuePriorities = &priority;
+        vk::DeviceCreateInfo deviceInfo{};
+        deviceInfo.queueCreateInfoCount = 1;
+        deviceInfo.pQueueCreateInfos    = &queueInfo;
+        return succeeds([&] { return vk::initDevice(physicalDevice, deviceInfo); });
+    }
+
+    inline vk::CommandBuffer allocateCommandBuffer() {
+        vk::CommandPoolCreateInfo poolInfo{};
+        vk::CommandBufferAllocateInfo allocInfo{};
+        allocInfo.commandPool        = valueOf(vk::createCommandPool(poolInfo));
+        allocInfo.level              = vk::CommandBufferLevel::ePrimary;
+        allocInfo.commandBufferCount = 1;
+        return valueOf(vk::allocateCommandBuffer(allocInfo));
+    }
+
+}  // namespace bench
+
+#endif  // VKGEN_BENCH_STUB_DEVICE_HPP
@@ -0,0 +1,143 @@
+// Submissions from several worker threads against the stub driver (submit_batcher option), its vkQueueSubmit2 busy waits 2 us:
+// every worker calling vk::queueSubmit2 behind a mutex, against workers enqueueing into
+// vk::SubmitBatcher and the owner thread flushing it at the end of the frame.
+// usage: bench_submit_batcher [csv file] [revision]
+#include "stub_device.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr size_t frames           = 200;
+    constexpr size_t submitsPerThread = 64;
+
+    struct Sample
+    {
+        std::string mode;
+        double      ns;
+        double      callsPerFrame;
+    };
+
+    struct Inputs
+    {
+        vk::CommandBufferSubmitInfo commandBuffer{};
+        vk::SemaphoreSubmitInfo     signal{};
+        vk::SubmitInfo2             submit{};
+
+        Inputs() {
+            // handles are never dereferenced by the stub
+            commandBuffer.commandBuffer = vk::CommandBuffer{ (VkCommandBuffer)uintptr_t{ 0x10 } };
+            signal.semaphore            = vk::Semaphore{ (VkSemaphore)uintptr_t{ 0x20 } };
+            signal.value                = 1;
+            signal.stageMask            = vk::PipelineStageFlagBits2::eAllCommands;
+
+            submit.commandBufferInfoCount   = 1;
+            submit.pCommandBufferInfos      = &commandBuffer;
+            submit.signalSemaphoreInfoCount = 1;
+            submit.pSignalSemaphoreInfos    = &signal;
+        }
+
+        Inputs(Inputs const &) = delete;
+    };
+
+    template <typename F>
+    double measure(size_t submits, F &&f) {
+        double total = 0.0;
+        for (size_t i = 0; i < frames; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            auto end = std::chrono::steady_clock::now();
+            total += std::chrono::duration<double, std::nano>(end - start).count();
+        }
+        return total / (frames * submits);
+    }
+
+    // busy waits like a kernel submission would, cost is per call and does not depend on submitCount
+    VKAPI_ATTR VkResult VKAPI_CALL busySubmit2(VkQueue, uint32_t, const VkSubmitInfo2 *, VkFence) {
+        const auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(2);
+        while (std::chrono::steady_clock::now() < end) {
+        }
+        return VK_SUCCESS;
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::string csvPath  = argc > 1 ? argv[1] : "";
+    const std::string revision = argc > 2 ? argv[2] : "local";
+
+    try {
+        if (!bench::initStubDevice()) {
+            std::cerr << "Failed to load the stub driver\n";
+            return 1;
+        }
+        const_cast<vk::DeviceDispatcher *>(vk::device.getDispatcher())->vkQueueSubmit2 = &busySubmit2;
+        const vk::Queue queue = vk::getDeviceQueue(0, 0);
+
+        const Inputs        in;
+        const size_t        threads = std::max(2u, std::thread::hardware_concurrency());
+        const size_t        submits = threads * submitsPerThread;
+        std::vector<Sample> samples;
+
+        // one vkQueueSubmit2 per SubmitInfo2, workers serialized by the mutex
+        std::mutex queueMutex;
+        const double locked = measure(submits, [&] {
+            std::vector<std::thread> workers;
+            for (size_t t = 0; t < threads; ++t) {
+                workers.emplace_back([&] {
+                    for (size_t i = 0; i < submitsPerThread; ++i) {
+                        std::lock_guard<std::mutex> lock{ queueMutex };
+                        vk::queueSubmit2(queue, in.submit, {});
+                    }
+                });
+            }
+            for (auto &w : workers) {
+                w.join();
+            }
+        });
+        samples.push_back({ "mutex_x" + std::to_string(threads), locked, double(submits) });
+
+        // workers only enqueue, this thread owns the queue and flushes once per frame
+        vk::SubmitBatcher batcher{ queue };
+        size_t            calls   = 0;
+        const double      batched = measure(submits, [&] {
+            std::vector<std::thread> workers;
+            for (size_t t = 0; t < threads; ++t) {
+                workers.emplace_back([&] {
+                    for (size_t i = 0; i < submitsPerThread; ++i) {
+                        batcher.enqueue(in.submit);
+                    }
+                });
+            }
+            for (auto &w : workers) {
+                w.join();
+            }
+            calls += batcher.flush() ? 1 : 0;
+        });
+        samples.push_back({ "batcher_x" + std::to_string(threads), batched, double(calls) / frames });
+
+        for (const auto &s : samples) {
+            std::printf("%-12s %8.3f ns/submit %8.1f vkQueueSubmit2/frame\n", s.mode.c_str(), s.ns, s.callsPerFrame);
+        }
+
+        if (!csvPath.empty()) {
+            std::ofstream csv{ csvPath, std::ios::app };
+            for (const auto &s : samples) {
+                csv << revision << ',' << s.mode << ',' << s.ns << ',' << s.callsPerFrame << '\n';
+            }
+        }
+    }
+    catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
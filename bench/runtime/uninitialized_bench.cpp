@@ -0,0 +1,119 @@
+// Construction of output-only structs, value initialized against vk::uninitialized (struct_uninitialized option),
+// global mode structs are default initialized instead of taking the tag.
+// Every constructed struct is handed to an opaque query that writes all of it, like a driver would.
+// usage: bench_uninitialized [csv file] [revision]
+#include <vulkan/vulkan.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace
+{
+    constexpr size_t iterations = 1'000'000;
+    constexpr size_t count      = 64;
+
+    struct Sample
+    {
+        const char *type;
+        const char *method;
+        size_t      bytes;
+        double      ns;
+    };
+
+    VkPhysicalDeviceProperties   sourceProperties{};
+    VkPhysicalDeviceIDProperties sourceID{};
+    VkMemoryRequirements         sourceRequirements{};
+
+    // stands in for vkGetPhysicalDeviceProperties2 and friends, not visible to the optimizer
+#if defined(_MSC_VER)
+    __declspec(noinline)
+#else
+    __attribute__((noinline))
+#endif
+    void query(vk::PhysicalDeviceProperties2 &properties) {
+        std::memcpy(&properties.properties, &sourceProperties, sizeof(sourceProperties));
+        auto *id = static_cast<VkPhysicalDeviceIDProperties *>(properties.pNext);
+        if (id) {
+            std::memcpy(id->deviceUUID, sourceID.deviceUUID, sizeof(sourceID) - offsetof(VkPhysicalDeviceIDProperties, deviceUUID));
+        }
+    }
+
+#if defined(_MSC_VER)
+    __declspec(noinline)
+#else
+    __attribute__((noinline))
+#endif
+    void query(vk::MemoryRequirements *requirements, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            std::memcpy(&requirements[i], &sourceRequirements, sizeof(sourceRequirements));
+        }
+    }
+
+    template <typename F>
+    double measure(size_t runs, F &&f) {
+        for (size_t i = 0; i < runs / 10; ++i) {
+            f();
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < runs; ++i) {
+            f();
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / runs;
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::string csvPath  = argc > 1 ? argv[1] : "";
+    const std::string revision = argc > 2 ? argv[2] : "local";
+
+    sourceProperties.apiVersion = VK_API_VERSION_1_3;
+    std::strcpy(sourceProperties.deviceName, "stub");
+
+    using Chain = vk::StructureChain<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceIDProperties>;
+
+    Sample samples[] = {
+        { "PhysicalDeviceProperties2", "value", sizeof(vk::PhysicalDeviceProperties2), measure(iterations, [] {
+              vk::PhysicalDeviceProperties2 p{};
+              query(p);
+          }) },
+        { "PhysicalDeviceProperties2", "uninitialized", sizeof(vk::PhysicalDeviceProperties2), measure(iterations, [] {
+              // global mode structs stay aggregates, default initialization sets only sType and pNext
+              vk::PhysicalDeviceProperties2 p;
+              query(p);
+          }) },
+        { "StructureChain", "value", sizeof(Chain), measure(iterations, [] {
+              Chain c;
+              query(c.get<vk::PhysicalDeviceProperties2>());
+          }) },
+        { "StructureChain", "uninitialized", sizeof(Chain), measure(iterations, [] {
+              Chain c(vk::uninitialized);
+              query(c.get<vk::PhysicalDeviceProperties2>());
+          }) },
+        { "Vector<MemoryRequirements>", "value", sizeof(vk::MemoryRequirements) * count, measure(iterations / 10, [] {
+              vk::Vector<vk::MemoryRequirements> v(count);
+              query(v.data(), v.size());
+          }) },
+        { "Vector<MemoryRequirements>", "uninitialized", sizeof(vk::MemoryRequirements) * count, measure(iterations / 10, [] {
+              vk::Vector<vk::MemoryRequirements> v(count, vk::uninitialized);
+              query(v.data(), v.size());
+          }) },
+    };
+
+    for (const auto &s : samples) {
+        std::printf("%-28s %-14s %6zu B %8.1f ns\n", s.type, s.method, s.bytes, s.ns);
+    }
+
+    if (!csvPath.empty()) {
+        std::ofstream csv{ csvPath, std::ios::app };
+        for (const auto &s : samples) {
+            csv << revision << ',' << s.type << ',' << s.method << ',' << s.bytes << ',' << s.ns << '\n';
+        }
+    }
+    return 0;
+}
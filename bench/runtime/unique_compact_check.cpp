@@ -0,0 +1,94 @@
+// Checks the unique_compact option against a stub driver, exits with 1 when a case fails:
+// compact unique handles store no owner, they have to destroy through vk::device exactly once,
+// with their allocator or pool, and not after release(). Prints the size of each checked unique handle.
+// usage: bench_unique_compact_check
+#include "stub_device.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+
+namespace
+{
+    uint32_t                     destroyed     = 0;
+    VkAllocationCallbacks const *destroyedWith = nullptr;
+    VkCommandPool                freedFrom     = VK_NULL_HANDLE;
+
+    VKAPI_ATTR void VKAPI_CALL stubDestroyBuffer(VkDevice, VkBuffer, const VkAllocationCallbacks *pAllocator) {
+        ++destroyed;
+        destroyedWith = pAllocator;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL stubFreeMemory(VkDevice, VkDeviceMemory, const VkAllocationCallbacks *pAllocator) {
+        ++destroyed;
+        destroyedWith = pAllocator;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL stubFreeCommandBuffers(VkDevice, VkCommandPool pool, uint32_t count, const VkCommandBuffer *) {
+        destroyed += count;
+        freedFrom = pool;
+    }
+
+    template <typename T>
+    T handle(uintptr_t value) {
+        return T{ reinterpret_cast<typename T::CType>(value) };
+    }
+
+    // true when the scope destroys count handles
+    template <typename F>
+    bool destroys(uint32_t count, F &&scope) {
+        destroyed     = 0;
+        destroyedWith = nullptr;
+        scope();
+        return destroyed == count;
+    }
+
+    bool expect(const char *name, bool ok) {
+        std::printf("%-34s %s\n", name, ok ? "ok" : "FAIL");
+        return ok;
+    }
+
+}  // namespace
+
+int main() {
+    if (!bench::initStubDevice()) {
+        std::printf("stub driver failed to load\n");
+        return 1;
+    }
+
+    auto *dispatcher                 = const_cast<vk::DeviceDispatcher *>(vk::device.getDispatcher());
+    dispatcher->vkDestroyBuffer      = &stubDestroyBuffer;
+    dispatcher->vkFreeMemory         = &stubFreeMemory;
+    dispatcher->vkFreeCommandBuffers = &stubFreeCommandBuffers;
+
+    std::printf("sizeof(UniqueBuffer)        %zu\n", sizeof(vk::UniqueBuffer));
+    std::printf("sizeof(UniqueDeviceMemory)  %zu\n", sizeof(vk::UniqueDeviceMemory));
+    std::printf("sizeof(UniqueCommandBuffer) %zu\n", sizeof(vk::UniqueCommandBuffer));
+
+    const vk::AllocationCallbacks allocator{};
+    const auto                   *callbacks = reinterpret_cast<VkAllocationCallbacks const *>(&allocator);
+
+    bool ok = true;
+    ok &= expect("buffer destroyed once", destroys(1, [] { vk::UniqueBuffer buffer(handle<vk::Buffer>(0x10)); }));
+    ok &= expect("buffer moved", destroys(1, [] {
+                     vk::UniqueBuffer buffer(handle<vk::Buffer>(0x10));
+                     vk::UniqueBuffer moved(std::move(buffer));
+                 }));
+    ok &= expect("buffer released", destroys(0, [] {
+                     vk::UniqueBuffer buffer(handle<vk::Buffer>(0x10));
+                     static_cast<void>(buffer.release());
+                 }));
+    ok &= expect("buffer reset", destroys(1, [&] {
+                     vk::UniqueBuffer buffer(handle<vk::Buffer>(0x10));
+                     buffer.reset();
+                     ok &= !buffer;
+                 }));
+    ok &= expect("memory freed with allocator", destroys(1, [&] {
+                     vk::UniqueDeviceMemory memory(handle<vk::DeviceMemory>(0x20), vk::ObjectFree<vk::Device>(allocator));
+                 }) && destroyedWith == callbacks);
+    ok &= expect("command buffer freed from pool", destroys(1, [] {
+                     vk::UniqueCommandBuffer commandBuffer(handle<vk::CommandBuffer>(0x30),
+                                                           vk::PoolFree<vk::Device, vk::CommandPool>(handle<vk::CommandPool>(0x40)));
+                 }) && freedFrom == reinterpret_cast<VkCommandPool>(uintptr_t{ 0x40 }));
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+// Generated vk::Vector compared with std::vector, vk::Vector<T, N> covers the small_vector case.
+// usage: bench_vector [csv file] [revision]
+#include <vulkan/vulkan.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr size_t iterations = 200'000;
+
+    struct Sample
+    {
+        const char *operation;
+        const char *container;
+        size_t      count;
+        double      ns;
+    };
+
+    size_t sink = 0;
+
+    template <typename F>
+    double measure(F &&f) {
+        for (size_t i = 0; i < iterations / 10; ++i) {
+            f();
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            f();
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+
+    template <typename V>
+    V fill(size_t count) {
+        V v;
+        for (size_t i = 0; i < count; ++i) {
+            vk::DescriptorBufferInfo info{};
+            info.offset = i;
+            info.range  = VK_WHOLE_SIZE;
+            v.push_back(info);
+        }
+        return v;
+    }
+
+    template <typename V>
+    void run(std::vector<Sample> &samples, const char *container, size_t count) {
+        samples.push_back({ "push_back", container, count, measure([&] {
+                                auto v = fill<V>(count);
+                                sink += v.size();
+                            }) });
+
+        const V src = fill<V>(count);
+        samples.push_back({ "copy", container, count, measure([&] {
+                                V v{ src };
+                                sink += v.size();
+                            }) });
+
+        samples.push_back({ "move", container, count, measure([&] {
+                                V a{ src };
+                                V b{ std::move(a) };
+                                sink += b.size();
+                            }) });
+
+        samples.push_back({ "resize", container, count, measure([&] {
+                                V v;
+                                v.resize(count);
+                                sink += v.size();
+                            }) });
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::string csvPath  = argc > 1 ? argv[1] : "";
+    const std::string revision = argc > 2 ? argv[2] : "local";
+
+    std::vector<Sample> samples;
+    for (size_t count : { 4, 16, 256 }) {
+        run<std::vector<vk::DescriptorBufferInfo>>(samples, "std::vector", count);
+        run<vk::Vector<vk::DescriptorBufferInfo>>(samples, "vk::Vector", count);
+        run<vk::Vector<vk::DescriptorBufferInfo, 16>>(samples, "vk::Vector<16>", count);
+    }
+
+    for (const auto &s : samples) {
+        std::printf("%-10s %-16s %5zu %10.1f ns\n", s.operation, s.container, s.count, s.ns);
+    }
+
+    if (!csvPath.empty()) {
+        std::ofstream csv{ csvPath, std::ios::app };
+        for (const auto &s : samples) {
+            csv << revision << ',' << s.operation << ',' << s.container << ',' << s.count << ',' << s.ns << '\n';
+        }
+    }
+    return sink == 0;
+}
@@ -0,0 +1,140 @@
+// Checks allocator handling of the generated vk::Vector, exits with 1 when a case fails:
+// propagate_on_container_copy_assignment/move_assignment/swap decide which allocator the target keeps,
+// every block has to be released through an allocator equal to the one that allocated it.
+// usage: bench_vector_check
+#include <vulkan/vulkan.hpp>
+
+#include <cstdio>
+#include <memory>
+#include <type_traits>
+
+namespace
+{
+    // outstanding element count per allocator id
+    long outstanding[4] = {};
+
+    template <typename T, bool Propagate>
+    struct TaggedAllocator
+    {
+        using value_type                             = T;
+        using propagate_on_container_copy_assignment = std::bool_constant<Propagate>;
+        using propagate_on_container_move_assignment = std::bool_constant<Propagate>;
+        using propagate_on_container_swap            = std::bool_constant<Propagate>;
+        using is_always_equal                        = std::false_type;
+
+        int id = 0;
+
+        TaggedAllocator() = default;
+
+        explicit TaggedAllocator(int id) : id(id) {}
+
+        template <typename U>
+        TaggedAllocator(const TaggedAllocator<U, Propagate> &rhs) : id(rhs.id) {}
+
+        T *allocate(size_t n) {
+            outstanding[id] += static_cast<long>(n);
+            return std::allocator<T>{}.allocate(n);
+        }
+
+        void deallocate(T *p, size_t n) {
+            outstanding[id] -= static_cast<long>(n);
+            std::allocator<T>{}.deallocate(p, n);
+        }
+
+        friend bool operator==(const TaggedAllocator &lhs, const TaggedAllocator &rhs) {
+            return lhs.id == rhs.id;
+        }
+    };
+
+    template <size_t N, bool Propagate>
+    using TestVector = vk::Vector<int, N, N != 0, TaggedAllocator<int, Propagate>>;
+
+    template <typename V>
+    V make(int id, int first, size_t count) {
+        V v{ typename V::allocator_type{ id } };
+        for (size_t i = 0; i < count; ++i) {
+            v.push_back(first + static_cast<int>(i));
+        }
+        return v;
+    }
+
+    template <typename V>
+    bool holds(const V &v, int id, int first, size_t count) {
+        if (v.get_allocator().id != id || v.size() != count) {
+            return false;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (v[i] != first + static_cast<int>(i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool released() {
+        for (long n : outstanding) {
+            if (n != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool expect(const char *name, bool ok) {
+        std::printf("%-34s %s\n", name, ok ? "ok" : "FAIL");
+        return ok;
+    }
+
+    // count 20 ends up on the heap, count 2 stays in the inline buffer of N = 4
+    template <size_t N, bool Propagate>
+    bool checkAssignments(const char *prefix) {
+        const int expected = Propagate ? 2 : 1;
+        bool      ok       = true;
+        char      name[64];
+
+        for (size_t count : { size_t{ 2 }, size_t{ 20 } }) {
+            {
+                auto       lhs = make<TestVector<N, Propagate>>(1, 100, 3);
+                const auto rhs = make<TestVector<N, Propagate>>(2, 0, count);
+                lhs            = rhs;
+                std::snprintf(name, sizeof(name), "%s copy assign %zu", prefix, count);
+                ok &= expect(name, holds(lhs, expected, 0, count) && holds(rhs, 2, 0, count));
+            }
+            {
+                auto lhs = make<TestVector<N, Propagate>>(1, 100, 3);
+                auto rhs = make<TestVector<N, Propagate>>(2, 0, count);
+                lhs      = std::move(rhs);
+                std::snprintf(name, sizeof(name), "%s move assign %zu", prefix, count);
+                ok &= expect(name, holds(lhs, expected, 0, count) && rhs.empty());
+            }
+            if constexpr (Propagate) {
+                auto lhs = make<TestVector<N, Propagate>>(1, 100, 3);
+                auto rhs = make<TestVector<N, Propagate>>(2, 0, count);
+                swap(lhs, rhs);
+                std::snprintf(name, sizeof(name), "%s swap %zu", prefix, count);
+                ok &= expect(name, holds(lhs, 2, 0, count) && holds(rhs, 1, 100, 3));
+            }
+        }
+        // without propagation allocators have to be equal for swap
+        {
+            auto lhs = make<TestVector<N, Propagate>>(1, 100, 3);
+            auto rhs = make<TestVector<N, Propagate>>(1, 0, 20);
+            lhs.swap(rhs);
+            std::snprintf(name, sizeof(name), "%s swap equal", prefix);
+            ok &= expect(name, holds(lhs, 1, 0, 20) && holds(rhs, 1, 100, 3));
+        }
+        std::snprintf(name, sizeof(name), "%s released", prefix);
+        ok &= expect(name, released());
+        return ok;
+    }
+
+}  // namespace
+
+int main() {
+    bool ok = true;
+    ok &= checkAssignments<0, true>("heap propagate");
+    ok &= checkAssignments<0, false>("heap keep");
+    ok &= checkAssignments<4, true>("inline propagate");
+    ok &= checkAssignments<4, false>("inline keep");
+    return ok ? 0 : 1;
+}
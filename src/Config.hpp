@@ -112,9 +112,22 @@ namespace vkgen
         ConfigWrapper<bool> interop{ "interop", { false } };
         ConfigWrapper<bool> staticInstancePFN{ "static_instance_pfn", { false } };
         ConfigWrapper<bool> staticDevicePFN{ "static_device_pfn", { false } };
+        ConfigWrapper<bool> memoizedQueries{ "memoized_queries", { false } };
+        // comma separated, empty selects all vkGetPhysicalDevice* queries without output handles
+        ConfigWrapper<std::string> memoizedCommands{ "memoized_commands", { "" } };
+        ConfigWrapper<bool>        deferredDestroy{ "deferred_destroy", { false } };
+        ConfigWrapper<bool>        pooledArrays{ "pooled_arrays", { false } };
+        // child handles keep owner dispatcher pointer; only getDispatcher() and raii member commands use it,
+        // in global mode vkCmd* wrappers take a DeviceDispatcher pointer defaulting to vk::device
+        ConfigWrapper<bool>        cachedDispatcher{ "cached_dispatcher", { false } };
+        ConfigWrapper<bool>        commandStream{ "command_stream", { false } };
+        ConfigWrapper<bool>        hostAllocators{ "host_allocators", { false } };
+        ConfigWrapper<bool>        submitBatcher{ "submit_batcher", { false } };
+        // global wrappers tag externsync handle arguments with the calling thread (lock free table) for the duration of the call
+        ConfigWrapper<bool>        externSyncCheck{ "extern_sync_check", { false } };
 
         [[nodiscard]] auto reflect() const {
-            return std::tie(interop, staticInstancePFN, staticDevicePFN);
+            return std::tie(interop, staticInstancePFN, staticDevicePFN, memoizedQueries, memoizedCommands, deferredDestroy, pooledArrays, cachedDispatcher, commandStream, hostAllocators, submitBatcher, externSyncCheck);
         }
     };
 
@@ -138,7 +151,12 @@ namespace vkgen
         ConfigWrapper<bool> useStaticCommands{ "static_link_commands", false };  // move
         ConfigWrapper<bool> allocatorParam{ "allocator_param", true };
         ConfigWrapper<bool> resultValueType{ "use_result_value_type", true };
+        ConfigWrapper<bool> expectedResult{ "expected_result", false };
         ConfigWrapper<bool> dispatchTableAsUnique{ "dispatch_table_as_unique", { false } };
+        ConfigWrapper<bool> uniqueCompact{ "unique_compact", { false } };
+        ConfigWrapper<bool> dispatchGrouping{ "dispatch_grouping", { false } };
+        // comma separated commands placed at start of dispatchers, used with dispatch_grouping
+        ConfigWrapper<std::string> dispatchHotList{ "dispatch_hot_list", { "" } };
 
         ConfigWrapper<bool> functionsVecAndArray{ "functions_vec_array", { false } };
         ConfigWrapper<bool> noStdVector{ "no_std_vector", { true } };
@@ -146,6 +164,14 @@ namespace vkgen
 
         ConfigWrapper<bool>    spaceshipOperator{ "spaceship_operator", true };
         ConfigWrapper<bool>    branchHint{ "branch_hint", false };
+        ConfigWrapper<bool>    coldErrorPaths{ "cold_error_paths", false };
+        ConfigWrapper<bool>    flatStructChain{ "flat_struct_chain", false };
+        ConfigWrapper<bool>    structChainVisitor{ "struct_chain_visitor", false };
+        ConfigWrapper<bool>    structHash{ "struct_hash", false };
+        ConfigWrapper<bool>    structUninitialized{ "struct_uninitialized", false };
+        ConfigWrapper<bool>    structFormat{ "struct_format", false };
+        ConfigWrapper<bool>    enumStringTables{ "enum_string_tables", false };
+        ConfigWrapper<bool>    compactFlags{ "compact_flags", false };
         ConfigWrapper<bool>    importStdMacro{ "import_std_macro", false };
         ConfigWrapper<bool>    integrateVma{ "integrate_vma", false };
         ConfigWrapper<bool>    proxyPassByCopy{ "proxy_pass_by_copy", false };
@@ -177,6 +203,7 @@ namespace vkgen
 
         ConfigWrapper<int> structMock{ "struct_mock", 0 };
         ConfigWrapper<int> enumMock{ "enum_mock",   0 };
+        ConfigWrapper<bool> stubDriver{ "stub_driver", false };
 
         ConfigGroupRAII raii;
 
@@ -192,14 +219,26 @@ namespace vkgen
                             globalMode,
                             onlyC,
                             // internalFunctions,
+                            dispatchTemplate,
+                            dispatchGrouping,
+                            dispatchHotList,
                             allocatorParam,
                             resultValueType,
+                            expectedResult,
                             functionsVecAndArray,
                             structConstructors,
                             structSetters,
                             structCompare,
                             spaceshipOperator,
                             branchHint,
+                            coldErrorPaths,
+                            flatStructChain,
+                            structChainVisitor,
+                            structHash,
+                            structUninitialized,
+                            structFormat,
+                            enumStringTables,
+                            compactFlags,
                             importStdMacro,
                             integrateVma,
                             proxyPassByCopy,
@@ -209,12 +248,15 @@ namespace vkgen
                             unionSetters,
                             handleConstructors,
                             handleTemplates,
+                            smartHandles,
+                            uniqueCompact,
                             contextClassName,
                             moduleName,
                             classMethods,
                             raii,
                             structMock,
                             enumMock,
+                            stubDriver,
                             expandMacros
                             );
         }
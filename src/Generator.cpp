@@ -398,6 +398,73 @@ static constexpr char const *RES_UNIQUE_HANDLE{ R"(
 )" };
 
 
+static constexpr char const *RES_UNIQUE_DISPATCH{ R"(
+  namespace detail
+  {
+    // compact deleters store dispatcher only when it is not the default (global or static) one
+    template <typename Dispatch>
+    class UniqueDispatch
+    {
+    public:
+      UniqueDispatch() = default;
+
+      UniqueDispatch( Dispatch const & dispatch ) VULKAN_HPP_NOEXCEPT : m_dispatch( &dispatch ) {}
+
+      Dispatch const & get() const VULKAN_HPP_NOEXCEPT
+      {
+        VULKAN_HPP_ASSERT( m_dispatch );
+        return *m_dispatch;
+      }
+
+    private:
+      Dispatch const * m_dispatch = nullptr;
+    };
+
+    template <>
+    class UniqueDispatch<VULKAN_HPP_DEFAULT_DISPATCHER_TYPE>
+    {
+    public:
+      UniqueDispatch() = default;
+
+      UniqueDispatch( VULKAN_HPP_DEFAULT_DISPATCHER_TYPE const & dispatch ) VULKAN_HPP_NOEXCEPT
+      {
+        VULKAN_HPP_ASSERT( &dispatch == &VULKAN_HPP_DEFAULT_DISPATCHER );
+        static_cast<void>( dispatch );
+      }
+
+      VULKAN_HPP_DEFAULT_DISPATCHER_TYPE const & get() const VULKAN_HPP_NOEXCEPT
+      {
+        return VULKAN_HPP_DEFAULT_DISPATCHER;
+      }
+    };
+  }  // namespace detail
+)" };
+
+static constexpr char const *RES_UNIQUE_GLOBAL_DESTROY{ R"(
+  namespace detail
+  {
+    // deleters of global mode call the destroy functions of vulkan_funcs.hpp,
+    // they are declared later and found by argument dependent lookup when a deleter is instantiated
+    template <typename... Args>
+    void uniqueDestroy( Args const &... args ) VULKAN_HPP_NOEXCEPT
+    {
+      destroy( args... );
+    }
+
+    template <typename... Args>
+    void uniqueFree( Args const &... args ) VULKAN_HPP_NOEXCEPT
+    {
+      free( args... );
+    }
+
+    template <typename... Args>
+    void uniqueRelease( Args const &... args ) VULKAN_HPP_NOEXCEPT
+    {
+      release( args... );
+    }
+  }  // namespace detail
+)" };
+
 static constexpr char const *RES_UNIQUE_HANDLE_EXP{ R"(
 
   template <typename Type>
@@ -591,1887 +658,2130 @@ static constexpr char const *RES_RESULT_CHECK_CPP{ R"(
   }}
 )" };
 
-static constexpr char const *RES_RESULT_CHECK{ R"(
-  VULKAN_HPP_INLINE void resultCheck( VkResult result, char const * message )
+static constexpr char const *RES_RESULT_CHECK_MASK{ R"(
+  namespace detail
   {{
+    template <typename... Codes>
+    VULKAN_HPP_CONSTEXPR uint64_t successMask( Codes... codes ) VULKAN_HPP_NOEXCEPT
+    {{
+      return ( successBit( static_cast<VkResult>( codes ) ) | ... | uint64_t( 0 ) );
+    }}
+
+    VULKAN_HPP_NOINLINE inline void resultCheckExtended( VkResult result, char const * message, uint64_t successMask )
+    {{
 #ifdef VULKAN_HPP_NO_EXCEPTIONS
-    ignore( result );  // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
-    ignore( message );
-    VULKAN_HPP_ASSERT_ON_RESULT( result == VK_SUCCESS );
+      ignore( result );  // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
+      ignore( message );
+      ignore( successMask );
+      VULKAN_HPP_ASSERT_ON_RESULT( ( successBit( result ) & successMask ) != 0 );
 #else
-    if ( result != VK_SUCCESS ){0}
+      if ( ( successBit( result ) & successMask ) == 0 )
+      {{
+        throwResultException( static_cast<{1}>( result ), message );
+      }}
+#endif
+    }}
+  }}  // namespace detail
+
+  template <uint64_t successMask>
+  VULKAN_HPP_INLINE void resultCheck( VkResult result, char const * message )
+  {{
+    // core success codes (0..31) are tested inline with single branch, anything else goes out of line
+    uint32_t const code = static_cast<uint32_t>( result );
+    if ( !( ( ( code < 32 ? successMask : 0 ) >> ( code & 31 ) ) & 1 ) ){0}
     {{
-      detail::throwResultException( result, message );
+      detail::resultCheckExtended( result, message, successMask );
     }}
-#endif
   }}
 
-  VULKAN_HPP_INLINE void resultCheck( VkResult result, char const * message, std::initializer_list<VkResult> successCodes )
+  template <uint64_t successMask>
+  VULKAN_HPP_INLINE void resultCheck( Result result, char const * message )
   {{
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    ignore( result );  // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
-    ignore( message );
-    ignore( successCodes );  // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
-    VULKAN_HPP_ASSERT_ON_RESULT( std::find( successCodes.begin(), successCodes.end(), result ) != successCodes.end() );
-#else
-    for (const auto &r : successCodes) {{
-        if (result == r) {{
-            return;
-        }}
-    }}
-    detail::throwResultException( result, message );
-#endif
+    resultCheck<successMask>( static_cast<VkResult>( result ), message );
   }}
 )" };
 
-static constexpr char const *RES_ARRAY_PROXY{ R"(
-template <typename T>
- class ArrayProxy
- {
- public:
-   VULKAN_HPP_CONSTEXPR ArrayProxy() VULKAN_HPP_NOEXCEPT
-     : m_count( 0 )
-     , m_ptr( nullptr )
-   {
-   }
+static constexpr char const *RES_RESULT_VALUE_EXPECTED{ R"(
+  template <typename T>
+  void ignore( T const & ) VULKAN_HPP_NOEXCEPT
+  {{
+  }}
 
-   VULKAN_HPP_CONSTEXPR ArrayProxy( std::nullptr_t ) VULKAN_HPP_NOEXCEPT
-     : m_count( 0 )
-     , m_ptr( nullptr )
-   {
-   }
+  // holds value inline, error is reported by result (no exceptions)
+  template <typename T>
+  struct [[nodiscard]] ResultValue
+  {{
+    ResultValue( {0} r, T & v ) VULKAN_HPP_NOEXCEPT
+      : result( r ), value( v )
+    {{
+    }}
 
-   ArrayProxy( T const & value ) VULKAN_HPP_NOEXCEPT
-     : m_count( 1 )
-     , m_ptr( &value )
-   {
-   }
+    ResultValue( {0} r, T && v ) VULKAN_HPP_NOEXCEPT
+      : result( r ), value( std::move( v ) )
+    {{
+    }}
 
-   ArrayProxy( uint32_t count, T const * ptr ) VULKAN_HPP_NOEXCEPT
-     : m_count( count )
-     , m_ptr( ptr )
-   {
-   }
+    {0} result;
+    T      value;
 
-   template <std::size_t C>
-   ArrayProxy( T const ( &ptr )[C] ) VULKAN_HPP_NOEXCEPT
-     : m_count( C )
-     , m_ptr( ptr )
-   {
-   }
+    bool has_value() const VULKAN_HPP_NOEXCEPT
+    {{
+      return static_cast<int32_t>( result ) >= 0;
+    }}
 
-#  if __GNUC__ >= 9
-#    pragma GCC diagnostic push
-#    pragma GCC diagnostic ignored "-Winit-list-lifetime"
-#  endif
+    explicit operator bool() const VULKAN_HPP_NOEXCEPT
+    {{
+      return has_value();
+    }}
 
-   ArrayProxy( std::initializer_list<T> const & list ) VULKAN_HPP_NOEXCEPT
-     : m_count( static_cast<uint32_t>( list.size() ) )
-     , m_ptr( list.begin() )
-   {
-   }
+    {0} error() const VULKAN_HPP_NOEXCEPT
+    {{
+      return result;
+    }}
 
-   template <typename B = T, typename std::enable_if<std::is_const<B>::value, int>::type = 0>
-   ArrayProxy( std::initializer_list<typename std::remove_const<T>::type> const & list ) VULKAN_HPP_NOEXCEPT
-     : m_count( static_cast<uint32_t>( list.size() ) )
-     , m_ptr( list.begin() )
-   {
-   }
+    T & operator*() & VULKAN_HPP_NOEXCEPT
+    {{
+      VULKAN_HPP_ASSERT( has_value() );
+      return value;
+    }}
 
-#  if __GNUC__ >= 9
-#    pragma GCC diagnostic pop
-#  endif
+    T const & operator*() const & VULKAN_HPP_NOEXCEPT
+    {{
+      VULKAN_HPP_ASSERT( has_value() );
+      return value;
+    }}
 
-   // Any type with a .data() return type implicitly convertible to T*, and a .size() return type implicitly
-   // convertible to size_t. The const version can capture temporaries, with lifetime ending at end of statement.
-   template <typename V,
-             typename std::enable_if<std::is_convertible<decltype( std::declval<V>().data() ), T *>::value &&
-                                     std::is_convertible<decltype( std::declval<V>().size() ), std::size_t>::value>::type * = nullptr>
-   ArrayProxy( V const & v ) VULKAN_HPP_NOEXCEPT
-     : m_count( static_cast<uint32_t>( v.size() ) )
-     , m_ptr( v.data() )
-   {
-   }
+    T && operator*() && VULKAN_HPP_NOEXCEPT
+    {{
+      VULKAN_HPP_ASSERT( has_value() );
+      return std::move( value );
+    }}
 
-   const T * begin() const VULKAN_HPP_NOEXCEPT
-   {
-     return m_ptr;
-   }
+    T * operator->() VULKAN_HPP_NOEXCEPT
+    {{
+      VULKAN_HPP_ASSERT( has_value() );
+      return &value;
+    }}
 
-   const T * end() const VULKAN_HPP_NOEXCEPT
-   {
-     return m_ptr + m_count;
-   }
+    T const * operator->() const VULKAN_HPP_NOEXCEPT
+    {{
+      VULKAN_HPP_ASSERT( has_value() );
+      return &value;
+    }}
 
-   const T & front() const VULKAN_HPP_NOEXCEPT
-   {
-     VULKAN_HPP_ASSERT( m_count && m_ptr );
-     return *m_ptr;
-   }
+    template <typename U>
+    T value_or( U && other ) const &
+    {{
+      return has_value() ? value : static_cast<T>( std::forward<U>( other ) );
+    }}
 
-   const T & back() const VULKAN_HPP_NOEXCEPT
-   {
-     VULKAN_HPP_ASSERT( m_count && m_ptr );
-     return *( m_ptr + m_count - 1 );
-   }
+    template <typename U>
+    T value_or( U && other ) &&
+    {{
+      return has_value() ? std::move( value ) : static_cast<T>( std::forward<U>( other ) );
+    }}
 
-   bool empty() const VULKAN_HPP_NOEXCEPT
-   {
-     return ( m_count == 0 );
-   }
+    operator std::tuple<{0} &, T &>() VULKAN_HPP_NOEXCEPT
+    {{
+      return std::tuple<{0} &, T &>( result, value );
+    }}
+  }};
 
-   uint32_t size() const VULKAN_HPP_NOEXCEPT
-   {
-     return m_count;
-   }
+  template <typename T>
+  struct ResultValueType
+  {{
+    typedef ResultValue<T> type;
+  }};
 
-   T const * data() const VULKAN_HPP_NOEXCEPT
-   {
-     return m_ptr;
-   }
+  template <>
+  struct ResultValueType<void>
+  {{
+    typedef {0} type;
+  }};
 
- private:
-   uint32_t  m_count;
-   T const * m_ptr;
- };
+  VULKAN_HPP_INLINE typename ResultValueType<void>::type createResultValueType( {0} result )
+  {{
+    return result;
+  }}
 
-template <typename T>
- class ArrayProxyNoTemporaries
- {
- public:
-   VULKAN_HPP_CONSTEXPR ArrayProxyNoTemporaries() VULKAN_HPP_NOEXCEPT
-     : m_count( 0 )
-     , m_ptr( nullptr )
-   {
-   }
+  template <typename T>
+  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( {0} result, T & data )
+  {{
+    return ResultValue<T>( result, data );
+  }}
 
-   VULKAN_HPP_CONSTEXPR ArrayProxyNoTemporaries( std::nullptr_t ) VULKAN_HPP_NOEXCEPT
-     : m_count( 0 )
-     , m_ptr( nullptr )
-   {
-   }
+  template <typename T>
+  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( {0} result, T && data )
+  {{
+    return ResultValue<T>( result, std::move( data ) );
+  }}
+)" };
 
-   template <typename B = T, typename std::enable_if<std::is_convertible<B, T>::value && std::is_lvalue_reference<B>::value, int>::type = 0>
-   ArrayProxyNoTemporaries( B && value ) VULKAN_HPP_NOEXCEPT
-     : m_count( 1 )
-     , m_ptr( &value )
-   {
-   }
+static constexpr char const *RES_RESULT_VALUE_EXPECTED_VK{ R"(
+  VULKAN_HPP_INLINE typename ResultValueType<void>::type createResultValueType( VkResult result )
+  {
+    return static_cast<Result>( result );
+  }
 
-   ArrayProxyNoTemporaries( uint32_t count, T * ptr ) VULKAN_HPP_NOEXCEPT
-     : m_count( count )
-     , m_ptr( ptr )
-   {
-   }
+  template <typename T>
+  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( VkResult result, T & data )
+  {
+    return ResultValue<T>( static_cast<Result>( result ), data );
+  }
 
-   template <std::size_t C>
-   ArrayProxyNoTemporaries( T ( &ptr )[C] ) VULKAN_HPP_NOEXCEPT
-     : m_count( C )
-     , m_ptr( ptr )
-   {
-   }
+  template <typename T>
+  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( VkResult result, T && data )
+  {
+    return ResultValue<T>( static_cast<Result>( result ), std::move( data ) );
+  }
+)" };
 
-   template <std::size_t C>
-   ArrayProxyNoTemporaries( T ( &&ptr )[C] ) = delete;
+static constexpr char const *RES_FLAT_STRUCTURE_CHAIN{ R"(
+  template <typename Head, typename...>
+  struct FlatStructureChainHead
+  {
+    using type = Head;
+  };
 
-   // Any l-value reference with a .data() return type implicitly convertible to T*, and a .size() return type implicitly convertible to size_t.
-   template <typename V,
-             typename std::enable_if<!std::is_convertible<decltype( std::declval<V>().begin() ), T *>::value &&
-                                       std::is_convertible<decltype( std::declval<V>().data() ), T *>::value &&
-                                       std::is_convertible<decltype( std::declval<V>().size() ), std::size_t>::value && std::is_lvalue_reference<V>::value,
-                                     int>::type = 0>
-   ArrayProxyNoTemporaries( V && v ) VULKAN_HPP_NOEXCEPT
-     : m_count( static_cast<uint32_t>( v.size() ) )
-     , m_ptr( v.data() )
-   {
-   }
-
-   // Any l-value reference with a .begin() return type implicitly convertible to T*, and a .size() return type implicitly convertible to size_t.
-   template <typename V,
-             typename std::enable_if<std::is_convertible<decltype( std::declval<V>().begin() ), T *>::value &&
-                                       std::is_convertible<decltype( std::declval<V>().size() ), std::size_t>::value && std::is_lvalue_reference<V>::value,
-                                     int>::type = 0>
-   ArrayProxyNoTemporaries( V && v ) VULKAN_HPP_NOEXCEPT
-     : m_count( static_cast<uint32_t>( v.size() ) )
-     , m_ptr( v.begin() )
-   {
-   }
-
-   const T * begin() const VULKAN_HPP_NOEXCEPT
-   {
-     return m_ptr;
-   }
+  // elements are stored in single buffer at constexpr offsets, links are kept as bitmask
+  template <typename... ChainElements>
+  class FlatStructureChain
+  {
+    static constexpr size_t count = sizeof...( ChainElements );
 
-   const T * end() const VULKAN_HPP_NOEXCEPT
-   {
-     return m_ptr + m_count;
-   }
+    static_assert( count <= 64, "FlatStructureChain supports at most 64 elements!" );
+    static_assert( ( std::is_trivially_copyable<ChainElements>::value && ... ), "FlatStructureChain elements must be trivially copyable!" );
 
-   const T & front() const VULKAN_HPP_NOEXCEPT
-   {
-     VULKAN_HPP_ASSERT( m_count && m_ptr );
-     return *m_ptr;
-   }
+    using Head = typename FlatStructureChainHead<ChainElements...>::type;
 
-   const T & back() const VULKAN_HPP_NOEXCEPT
-   {
-     VULKAN_HPP_ASSERT( m_count && m_ptr );
-     return *( m_ptr + m_count - 1 );
-   }
+    struct Layout
+    {
+      size_t offsets[count];
+      size_t size;
+    };
 
-   bool empty() const VULKAN_HPP_NOEXCEPT
-   {
-     return ( m_count == 0 );
-   }
+    static constexpr Layout layout = []() {
+      Layout       l        = {};
+      size_t const sizes[]  = { sizeof( ChainElements )... };
+      size_t const aligns[] = { alignof( ChainElements )... };
+      size_t       offset   = 0;
+      for ( size_t i = 0; i < count; ++i )
+      {
+        offset       = ( offset + aligns[i] - 1 ) / aligns[i] * aligns[i];
+        l.offsets[i] = offset;
+        offset += sizes[i];
+      }
+      l.size = offset;
+      return l;
+    }();
 
-   uint32_t size() const VULKAN_HPP_NOEXCEPT
-   {
-     return m_count;
-   }
+    static constexpr uint64_t allLinked = count == 64 ? ~uint64_t( 0 ) : ( uint64_t( 1 ) << count ) - 1;
 
-   T * data() const VULKAN_HPP_NOEXCEPT
-   {
-     return m_ptr;
-   }
+    template <typename T, size_t Which>
+    static constexpr size_t indexOf() VULKAN_HPP_NOEXCEPT
+    {
+      bool const matches[] = { std::is_same<T, ChainElements>::value... };
+      size_t     n         = Which;
+      for ( size_t i = 0; i < count; ++i )
+      {
+        if ( matches[i] && n-- == 0 )
+        {
+          return i;
+        }
+      }
+      return count;
+    }
 
- private:
-   uint32_t m_count;
-   T *      m_ptr;
- };
+  public:
+    FlatStructureChain() VULKAN_HPP_NOEXCEPT : FlatStructureChain( ChainElements()... ) {}
 
- template <typename T>
- class StridedArrayProxy : protected ArrayProxy<T>
- {
- public:
-   using ArrayProxy<T>::ArrayProxy;
+    FlatStructureChain( ChainElements const &... elems ) VULKAN_HPP_NOEXCEPT
+    {
+      static_assert( StructureChainValidation<sizeof...( ChainElements ) - 1, ChainElements...>::valid, "The structure chain is not valid!" );
+      construct( std::make_index_sequence<count>(), elems... );
+      link();
+    }
 
-   StridedArrayProxy( uint32_t count, T const * ptr, uint32_t stride ) VULKAN_HPP_NOEXCEPT
-     : ArrayProxy<T>( count, ptr )
-     , m_stride( stride )
-   {
-     VULKAN_HPP_ASSERT( sizeof( T ) <= stride );
-   }
+    FlatStructureChain( FlatStructureChain const & rhs ) VULKAN_HPP_NOEXCEPT : m_linked( rhs.m_linked )
+    {
+      std::memcpy( m_storage, rhs.m_storage, sizeof( m_storage ) );
+      link();
+    }
 
-   using ArrayProxy<T>::begin;
+    FlatStructureChain & operator=( FlatStructureChain const & rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      std::memcpy( m_storage, rhs.m_storage, sizeof( m_storage ) );
+      m_linked = rhs.m_linked;
+      link();
+      return *this;
+    }
 
-   const T * end() const VULKAN_HPP_NOEXCEPT
-   {
-     return reinterpret_cast<T const *>( static_cast<uint8_t const *>( begin() ) + size() * m_stride );
-   }
+    template <typename T = Head, size_t Which = 0>
+    T & get() VULKAN_HPP_NOEXCEPT
+    {
+      constexpr size_t index = indexOf<T, Which>();
+      static_assert( index < count, "Structure is not part of this FlatStructureChain!" );
+      return *reinterpret_cast<T *>( m_storage + layout.offsets[index] );
+    }
 
-   using ArrayProxy<T>::front;
+    template <typename T = Head, size_t Which = 0>
+    T const & get() const VULKAN_HPP_NOEXCEPT
+    {
+      constexpr size_t index = indexOf<T, Which>();
+      static_assert( index < count, "Structure is not part of this FlatStructureChain!" );
+      return *reinterpret_cast<T const *>( m_storage + layout.offsets[index] );
+    }
 
-   const T & back() const VULKAN_HPP_NOEXCEPT
-   {
-     VULKAN_HPP_ASSERT( begin() && size() );
-     return *reinterpret_cast<T const *>( static_cast<uint8_t const *>( begin() ) + ( size() - 1 ) * m_stride );
-   }
+    template <typename T0, typename T1, typename... Ts>
+    std::tuple<T0 &, T1 &, Ts &...> get() VULKAN_HPP_NOEXCEPT
+    {
+      return std::tie( get<T0>(), get<T1>(), get<Ts>()... );
+    }
 
-   using ArrayProxy<T>::empty;
-   using ArrayProxy<T>::size;
-   using ArrayProxy<T>::data;
+    template <typename T0, typename T1, typename... Ts>
+    std::tuple<T0 const &, T1 const &, Ts const &...> get() const VULKAN_HPP_NOEXCEPT
+    {
+      return std::tie( get<T0>(), get<T1>(), get<Ts>()... );
+    }
 
-   uint32_t stride() const
-   {
-     return m_stride;
-   }
+    template <typename ClassType, size_t Which = 0>
+    bool isLinked() const VULKAN_HPP_NOEXCEPT
+    {
+      constexpr size_t index = indexOf<ClassType, Which>();
+      static_assert( index < count, "Structure is not part of this FlatStructureChain!" );
+      return ( m_linked >> index ) & 1;
+    }
 
- private:
-   uint32_t m_stride = sizeof( T );
- };
-)" };
+    template <typename ClassType, size_t Which = 0>
+    void relink() VULKAN_HPP_NOEXCEPT
+    {
+      constexpr size_t index = indexOf<ClassType, Which>();
+      static_assert( index != 0 && index < count, "Can't relink Structure that's not part of this FlatStructureChain!" );
+      VULKAN_HPP_ASSERT( ( ( m_linked >> index ) & 1 ) == 0 );
+      m_linked |= uint64_t( 1 ) << index;
+      link();
+    }
 
-static constexpr char const *RES_ARRAY_WRAPPER{ R"(
-  template <typename T, size_t N>
-  class ArrayWrapper1D : public std::array<T, N>
-  {
-  public:
-    VULKAN_HPP_CONSTEXPR ArrayWrapper1D() VULKAN_HPP_NOEXCEPT : std::array<T, N>() {}
+    template <typename ClassType, size_t Which = 0>
+    void unlink() VULKAN_HPP_NOEXCEPT
+    {
+      constexpr size_t index = indexOf<ClassType, Which>();
+      static_assert( index != 0 && index < count, "Can't unlink Structure that's not part of this FlatStructureChain!" );
+      VULKAN_HPP_ASSERT( ( ( m_linked >> index ) & 1 ) != 0 );
+      m_linked &= ~( uint64_t( 1 ) << index );
+      link();
+    }
 
-    VULKAN_HPP_CONSTEXPR ArrayWrapper1D( std::array<T, N> const & data ) VULKAN_HPP_NOEXCEPT : std::array<T, N>( data ) {}
+  private:
+    VkBaseOutStructure * element( size_t index ) VULKAN_HPP_NOEXCEPT
+    {
+      return reinterpret_cast<VkBaseOutStructure *>( m_storage + layout.offsets[index] );
+    }
 
-#if ( VK_USE_64_BIT_PTR_DEFINES == 0 )
-    // on 32 bit compiles, needs overloads on index type int to resolve ambiguities
-    VULKAN_HPP_CONSTEXPR T const & operator[]( int index ) const VULKAN_HPP_NOEXCEPT
+    template <size_t... I>
+    void construct( std::index_sequence<I...>, ChainElements const &... elems ) VULKAN_HPP_NOEXCEPT
     {
-      return std::array<T, N>::operator[]( index );
+      ( ::new ( m_storage + layout.offsets[I] ) ChainElements( elems ), ... );
     }
 
-    T & operator[]( int index ) VULKAN_HPP_NOEXCEPT
+    void link() VULKAN_HPP_NOEXCEPT
     {
-      return std::array<T, N>::operator[]( index );
+      link( std::make_index_sequence<count>() );
     }
-#endif
 
-    operator T const *() const VULKAN_HPP_NOEXCEPT
+    // rebuilds pNext from last element to head, skips unlinked elements
+    template <size_t... I>
+    void link( std::index_sequence<I...> ) VULKAN_HPP_NOEXCEPT
     {
-      return this->data();
+      VkBaseOutStructure * next = nullptr;
+      ( linkElement( count - 1 - I, next ), ... );
     }
 
-    operator T *() VULKAN_HPP_NOEXCEPT
+    void linkElement( size_t index, VkBaseOutStructure *& next ) VULKAN_HPP_NOEXCEPT
     {
-      return this->data();
+      if ( ( m_linked >> index ) & 1 )
+      {
+        element( index )->pNext = next;
+        next                    = element( index );
+      }
     }
 
-    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
-    operator std::string() const
+    alignas( ChainElements... ) unsigned char m_storage[layout.size];
+    uint64_t m_linked = allLinked;
+  };
+)" };
+
+static constexpr char const *RES_HASH{ R"(
+  //============
+  //=== HASH ===
+  //============
+
+  template <typename T>
+  typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value>::type
+    hashCombine( std::size_t & seed, T const & value ) VULKAN_HPP_NOEXCEPT
+  {
+    seed ^= std::hash<T>{}( value ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+  }
+
+  template <typename BitType>
+  void hashCombine( std::size_t & seed, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
+  {
+    hashCombine( seed, static_cast<typename Flags<BitType>::MaskType>( flags ) );
+  }
+
+  namespace detail
+  {
+    inline void hashBytes( std::size_t & seed, void const * data, std::size_t size ) VULKAN_HPP_NOEXCEPT
     {
-      return std::string( this->data() );
+      hashCombine( seed, std::hash<std::string_view>{}( std::string_view( static_cast<char const *>( data ), size ) ) );
     }
 
-#if 17 <= VULKAN_HPP_CPP_VERSION
-    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
-    operator std::string_view() const
+    inline void hashString( std::size_t & seed, char const * str ) VULKAN_HPP_NOEXCEPT
     {
-      return std::string_view( this->data() );
+      hashCombine( seed, str ? std::hash<std::string_view>{}( std::string_view( str ) ) : std::size_t( 0 ) );
     }
+
+    // hashes every known structure in pNext chain, unknown structures by sType only
+    inline void hashChain( std::size_t & seed, void const * pNext ) VULKAN_HPP_NOEXCEPT;
+  }  // namespace detail
+)" };
+
+static constexpr char const *RES_FORMAT{ R"(
+  //==============
+  //=== FORMAT ===
+  //==============
+
+#if !defined( VULKAN_HPP_FORMAT_DEPTH )
+#  define VULKAN_HPP_FORMAT_DEPTH 4
 #endif
 
-#if defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
-    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
-    std::strong_ordering operator<=>( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+  namespace detail
+  {
+    template <typename OutputIt>
+    OutputIt formatText( OutputIt out, std::string_view str )
     {
-      return *static_cast<std::array<char, N> const *>( this ) <=> *static_cast<std::array<char, N> const *>( &rhs );
+      for ( char c : str )
+      {
+        *out++ = c;
+      }
+      return out;
     }
-#else
-    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
-    bool operator<( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+
+    template <typename OutputIt, typename T>
+    OutputIt formatValue( OutputIt out, T value )
     {
-      return *static_cast<std::array<char, N> const *>( this ) < *static_cast<std::array<char, N> const *>( &rhs );
+      if constexpr ( std::is_pointer<T>::value )
+      {
+        if ( !value )
+        {
+          return formatText( out, "null" );
+        }
+        char       buffer[2 + 2 * sizeof( void * )] = { '0', 'x' };
+        auto const result = std::to_chars( buffer + 2, buffer + sizeof( buffer ), reinterpret_cast<uintptr_t>( value ), 16 );
+        return formatText( out, std::string_view( buffer, result.ptr - buffer ) );
+      }
+      else if constexpr ( std::is_enum<T>::value )
+      {
+        return formatValue( out, static_cast<typename std::underlying_type<T>::type>( value ) );
+      }
+      else
+      {
+        char       buffer[32];
+        auto const result = std::to_chars( buffer, buffer + sizeof( buffer ), value );
+        return formatText( out, std::string_view( buffer, result.ptr - buffer ) );
+      }
     }
 
-    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
-    bool operator<=( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    template <typename OutputIt>
+    OutputIt formatString( OutputIt out, char const * str, size_t maxSize = ~size_t( 0 ) )
     {
-      return *static_cast<std::array<char, N> const *>( this ) <= *static_cast<std::array<char, N> const *>( &rhs );
+      if ( !str )
+      {
+        return formatText( out, "null" );
+      }
+      *out++ = '"';
+      for ( size_t i = 0; i < maxSize && str[i]; ++i )
+      {
+        *out++ = str[i];
+      }
+      *out++ = '"';
+      return out;
     }
 
-    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
-    bool operator>( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    template <typename OutputIt>
+    OutputIt formatBytes( OutputIt out, void const * data, size_t size )
     {
-      return *static_cast<std::array<char, N> const *>( this ) > *static_cast<std::array<char, N> const *>( &rhs );
+      static constexpr char digits[] = "0123456789abcdef";
+      out = formatText( out, "0x" );
+      for ( size_t i = 0; i < size; ++i )
+      {
+        uint8_t const byte = static_cast<uint8_t const *>( data )[i];
+        *out++             = digits[byte >> 4];
+        *out++             = digits[byte & 15];
+      }
+      return out;
     }
 
-    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
-    bool operator>=( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    template <typename OutputIt, typename T>
+    OutputIt formatEnum( OutputIt out, T value )
     {
-      return *static_cast<std::array<char, N> const *>( this ) >= *static_cast<std::array<char, N> const *>( &rhs );
+      std::string_view const name = to_string_view( value );
+      return name.empty() ? formatValue( out, value ) : formatText( out, name );
     }
-#endif
 
-    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
-    bool operator==( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    template <typename T>
+    struct StructFormatter
     {
-      return *static_cast<std::array<char, N> const *>( this ) == *static_cast<std::array<char, N> const *>( &rhs );
-    }
+      template <typename ParseContext>
+      constexpr auto parse( ParseContext & ctx )
+      {
+        return ctx.begin();
+      }
 
-    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
-    bool operator!=( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+      template <typename FormatContext>
+      auto format( T const & value, FormatContext & ctx ) const
+      {
+        return formatTo( ctx.out(), value );
+      }
+    };
+  }  // namespace detail
+)" };
+
+static constexpr char const *RES_CHAIN_VISITOR{ R"(
+  namespace detail
+  {
+    template <typename Visitor, typename Base, typename T>
+    void visitStructure( Base * structure, Visitor & visitor )
     {
-      return *static_cast<std::array<char, N> const *>( this ) != *static_cast<std::array<char, N> const *>( &rhs );
+      using Type = typename std::conditional<std::is_const<Base>::value, T const, T>::type;
+      if constexpr ( std::is_invocable<Visitor &, Type &>::value )
+      {
+        visitor( *reinterpret_cast<Type *>( structure ) );
+      }
+      else if constexpr ( std::is_invocable<Visitor &, Base &>::value )
+      {
+        visitor( *structure );
+      }
     }
-  };
+  }  // namespace detail
 
-  // specialization of relational operators between std::string and arrays of chars
-  template <size_t N>
-  bool operator<( std::string const & lhs, ArrayWrapper1D<char, N> const & rhs ) VULKAN_HPP_NOEXCEPT
+  VULKAN_HPP_CONSTEXPR size_t sizeofStructureType( VkStructureType sType ) VULKAN_HPP_NOEXCEPT
   {
-    return lhs < rhs.data();
+    return detail::structureTypeSizes[detail::structureTypeSlot( sType )];
   }
 
-  template <size_t N>
-  bool operator<=( std::string const & lhs, ArrayWrapper1D<char, N> const & rhs ) VULKAN_HPP_NOEXCEPT
+  // calls visitor with typed reference of every structure in pNext chain,
+  // unknown structures are passed as VkBaseOutStructure if visitor accepts it
+  template <typename Visitor>
+  void visitChain( void * chain, Visitor && visitor )
   {
-    return lhs <= rhs.data();
+    using Table = detail::StructureVisitTable<typename std::remove_reference<Visitor>::type, VkBaseOutStructure>;
+    for ( auto * s = reinterpret_cast<VkBaseOutStructure *>( chain ); s; s = s->pNext )
+    {
+      Table::table[detail::structureTypeSlot( s->sType )]( s, visitor );
+    }
   }
 
-  template <size_t N>
-  bool operator>( std::string const & lhs, ArrayWrapper1D<char, N> const & rhs ) VULKAN_HPP_NOEXCEPT
+  template <typename Visitor>
+  void visitChain( void const * chain, Visitor && visitor )
   {
-    return lhs > rhs.data();
+    using Table = detail::StructureVisitTable<typename std::remove_reference<Visitor>::type, VkBaseInStructure const>;
+    for ( auto const * s = reinterpret_cast<VkBaseInStructure const *>( chain ); s; s = s->pNext )
+    {
+      Table::table[detail::structureTypeSlot( s->sType )]( s, visitor );
+    }
   }
 
-  template <size_t N>
-  bool operator>=( std::string const & lhs, ArrayWrapper1D<char, N> const & rhs ) VULKAN_HPP_NOEXCEPT
+  // bytes needed by deepCopyChain, 0 if chain contains unknown structure
+  inline size_t deepCopyChainSize( void const * chain ) VULKAN_HPP_NOEXCEPT
   {
-    return lhs >= rhs.data();
+    size_t total = 0;
+    for ( auto const * s = reinterpret_cast<VkBaseInStructure const *>( chain ); s; s = s->pNext )
+    {
+      size_t size = sizeofStructureType( s->sType );
+      if ( size == 0 )
+      {
+        return 0;
+      }
+      total += ( size + alignof( std::max_align_t ) - 1 ) & ~( alignof( std::max_align_t ) - 1 );
+    }
+    return total + alignof( std::max_align_t ) - 1;
   }
 
-  template <size_t N>
-  bool operator==( std::string const & lhs, ArrayWrapper1D<char, N> const & rhs ) VULKAN_HPP_NOEXCEPT
+  // copies every structure of chain into arena and links the copies,
+  // pointers inside the structures are not followed
+  // returns nullptr if arena is too small or chain contains unknown structure
+  inline VkBaseOutStructure * deepCopyChain( void const * chain, void * arena, size_t arenaSize, size_t * usedSize = nullptr ) VULKAN_HPP_NOEXCEPT
   {
-    return lhs == rhs.data();
+    VkBaseOutStructure *  head   = nullptr;
+    VkBaseOutStructure ** link   = &head;
+    uintptr_t const       begin  = reinterpret_cast<uintptr_t>( arena );
+    uintptr_t             offset = begin;
+    for ( auto const * s = reinterpret_cast<VkBaseInStructure const *>( chain ); s; s = s->pNext )
+    {
+      size_t const size = sizeofStructureType( s->sType );
+      offset            = ( offset + alignof( std::max_align_t ) - 1 ) & ~uintptr_t( alignof( std::max_align_t ) - 1 );
+      if ( size == 0 || offset + size > begin + arenaSize )
+      {
+        return nullptr;
+      }
+      auto * dst = reinterpret_cast<VkBaseOutStructure *>( offset );
+      std::memcpy( dst, s, size );
+      *link = dst;
+      link  = &dst->pNext;
+      offset += size;
+    }
+    *link = nullptr;
+    if ( usedSize )
+    {
+      *usedSize = offset - begin;
+    }
+    return head;
   }
+)" };
 
-  template <size_t N>
-  bool operator!=( std::string const & lhs, ArrayWrapper1D<char, N> const & rhs ) VULKAN_HPP_NOEXCEPT
-  {
-    return lhs != rhs.data();
-  }
+static constexpr char const *RES_ENUM_STRING_TABLES{ R"(
+  //==========================
+  //=== ENUM STRING TABLES ===
+  //==========================
 
-  template <typename T, size_t N, size_t M>
-  class ArrayWrapper2D : public std::array<ArrayWrapper1D<T, M>, N>
+  namespace detail
   {
-  public:
-    VULKAN_HPP_CONSTEXPR ArrayWrapper2D() VULKAN_HPP_NOEXCEPT : std::array<ArrayWrapper1D<T, M>, N>() {}
+    struct EnumName
+    {
+      int64_t          value;
+      std::string_view name;
+    };
 
-    VULKAN_HPP_CONSTEXPR ArrayWrapper2D( std::array<std::array<T, M>, N> const & data ) VULKAN_HPP_NOEXCEPT
-      : std::array<ArrayWrapper1D<T, M>, N>( *reinterpret_cast<std::array<ArrayWrapper1D<T, M>, N> const *>( &data ) )
+    struct EnumNames
     {
-    }
-  };
-)" };
+      EnumName const * data;
+      size_t           size;
+    };
 
-static constexpr char const *RES_VECTOR{ R"(
+    // names are sorted by value
+    VULKAN_HPP_CONSTEXPR_14 std::string_view findEnumName( EnumNames names, int64_t value ) VULKAN_HPP_NOEXCEPT
+    {
+      EnumName const * first = names.data;
+      size_t           count = names.size;
+      while ( count > 0 )
+      {
+        size_t const half = count / 2;
+        if ( first[half].value < value )
+        {
+          first += half + 1;
+          count -= half + 1;
+        }
+        else
+        {
+          count = half;
+        }
+      }
+      return ( first != names.data + names.size && first->value == value ) ? first->name : std::string_view();
+    }
 
-namespace detail {
-  template<typename T>
-  class Iterator
-  {
-  public:
-    using value_type = std::remove_cv<T>::type;
-    using element_type = std::add_cv<T>::type;
-    using pointer    = T*;
-    using reference  = T&;
-    using difference_type = std::ptrdiff_t;
-    using iterator_category=std::random_access_iterator_tag;
-    using iterator_concept=std::contiguous_iterator_tag;
+    // seeded FNV-1a, seed and table size are picked by generator so names of one enum do not collide
+    VULKAN_HPP_CONSTEXPR_14 uint32_t hashEnumName( std::string_view name, uint32_t seed ) VULKAN_HPP_NOEXCEPT
+    {
+      uint32_t hash = 2166136261u ^ seed;
+      for ( char c : name )
+      {
+        hash = ( hash ^ static_cast<uint8_t>( c ) ) * 16777619u;
+      }
+      return hash ^ ( hash >> 15 );
+    }
 
-    Iterator() : v(nullptr) {}
-    Iterator(reference r) : v(&r) {}
-    Iterator(pointer p) : v(p) {}
+    template <typename OutputIt>
+    OutputIt writeString( OutputIt out, std::string_view str )
+    {
+      for ( char c : str )
+      {
+        *out++ = c;
+      }
+      return out;
+    }
 
-    reference                 operator*()             { return *v; }
-    // std::add_const<reference> operator*()       const { return *v; }
-    pointer                   operator->()  const          { return v; }
-    // std::add_const<pointer>   operator->()      const { return v; }
-    reference                 operator[](difference_type m) const { return *(v + m); }
-    // std::add_const<reference> operator[](difference_type m) const { return *(v + m); }
+    template <typename OutputIt>
+    OutputIt writeFlags( OutputIt out, uint64_t value, EnumNames names )
+    {
+      if ( !value )
+      {
+        return writeString( out, "{}" );
+      }
+      out        = writeString( out, "{ " );
+      bool first = true;
+      for ( size_t i = 0; i < names.size; ++i )
+      {
+        if ( value & static_cast<uint64_t>( names.data[i].value ) )
+        {
+          if ( !first )
+          {
+            out = writeString( out, " | " );
+          }
+          out   = writeString( out, names.data[i].name );
+          first = false;
+        }
+      }
+      return writeString( out, " }" );
+    }
 
-    friend reference operator*(const Iterator& it) { return *(it.v); }
+    VULKAN_HPP_CONSTEXPR_14 std::string_view trimEnumName( std::string_view str ) VULKAN_HPP_NOEXCEPT
+    {
+      while ( !str.empty() && ( str.front() == ' ' || str.front() == '{' ) )
+      {
+        str.remove_prefix( 1 );
+      }
+      while ( !str.empty() && ( str.back() == ' ' || str.back() == '}' ) )
+      {
+        str.remove_suffix( 1 );
+      }
+      return str;
+    }
+  }  // namespace detail
 
-    friend Iterator operator+(difference_type diff, const Iterator& it) { return it + diff; }
-    friend Iterator operator-(difference_type diff, const Iterator& it) { return it - diff; }
+  template <typename T>
+  std::optional<T> from_string( std::string_view name ) VULKAN_HPP_NOEXCEPT;
 
-    Iterator& operator++()       { ++v; return *this; }
-    Iterator& operator--()       { --v; return *this; }
-    Iterator  operator++(int)    { Iterator it(*this); ++v; return it; }
-    Iterator  operator--(int)    { Iterator it(*this); --v; return it; }
+  namespace detail
+  {
+    // parses "{ A | B }" as written by to_string, braces are optional
+    template <typename BitType>
+    std::optional<Flags<BitType>> parseFlags( std::string_view str ) VULKAN_HPP_NOEXCEPT
+    {
+      Flags<BitType> flags;
+      str = trimEnumName( str );
+      while ( !str.empty() )
+      {
+        size_t const           end = str.find( '|' );
+        std::optional<BitType> bit = from_string<BitType>( trimEnumName( str.substr( 0, end ) ) );
+        if ( !bit )
+        {
+          return std::nullopt;
+        }
+        flags |= *bit;
+        str = end == std::string_view::npos ? std::string_view() : str.substr( end + 1 );
+      }
+      return flags;
+    }
+  }  // namespace detail
 
-    Iterator& operator+=(difference_type  n)  { v += n; return *this; }
-    Iterator& operator-=(difference_type  n)  { v -= n; return *this; }
+  // writes same text as to_string( Flags ) without allocation, enumNames() is found by ADL
+  template <typename OutputIt, typename BitType>
+  OutputIt to_string( OutputIt out, Flags<BitType> value )
+  {
+    return detail::writeFlags( out, static_cast<uint64_t>( static_cast<typename Flags<BitType>::MaskType>( value ) ), enumNames( BitType() ) );
+  }
+)" };
 
-    Iterator operator+(difference_type  n)   const { Iterator it(*this); return it += n;}
-    Iterator operator-(difference_type  n)   const { Iterator it(*this); return it -= n;}
+static constexpr char const *RES_ENUM_FORMATTERS{ R"(
+#if defined( __cpp_lib_format )
+#  include <format>
 
-    difference_type operator-(const Iterator& it) const { return v - it.v; }
+template <typename T>
+  requires( std::is_enum_v<T> && requires( T value ) {{ {0}::to_string_view( value ); }} )
+struct std::formatter<T, char> : std::formatter<std::string_view, char>
+{{
+  template <typename FormatContext>
+  auto format( T value, FormatContext & ctx ) const
+  {{
+    return std::formatter<std::string_view, char>::format( {0}::to_string_view( value ), ctx );
+  }}
+}};
 
-    bool operator<(Iterator const& it)  const { return v <  it.v; }
-    bool operator<=(Iterator const& it) const { return v <= it.v; }
-    bool operator>(Iterator const& it)  const { return v >  it.v; }
-    bool operator>=(Iterator const& it) const { return v >= it.v; }
-    bool operator!=(const Iterator &it) const { return v != it.v; }
-    bool operator==(const Iterator &it) const { return v == it.v; }
+template <typename BitType>
+struct std::formatter<{0}::Flags<BitType>, char>
+{{
+  constexpr auto parse( std::format_parse_context & ctx )
+  {{
+    return ctx.begin();
+  }}
 
-  private:
-    pointer v;
-  };
-}
+  template <typename FormatContext>
+  auto format( {0}::Flags<BitType> value, FormatContext & ctx ) const
+  {{
+    return {0}::to_string( ctx.out(), value );
+  }}
+}};
+#endif
 
-template<typename T, size_t N = 0, bool s = N != 0>
-class Vector;
+#if defined( FMT_VERSION )
+namespace {0}
+{{
+  namespace detail
+  {{
+    template <typename T, typename = void>
+    struct HasStringTable : std::false_type
+    {{
+    }};
 
-template<typename T, size_t N>
-class Vector<T, N, true> {
+    template <typename T>
+    struct HasStringTable<T, decltype( void( {0}::to_string_view( T() ) ) )> : std::is_enum<T>
+    {{
+    }};
+  }}  // namespace detail
+}}  // namespace {0}
 
-  using value_type = T;
-  using reference = value_type&;
-  using const_reference = const value_type&;
-  using iterator = detail::Iterator<T>;
-  using const_iterator = detail::Iterator<T>;
+template <typename T>
+struct fmt::formatter<T, char, std::enable_if_t<{0}::detail::HasStringTable<T>::value>> : fmt::formatter<fmt::string_view, char>
+{{
+  template <typename FormatContext>
+  auto format( T value, FormatContext & ctx ) const
+  {{
+    std::string_view const name = {0}::to_string_view( value );
+    return fmt::formatter<fmt::string_view, char>::format( fmt::string_view( name.data(), name.size() ), ctx );
+  }}
+}};
 
-  T *m_begin = buffer;
-  T *m_end   = buffer;
-  size_t cap = N;
-  T buffer[N];
+template <typename BitType>
+struct fmt::formatter<{0}::Flags<BitType>, char>
+{{
+  constexpr auto parse( fmt::format_parse_context & ctx )
+  {{
+    return ctx.begin();
+  }}
 
-  void deallocate_storage() noexcept(std::is_nothrow_destructible_v<T>) {
-    clear();
-    if (m_begin && m_begin != buffer) {
-      std::allocator<T>().deallocate(m_begin, cap);
-    }
-    m_begin = buffer;
-    m_end   = buffer;
-    cap     = N;
-  }
+  template <typename FormatContext>
+  auto format( {0}::Flags<BitType> value, FormatContext & ctx ) const
+  {{
+    return {0}::to_string( ctx.out(), value );
+  }}
+}};
+#endif
+)" };
 
-#if __cpp_lib_allocate_at_least
-  using allocation_result = std::allocation_result<T*>;
-  static allocation_result allocate(size_t count) {
-    return std::allocator<T>().allocate_at_least(count);
-  }
+static constexpr char const *RES_RESULT_CHECK{ R"(
+  VULKAN_HPP_INLINE void resultCheck( VkResult result, char const * message )
+  {{
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    ignore( result );  // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
+    ignore( message );
+    VULKAN_HPP_ASSERT_ON_RESULT( result == VK_SUCCESS );
 #else
-  struct allocation_result {
-    T *ptr;
-    size_t count;
-  };
-  static allocation_result allocate(size_t count) {
-    return { std::allocator<T>().allocate(count), count };
-  }
+    if ( result != VK_SUCCESS ){0}
+    {{
+      detail::throwResultException( result, message );
+    }}
 #endif
+  }}
 
-  void set_storage(const allocation_result &alloc, size_t size) noexcept {
-    m_begin = alloc.ptr;
-    m_end = alloc.ptr + size;
-    cap = alloc.count;
-  }
+  VULKAN_HPP_INLINE void resultCheck( VkResult result, char const * message, std::initializer_list<VkResult> successCodes )
+  {{
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    ignore( result );  // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
+    ignore( message );
+    ignore( successCodes );  // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
+    VULKAN_HPP_ASSERT_ON_RESULT( std::find( successCodes.begin(), successCodes.end(), result ) != successCodes.end() );
+#else
+    for (const auto &r : successCodes) {{
+        if (result == r) {{
+            return;
+        }}
+    }}
+    detail::throwResultException( result, message );
+#endif
+  }}
+)" };
 
-  void reallocate(size_t count, size_t size) {
-    auto alloc = allocate(count);
-    if (m_begin) {
-      std::memcpy(alloc.ptr, m_begin, this->size() * sizeof(T));
-      if (!is_inline()) {
-        std::allocator<T>().deallocate(m_begin, cap);
-      }
-    }
-    set_storage(alloc, size);
-  }
+static constexpr char const *RES_ARRAY_PROXY{ R"(
+template <typename T>
+ class ArrayProxy
+ {
+ public:
+   VULKAN_HPP_CONSTEXPR ArrayProxy() VULKAN_HPP_NOEXCEPT
+     : m_count( 0 )
+     , m_ptr( nullptr )
+   {
+   }
 
-  void reallocate(size_t count) {
-    reallocate(count, count);
-  }
+   VULKAN_HPP_CONSTEXPR ArrayProxy( std::nullptr_t ) VULKAN_HPP_NOEXCEPT
+     : m_count( 0 )
+     , m_ptr( nullptr )
+   {
+   }
 
-  template<size_t X>
-  void copy_items_from(Vector<T, X> &v) {
-    const T* src = v.m_begin;
-    for (auto* it = m_begin; it != m_end; ++it) {
-      *it = *src;
-      src++;
-    }
-  }
+   VULKAN_HPP_CONSTEXPR ArrayProxy( T const & value ) VULKAN_HPP_NOEXCEPT
+     : m_count( 1 )
+     , m_ptr( &value )
+   {
+   }
 
-  template<size_t X>
-  void move_items_from(Vector<T, X> &&v) {
-    T* src = v.m_begin;
-    for (auto* it = m_begin; it != m_end; ++it) {
-      *it = std::move(*src);
-      src++;
-    }
-  }
+   VULKAN_HPP_CONSTEXPR ArrayProxy( uint32_t count, T const * ptr ) VULKAN_HPP_NOEXCEPT
+     : m_count( count )
+     , m_ptr( ptr )
+   {
+   }
 
-  template<size_t X>
-  void move_from(Vector<T, X> &&v) {
-    if (v.is_inline()) {
-      unitialized_resize(v.size());
-      move_items_from(std::forward<Vector<T, X>>(v));
-      v.deallocate_storage();
-    } else {
-      std::swap(m_begin, v.m_begin);
-      std::swap(m_end, v.m_end);
-      std::swap(cap, v.cap);
-    }
-  }
+   template <std::size_t C>
+   VULKAN_HPP_CONSTEXPR ArrayProxy( T const ( &ptr )[C] ) VULKAN_HPP_NOEXCEPT
+     : m_count( C )
+     , m_ptr( ptr )
+   {
+   }
 
-  void destroy_items(T *begin, T *end) noexcept(std::is_nothrow_destructible_v<T>) {
-    for (auto* it = begin; it != end; ++it) {
-      std::destroy_at(it);
-      *it = {};
-    };
-  }
+#  if __GNUC__ >= 9
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Winit-list-lifetime"
+#  endif
 
-public:
-  constexpr Vector() = default;
+   VULKAN_HPP_CONSTEXPR_14 ArrayProxy( std::initializer_list<T> const & list ) VULKAN_HPP_NOEXCEPT
+     : m_count( static_cast<uint32_t>( list.size() ) )
+     , m_ptr( list.begin() )
+   {
+   }
 
-  template<size_t X>
-  constexpr Vector(Vector<T, X> &v) {
-    if (v.empty()) {
-      return;
-    }
-    reserve(v.size());
-    m_end = m_begin + v.size();
-    copy_items_from(v);
-  }
+   template <typename B = T, typename std::enable_if<std::is_const<B>::value, int>::type = 0>
+   VULKAN_HPP_CONSTEXPR_14 ArrayProxy( std::initializer_list<typename std::remove_const<T>::type> const & list ) VULKAN_HPP_NOEXCEPT
+     : m_count( static_cast<uint32_t>( list.size() ) )
+     , m_ptr( list.begin() )
+   {
+   }
 
-  template<size_t X>
-  constexpr Vector(Vector<T, X> &&v) noexcept {
-    move_from(std::forward<Vector<T, X>>(v));
-  }
+#  if __GNUC__ >= 9
+#    pragma GCC diagnostic pop
+#  endif
 
-  template<size_t X>
-  Vector& operator=(Vector<T, X> &v) {
-    if (this != &v) {
-      clear();
-      unitialized_resize(v.size());
-      copy_items_from(v);
-    }
-    return *this;
-  }
+   // Any type with a .data() return type implicitly convertible to T*, and a .size() return type implicitly
+   // convertible to size_t. The const version can capture temporaries, with lifetime ending at end of statement.
+   template <typename V,
+             typename std::enable_if<std::is_convertible<decltype( std::declval<V>().data() ), T *>::value &&
+                                     std::is_convertible<decltype( std::declval<V>().size() ), std::size_t>::value>::type * = nullptr>
+   VULKAN_HPP_CONSTEXPR_14 ArrayProxy( V const & v ) VULKAN_HPP_NOEXCEPT
+     : m_count( static_cast<uint32_t>( v.size() ) )
+     , m_ptr( v.data() )
+   {
+   }
 
-  template<size_t X>
-  Vector& operator=(Vector<T, X> &&v) {
-    if (this != &v) {
-      clear();
-      move_from(std::forward<Vector<T, X>>(v));
-    }
-    return *this;
-  }
+   VULKAN_HPP_CONSTEXPR const T * begin() const VULKAN_HPP_NOEXCEPT
+   {
+     return m_ptr;
+   }
 
-  constexpr explicit Vector(size_t s) {
-    resize(s);
-  }
+   VULKAN_HPP_CONSTEXPR const T * end() const VULKAN_HPP_NOEXCEPT
+   {
+     return m_ptr + m_count;
+   }
 
-  ~Vector() noexcept(std::is_nothrow_destructible_v<T>) {
-    deallocate_storage();
-  }
+   VULKAN_HPP_CONSTEXPR_14 const T & front() const VULKAN_HPP_NOEXCEPT
+   {
+     VULKAN_HPP_ASSERT( m_count && m_ptr );
+     return *m_ptr;
+   }
 
-  void clear() noexcept(std::is_nothrow_destructible_v<T>) {
-    if constexpr (!std::is_trivially_destructible_v<T>) {
-      for (auto* it = m_begin; it != m_end; ++it) {
-        std::destroy_at(it);
-      }
-    }
-    m_end = m_begin;
-  }
+   VULKAN_HPP_CONSTEXPR_14 const T & back() const VULKAN_HPP_NOEXCEPT
+   {
+     VULKAN_HPP_ASSERT( m_count && m_ptr );
+     return *( m_ptr + m_count - 1 );
+   }
 
-  void confirm(size_t s) { // deprecated
-     m_end = m_begin + s;
-  }
+   VULKAN_HPP_CONSTEXPR bool empty() const VULKAN_HPP_NOEXCEPT
+   {
+     return ( m_count == 0 );
+   }
 
-  void reserve(size_t s) {
-    if (s <= cap || s == 0) {
-      return;
-    }
-    reallocate(s, size());
-  }
+   VULKAN_HPP_CONSTEXPR uint32_t size() const VULKAN_HPP_NOEXCEPT
+   {
+     return m_count;
+   }
 
-  void resize(size_t s) {
-    size_t cs = size();
-    if (s < cs) {
-      if constexpr (!std::is_trivially_destructible_v<T>) {
-        auto *old = m_end;
-        m_end = m_begin + s;
-        destroy_items(m_end, old);
-      }
-      else {
-        m_end = m_begin + s;
-      }
-    }
-    else if (s > cs) {
-      T* it;
-      if (s > cap) {
-        reallocate(s);
-        it = m_begin + cs;
-      }
-      else {
-        it = m_end;
-        m_end = m_begin + s;
-      }
-      for (; it != m_end; ++it) {
-        std::construct_at(it);
-      }
-    }
-  }
+   VULKAN_HPP_CONSTEXPR T const * data() const VULKAN_HPP_NOEXCEPT
+   {
+     return m_ptr;
+   }
 
-  void unitialized_resize(size_t s) {
-    if constexpr (!std::is_trivially_destructible_v<T>) {
-      resize(s);
-      return;
-    }
+ private:
+   uint32_t  m_count;
+   T const * m_ptr;
+ };
 
-    size_t cs = size();
-    if (s < cs) {
-      m_end = m_begin + s;
-    }
-    else if (s > cs) {
-      if (s > cap) {
-        reallocate(s);
-      }
-      else {
-        m_end = m_begin + s;
-      }
-    }
-  }
+template <typename T>
+ class ArrayProxyNoTemporaries
+ {
+ public:
+   VULKAN_HPP_CONSTEXPR ArrayProxyNoTemporaries() VULKAN_HPP_NOEXCEPT
+     : m_count( 0 )
+     , m_ptr( nullptr )
+   {
+   }
 
-  constexpr bool is_inline() const noexcept {
-    return m_begin == buffer;
-  }
+   VULKAN_HPP_CONSTEXPR ArrayProxyNoTemporaries( std::nullptr_t ) VULKAN_HPP_NOEXCEPT
+     : m_count( 0 )
+     , m_ptr( nullptr )
+   {
+   }
 
-  size_t size() const noexcept {
-    return m_end - m_begin;
-  }
+   template <typename B = T, typename std::enable_if<std::is_convertible<B, T>::value && std::is_lvalue_reference<B>::value, int>::type = 0>
+   VULKAN_HPP_CONSTEXPR ArrayProxyNoTemporaries( B && value ) VULKAN_HPP_NOEXCEPT
+     : m_count( 1 )
+     , m_ptr( &value )
+   {
+   }
 
-  size_t capacity() const noexcept {
-    return cap;
-  }
+   VULKAN_HPP_CONSTEXPR ArrayProxyNoTemporaries( uint32_t count, T * ptr ) VULKAN_HPP_NOEXCEPT
+     : m_count( count )
+     , m_ptr( ptr )
+   {
+   }
 
-  constexpr size_t buffer_capacity() const {
-    return N;
-  }
+   template <std::size_t C>
+   VULKAN_HPP_CONSTEXPR ArrayProxyNoTemporaries( T ( &ptr )[C] ) VULKAN_HPP_NOEXCEPT
+     : m_count( C )
+     , m_ptr( ptr )
+   {
+   }
 
-  constexpr bool empty() const noexcept {
-    return m_begin == m_end;
-  }
+   template <std::size_t C>
+   ArrayProxyNoTemporaries( T ( &&ptr )[C] ) = delete;
 
-  constexpr T *data() noexcept {
-    return m_begin;
-  }
-  constexpr const T *data() const noexcept {
-    return m_begin;
-  }
+   // Any l-value reference with a .data() return type implicitly convertible to T*, and a .size() return type implicitly convertible to size_t.
+   template <typename V,
+             typename std::enable_if<!std::is_convertible<decltype( std::declval<V>().begin() ), T *>::value &&
+                                       std::is_convertible<decltype( std::declval<V>().data() ), T *>::value &&
+                                       std::is_convertible<decltype( std::declval<V>().size() ), std::size_t>::value && std::is_lvalue_reference<V>::value,
+                                     int>::type = 0>
+   VULKAN_HPP_CONSTEXPR_14 ArrayProxyNoTemporaries( V && v ) VULKAN_HPP_NOEXCEPT
+     : m_count( static_cast<uint32_t>( v.size() ) )
+     , m_ptr( v.data() )
+   {
+   }
 
-  iterator begin() noexcept {
-    return iterator{m_begin};
-  }
-  const_iterator begin() const noexcept {
-    return const_iterator{m_begin};
-  }
+   // Any l-value reference with a .begin() return type implicitly convertible to T*, and a .size() return type implicitly convertible to size_t.
+   template <typename V,
+             typename std::enable_if<std::is_convertible<decltype( std::declval<V>().begin() ), T *>::value &&
+                                       std::is_convertible<decltype( std::declval<V>().size() ), std::size_t>::value && std::is_lvalue_reference<V>::value,
+                                     int>::type = 0>
+   VULKAN_HPP_CONSTEXPR_14 ArrayProxyNoTemporaries( V && v ) VULKAN_HPP_NOEXCEPT
+     : m_count( static_cast<uint32_t>( v.size() ) )
+     , m_ptr( v.begin() )
+   {
+   }
 
-  iterator end() noexcept {
-    return iterator{m_end};
-  }
-  const_iterator end() const noexcept {
-    return const_iterator{m_end};
-  }
+   VULKAN_HPP_CONSTEXPR const T * begin() const VULKAN_HPP_NOEXCEPT
+   {
+     return m_ptr;
+   }
 
-  constexpr reference operator[](size_t n) noexcept {
-    assert(n < size() && "vector[] index out of bounds");
-    return m_begin[n];
-  }
-  constexpr const_reference operator[](size_t n) const noexcept {
-    assert(n < size() && "vector[] index out of bounds");
-    return m_begin[n];
-  }
+   VULKAN_HPP_CONSTEXPR const T * end() const VULKAN_HPP_NOEXCEPT
+   {
+     return m_ptr + m_count;
+   }
 
-  constexpr reference at(size_t n) {
-    if (n >= size())
-      throw std::out_of_range("vector");
-    return m_begin[n];
-  }
-  constexpr const_reference at(size_t n) const {
-    if (n >= size())
-      throw std::out_of_range("vector");
-    return m_begin[n];
-  }
+   VULKAN_HPP_CONSTEXPR_14 const T & front() const VULKAN_HPP_NOEXCEPT
+   {
+     VULKAN_HPP_ASSERT( m_count && m_ptr );
+     return *m_ptr;
+   }
 
-  constexpr reference front() noexcept {
-    assert(!empty() && "front() called on an empty vector");
-    return *m_begin;
-  }
-  constexpr const_reference front() const noexcept {
-    assert(!empty() && "front() called on an empty vector");
-    return *m_begin;
-  }
+   VULKAN_HPP_CONSTEXPR_14 const T & back() const VULKAN_HPP_NOEXCEPT
+   {
+     VULKAN_HPP_ASSERT( m_count && m_ptr );
+     return *( m_ptr + m_count - 1 );
+   }
 
-  constexpr reference back() noexcept {
-    assert(!empty() && "back() called on an empty vector");
-    return *(m_end - 1);
-  }
-  constexpr const_reference back() const noexcept {
-    assert(!empty() && "back() called on an empty vector");
-    return *(m_end - 1);
-  }
-};
+   VULKAN_HPP_CONSTEXPR bool empty() const VULKAN_HPP_NOEXCEPT
+   {
+     return ( m_count == 0 );
+   }
 
-template<typename T, size_t N>
-class Vector<T, N, false> {
+   VULKAN_HPP_CONSTEXPR uint32_t size() const VULKAN_HPP_NOEXCEPT
+   {
+     return m_count;
+   }
 
-  using value_type = T;
-  using reference = value_type&;
-  using const_reference = const value_type&;
-  using iterator = detail::Iterator<T>;
-  using const_iterator = detail::Iterator<T>;
+   VULKAN_HPP_CONSTEXPR T * data() const VULKAN_HPP_NOEXCEPT
+   {
+     return m_ptr;
+   }
 
-  T *m_begin = {};
-  T *m_end   = {};
-  size_t cap = 0;
+ private:
+   uint32_t m_count;
+   T *      m_ptr;
+ };
 
-  void deallocate_storage() noexcept(std::is_nothrow_destructible_v<T>) {
-    if (m_begin) {
-      clear();
-      std::allocator<T>().deallocate(m_begin, cap);
-      m_begin = {};
-      m_end   = {};
-      cap     = 0;
-    }
-  }
+ template <typename T>
+ class StridedArrayProxy : protected ArrayProxy<T>
+ {
+ public:
+   using ArrayProxy<T>::ArrayProxy;
 
-#if __cpp_lib_allocate_at_least
-  using allocation_result = std::allocation_result<T*>;
-  static allocation_result allocate(size_t count) {
-    return std::allocator<T>().allocate_at_least(count);
-  }
-#else
-  struct allocation_result {
-    T *ptr;
-    size_t count;
-  };
-  static allocation_result allocate(size_t count) {
-    return { std::allocator<T>().allocate(count), count };
-  }
-#endif
+   StridedArrayProxy( uint32_t count, T const * ptr, uint32_t stride ) VULKAN_HPP_NOEXCEPT
+     : ArrayProxy<T>( count, ptr )
+     , m_stride( stride )
+   {
+     VULKAN_HPP_ASSERT( sizeof( T ) <= stride );
+   }
 
-  void set_storage(const allocation_result &alloc, size_t size) noexcept {
-    m_begin = alloc.ptr;
-    m_end = alloc.ptr + size;
-    cap = alloc.count;
-  }
+   using ArrayProxy<T>::begin;
 
-  void reallocate(size_t count, size_t size) {
-    auto alloc = allocate(count);
-    if (m_begin) {
-      std::memcpy(alloc.ptr, m_begin, this->size() * sizeof(T));
-      std::allocator<T>().deallocate(m_begin, cap);
-    }
-    set_storage(alloc, size);
-  }
+   const T * end() const VULKAN_HPP_NOEXCEPT
+   {
+     return reinterpret_cast<T const *>( static_cast<uint8_t const *>( begin() ) + size() * m_stride );
+   }
 
-  void reallocate(size_t count) {
-    reallocate(count, count);
-  }
+   using ArrayProxy<T>::front;
 
-  template<size_t X>
-  void copy_items_from(Vector<T, X> &v) {
-    const T* src = v.m_begin;
-    for (auto* it = m_begin; it != m_end; ++it) {
-      *it = *src;
-      src++;
-    }
-  }
+   const T & back() const VULKAN_HPP_NOEXCEPT
+   {
+     VULKAN_HPP_ASSERT( begin() && size() );
+     return *reinterpret_cast<T const *>( static_cast<uint8_t const *>( begin() ) + ( size() - 1 ) * m_stride );
+   }
 
-  template<size_t X>
-  void move_items_from(Vector<T, X> &&v) {
-    T* src = v.m_begin;
-    for (auto* it = m_begin; it != m_end; ++it) {
-      *it = std::move(*src);
-      src++;
-    }
-  }
+   using ArrayProxy<T>::empty;
+   using ArrayProxy<T>::size;
+   using ArrayProxy<T>::data;
 
-  template<size_t X>
-  void move_from(Vector<T, X> &&v) {
-    if (v.is_inline()) {
-      unitialized_resize(v.size());
-      move_items_from(std::forward<Vector<T, X>>(v));
-      v.deallocate_storage();
-    } else {
-      std::swap(m_begin, v.m_begin);
-      std::swap(m_end, v.m_end);
-      std::swap(cap, v.cap);
-    }
-  }
+   uint32_t stride() const
+   {
+     return m_stride;
+   }
 
-  void destroy_items(T *begin, T *end) noexcept(std::is_nothrow_destructible_v<T>) {
-      for (auto* it = begin; it != end; ++it) {
-        std::destroy_at(it);
-        *it = {};
-      };
-  }
+ private:
+   uint32_t m_stride = sizeof( T );
+ };
+)" };
 
-public:
-  constexpr Vector() = default;
+static constexpr char const *RES_UNINITIALIZED{ R"(
+  // tag of constructors that skip value initialization, contents are indeterminate until written
+  struct uninitialized_t
+  {
+    explicit uninitialized_t() = default;
+  };
 
-  template<size_t X>
-  constexpr Vector(Vector<T, X> &v) {
-    if (v.empty()) {
-      return;
-    }
-    reserve(v.size());
-    m_end = m_begin + v.size();
-    copy_items_from(v);
-  }
+  VULKAN_HPP_CONSTEXPR_INLINE uninitialized_t uninitialized{};
+)" };
 
-  template<size_t X>
-  constexpr Vector(Vector<T, X> &&v) noexcept {
-    move_from(std::forward<Vector<T, X>>(v));
-  }
+static constexpr char const *RES_DEFAULT_INITIALIZED{ R"(
+  namespace detail
+  {
+    // converts to a default initialized T, the returned object is the one being initialized
+    template <typename T>
+    struct DefaultInitialized
+    {
+      operator T() const VULKAN_HPP_NOEXCEPT
+      {
+        T value;
+        return value;
+      }
+    };
+  }  // namespace detail
+)" };
 
-  template<size_t X>
-  Vector& operator=(Vector<T, X> &v) {
-    if (this != &v) {
-      clear();
-      unitialized_resize(v.size());
-      copy_items_from(v);
+static constexpr char const *RES_ARRAY_WRAPPER_1{ R"(
+  template <typename T, size_t N>
+  class ArrayWrapper1D : public std::array<T, N>
+  {
+  public:
+    VULKAN_HPP_CONSTEXPR ArrayWrapper1D() VULKAN_HPP_NOEXCEPT : std::array<T, N>() {}
+
+    VULKAN_HPP_CONSTEXPR ArrayWrapper1D( std::array<T, N> const & data ) VULKAN_HPP_NOEXCEPT : std::array<T, N>( data ) {}
+)" };
+
+static constexpr char const *RES_ARRAY_WRAPPER_UNINITIALIZED{ R"(
+    ArrayWrapper1D( uninitialized_t ) VULKAN_HPP_NOEXCEPT {}
+)" };
+
+static constexpr char const *RES_ARRAY_WRAPPER_2{ R"(
+
+#if ( VK_USE_64_BIT_PTR_DEFINES == 0 )
+    // on 32 bit compiles, needs overloads on index type int to resolve ambiguities
+    VULKAN_HPP_CONSTEXPR T const & operator[]( int index ) const VULKAN_HPP_NOEXCEPT
+    {
+      return std::array<T, N>::operator[]( index );
     }
-    return *this;
-  }
 
-  template<size_t X>
-  Vector& operator=(Vector<T, X> &&v) {
-    if (this != &v) {
-      clear();
-      move_from(std::forward<Vector<T, X>>(v));
+    VULKAN_HPP_CONSTEXPR_14 T & operator[]( int index ) VULKAN_HPP_NOEXCEPT
+    {
+      return std::array<T, N>::operator[]( index );
     }
-    return *this;
-  }
+#endif
 
-  constexpr explicit Vector(size_t s) {
-    resize(s);
-  }
+    VULKAN_HPP_CONSTEXPR operator T const *() const VULKAN_HPP_NOEXCEPT
+    {
+      return this->data();
+    }
 
-  ~Vector() noexcept(std::is_nothrow_destructible_v<T>) {
-    deallocate_storage();
-  }
+    VULKAN_HPP_CONSTEXPR_14 operator T *() VULKAN_HPP_NOEXCEPT
+    {
+      return this->data();
+    }
 
-  void clear() noexcept(std::is_nothrow_destructible_v<T>) {
-    if constexpr (!std::is_trivially_destructible_v<T>) {
-      destroy_items(m_begin, m_end);
+    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
+    operator std::string() const
+    {
+      return std::string( this->data() );
     }
-    m_end = m_begin;
-  }
 
-  void reserve(size_t s) {
-    if (s <= cap || s == 0) {
-      return;
+#if 17 <= VULKAN_HPP_CPP_VERSION
+    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
+    operator std::string_view() const
+    {
+      return std::string_view( this->data() );
     }
-    reallocate(s, size());
-  }
+#endif
 
-  void resize(size_t s) {
-    size_t cs = size();
-    if (s < cs) {
-      if constexpr (!std::is_trivially_destructible_v<T>) {
-        auto *old = m_end;
-        m_end = m_begin + s;
-        destroy_items(m_end, old);
-      }
-      else {
-        m_end = m_begin + s;
-      }
+#if defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
+    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
+    VULKAN_HPP_CONSTEXPR std::strong_ordering operator<=>( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return *static_cast<std::array<char, N> const *>( this ) <=> *static_cast<std::array<char, N> const *>( &rhs );
     }
-    else if (s > cs) {
-      T* it;
-      if (s > cap) {
-        reallocate(s);
-        it = m_begin + cs;
-      }
-      else {
-        it = m_end;
-        m_end = m_begin + s;
-      }
-      for (; it != m_end; ++it) {
-        std::construct_at(it);
-      }
+#else
+    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
+    bool operator<( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return *static_cast<std::array<char, N> const *>( this ) < *static_cast<std::array<char, N> const *>( &rhs );
     }
-  }
 
-  void unitialized_resize(size_t s) {
-    if constexpr (!std::is_trivially_destructible_v<T>) {
-      resize(s);
-      return;
+    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
+    bool operator<=( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return *static_cast<std::array<char, N> const *>( this ) <= *static_cast<std::array<char, N> const *>( &rhs );
     }
 
-    size_t cs = size();
-    if (s < cs) {
-      m_end = m_begin + s;
+    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
+    bool operator>( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return *static_cast<std::array<char, N> const *>( this ) > *static_cast<std::array<char, N> const *>( &rhs );
     }
-    else if (s > cs) {
-      if (s > cap) {
-        reallocate(s);
-      }
-      else {
-        m_end = m_begin + s;
-      }
+
+    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
+    bool operator>=( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return *static_cast<std::array<char, N> const *>( this ) >= *static_cast<std::array<char, N> const *>( &rhs );
     }
-  }
+#endif
 
-  constexpr bool is_inline() const noexcept {
-    return false;
-  }
+    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
+    bool operator==( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return *static_cast<std::array<char, N> const *>( this ) == *static_cast<std::array<char, N> const *>( &rhs );
+    }
 
-  size_t size() const noexcept {
-    return m_end - m_begin;
-  }
+    template <typename B = T, typename std::enable_if<std::is_same<B, char>::value, int>::type = 0>
+    bool operator!=( ArrayWrapper1D<char, N> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return *static_cast<std::array<char, N> const *>( this ) != *static_cast<std::array<char, N> const *>( &rhs );
+    }
+  };
 
-  void confirm(size_t s) { // deprecated
-    m_end = m_begin + s;
+  // specialization of relational operators between std::string and arrays of chars
+  template <size_t N>
+  bool operator<( std::string const & lhs, ArrayWrapper1D<char, N> const & rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return lhs < rhs.data();
   }
 
-  size_t capacity() const noexcept {
-    return cap;
+  template <size_t N>
+  bool operator<=( std::string const & lhs, ArrayWrapper1D<char, N> const & rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return lhs <= rhs.data();
   }
 
-  constexpr size_t buffer_capacity() const {
-    return N;
+  template <size_t N>
+  bool operator>( std::string const & lhs, ArrayWrapper1D<char, N> const & rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return lhs > rhs.data();
   }
 
-  constexpr bool empty() const noexcept {
-    return m_begin == m_end;
+  template <size_t N>
+  bool operator>=( std::string const & lhs, ArrayWrapper1D<char, N> const & rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return lhs >= rhs.data();
   }
 
-  constexpr T *data() noexcept {
-    return m_begin;
-  }
-  constexpr const T *data() const noexcept {
-    return m_begin;
+  template <size_t N>
+  bool operator==( std::string const & lhs, ArrayWrapper1D<char, N> const & rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return lhs == rhs.data();
   }
 
-  iterator begin() noexcept {
-    return iterator{m_begin};
-  }
-  const_iterator begin() const noexcept {
-    return const_iterator{m_begin};
+  template <size_t N>
+  bool operator!=( std::string const & lhs, ArrayWrapper1D<char, N> const & rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return lhs != rhs.data();
   }
 
-  iterator end() noexcept {
-    return iterator{m_end};
-  }
-  const_iterator end() const noexcept {
-    return const_iterator{m_end};
-  }
+  template <typename T, size_t N, size_t M>
+  class ArrayWrapper2D : public std::array<ArrayWrapper1D<T, M>, N>
+  {
+  public:
+    VULKAN_HPP_CONSTEXPR ArrayWrapper2D() VULKAN_HPP_NOEXCEPT : std::array<ArrayWrapper1D<T, M>, N>() {}
 
-  constexpr reference operator[](size_t n) noexcept {
-    assert(n < size() && "vector[] index out of bounds");
-    return m_begin[n];
-  }
-  constexpr const_reference operator[](size_t n) const noexcept {
-    assert(n < size() && "vector[] index out of bounds");
-    return m_begin[n];
-  }
-
-  constexpr reference at(size_t n) {
-    if (n >= size())
-      throw std::out_of_range("vector");
-    return m_begin[n];
-  }
-  constexpr const_reference at(size_t n) const {
-    if (n >= size())
-      throw std::out_of_range("vector");
-    return m_begin[n];
-  }
-
-  constexpr reference front() noexcept {
-    assert(!empty() && "front() called on an empty vector");
-    return *m_begin;
-  }
-  constexpr const_reference front() const noexcept {
-    assert(!empty() && "front() called on an empty vector");
-    return *m_begin;
-  }
-
-  constexpr reference back() noexcept {
-    assert(!empty() && "back() called on an empty vector");
-    return *(m_end - 1);
-  }
-  constexpr const_reference back() const noexcept {
-    assert(!empty() && "back() called on an empty vector");
-    return *(m_end - 1);
-  }
-};
+#if 20 <= VULKAN_HPP_CPP_VERSION
+    // element wise, usable in constant expressions
+    constexpr ArrayWrapper2D( std::array<std::array<T, M>, N> const & data ) VULKAN_HPP_NOEXCEPT : std::array<ArrayWrapper1D<T, M>, N>()
+    {
+      for ( size_t i = 0; i < N; ++i )
+      {
+        ( *this )[i] = data[i];
+      }
+    }
+#else
+    VULKAN_HPP_CONSTEXPR ArrayWrapper2D( std::array<std::array<T, M>, N> const & data ) VULKAN_HPP_NOEXCEPT
+      : std::array<ArrayWrapper1D<T, M>, N>( *reinterpret_cast<std::array<ArrayWrapper1D<T, M>, N> const *>( &data ) )
+    {
+    }
+#endif
+  };
 )" };
 
-static constexpr char const *RES_BASE_TYPES{ R"(
-  //==================
-  //=== BASE TYPEs ===
-  //==================
-
-  using Bool32          = uint32_t;
-  using DeviceAddress   = uint64_t;
-  using DeviceSize      = uint64_t;
-  using RemoteAddressNV = void *;
-  using SampleMask      = uint32_t;
+static constexpr char const *RES_VECTOR_UNINITIALIZED{ R"(
+  // elements constructed with uninitialized_t when T supports it, default initialized otherwise
+  Vector(size_t s, uninitialized_t, const Allocator &alloc = Allocator()) : m_alloc(alloc) {
+    reserve(s);
+    if constexpr (std::is_constructible_v<T, uninitialized_t>) {
+      for (T *it = m_begin; it != m_begin + s; ++it) {
+        ::new (static_cast<void *>(it)) T(uninitialized);
+      }
+    } else {
+      std::uninitialized_default_construct(m_begin, m_begin + s);
+    }
+    m_end = m_begin + s;
+  }
 )" };
 
-static constexpr char const *RES_FLAG_TRAITS{ R"(
-  template <typename FlagBitsType>
-  struct FlagTraits
-  {
-    static VULKAN_HPP_CONST_OR_CONSTEXPR bool isBitmask = false;
-  };
-)" };
+static constexpr char const *RES_VECTOR_1{ R"(
 
-static constexpr char const *RES_FLAGS_1{ R"(
-  template <typename BitType>
-  class Flags
+namespace detail {
+  template<typename T>
+  class Iterator
   {
   public:
-    using MaskType = typename std::underlying_type<BitType>::type;
+    using value_type = std::remove_cv<T>::type;
+    using element_type = std::add_cv<T>::type;
+    using pointer    = T*;
+    using reference  = T&;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category=std::random_access_iterator_tag;
+    using iterator_concept=std::contiguous_iterator_tag;
 
-    // constructors
-    VULKAN_HPP_CONSTEXPR Flags() VULKAN_HPP_NOEXCEPT : m_mask( 0 ) {}
+    Iterator() : v(nullptr) {}
+    Iterator(reference r) : v(&r) {}
+    Iterator(pointer p) : v(p) {}
 
-    VULKAN_HPP_CONSTEXPR Flags( BitType bit ) VULKAN_HPP_NOEXCEPT : m_mask( static_cast<MaskType>( bit ) ) {}
+    reference                 operator*()             { return *v; }
+    // std::add_const<reference> operator*()       const { return *v; }
+    pointer                   operator->()  const          { return v; }
+    // std::add_const<pointer>   operator->()      const { return v; }
+    reference                 operator[](difference_type m) const { return *(v + m); }
+    // std::add_const<reference> operator[](difference_type m) const { return *(v + m); }
 
-    VULKAN_HPP_CONSTEXPR Flags( Flags<BitType> const & rhs ) VULKAN_HPP_NOEXCEPT = default;
+    friend reference operator*(const Iterator& it) { return *(it.v); }
 
-    VULKAN_HPP_CONSTEXPR explicit Flags( MaskType flags ) VULKAN_HPP_NOEXCEPT : m_mask( flags ) {}
+    friend Iterator operator+(difference_type diff, const Iterator& it) { return it + diff; }
+    friend Iterator operator-(difference_type diff, const Iterator& it) { return it - diff; }
 
-    // relational operators
-#if defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
-    auto operator<=>( Flags<BitType> const & ) const = default;
-#else
-    VULKAN_HPP_CONSTEXPR bool operator<( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
-    {
-      return m_mask < rhs.m_mask;
-    }
+    Iterator& operator++()       { ++v; return *this; }
+    Iterator& operator--()       { --v; return *this; }
+    Iterator  operator++(int)    { Iterator it(*this); ++v; return it; }
+    Iterator  operator--(int)    { Iterator it(*this); --v; return it; }
 
-    VULKAN_HPP_CONSTEXPR bool operator<=( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
-    {
-      return m_mask <= rhs.m_mask;
-    }
+    Iterator& operator+=(difference_type  n)  { v += n; return *this; }
+    Iterator& operator-=(difference_type  n)  { v -= n; return *this; }
 
-    VULKAN_HPP_CONSTEXPR bool operator>( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
-    {
-      return m_mask > rhs.m_mask;
-    }
+    Iterator operator+(difference_type  n)   const { Iterator it(*this); return it += n;}
+    Iterator operator-(difference_type  n)   const { Iterator it(*this); return it -= n;}
 
-    VULKAN_HPP_CONSTEXPR bool operator>=( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
-    {
-      return m_mask >= rhs.m_mask;
-    }
+    difference_type operator-(const Iterator& it) const { return v - it.v; }
 
-    VULKAN_HPP_CONSTEXPR bool operator==( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
-    {
-      return m_mask == rhs.m_mask;
-    }
+    bool operator<(Iterator const& it)  const { return v <  it.v; }
+    bool operator<=(Iterator const& it) const { return v <= it.v; }
+    bool operator>(Iterator const& it)  const { return v >  it.v; }
+    bool operator>=(Iterator const& it) const { return v >= it.v; }
+    bool operator!=(const Iterator &it) const { return v != it.v; }
+    bool operator==(const Iterator &it) const { return v == it.v; }
 
-    VULKAN_HPP_CONSTEXPR bool operator!=( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
-    {
-      return m_mask != rhs.m_mask;
-    }
-#endif
+  private:
+    pointer v;
+  };
+}
 
-    // logical operator
-    VULKAN_HPP_CONSTEXPR bool operator!() const VULKAN_HPP_NOEXCEPT
-    {
-      return !m_mask;
-    }
+namespace detail {
+  // growth policy, at least 1.5x of current capacity
+  constexpr size_t grow_capacity(size_t cap, size_t required) noexcept {
+    size_t const next = cap + cap / 2;
+    return next > required ? next : required;
+  }
 
-    // bitwise operators
-    VULKAN_HPP_CONSTEXPR Flags<BitType> operator&( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
-    {
-      return Flags<BitType>( m_mask & rhs.m_mask );
+  template<typename T>
+  void copy_construct_items(T *dst, const T *src, size_t count) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      if (count) {
+        std::memcpy(dst, src, count * sizeof(T));
+      }
     }
+    else {
+      std::uninitialized_copy_n(src, count, dst);
+    }
+  }
 
-    VULKAN_HPP_CONSTEXPR Flags<BitType> operator|( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
-    {
-      return Flags<BitType>( m_mask | rhs.m_mask );
+  // moves items to uninitialized storage and ends lifetime of source items
+  template<typename T>
+  void relocate_items(T *dst, T *src, size_t count) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      if (count) {
+        std::memmove(dst, src, count * sizeof(T));
+      }
+    }
+    else {
+      std::uninitialized_move_n(src, count, dst);
+      std::destroy_n(src, count);
     }
+  }
 
-    VULKAN_HPP_CONSTEXPR Flags<BitType> operator^( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
-    {
-      return Flags<BitType>( m_mask ^ rhs.m_mask );
+  template<typename T>
+  void destroy_items(T *begin, T *end) noexcept(std::is_nothrow_destructible_v<T>) {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      std::destroy(begin, end);
     }
-)" };
+  }
+}
 
-static constexpr char const *RES_FLAGS_2{ R"(
-    // assignment operators
-    VULKAN_HPP_CONSTEXPR_14 Flags<BitType> & operator=( Flags<BitType> const & rhs ) VULKAN_HPP_NOEXCEPT = default;
+template<typename T, size_t N = 0, bool s = N != 0, typename Allocator = std::allocator<T>>
+class Vector;
 
-    VULKAN_HPP_CONSTEXPR_14 Flags<BitType> & operator|=( Flags<BitType> const & rhs ) VULKAN_HPP_NOEXCEPT
-    {
-      m_mask |= rhs.m_mask;
-      return *this;
-    }
+template<typename T, size_t N, typename Allocator>
+class Vector<T, N, true, Allocator> {
+  template<typename, size_t, bool, typename>
+  friend class Vector;
 
-    VULKAN_HPP_CONSTEXPR_14 Flags<BitType> & operator&=( Flags<BitType> const & rhs ) VULKAN_HPP_NOEXCEPT
-    {
-      m_mask &= rhs.m_mask;
-      return *this;
-    }
+  using alloc_traits = std::allocator_traits<Allocator>;
 
-    VULKAN_HPP_CONSTEXPR_14 Flags<BitType> & operator^=( Flags<BitType> const & rhs ) VULKAN_HPP_NOEXCEPT
-    {
-      m_mask ^= rhs.m_mask;
-      return *this;
-    }
+public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = detail::Iterator<T>;
+  using const_iterator = detail::Iterator<T>;
 
-    // cast operators
-    explicit VULKAN_HPP_CONSTEXPR operator bool() const VULKAN_HPP_NOEXCEPT
-    {
-      return !!m_mask;
-    }
+private:
+  T *m_begin = buffer;
+  T *m_end   = buffer;
+  size_t cap = N;
+  [[no_unique_address]] Allocator m_alloc = {};
+  union {
+    T buffer[N];
+  };
 
-    explicit VULKAN_HPP_CONSTEXPR operator MaskType() const VULKAN_HPP_NOEXCEPT
-    {
-      return m_mask;
+  void deallocate_storage() noexcept(std::is_nothrow_destructible_v<T>) {
+    clear();
+    if (!is_inline()) {
+      alloc_traits::deallocate(m_alloc, m_begin, cap);
     }
+    set_empty();
+  }
 
-#if defined( VULKAN_HPP_FLAGS_MASK_TYPE_AS_PUBLIC )
-  public:
+  void set_empty() noexcept {
+    m_begin = buffer;
+    m_end   = buffer;
+    cap     = N;
+  }
+
+#if __cpp_lib_allocate_at_least
+  using allocation_result = std::allocation_result<T*>;
+  allocation_result allocate(size_t count) {
+    return alloc_traits::allocate_at_least(m_alloc, count);
+  }
 #else
-  private:
-#endif
-    MaskType m_mask;
+  struct allocation_result {
+    T *ptr;
+    size_t count;
   };
+  allocation_result allocate(size_t count) {
+    return { alloc_traits::allocate(m_alloc, count), count };
+  }
+#endif
 
-#if !defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
-  // relational operators only needed for pre C++20
-  template <typename BitType>
-  VULKAN_HPP_CONSTEXPR bool operator<( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
-  {
-    return flags.operator>( bit );
+  void set_storage(const allocation_result &alloc, size_t size) noexcept {
+    m_begin = alloc.ptr;
+    m_end = alloc.ptr + size;
+    cap = alloc.count;
   }
 
-  template <typename BitType>
-  VULKAN_HPP_CONSTEXPR bool operator<=( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
-  {
-    return flags.operator>=( bit );
+  void reallocate(size_t count, size_t size) {
+    auto alloc = allocate(count);
+    detail::relocate_items(alloc.ptr, m_begin, this->size());
+    if (!is_inline()) {
+      alloc_traits::deallocate(m_alloc, m_begin, cap);
+    }
+    set_storage(alloc, size);
   }
 
-  template <typename BitType>
-  VULKAN_HPP_CONSTEXPR bool operator>( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
-  {
-    return flags.operator<( bit );
+  void grow(size_t required) {
+    reallocate(detail::grow_capacity(cap, required), size());
   }
 
-  template <typename BitType>
-  VULKAN_HPP_CONSTEXPR bool operator>=( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
-  {
-    return flags.operator<=( bit );
+  template<size_t X, bool Y>
+  void copy_from(const Vector<T, X, Y, Allocator> &v) {
+    reserve(v.size());
+    detail::copy_construct_items(m_begin, v.m_begin, v.size());
+    m_end = m_begin + v.size();
   }
 
-  template <typename BitType>
-  VULKAN_HPP_CONSTEXPR bool operator==( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
-  {
-    return flags.operator==( bit );
+  // propagate_on_container_copy_assignment: storage of the old allocator is released with it
+  void copy_assign_allocator(const Allocator &alloc) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+      if (!alloc_traits::is_always_equal::value && !(m_alloc == alloc)) {
+        deallocate_storage();
+      }
+      m_alloc = alloc;
+    }
   }
 
-  template <typename BitType>
-  VULKAN_HPP_CONSTEXPR bool operator!=( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
-  {
-    return flags.operator!=( bit );
+  // propagate_on_container_move_assignment: called with empty storage, move_from then steals the buffer
+  void move_assign_allocator(const Allocator &alloc) {
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+      m_alloc = alloc;
+    }
   }
-#endif
 
-  // bitwise operators
-  template <typename BitType>
-  VULKAN_HPP_CONSTEXPR Flags<BitType> operator&( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
-  {
-    return flags.operator&( bit );
+  template<size_t X, bool Y>
+  void move_from(Vector<T, X, Y, Allocator> &&v) {
+    if (v.is_inline() || (!alloc_traits::is_always_equal::value && !(m_alloc == v.m_alloc))) {
+      reserve(v.size());
+      detail::relocate_items(m_begin, v.m_begin, v.size());
+      m_end = m_begin + v.size();
+      v.m_end = v.m_begin;
+      v.deallocate_storage();
+    } else {
+      m_begin = v.m_begin;
+      m_end   = v.m_end;
+      cap     = v.cap;
+      v.set_empty();
+    }
   }
 
-  template <typename BitType>
-  VULKAN_HPP_CONSTEXPR Flags<BitType> operator|( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
-  {
-    return flags.operator|( bit );
+public:
+  constexpr Vector() noexcept {}
+
+  constexpr explicit Vector(const Allocator &alloc) noexcept : m_alloc(alloc) {}
+
+  Vector(const Vector &v) : m_alloc(alloc_traits::select_on_container_copy_construction(v.m_alloc)) {
+    copy_from(v);
   }
 
-  template <typename BitType>
-  VULKAN_HPP_CONSTEXPR Flags<BitType> operator^( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
-  {
-    return flags.operator^( bit );
+  Vector(Vector &&v) noexcept(std::is_nothrow_move_constructible_v<T>) : m_alloc(v.m_alloc) {
+    move_from(std::move(v));
   }
 
-)" };
+  template<size_t X, bool Y>
+  Vector(const Vector<T, X, Y, Allocator> &v) : m_alloc(v.m_alloc) {
+    copy_from(v);
+  }
 
-static constexpr char const *RES_OPTIONAL{ R"(
-  template <typename RefType>
-  class Optional {
-  public:
-    Optional( RefType & reference ) VULKAN_HPP_NOEXCEPT
-    {
-      m_ptr = &reference;
-    }
-    Optional( RefType * ptr ) VULKAN_HPP_NOEXCEPT
-    {
-      m_ptr = ptr;
+  template<size_t X, bool Y>
+  Vector(Vector<T, X, Y, Allocator> &&v) noexcept(std::is_nothrow_move_constructible_v<T>) : m_alloc(v.m_alloc) {
+    move_from(std::move(v));
+  }
+
+  Vector& operator=(const Vector &v) {
+    if (this != &v) {
+      clear();
+      copy_assign_allocator(v.m_alloc);
+      copy_from(v);
     }
-    Optional( std::nullptr_t ) VULKAN_HPP_NOEXCEPT
-    {
-      m_ptr = nullptr;
+    return *this;
+  }
+
+  Vector& operator=(Vector &&v) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (this != &v) {
+      deallocate_storage();
+      move_assign_allocator(v.m_alloc);
+      move_from(std::move(v));
     }
+    return *this;
+  }
 
-    operator RefType *() const VULKAN_HPP_NOEXCEPT
-    {
-      return m_ptr;
+  template<size_t X, bool Y>
+  Vector& operator=(const Vector<T, X, Y, Allocator> &v) {
+    clear();
+    copy_assign_allocator(v.m_alloc);
+    copy_from(v);
+    return *this;
+  }
+
+  template<size_t X, bool Y>
+  Vector& operator=(Vector<T, X, Y, Allocator> &&v) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    deallocate_storage();
+    move_assign_allocator(v.m_alloc);
+    move_from(std::move(v));
+    return *this;
+  }
+
+  // allocators are exchanged only with propagate_on_container_swap, otherwise they must compare equal
+  void swap(Vector &v) {
+    if (this == &v) {
+      return;
     }
-    RefType const * operator->() const VULKAN_HPP_NOEXCEPT
-    {
-      return m_ptr;
+    if (!is_inline() && !v.is_inline()) {
+      if constexpr (alloc_traits::propagate_on_container_swap::value) {
+        std::swap(m_alloc, v.m_alloc);
+      }
+      std::swap(m_begin, v.m_begin);
+      std::swap(m_end, v.m_end);
+      std::swap(cap, v.cap);
+      return;
     }
-    explicit operator bool() const VULKAN_HPP_NOEXCEPT
-    {
-      return !!m_ptr;
+    // inline buffer can't change owner, items are relocated through a temporary
+    Vector tmp(std::move(v));
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      v.m_alloc = m_alloc;
     }
+    v.move_from(std::move(*this));
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      m_alloc = tmp.m_alloc;
+    }
+    move_from(std::move(tmp));
+  }
 
-  private:
-    RefType * m_ptr;
-  };
+  explicit Vector(size_t s, const Allocator &alloc = Allocator()) : m_alloc(alloc) {
+    resize(s);
+  }
 )" };
 
-static constexpr char const *RES_RAII{ R"(
-    template <class T, class U = T>
-    VULKAN_HPP_CONSTEXPR_14 VULKAN_HPP_INLINE T exchange( T & obj, U && newValue ) {
-#  if ( 14 <= VULKAN_HPP_CPP_VERSION )
-      return std::exchange<T>( obj, std::forward<U>( newValue ) );
-#  else
-      T oldValue = std::move( obj );
-      obj        = std::forward<U>( newValue );
-      return oldValue;
-#  endif
-    }
-)" };
+static constexpr char const *RES_VECTOR_2{ R"(
+  ~Vector() noexcept(std::is_nothrow_destructible_v<T>) {
+    deallocate_storage();
+  }
 
-// static constexpr char const *RES_{R"()"};
+  allocator_type get_allocator() const noexcept {
+    return m_alloc;
+  }
 
+  void clear() noexcept(std::is_nothrow_destructible_v<T>) {
+    detail::destroy_items(m_begin, m_end);
+    m_end = m_begin;
+  }
 
-namespace vkgen
-{
+  void confirm(size_t s) { // deprecated
+     m_end = m_begin + s;
+  }
 
-//    std::string Generator::genWithProtect(const std::string &code, const std::string &protect) const {
-//        std::string output;
-//        if (code.empty()) {
-//            return output;
-//        }
-//        if (!protect.empty()) {
-//            output += "#if defined(" + protect + ")\n";
-//        }
-//        output += code;
-//        if (!protect.empty()) {
-//            output += "#endif // " + protect + "\n";
-//        }
-//        return output;
-//    }
-//
-//    std::string Generator::genWithProtectNegate(const std::string &code, const std::string &protect) const {
-//        std::string output;
-//        if (code.empty()) {
-//            return output;
-//        }
-//        if (!protect.empty()) {
-//            output += "#ifndef " + protect + "\n";
-//        }
-//        output += code;
-//        if (!protect.empty()) {
-//            output += "#endif // " + protect + "\n";
-//        }
-//        return output;
-//    }
+  void reserve(size_t s) {
+    if (s <= cap) {
+      return;
+    }
+    reallocate(s, size());
+  }
 
-//    std::pair<std::string, std::string>
-//      Generator::genCodeAndProtect(const GenericType &type, const std::function<void(std::string &)> &function, bool bypass) const {
-//        if (!type.canGenerate() && !bypass) {
-//            return std::make_pair("", "");
-//        }
-//        std::string       output;
-//        std::string const protect = std::string{ type.getProtect() };
-//        function(output);
-//        return std::make_pair(output, protect);
-//    }
+  void resize(size_t s) {
+    size_t cs = size();
+    if (s < cs) {
+      auto *old = m_end;
+      m_end = m_begin + s;
+      detail::destroy_items(m_end, old);
+    }
+    else if (s > cs) {
+      if (s > cap) {
+        grow(s);
+      }
+      std::uninitialized_value_construct(m_end, m_begin + s);
+      m_end = m_begin + s;
+    }
+  }
 
-    // TODO rename
-    void Generator::genOptional(OutputBuffer &output, const GenericType &type, const std::function<void(OutputBuffer&)> &function) const {
-        if (!type.canGenerate()) {
-            return;
-        }
-        const auto &protect = type.getProtect();
-        if (!protect.empty()) {
-            output += "#if defined(";
-            output += protect;
-            output += ")\n";
-        }
-        function(output);
-        if (!protect.empty()) {
-            output += "#endif // ";
-            output += protect;
-            output += "\n";
-        }
+  void unitialized_resize(size_t s) {
+    if constexpr (!std::is_trivially_default_constructible_v<T> || !std::is_trivially_destructible_v<T>) {
+      resize(s);
+      return;
     }
 
-//    std::string Generator::genOptional(const GenericType &type, std::function<void(std::string &)> function, bool bypass) const {
-//        auto [code, protect] = genCodeAndProtect(type, function, bypass);
-//        return genWithProtect(code, protect);
-//    }
+    if (s > cap) {
+      grow(s);
+    }
+    m_end = m_begin + s;
+  }
 
-    void Generator::genPlatform(OutputBuffer &output, const GenericType &type, const std::function<void(OutputBuffer&)> &function) {
-        const auto &p = type.getProtect();
-        // if (!p.empty()) {
-            // outputFuncs.platform.add(type, function);
-//        }
-//        else {
-            genOptional(output, type, function);
-        // }
+  template<typename... Args>
+  reference emplace_back(Args&&... args) {
+    if (size() == cap) {
+      grow(cap + 1);
     }
+    T *it = std::construct_at(m_end, std::forward<Args>(args)...);
+    ++m_end;
+    return *it;
+  }
 
-//    std::string Generator::genPlatform(const GenericType &type, std::function<void(std::string &)> function, bool bypass) {
-//        const auto &p = type.getProtect();
-//        if (!p.empty()) {
-//            outputFuncs.platform.add(type, function);
-//            return "";
-//        }
-//        return genOptional(type, function);
-//    }
+  void push_back(const T &value) {
+    emplace_back(value);
+  }
 
-//    static std::string genDefine(const std::string &define, const Define::State state, const bool neg, const std::function<void(OutputBuffer&)> &function) {
-//        if (state == Define::DISABLED) {
-//            return "";
-//        }
-//        std::string code;
-//        function(code);
-//        if (state == Define::COND_ENABLED) {
-//            std::string output;
-//            if (!code.empty()) {
-//                output += "#if ";
-//                if (neg) {
-//                    output += '!';
-//                }
-//                output += "defined( " + define + " )\n";
-//                output += code;
-//                output += "#endif // " + define + "\n";
-//            }
-//            return output;
-//        }
-//        return code;
-//    }
+  void push_back(T &&value) {
+    emplace_back(std::move(value));
+  }
 
-    void Generator::gen(OutputBuffer &output, const Define &define, const std::function<void(OutputBuffer&)> &function) const {
-        if (define.state == Define::DISABLED) {
-            return;
-        }
-        output += "#if ";
-        if (define.type == Define::IF_NOT) {
-            output += "!";
-        }
-        output += "defined( ";
-        output += define.define;
-        output += " )\n";
+  void pop_back() noexcept(std::is_nothrow_destructible_v<T>) {
+    assert(!empty() && "pop_back() called on an empty vector");
+    --m_end;
+    detail::destroy_items(m_end, m_end + 1);
+  }
 
-        function(output);
+  constexpr bool is_inline() const noexcept {
+    return m_begin == buffer;
+  }
 
-        output += "#endif // ";
-        output += define.define;
-        output += "\n";
-    }
+  size_t size() const noexcept {
+    return m_end - m_begin;
+  }
 
-//    std::string Generator::gen(const Define &define, std::function<void(std::string &)> function) const {
-//        return genDefine(define.define, define.state, false, function);
-//    }
-//
-//    std::string Generator::gen(const NDefine &define, std::function<void(std::string &)> function) const {
-//        return genDefine(define.define, define.state, true, function);
-//    }
+  size_t capacity() const noexcept {
+    return cap;
+  }
 
-    std::string Generator::genNamespaceMacro(const Macro &m) {
-        std::string output    = genMacro(m);
-        const bool  stringify = true;
-        if (m.usesDefine || stringify) {
-            output += vkgen::format("#define {0}_STRING  VULKAN_HPP_STRINGIFY({1})\n", m.define, m.value);
-        } else {
-            output += vkgen::format("#define {0}_STRING  \"{1}\"\n", m.define, m.value);
-        }
-        return output;
-    }
+  constexpr size_t buffer_capacity() const {
+    return N;
+  }
 
-    void Generator::generateMacros(OutputBuffer &output) {
-        output += R"(
-#if defined( _MSVC_LANG )
-#  define VULKAN_HPP_CPLUSPLUS _MSVC_LANG
-#else
-#  define VULKAN_HPP_CPLUSPLUS __cplusplus
-#endif
-)";
-        if (cfg.gen.cppStd == 20) {
-            output += R"(
-#if 202002L < VULKAN_HPP_CPLUSPLUS
-#  define VULKAN_HPP_CPP_VERSION 23
-#elif 201703L < VULKAN_HPP_CPLUSPLUS
-#  define VULKAN_HPP_CPP_VERSION 20
-#else
-#  error "vulkan.hpp needs at least c++ standard version 20"
-#endif
-)";
-        }
-        else if (cfg.gen.cppStd == 17) {
-            output += R"(
-#if 202002L < VULKAN_HPP_CPLUSPLUS
-#  define VULKAN_HPP_CPP_VERSION 23
-#elif 201703L < VULKAN_HPP_CPLUSPLUS
-#  define VULKAN_HPP_CPP_VERSION 20
-#elif 201402L < VULKAN_HPP_CPLUSPLUS
-#  define VULKAN_HPP_CPP_VERSION 17
-#else
-#  error "vulkan.hpp needs at least c++ standard version 17"
-#endif
-)";
-        }
-        else {
-            output += R"(
-#if 202002L < VULKAN_HPP_CPLUSPLUS
-#  define VULKAN_HPP_CPP_VERSION 23
-#elif 201703L < VULKAN_HPP_CPLUSPLUS
-#  define VULKAN_HPP_CPP_VERSION 20
-#elif 201402L < VULKAN_HPP_CPLUSPLUS
-#  define VULKAN_HPP_CPP_VERSION 17
-#elif 201103L < VULKAN_HPP_CPLUSPLUS
-#  define VULKAN_HPP_CPP_VERSION 14
-#elif 199711L < VULKAN_HPP_CPLUSPLUS
-#  define VULKAN_HPP_CPP_VERSION 11
-#else
-#  error "vulkan.hpp needs at least c++ standard version 11"
-#endif
-)";
-        }
-        output += R"(
-#if defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
-#  if !defined( VULKAN_HPP_NO_SMART_HANDLE )
-#    define VULKAN_HPP_NO_SMART_HANDLE
-#  endif
-#endif
+  constexpr bool empty() const noexcept {
+    return m_begin == m_end;
+  }
 
-#if defined( VULKAN_HPP_NO_CONSTRUCTORS )
-#  if !defined( VULKAN_HPP_NO_STRUCT_CONSTRUCTORS )
-#    define VULKAN_HPP_NO_STRUCT_CONSTRUCTORS
-#  endif
-#  if !defined( VULKAN_HPP_NO_UNION_CONSTRUCTORS )
-#    define VULKAN_HPP_NO_UNION_CONSTRUCTORS
-#  endif
-#endif
+  constexpr T *data() noexcept {
+    return m_begin;
+  }
+  constexpr const T *data() const noexcept {
+    return m_begin;
+  }
 
-#if defined( VULKAN_HPP_NO_SETTERS )
-#  if !defined( VULKAN_HPP_NO_STRUCT_SETTERS )
-#    define VULKAN_HPP_NO_STRUCT_SETTERS
-#  endif
-#  if !defined( VULKAN_HPP_NO_UNION_SETTERS )
-#    define VULKAN_HPP_NO_UNION_SETTERS
-#  endif
-#endif
+  iterator begin() noexcept {
+    return iterator{m_begin};
+  }
+  const_iterator begin() const noexcept {
+    return const_iterator{m_begin};
+  }
 
-#if defined( __clang__ )
-#include <cassert>
-#else
-#include <assert.h>
-#endif
+  iterator end() noexcept {
+    return iterator{m_end};
+  }
+  const_iterator end() const noexcept {
+    return const_iterator{m_end};
+  }
 
-#if !defined( VULKAN_HPP_ASSERT )
-#  define VULKAN_HPP_ASSERT assert
-#endif
+  constexpr reference operator[](size_t n) noexcept {
+    assert(n < size() && "vector[] index out of bounds");
+    return m_begin[n];
+  }
+  constexpr const_reference operator[](size_t n) const noexcept {
+    assert(n < size() && "vector[] index out of bounds");
+    return m_begin[n];
+  }
 
-#if !defined( VULKAN_HPP_ASSERT_ON_RESULT )
-#  define VULKAN_HPP_ASSERT_ON_RESULT VULKAN_HPP_ASSERT
-#endif
+  constexpr reference at(size_t n) {
+    if (n >= size())
+      throw std::out_of_range("vector");
+    return m_begin[n];
+  }
+  constexpr const_reference at(size_t n) const {
+    if (n >= size())
+      throw std::out_of_range("vector");
+    return m_begin[n];
+  }
 
-#if !defined( VULKAN_HPP_STATIC_ASSERT )
-#  define VULKAN_HPP_STATIC_ASSERT static_assert
-#endif
+  constexpr reference front() noexcept {
+    assert(!empty() && "front() called on an empty vector");
+    return *m_begin;
+  }
+  constexpr const_reference front() const noexcept {
+    assert(!empty() && "front() called on an empty vector");
+    return *m_begin;
+  }
 
-#if !defined( VULKAN_HPP_ENABLE_DYNAMIC_LOADER_TOOL )
-#  define VULKAN_HPP_ENABLE_DYNAMIC_LOADER_TOOL 1
-#endif
+  constexpr reference back() noexcept {
+    assert(!empty() && "back() called on an empty vector");
+    return *(m_end - 1);
+  }
+  constexpr const_reference back() const noexcept {
+    assert(!empty() && "back() called on an empty vector");
+    return *(m_end - 1);
+  }
+};
 
-#if !defined( __has_include )
-#  define __has_include( x ) false
-#endif
+template<typename T, size_t N, typename Allocator>
+class Vector<T, N, false, Allocator> {
+  template<typename, size_t, bool, typename>
+  friend class Vector;
 
-)";
-        if (cfg.gen.spaceshipOperator && !cfg.gen.globalMode) {
-            output += R"(
-//#if ( 201907 <= __cpp_lib_three_way_comparison ) && __has_include( <compare> ) && !defined( VULKAN_HPP_NO_SPACESHIP_OPERATOR )
-//#  define VULKAN_HPP_HAS_SPACESHIP_OPERATOR
-//#endif
-#ifndef VULKAN_HPP_NO_SPACESHIP_OPERATOR
-#  if __has_include( <compare> )
-#    include <compare>
-#    if ( 201907L <= __cpp_lib_three_way_comparison )
-#      define VULKAN_HPP_HAS_SPACESHIP_OPERATOR
-#    endif
-#  endif
-#endif
-)";
-        }
+  using alloc_traits = std::allocator_traits<Allocator>;
 
-        if (cfg.gen.branchHint) {
-            output += R"(
-#if !defined( VULKAN_HPP_LIKELY )
-#  if defined( __clang__ )
-#    define VULKAN_HPP_LIKELY [[likely]]
-#  else
-#    define VULKAN_HPP_LIKELY
-#  endif
-#endif
+public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = detail::Iterator<T>;
+  using const_iterator = detail::Iterator<T>;
 
-#if !defined( VULKAN_HPP_UNLIKELY )
-#  if defined( __clang__ )
-#    define VULKAN_HPP_UNLIKELY [[unlikely]]
-#  else
-#    define VULKAN_HPP_UNLIKELY
-#  endif
-#endif
-)";
-        }
+private:
+  T *m_begin = {};
+  T *m_end   = {};
+  size_t cap = 0;
+  [[no_unique_address]] Allocator m_alloc = {};
 
-        output += R"(
-#if ( 201803 <= __cpp_lib_span )
-#  define VULKAN_HPP_SUPPORT_SPAN
-#endif
+  void deallocate_storage() noexcept(std::is_nothrow_destructible_v<T>) {
+    if (m_begin) {
+      clear();
+      alloc_traits::deallocate(m_alloc, m_begin, cap);
+      set_empty();
+    }
+  }
 
-#ifndef VK_USE_64_BIT_PTR_DEFINES
-#  if defined( __LP64__ ) || defined( _WIN64 ) || ( defined( __x86_64__ ) && !defined( __ILP32__ ) ) || defined( _M_X64 ) || defined( __ia64 ) || \
-    defined( _M_IA64 ) || defined( __aarch64__ ) || defined( __powerpc64__ ) || ( defined( __riscv ) && __riscv_xlen == 64 )
-#    define VK_USE_64_BIT_PTR_DEFINES 1
-#  else
-#    define VK_USE_64_BIT_PTR_DEFINES 0
-#  endif
-#endif
+  void set_empty() noexcept {
+    m_begin = {};
+    m_end   = {};
+    cap     = 0;
+  }
 
-// 32-bit vulkan is not typesafe for non-dispatchable handles, so don't allow copy constructors on this platform by default.
-// To enable this feature on 32-bit platforms please define VULKAN_HPP_TYPESAFE_CONVERSION
-#if ( VK_USE_64_BIT_PTR_DEFINES == 1 )
-#  if !defined( VULKAN_HPP_TYPESAFE_CONVERSION )
-#    define VULKAN_HPP_TYPESAFE_CONVERSION
-#  endif
+#if __cpp_lib_allocate_at_least
+  using allocation_result = std::allocation_result<T*>;
+  allocation_result allocate(size_t count) {
+    return alloc_traits::allocate_at_least(m_alloc, count);
+  }
+#else
+  struct allocation_result {
+    T *ptr;
+    size_t count;
+  };
+  allocation_result allocate(size_t count) {
+    return { alloc_traits::allocate(m_alloc, count), count };
+  }
 #endif
 
-// <tuple> includes <sys/sysmacros.h> through some other header
-// this results in major(x) being resolved to gnu_dev_major(x)
-// which is an expression in a constructor initializer list.
-#if defined( major )
-#  undef major
-#endif
-#if defined( minor )
-#  undef minor
-#endif
+  void set_storage(const allocation_result &alloc, size_t size) noexcept {
+    m_begin = alloc.ptr;
+    m_end = alloc.ptr + size;
+    cap = alloc.count;
+  }
 
-// Windows defines MemoryBarrier which is deprecated and collides
-// with the VULKAN_HPP_NAMESPACE::MemoryBarrier struct.
-#if defined( MemoryBarrier )
-#  undef MemoryBarrier
-#endif
+  void reallocate(size_t count, size_t size) {
+    auto alloc = allocate(count);
+    if (m_begin) {
+      detail::relocate_items(alloc.ptr, m_begin, this->size());
+      alloc_traits::deallocate(m_alloc, m_begin, cap);
+    }
+    set_storage(alloc, size);
+  }
 
-#if !defined( VULKAN_HPP_HAS_UNRESTRICTED_UNIONS )
-#  if defined( __clang__ )
-#    if __has_feature( cxx_unrestricted_unions )
-#      define VULKAN_HPP_HAS_UNRESTRICTED_UNIONS
-#    endif
-#  elif defined( __GNUC__ )
-#    define GCC_VERSION ( __GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__ )
-#    if 40600 <= GCC_VERSION
-#      define VULKAN_HPP_HAS_UNRESTRICTED_UNIONS
-#    endif
-#  elif defined( _MSC_VER )
-#    if 1900 <= _MSC_VER
-#      define VULKAN_HPP_HAS_UNRESTRICTED_UNIONS
-#    endif
-#  endif
-#endif
+  void grow(size_t required) {
+    reallocate(detail::grow_capacity(cap, required), size());
+  }
 
-#if !defined( VULKAN_HPP_INLINE )
-#  if defined( __clang__ )
-#    if __has_attribute( always_inline )
-#      define VULKAN_HPP_INLINE __attribute__( ( always_inline ) ) __inline__
-#    else
-#      define VULKAN_HPP_INLINE inline
-#    endif
-#  elif defined( __GNUC__ )
-#    define VULKAN_HPP_INLINE __attribute__( ( always_inline ) ) __inline__
-#  elif defined( _MSC_VER )
-#    define VULKAN_HPP_INLINE inline
-#  else
-#    define VULKAN_HPP_INLINE inline
-#  endif
-#endif
+  template<size_t X, bool Y>
+  void copy_from(const Vector<T, X, Y, Allocator> &v) {
+    reserve(v.size());
+    detail::copy_construct_items(m_begin, v.m_begin, v.size());
+    m_end = m_begin + v.size();
+  }
 
-#if defined( VULKAN_HPP_TYPESAFE_CONVERSION )
-#  define VULKAN_HPP_TYPESAFE_EXPLICIT
-#else
-#  define VULKAN_HPP_TYPESAFE_EXPLICIT explicit
-#endif
+  // propagate_on_container_copy_assignment: storage of the old allocator is released with it
+  void copy_assign_allocator(const Allocator &alloc) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+      if (!alloc_traits::is_always_equal::value && !(m_alloc == alloc)) {
+        deallocate_storage();
+      }
+      m_alloc = alloc;
+    }
+  }
 
-#if defined( __cpp_constexpr )
-#  define VULKAN_HPP_CONSTEXPR constexpr
-#  if __cpp_constexpr >= 201304
-#    define VULKAN_HPP_CONSTEXPR_14 constexpr
-#  else
-#    define VULKAN_HPP_CONSTEXPR_14
-#  endif
-#  define VULKAN_HPP_CONST_OR_CONSTEXPR constexpr
-#else
-#  define VULKAN_HPP_CONSTEXPR
-#  define VULKAN_HPP_CONSTEXPR_14
-#  define VULKAN_HPP_CONST_OR_CONSTEXPR const
-#endif
+  // propagate_on_container_move_assignment: called with empty storage, move_from then steals the buffer
+  void move_assign_allocator(const Allocator &alloc) {
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+      m_alloc = alloc;
+    }
+  }
 
-#if !defined( VULKAN_HPP_CONSTEXPR_INLINE )
-#  if 201606L <= __cpp_inline_variables
-#    define VULKAN_HPP_CONSTEXPR_INLINE VULKAN_HPP_CONSTEXPR inline
-#  else
-#    define VULKAN_HPP_CONSTEXPR_INLINE VULKAN_HPP_CONSTEXPR
-#  endif
-#endif
+  template<size_t X, bool Y>
+  void move_from(Vector<T, X, Y, Allocator> &&v) {
+    if (v.is_inline() || (!alloc_traits::is_always_equal::value && !(m_alloc == v.m_alloc))) {
+      reserve(v.size());
+      detail::relocate_items(m_begin, v.m_begin, v.size());
+      m_end = m_begin + v.size();
+      v.m_end = v.m_begin;
+      v.deallocate_storage();
+    } else {
+      m_begin = v.m_begin;
+      m_end   = v.m_end;
+      cap     = v.cap;
+      v.set_empty();
+    }
+  }
 
-#if !defined( VULKAN_HPP_NOEXCEPT )
-#  if defined( _MSC_VER ) && ( _MSC_VER <= 1800 )
-#    define VULKAN_HPP_NOEXCEPT
-#  else
-#    define VULKAN_HPP_NOEXCEPT     noexcept
-#    define VULKAN_HPP_HAS_NOEXCEPT 1
-#    if defined( VULKAN_HPP_NO_EXCEPTIONS )
-#      define VULKAN_HPP_NOEXCEPT_WHEN_NO_EXCEPTIONS noexcept
-#    else
-#      define VULKAN_HPP_NOEXCEPT_WHEN_NO_EXCEPTIONS
-#    endif
-#  endif
-#endif
+public:
+  constexpr Vector() noexcept = default;
 
-#if 14 <= VULKAN_HPP_CPP_VERSION
-#  define VULKAN_HPP_DEPRECATED( msg ) [[deprecated( msg )]]
-#else
-#  define VULKAN_HPP_DEPRECATED( msg )
-#endif
+  constexpr explicit Vector(const Allocator &alloc) noexcept : m_alloc(alloc) {}
 
-#if ( 17 <= VULKAN_HPP_CPP_VERSION ) && !defined( VULKAN_HPP_NO_NODISCARD_WARNINGS )
-#  define VULKAN_HPP_NODISCARD [[nodiscard]]
-#  if defined( VULKAN_HPP_NO_EXCEPTIONS )
-#    define VULKAN_HPP_NODISCARD_WHEN_NO_EXCEPTIONS [[nodiscard]]
-#  else
-#    define VULKAN_HPP_NODISCARD_WHEN_NO_EXCEPTIONS
-#  endif
-#else
-#  define VULKAN_HPP_NODISCARD
-#  define VULKAN_HPP_NODISCARD_WHEN_NO_EXCEPTIONS
-#endif
+  Vector(const Vector &v) : m_alloc(alloc_traits::select_on_container_copy_construction(v.m_alloc)) {
+    copy_from(v);
+  }
 
-#if defined( VULKAN_HPP_NO_DEFAULT_DISPATCHER )
-#  define VULKAN_HPP_DEFAULT_ARGUMENT_ASSIGNMENT
-#  define VULKAN_HPP_DEFAULT_ARGUMENT_NULLPTR_ASSIGNMENT
-#  define VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT
-#else
-#  define VULKAN_HPP_DEFAULT_ARGUMENT_ASSIGNMENT         = {}
-#  define VULKAN_HPP_DEFAULT_ARGUMENT_NULLPTR_ASSIGNMENT = nullptr
-#  define VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT       = VULKAN_HPP_DEFAULT_DISPATCHER
-#endif
+  Vector(Vector &&v) noexcept(std::is_nothrow_move_constructible_v<T>) : m_alloc(v.m_alloc) {
+    move_from(std::move(v));
+  }
 
-#ifndef VULKAN_HPP_DEFAULT_ALLOCATOR_ASSIGNMENT
-#  define VULKAN_HPP_DEFAULT_ALLOCATOR_ASSIGNMENT        VULKAN_HPP_DEFAULT_ARGUMENT_NULLPTR_ASSIGNMENT
-#endif
+  template<size_t X, bool Y>
+  Vector(const Vector<T, X, Y, Allocator> &v) : m_alloc(v.m_alloc) {
+    copy_from(v);
+  }
 
-)";
+  template<size_t X, bool Y>
+  Vector(Vector<T, X, Y, Allocator> &&v) noexcept(std::is_nothrow_move_constructible_v<T>) : m_alloc(v.m_alloc) {
+    move_from(std::move(v));
+  }
 
-        output += R"(
-#define VULKAN_HPP_STRINGIFY2( text ) #text
-#define VULKAN_HPP_STRINGIFY( text )  VULKAN_HPP_STRINGIFY2( text )
-)";
-        output += genNamespaceMacro(cfg.macro.mNamespace);
+  Vector& operator=(const Vector &v) {
+    if (this != &v) {
+      clear();
+      copy_assign_allocator(v.m_alloc);
+      copy_from(v);
+    }
+    return *this;
+  }
 
-        if (cfg.gen.raii.interop) {
-            output += R"(
-#ifdef VULKAN_HPP_EXPERIMENTAL_INTEROP
-#   undef VULKAN_HPP_EXPERIMENTAL_NO_INTEROP
-#else
-#   define VULKAN_HPP_EXPERIMENTAL_NO_INTEROP
-#endif
+  Vector& operator=(Vector &&v) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (this != &v) {
+      deallocate_storage();
+      move_assign_allocator(v.m_alloc);
+      move_from(std::move(v));
+    }
+    return *this;
+  }
 
-#ifdef VULKAN_HPP_EXPERIMENTAL_NO_INDIRECT_CMDS
-#   undef VULKAN_HPP_EXPERIMENTAL_NO_RAII_INDIRECT
-#   define VULKAN_HPP_EXPERIMENTAL_NO_RAII_INDIRECT_SUB
-#else
-#   undef VULKAN_HPP_EXPERIMENTAL_NO_RAII_INDIRECT_SUB
-#   define VULKAN_HPP_EXPERIMENTAL_NO_RAII_INDIRECT
-#endif
+  template<size_t X, bool Y>
+  Vector& operator=(const Vector<T, X, Y, Allocator> &v) {
+    clear();
+    copy_assign_allocator(v.m_alloc);
+    copy_from(v);
+    return *this;
+  }
 
-)";
-        }
+  template<size_t X, bool Y>
+  Vector& operator=(Vector<T, X, Y, Allocator> &&v) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    deallocate_storage();
+    move_assign_allocator(v.m_alloc);
+    move_from(std::move(v));
+    return *this;
+  }
 
-        output += "\n";
+  // allocators are exchanged only with propagate_on_container_swap, otherwise they must compare equal
+  void swap(Vector &v) {
+    if (this == &v) {
+      return;
     }
+    if (!is_inline() && !v.is_inline()) {
+      if constexpr (alloc_traits::propagate_on_container_swap::value) {
+        std::swap(m_alloc, v.m_alloc);
+      }
+      std::swap(m_begin, v.m_begin);
+      std::swap(m_end, v.m_end);
+      std::swap(cap, v.cap);
+      return;
+    }
+    // inline buffer can't change owner, items are relocated through a temporary
+    Vector tmp(std::move(v));
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      v.m_alloc = m_alloc;
+    }
+    v.move_from(std::move(*this));
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      m_alloc = tmp.m_alloc;
+    }
+    move_from(std::move(tmp));
+  }
 
-    std::string Generator::generateHeader() {
-        std::string output;
+  explicit Vector(size_t s, const Allocator &alloc = Allocator()) : m_alloc(alloc) {
+    resize(s);
+  }
+)" };
 
-        output += "#include \"vulkan.h\"\n";
-        output += "#include \"vulkan_hpp_macros.hpp\"\n";
-        // output += "#include <vulkan/vulkan.h>\n";
+static constexpr char const *RES_VECTOR_3{ R"(
+  ~Vector() noexcept(std::is_nothrow_destructible_v<T>) {
+    deallocate_storage();
+  }
 
-        output += vkgen::format(R"(
-static_assert(VK_HEADER_VERSION == {0}, "Wrong VK_HEADER_VERSION!");
-)",
-                                headerVersion);
-        if (cfg.gen.importStdMacro) {
-            output += R"(
-#ifdef USE_IMPORT_STD
-import std;
-#else
-)";
-        }
+  allocator_type get_allocator() const noexcept {
+    return m_alloc;
+  }
 
-        if (cfg.gen.cppStd >= 20) {
-            output += R"(
-#include <bit>   // std::bit_cast
-)";
-        }
+  void clear() noexcept(std::is_nothrow_destructible_v<T>) {
+    detail::destroy_items(m_begin, m_end);
+    m_end = m_begin;
+  }
 
-        if (!cfg.gen.globalMode) {
-            output += R"(
-#include <algorithm>
-)";
-        }
-        else {
-            output += R"(
-#include <type_traits>
-)";
-        }
-        if (!cfg.gen.globalMode) {
-            output += R"(
-#include <array>   // ArrayWrapperND
-)";
-        }
-        output += R"(
-#include <cstring> // strcmp, std::memcpy
-)";
-        output += R"(
-#include <string>  // std::string
+  void confirm(size_t s) { // deprecated
+    m_end = m_begin + s;
+  }
 
-/*
-#if 17 <= VULKAN_HPP_CPP_VERSION
-#  include <string_view>  // std::string_view
-#endif
-*/
+  void reserve(size_t s) {
+    if (s <= cap) {
+      return;
+    }
+    reallocate(s, size());
+  }
 
-#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
-#  include <tuple>   // std::tie
-)";
-        if (!cfg.gen.globalMode) {
-            output += "#  include <vector>  // std::vector\n";
-        }
-        output += R"(
-#endif
+  void resize(size_t s) {
+    size_t cs = size();
+    if (s < cs) {
+      auto *old = m_end;
+      m_end = m_begin + s;
+      detail::destroy_items(m_end, old);
+    }
+    else if (s > cs) {
+      if (s > cap) {
+        grow(s);
+      }
+      std::uninitialized_value_construct(m_end, m_begin + s);
+      m_end = m_begin + s;
+    }
+  }
 
-#if !defined( VULKAN_HPP_NO_EXCEPTIONS )
-#  include <system_error>  // std::is_error_code_enum
-#endif
+  void unitialized_resize(size_t s) {
+    if constexpr (!std::is_trivially_default_constructible_v<T> || !std::is_trivially_destructible_v<T>) {
+      resize(s);
+      return;
+    }
 
-#if defined( VULKAN_HPP_SUPPORT_SPAN )
-#  include <span>
-#endif
-)";
+    if (s > cap) {
+      grow(s);
+    }
+    m_end = m_begin + s;
+  }
 
-        if (cfg.gen.globalMode) {
-            output += R"(
-#  include <cstdio>   // std::snprintf
-)";
-        }
-        else if (cfg.gen.expApi) {
-            output += R"(
-#ifdef VULKAN_HPP_EXPERIMENTAL_HEX
-#  include <cstdio>   // std::snprintf
-#elif __cpp_lib_format
-#  include <format>   // std::format
-#else
-#  include <sstream>  // std::stringstream
-#endif
-)";
-        } else {
-            output += R"(
-#if __cpp_lib_format
-#  include <format>   // std::format
-#else
-#  include <sstream>  // std::stringstream
-#endif
-)";
-        }
+  template<typename... Args>
+  reference emplace_back(Args&&... args) {
+    if (size() == cap) {
+      grow(cap + 1);
+    }
+    T *it = std::construct_at(m_end, std::forward<Args>(args)...);
+    ++m_end;
+    return *it;
+  }
 
-        if (cfg.gen.importStdMacro) {
-            output += R"(
+  void push_back(const T &value) {
+    emplace_back(value);
+  }
+
+  void push_back(T &&value) {
+    emplace_back(std::move(value));
+  }
+
+  void pop_back() noexcept(std::is_nothrow_destructible_v<T>) {
+    assert(!empty() && "pop_back() called on an empty vector");
+    --m_end;
+    detail::destroy_items(m_end, m_end + 1);
+  }
+
+  constexpr bool is_inline() const noexcept {
+    return false;
+  }
+
+  size_t size() const noexcept {
+    return m_end - m_begin;
+  }
+
+  size_t capacity() const noexcept {
+    return cap;
+  }
+
+  constexpr size_t buffer_capacity() const {
+    return N;
+  }
+
+  constexpr bool empty() const noexcept {
+    return m_begin == m_end;
+  }
+
+  constexpr T *data() noexcept {
+    return m_begin;
+  }
+  constexpr const T *data() const noexcept {
+    return m_begin;
+  }
+
+  iterator begin() noexcept {
+    return iterator{m_begin};
+  }
+  const_iterator begin() const noexcept {
+    return const_iterator{m_begin};
+  }
+
+  iterator end() noexcept {
+    return iterator{m_end};
+  }
+  const_iterator end() const noexcept {
+    return const_iterator{m_end};
+  }
+
+  constexpr reference operator[](size_t n) noexcept {
+    assert(n < size() && "vector[] index out of bounds");
+    return m_begin[n];
+  }
+  constexpr const_reference operator[](size_t n) const noexcept {
+    assert(n < size() && "vector[] index out of bounds");
+    return m_begin[n];
+  }
+
+  constexpr reference at(size_t n) {
+    if (n >= size())
+      throw std::out_of_range("vector");
+    return m_begin[n];
+  }
+  constexpr const_reference at(size_t n) const {
+    if (n >= size())
+      throw std::out_of_range("vector");
+    return m_begin[n];
+  }
+
+  constexpr reference front() noexcept {
+    assert(!empty() && "front() called on an empty vector");
+    return *m_begin;
+  }
+  constexpr const_reference front() const noexcept {
+    assert(!empty() && "front() called on an empty vector");
+    return *m_begin;
+  }
+
+  constexpr reference back() noexcept {
+    assert(!empty() && "back() called on an empty vector");
+    return *(m_end - 1);
+  }
+  constexpr const_reference back() const noexcept {
+    assert(!empty() && "back() called on an empty vector");
+    return *(m_end - 1);
+  }
+};
+
+template<typename T, size_t N, bool s, typename Allocator>
+void swap(Vector<T, N, s, Allocator> &lhs, Vector<T, N, s, Allocator> &rhs) {
+  lhs.swap(rhs);
+}
+
+#if defined( __cpp_lib_memory_resource )
+template<typename T, size_t N = 0>
+using PmrVector = Vector<T, N, N != 0, std::pmr::polymorphic_allocator<T>>;
 #endif
-)";
-        }
+)" };
 
-        output += "\n";
-        return output;
-    }
+static constexpr char const *RES_BASE_TYPES{ R"(
+  //==================
+  //=== BASE TYPEs ===
+  //==================
 
-    void Generator::generateFlags(vkgen::OutputBuffer &output) const {
-        if (cfg.gen.enumMock >= 2) {
-            output += R"(
+  using Bool32          = uint32_t;
+  using DeviceAddress   = uint64_t;
+  using DeviceSize      = uint64_t;
+  using RemoteAddressNV = void *;
+  using SampleMask      = uint32_t;
+)" };
+
+static constexpr char const *RES_FLAG_TRAITS{ R"(
+  template <typename FlagBitsType>
+  struct FlagTraits
+  {
+    static VULKAN_HPP_CONST_OR_CONSTEXPR bool isBitmask = false;
+  };
+)" };
+
+static constexpr char const *RES_FLAGS_1{ R"(
   template <typename BitType>
   class Flags
   {
@@ -2488,9 +2798,9 @@ import std;
     VULKAN_HPP_CONSTEXPR explicit Flags( MaskType flags ) VULKAN_HPP_NOEXCEPT : m_mask( flags ) {}
 
     // relational operators
-  #if defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
+#if defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
     auto operator<=>( Flags<BitType> const & ) const = default;
-  #else
+#else
     VULKAN_HPP_CONSTEXPR bool operator<( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
     {
       return m_mask < rhs.m_mask;
@@ -2520,7 +2830,7 @@ import std;
     {
       return m_mask != rhs.m_mask;
     }
-  #endif
+#endif
 
     // logical operator
     VULKAN_HPP_CONSTEXPR bool operator!() const VULKAN_HPP_NOEXCEPT
@@ -2543,12 +2853,9 @@ import std;
     {
       return Flags<BitType>( m_mask ^ rhs.m_mask );
     }
+)" };
 
-    VULKAN_HPP_CONSTEXPR Flags<BitType> operator~() const VULKAN_HPP_NOEXCEPT
-    {
-      return Flags<BitType>( m_mask ^ static_cast<MaskType>(BitType::allFlags) );
-    }
-
+static constexpr char const *RES_FLAGS_2{ R"(
     // assignment operators
     VULKAN_HPP_CONSTEXPR_14 Flags<BitType> & operator=( Flags<BitType> const & rhs ) VULKAN_HPP_NOEXCEPT = default;
 
@@ -2581,15 +2888,15 @@ import std;
       return m_mask;
     }
 
-  #if defined( VULKAN_HPP_FLAGS_MASK_TYPE_AS_PUBLIC )
+#if defined( VULKAN_HPP_FLAGS_MASK_TYPE_AS_PUBLIC )
   public:
-  #else
+#else
   private:
-  #endif
+#endif
     MaskType m_mask;
   };
 
-  #if !defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
+#if !defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
   // relational operators only needed for pre C++20
   template <typename BitType>
   VULKAN_HPP_CONSTEXPR bool operator<( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
@@ -2626,7 +2933,7 @@ import std;
   {
     return flags.operator!=( bit );
   }
-  #endif
+#endif
 
   // bitwise operators
   template <typename BitType>
@@ -2647,5741 +2954,10382 @@ import std;
     return flags.operator^( bit );
   }
 
+)" };
 
-  // bitwise operators on BitType
-  template <typename BitType>
-  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator&( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
-  {
-    return Flags<BitType>( lhs ) & rhs;
-  }
+static constexpr char const *RES_FLAGS_COMPACT{ R"(
+  // bitmask enums are the ones with allFlagsOf() found by ADL, no FlagTraits specializations
   template <typename BitType>
-  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator~( BitType bit ) VULKAN_HPP_NOEXCEPT
-  {
-    return ~( Flags<BitType>( bit ) );
-  }
+  concept BitmaskType = std::is_enum_v<BitType> && requires( BitType bit ) { allFlagsOf( bit ); };
 
   template <typename BitType>
-  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator|( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
+  class Flags
   {
-    return Flags<BitType>( lhs ) | rhs;
-  }
+  public:
+    using MaskType = std::underlying_type_t<BitType>;
 
-  template <typename BitType>
-  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator^( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
-  {
-    return Flags<BitType>( lhs ) ^ rhs;
-  }
-)";
-            return;
-        }
+    // constructors
+    VULKAN_HPP_CONSTEXPR Flags() VULKAN_HPP_NOEXCEPT = default;
 
-        if (cfg.gen.enumMock == 1) {
-            return;
-        }
+    VULKAN_HPP_CONSTEXPR Flags( BitType bit ) VULKAN_HPP_NOEXCEPT : m_mask( static_cast<MaskType>( bit ) ) {}
 
-        output += expIfndef("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
-        output += RES_FLAG_TRAITS;
-        output += expEndif("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
-        output += RES_FLAGS_1;
-        output += expIfndef("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
-        output += R"(
-    VULKAN_HPP_CONSTEXPR Flags<BitType> operator~() const VULKAN_HPP_NOEXCEPT
+    VULKAN_HPP_CONSTEXPR explicit Flags( MaskType flags ) VULKAN_HPP_NOEXCEPT : m_mask( flags ) {}
+
+    // relational operators, BitType converts implicitly
+    auto operator<=>( Flags<BitType> const & ) const = default;
+
+    // logical operator
+    VULKAN_HPP_CONSTEXPR bool operator!() const VULKAN_HPP_NOEXCEPT
     {
-      return Flags<BitType>( m_mask ^ FlagTraits<BitType>::allFlags.m_mask );
+      return !m_mask;
     }
-)";
-        output += expEndif("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
-        output += RES_FLAGS_2;
-        output += expIfndef("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
-        output += R"(
-  // bitwise operators on BitType
-  template <typename BitType, typename std::enable_if<FlagTraits<BitType>::isBitmask, bool>::type = true>
-  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator&( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
-  {
-    return Flags<BitType>( lhs ) & rhs;
-  }
-  template <typename BitType, typename std::enable_if<FlagTraits<BitType>::isBitmask, bool>::type = true>
-  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator~( BitType bit ) VULKAN_HPP_NOEXCEPT
-  {
-    return ~( Flags<BitType>( bit ) );
-  }
-)";
 
-        if (cfg.gen.expApi) {
-            output += R"(
-#ifndef VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS
-  template <typename BitType, typename std::enable_if<FlagTraits<BitType>::isBitmask, bool>::type = true>
-#else
-  template <typename BitType>
-#endif
-  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator|( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
-  {
-    return Flags<BitType>( lhs ) | rhs;
-  }
-#ifndef VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS
-  template <typename BitType, typename std::enable_if<FlagTraits<BitType>::isBitmask, bool>::type = true>
+    // bitwise operators, hidden friends also take BitType on either side
+    friend VULKAN_HPP_CONSTEXPR Flags<BitType> operator&( Flags<BitType> lhs, Flags<BitType> rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      return Flags<BitType>( lhs.m_mask & rhs.m_mask );
+    }
+
+    friend VULKAN_HPP_CONSTEXPR Flags<BitType> operator|( Flags<BitType> lhs, Flags<BitType> rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      return Flags<BitType>( lhs.m_mask | rhs.m_mask );
+    }
+
+    friend VULKAN_HPP_CONSTEXPR Flags<BitType> operator^( Flags<BitType> lhs, Flags<BitType> rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      return Flags<BitType>( lhs.m_mask ^ rhs.m_mask );
+    }
+
+    VULKAN_HPP_CONSTEXPR Flags<BitType> operator~() const VULKAN_HPP_NOEXCEPT
+      requires BitmaskType<BitType>
+    {
+      return Flags<BitType>( m_mask ^ allFlagsOf( BitType{} ) );
+    }
+
+    // assignment operators
+    VULKAN_HPP_CONSTEXPR_14 Flags<BitType> & operator|=( Flags<BitType> rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      m_mask |= rhs.m_mask;
+      return *this;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 Flags<BitType> & operator&=( Flags<BitType> rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      m_mask &= rhs.m_mask;
+      return *this;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 Flags<BitType> & operator^=( Flags<BitType> rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      m_mask ^= rhs.m_mask;
+      return *this;
+    }
+
+    // cast operators
+    explicit VULKAN_HPP_CONSTEXPR operator bool() const VULKAN_HPP_NOEXCEPT
+    {
+      return !!m_mask;
+    }
+
+    explicit VULKAN_HPP_CONSTEXPR operator MaskType() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_mask;
+    }
+
+#if defined( VULKAN_HPP_FLAGS_MASK_TYPE_AS_PUBLIC )
+  public:
 #else
-  template <typename BitType>
+  private:
 #endif
-  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator^( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
+    MaskType m_mask = 0;
+  };
+
+  // bitwise operators on BitType
+  template <BitmaskType BitType>
+  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator&( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
   {
-    return Flags<BitType>( lhs ) ^ rhs;
+    return Flags<BitType>( lhs ) & rhs;
   }
-)";
-        } else {
-            output += R"(
-  template <typename BitType, typename std::enable_if<FlagTraits<BitType>::isBitmask, bool>::type = true>
+
+  template <BitmaskType BitType>
   VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator|( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
   {
     return Flags<BitType>( lhs ) | rhs;
   }
 
-  template <typename BitType, typename std::enable_if<FlagTraits<BitType>::isBitmask, bool>::type = true>
+  template <BitmaskType BitType>
   VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator^( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
   {
     return Flags<BitType>( lhs ) ^ rhs;
   }
-)";
-        }
 
-        output += expEndif("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
+  template <BitmaskType BitType>
+  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator~( BitType bit ) VULKAN_HPP_NOEXCEPT
+  {
+    return ~( Flags<BitType>( bit ) );
+  }
+)" };
+
+static constexpr char const *RES_EXTERN_SYNC_CHECK{ R"(
+#if defined( VULKAN_HPP_EXTERN_SYNC_CHECK )
+#  if !defined( VULKAN_HPP_EXTERN_SYNC_REPORT )
+#    define VULKAN_HPP_EXTERN_SYNC_REPORT( command ) \
+      ( std::fprintf( stderr, "%s: externally synchronized handle used by two threads at once\n", command ), std::abort() )
+#  endif
+
+  namespace detail
+  {
+    VULKAN_HPP_INLINE uint64_t externSyncThreadId() VULKAN_HPP_NOEXCEPT
+    {
+      static std::atomic<uint64_t> counter{ 0 };
+      thread_local uint64_t const  id = counter.fetch_add( 1, std::memory_order_relaxed ) + 1;
+      return id;
     }
 
-    std::string FunctionGenerator::getTemplate() const {
-        return additonalTemplate;
+    // dispatchable handles are pointers, non-dispatchable ones may be uint64_t
+    template <typename T>
+    VULKAN_HPP_INLINE uint64_t externSyncKey( T handle ) VULKAN_HPP_NOEXCEPT
+    {
+      uint64_t key = 0;
+      std::memcpy( &key, &handle, sizeof( handle ) );
+      return key;
     }
 
-    void FunctionGenerator::generatePrefix(std::string &output, bool declaration, bool isInline) {
-        const auto &cfg = gen.getConfig();
+#  if !defined( VULKAN_HPP_EXTERN_SYNC_TABLE_SIZE )
+#    define VULKAN_HPP_EXTERN_SYNC_TABLE_SIZE 16384
+#  endif
 
-        if (specifierInline) {
-            if (isInline || ! cfg.gen.cppFiles) {
-                output += cfg.macro.mInline.get() + " ";
-            }
-        }
-        if (specifierExplicit && declaration) {
-            output += cfg.macro.mExplicit.get() + " ";
+    // thread using each externally synchronized handle, debug aid, lock free:
+    // open addressed slots, a slot is bound to a handle once (CAS on the key) and keeps it,
+    // its owner word (thread id << 16 | nesting depth) is taken with CAS and released by the owning thread;
+    // handles not finding a slot within the probe limit are not checked
+    class ExternSyncTable
+    {
+    public:
+      static_assert( ( VULKAN_HPP_EXTERN_SYNC_TABLE_SIZE & ( VULKAN_HPP_EXTERN_SYNC_TABLE_SIZE - 1 ) ) == 0,
+                     "VULKAN_HPP_EXTERN_SYNC_TABLE_SIZE must be a power of two" );
+
+      static ExternSyncTable & get() VULKAN_HPP_NOEXCEPT
+      {
+        static ExternSyncTable table;
+        return table;
+      }
+
+      // owner word of the handle, nullptr when the table has no slot for it
+      std::atomic<uint64_t> * find( uint64_t handle ) VULKAN_HPP_NOEXCEPT
+      {
+        size_t index = static_cast<size_t>( ( handle * 0x9E3779B97F4A7C15ull ) >> 32 );
+        for ( size_t probe = 0; probe < probeLimit; ++probe, ++index )
+        {
+          Slot &   slot = m_slots[index & ( VULKAN_HPP_EXTERN_SYNC_TABLE_SIZE - 1 )];
+          uint64_t key  = slot.key.load( std::memory_order_acquire );
+          if ( key == 0 && slot.key.compare_exchange_strong( key, handle, std::memory_order_acq_rel, std::memory_order_acquire ) )
+          {
+            return &slot.owner;
+          }
+          if ( key == handle )
+          {
+            return &slot.owner;
+          }
         }
-        if (specifierConstexpr) {
-            output += cfg.macro.mConstexpr.get() + " ";
-        } else if (specifierConstexpr14) {
-            output += cfg.macro.mConstexpr14.get() + " ";
+        return nullptr;
+      }
+
+      // false when another thread uses the handle, nested calls from the owning thread pass
+      static bool acquire( std::atomic<uint64_t> & owner, uint64_t thread ) VULKAN_HPP_NOEXCEPT
+      {
+        uint64_t current = owner.load( std::memory_order_relaxed );
+        for ( ;; )
+        {
+          if ( current != 0 && ( current >> 16 ) != thread )
+          {
+            return false;
+          }
+          uint64_t const next = current == 0 ? ( thread << 16 ) | 1 : current + 1;
+          if ( owner.compare_exchange_weak( current, next, std::memory_order_acquire, std::memory_order_relaxed ) )
+          {
+            return true;
+          }
         }
-    }
+      }
 
-    void FunctionGenerator::generateSuffix(std::string &output, bool declaration) {
-        if (specifierConst) {
-            output += " const";
+      // only the owning thread writes a taken owner word
+      static void release( std::atomic<uint64_t> & owner ) VULKAN_HPP_NOEXCEPT
+      {
+        uint64_t const current = owner.load( std::memory_order_relaxed );
+        owner.store( ( current & 0xffff ) == 1 ? 0 : current - 1, std::memory_order_release );
+      }
+
+    private:
+      static constexpr size_t probeLimit = 64;
+
+      struct Slot
+      {
+        std::atomic<uint64_t> key   = {};
+        std::atomic<uint64_t> owner = {};
+      };
+
+      Slot m_slots[VULKAN_HPP_EXTERN_SYNC_TABLE_SIZE] = {};
+    };
+
+    // owns the handle for the duration of a call, null handles are not checked
+    class ExternSyncScope
+    {
+    public:
+      ExternSyncScope( uint64_t handle, char const * command ) VULKAN_HPP_NOEXCEPT
+      {
+        if ( !handle )
+        {
+          return;
         }
-        if (specifierNoexcept) {
-            output += " VULKAN_HPP_NOEXCEPT";
+        m_owner = ExternSyncTable::get().find( handle );
+        if ( m_owner && !ExternSyncTable::acquire( *m_owner, externSyncThreadId() ) )
+        {
+          m_owner = nullptr;
+          VULKAN_HPP_EXTERN_SYNC_REPORT( command );
         }
-    }
+      }
 
-    void FunctionGenerator::generateArgument(std::string &output, const Argument &arg, bool declaration) {
-        output += arg.type;
-        output += ' ';
-        output += arg.id;
-        if (declaration) {
-            output += arg.assignment;
+      ExternSyncScope( ExternSyncScope const & )             = delete;
+      ExternSyncScope & operator=( ExternSyncScope const & ) = delete;
+
+      ~ExternSyncScope()
+      {
+        if ( m_owner )
+        {
+          ExternSyncTable::release( *m_owner );
         }
+      }
+
+    private:
+      std::atomic<uint64_t> * m_owner = nullptr;
+    };
+  }  // namespace detail
+#endif
+)" };
+
+static constexpr char const *RES_OPTIONAL{ R"(
+  template <typename RefType>
+  class Optional {
+  public:
+    Optional( RefType & reference ) VULKAN_HPP_NOEXCEPT
+    {
+      m_ptr = &reference;
+    }
+    Optional( RefType * ptr ) VULKAN_HPP_NOEXCEPT
+    {
+      m_ptr = ptr;
+    }
+    Optional( std::nullptr_t ) VULKAN_HPP_NOEXCEPT
+    {
+      m_ptr = nullptr;
     }
 
-    void FunctionGenerator::generateArgument(std::string &output, const VariableData *var, bool declaration) {
-        output += "/*V*/";
+    operator RefType *() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_ptr;
+    }
+    RefType const * operator->() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_ptr;
+    }
+    explicit operator bool() const VULKAN_HPP_NOEXCEPT
+    {
+      return !!m_ptr;
     }
 
-    void FunctionGenerator::generateArguments(std::string &output, bool declaration) {
-        for (const auto &a : arguments) {
+  private:
+    RefType * m_ptr;
+  };
+)" };
 
-            std::visit([&](auto&& arg) {
-                generateArgument(output, arg, declaration);
-                output += ", ";
-            }, a);
+static constexpr char const *RES_RETIRE_QUEUE{ R"(
+  // Device children handed to push() are destroyed by collect() once
+  // the GPU timeline reaches the value they were retired with.
+  // push() is lock-free and may be called from any thread, collect() from one thread at a time.
+  class RetireQueue
+  {
+  public:
+    struct Entry
+    {
+      void ( *destroy )( Entry const & )      = {};
+      PFN_vkVoidFunction            pfn       = {};
+      uint64_t                      owner     = {};
+      uint64_t                      pool      = {};
+      uint64_t                      handle    = {};
+      VkAllocationCallbacks const * allocator = {};
+      uint64_t                      value     = {};
+      Entry *                       next      = {};
+    };
 
-        }
-        if (output.ends_with(", ")) {
-            output.erase(output.end() - 2);
-        }
-    }
+    RetireQueue()                                  = default;
+    RetireQueue( RetireQueue const & )             = delete;
+    RetireQueue & operator=( RetireQueue const & ) = delete;
 
-    void FunctionGenerator::generatePrototype(std::string &output, bool declaration, bool isInline) {
-        generatePrefix(output, declaration, isInline);
-        std::string templ = getTemplate();
-        if (!templ.empty()) {
-            output += "template<";
-            output += templ;
-            output += ">\n";
-            output += indent;
-        }
-        output += type;
-        if (!type.empty()) {
-            output += ' ';
-        }
-        if (!declaration && !className.empty()) {
-            output += className;
-            output += "::";
-        }
-        output += name;
-        output += '(';
-        generateArguments(output, declaration);
-        output += ")";
-        generateSuffix(output, declaration);
+    ~RetireQueue()
+    {
+      flush();
     }
 
-    std::string FunctionGenerator::generate(bool declaration, bool isInline) {
-        std::string output = indent;
-        generatePrototype(output, declaration, isInline);
-        output += '\n';
-        if (!inits.empty()) {
-            output += indent;
-            output += "  : ";
-            for (size_t i = 0; i < inits.size(); ++i) {
-
-                output += inits[i].dst;
-                output += '(';
-                output += inits[i].src;
-                output += ')';
-                if (i != inits.size() - 1) {
-                    output += ',';
-                }
-                output += '\n';
-                output += indent;
-                output += "    ";
-            }
-            strStripSuffix(output, "    ");
-        }
-        output += indent;
-        output += "{\n";
-        output += code;
-        output += indent;
-        output += "}\n\n";
-        return output;
+    // timeline value of last submitted work, handles retired from now on wait for it
+    void setRetireValue( uint64_t value ) VULKAN_HPP_NOEXCEPT
+    {
+      m_retireValue.store( value, std::memory_order_release );
     }
 
-    std::string FunctionGenerator::generate() {
-        return generate(true, true);
+    uint64_t getRetireValue() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_retireValue.load( std::memory_order_acquire );
     }
 
-    std::string FunctionGenerator::generate(GuardedOutputFuncs &impl) {
-        const bool hasTemplate = !getTemplate().empty();
-        bool genInline = allowInline;
-        if (gen.getConfig().gen.cppFiles && (!hasTemplate || !allowInline)) {
-            genInline = false;
-        }
-        if (genInline) {
-            return generate();
-        }
-        std::string output = indent;
-        generatePrototype(output, true);
-        output += ";\n\n";
+    // false when entry could not be allocated, caller destroys handle immediately
+    bool push( Entry const & entry ) VULKAN_HPP_NOEXCEPT
+    {
+      Entry * node = new ( std::nothrow ) Entry( entry );
+      if ( !node )
+      {
+        return false;
+      }
+      node->value = getRetireValue();
+      node->next  = m_head.load( std::memory_order_relaxed );
+      while ( !m_head.compare_exchange_weak( node->next, node, std::memory_order_release, std::memory_order_relaxed ) )
+      {
+      }
+      return true;
+    }
 
-        std::vector<Protect> protects;
-        if (!optionalProtect.first.empty()) {
-            protects.emplace_back(optionalProtect);
+    // destroys handles retired with value <= completedValue in retire order, returns their count
+    size_t collect( uint64_t completedValue ) VULKAN_HPP_NOEXCEPT
+    {
+      Entry * list    = m_head.exchange( nullptr, std::memory_order_acquire );
+      Entry * ordered = nullptr;
+      while ( list )
+      {
+        Entry * next = list->next;
+        list->next   = ordered;
+        ordered      = list;
+        list         = next;
+      }
+
+      size_t  count = 0;
+      Entry * keep  = nullptr;
+      Entry * tail  = nullptr;
+      while ( ordered )
+      {
+        Entry * next = ordered->next;
+        if ( ordered->value <= completedValue )
+        {
+          ordered->destroy( *ordered );
+          delete ordered;
+          ++count;
         }
-        if (base) {
-            const auto &p = base->getProtect();
-            if (!p.empty()) {
-                protects.emplace_back(p, true);
-            }
+        else
+        {
+          ordered->next = keep;
+          keep          = ordered;
+          if ( !tail )
+          {
+            tail = ordered;
+          }
         }
+        ordered = next;
+      }
 
-        std::string def = generate(false);
-        if (hasTemplate) {
-            impl.templ.get(protects) += std::move(def);
-        }
-        else {
-            impl.def.get(protects) += std::move(def);
+      if ( keep )
+      {
+        tail->next = m_head.load( std::memory_order_relaxed );
+        while ( !m_head.compare_exchange_weak( tail->next, keep, std::memory_order_release, std::memory_order_relaxed ) )
+        {
         }
-        return output;
+      }
+      return count;
     }
 
-    class UniqueBaseGenerator
+    // destroys everything, device must be idle
+    size_t flush() VULKAN_HPP_NOEXCEPT
     {
-        const Generator &gen;
-        bool             exp;
+      return collect( ~uint64_t( 0 ) );
+    }
 
-      public:
-        bool        alloc;
-        bool        dispatch;
-        bool        owner   = true;
-        bool        destroy = true;
-        bool        destroyRef = false;
-        bool        pool    = false;
-        std::string name;
-        std::string templ;
-        std::string specialization;
-        std::string destroyType;
+    template <typename T>
+    static uint64_t toEntryHandle( T handle ) VULKAN_HPP_NOEXCEPT
+    {
+      uint64_t value = 0;
+      std::memcpy( &value, &handle, sizeof( T ) );
+      return value;
+    }
 
-        UniqueBaseGenerator(const Generator &gen) noexcept : gen(gen), exp(gen.getConfig().gen.expApi), alloc(gen.getConfig().gen.allocatorParam) {
-            dispatch = !exp;
-        }
+    template <typename T>
+    static T fromEntryHandle( uint64_t value ) VULKAN_HPP_NOEXCEPT
+    {
+      T handle;
+      std::memcpy( &handle, &value, sizeof( T ) );
+      return handle;
+    }
 
-        void generate(OutputBuffer &output) {
-            OutputClass out {
-                .name = this->name + specialization
-            };
-            std::string    ownerType = exp ? "OwnerType*" : "OwnerType";
+  private:
+    std::atomic<Entry *>  m_head        = {};
+    std::atomic<uint64_t> m_retireValue = {};
+  };
+)" };
 
-            out.sPublic += "    " + name + "() = default;\n";
+static constexpr char const *RES_RAII{ R"(
+    template <class T, class U = T>
+    VULKAN_HPP_CONSTEXPR_14 VULKAN_HPP_INLINE T exchange( T & obj, U && newValue ) {
+#  if ( 14 <= VULKAN_HPP_CPP_VERSION )
+      return std::exchange<T>( obj, std::forward<U>( newValue ) );
+#  else
+      T oldValue = std::move( obj );
+      obj        = std::forward<U>( newValue );
+      return oldValue;
+#  endif
+    }
+)" };
 
-            ArgumentBuilder args(false);
-            if (owner) {
-                args.append( exp ? "OwnerType&" : "OwnerType", " owner", "", "m_owner", exp);
-                out.sPrivate += "    " + ownerType + " m_owner = {};\n";
-            }
-            if (pool) {
-                args.append("PoolType", " pool", "", "m_pool");
-                out.sPrivate += "    PoolType m_pool = {};\n";
-            }
-            if (alloc) {
-                args.append("Optional<const AllocationCallbacks>", " allocationCallbacks", " VULKAN_HPP_DEFAULT_ALLOCATOR_ASSIGNMENT", "m_allocationCallbacks");
-                out.sPrivate += "    Optional<const AllocationCallbacks> m_allocationCallbacks = nullptr;\n";
-            }
-            if (dispatch) {
-                args.append("Dispatch const &", "dispatch", " VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT", "m_dispatch", true);
-                out.sPrivate += "    Dispatch const *                    m_dispatch            = nullptr;\n";
-            }
+static constexpr char const *RES_HOST_ALLOCATORS{ R"(
+  namespace alloc_detail
+  {
+    // in front of every block handed out by host allocators
+    struct HostBlockHeader
+    {
+      uint64_t size;
+      uint32_t offset;  // from start of underlying allocation
+      uint32_t tag;
+    };
+    static_assert( sizeof( HostBlockHeader ) == 16, "unexpected padding" );
 
-            if (args.size() > 0) {
-                out.sPublic += "    " + name + "(" + args.string() + ") VULKAN_HPP_NOEXCEPT\n";
-                out.sPublic += "     " + args.initializer() + "\n";
-                out.sPublic += "    {\n";
-                out.sPublic += "    }\n";
-            }
+    enum HostBlockTag : uint32_t
+    {
+      eHostBlockUpstream = 0,
+      eHostBlockArena    = 1,
+      eHostBlockPool     = 2  // followed by size class index
+    };
 
-            if (owner) {
-                out.sPublic += vkgen::format(R"(
-    {0} getOwner() const VULKAN_HPP_NOEXCEPT
-    {{
-      return m_owner;
-    }}
-)",
-                                             ownerType);
-            }
-            if (alloc) {
-                out.sPublic += vkgen::format(R"(
-    Optional<const AllocationCallbacks> getAllocator() const VULKAN_HPP_NOEXCEPT
-    {{
-      return m_allocationCallbacks;
-    }}
-)");
-            }
-            if (dispatch) {
-                out.sPublic += vkgen::format(R"(
-    Dispatch const & getDispatch() const VULKAN_HPP_NOEXCEPT
-    {{
-      return *m_dispatch;
-    }}
-)");
-            }
-            if (destroy) {
-                std::string assert;
-                std::string code = "      ";
-                if (owner) {
-                    assert += "m_owner";
-                    code += "m_owner";
-                    code += exp? "->" : ".";
-                } else {
-                    code += "t.";
-                }
-                if (dispatch) {
-                    if (!assert.empty()) {
-                        assert += " && ";
-                    }
-                    assert += "m_dispatch";
-                }
-                if (!assert.empty()) {
-                    assert = "VULKAN_HPP_ASSERT ( " + assert + " );\n";
-                }
-                code += destroyType;
-                code += "(";
-                if (pool) {
-                    code += "m_pool";
-                }
-                if (owner) {
-                    if (pool) {
-                        code += ", ";
-                    }
-                    code += "t";
-                }
-                if (alloc) {
-                    if (owner) {
-                        code += ", ";
-                    }
-                    code += "m_allocationCallbacks";
-                }
-                if (dispatch) {
-                    if (owner || alloc) {
-                        code += ", ";
-                    }
-                    code += "*m_dispatch";
-                }
-                code += ");\n";
-                out.sProtected += vkgen::format(R"(
-    template <typename T>
-    void destroy( {2} t ) VULKAN_HPP_NOEXCEPT
-    {{
-      {0}{1}
-    }}
-)",
-                                                assert,
-                                                code,
-                                                destroyRef? "const T&" : "T");
-            }
+    VULKAN_HPP_INLINE HostBlockHeader & hostBlockHeader( void * memory ) VULKAN_HPP_NOEXCEPT
+    {
+      return *( reinterpret_cast<HostBlockHeader *>( memory ) - 1 );
+    }
 
-            std::string t = templ;
+    // keeps block aligned while leaving room for header
+    VULKAN_HPP_INLINE size_t hostBlockPadding( size_t alignment ) VULKAN_HPP_NOEXCEPT
+    {
+      return alignment > sizeof( HostBlockHeader ) ? alignment : sizeof( HostBlockHeader );
+    }
 
-            if (pool) {
-                if (!t.empty()) {
-                    t += ", ";
-                }
-                t += "typename PoolType";
-            }
-            if (dispatch) {
-                if (!t.empty()) {
-                    t += ", ";
-                }
-                t += "typename Dispatch";
-            }
-            output += "  template <";
-            output += t;
-            output += ">\n";
-            output += std::move(out);
-            output += "\n";
-        }
-    };
+    VULKAN_HPP_INLINE size_t hostBlockAlignment( size_t alignment ) VULKAN_HPP_NOEXCEPT
+    {
+      return alignment > alignof( HostBlockHeader ) ? alignment : alignof( HostBlockHeader );
+    }
 
-    void Generator::generateMainFile(GenOutput &files) {
-        auto &output          = files.addFile("");
+    VULKAN_HPP_INLINE void * hostAllocateUpstream( VkAllocationCallbacks const * upstream, size_t size, size_t alignment, VkSystemAllocationScope scope ) VULKAN_HPP_NOEXCEPT
+    {
+      alignment               = hostBlockAlignment( alignment );
+      size_t const    padding = hostBlockPadding( alignment );
+      unsigned char * raw     = static_cast<unsigned char *>( upstream ? upstream->pfnAllocation( upstream->pUserData, size + padding, alignment, scope )
+                                                                       : std::malloc( size + padding + alignment ) );
+      if ( !raw )
+      {
+        return nullptr;
+      }
+      uintptr_t const user   = ( reinterpret_cast<uintptr_t>( raw ) + padding + alignment - 1 ) & ~uintptr_t( alignment - 1 );
+      void *          memory = reinterpret_cast<void *>( user );
+      hostBlockHeader( memory ) = { size, static_cast<uint32_t>( user - reinterpret_cast<uintptr_t>( raw ) ), eHostBlockUpstream };
+      return memory;
+    }
 
-        output += generateHeader();
+    VULKAN_HPP_INLINE void hostFreeUpstream( VkAllocationCallbacks const * upstream, void * memory ) VULKAN_HPP_NOEXCEPT
+    {
+      void * raw = static_cast<unsigned char *>( memory ) - hostBlockHeader( memory ).offset;
+      if ( upstream )
+      {
+        upstream->pfnFree( upstream->pUserData, raw );
+      }
+      else
+      {
+        std::free( raw );
+      }
+    }
 
-        generateArrays(files, output);
-        generateVector(files, output);
+    // VkAllocationCallbacks pointing to Derived::allocate and Derived::free, memory of other scopes goes to upstream
+    template <typename Derived>
+    class HostAllocatorBase
+    {
+    public:
+      HostAllocatorBase( HostAllocatorBase const & )             = delete;
+      HostAllocatorBase & operator=( HostAllocatorBase const & ) = delete;
 
-        output += beginNamespace();
+      AllocationCallbacks const & callbacks() const VULKAN_HPP_NOEXCEPT
+      {
+        return *reinterpret_cast<AllocationCallbacks const *>( &m_callbacks );
+      }
 
-        output += RES_OPTIONAL;
+    protected:
+      explicit HostAllocatorBase( AllocationCallbacks const * upstream ) VULKAN_HPP_NOEXCEPT
+        : m_upstream( reinterpret_cast<VkAllocationCallbacks const *>( upstream ) )
+      {
+        m_callbacks.pUserData       = static_cast<Derived *>( this );
+        m_callbacks.pfnAllocation   = &allocation;
+        m_callbacks.pfnReallocation = &reallocation;
+        m_callbacks.pfnFree         = &deallocation;
+      }
 
-        gen(output, cfg.gen.smartHandles, [&](auto &output) {
-            if (cfg.gen.expApi) {
-                output += RES_UNIQUE_HANDLE_EXP;
-            } else {
-                output += RES_UNIQUE_HANDLE;
-            }
+      VkAllocationCallbacks const * m_upstream;
+      VkAllocationCallbacks         m_callbacks = {};
 
-            UniqueBaseGenerator g(*this);
-            g.name        = "ObjectDestroy";
-            g.templ       = "typename OwnerType";
-            g.destroyType = "destroy";
-            output += "  struct AllocationCallbacks;\n\n";
-            g.generate(output);
+    private:
+      static void * VKAPI_PTR allocation( void * user, size_t size, size_t alignment, VkSystemAllocationScope scope )
+      {
+        return static_cast<Derived *>( user )->allocate( size, alignment, scope );
+      }
 
-            g.templ.clear();
-            g.specialization = "<NoParent";
-            g.specialization += (g.dispatch ? ", Dispatch>" : ">");
-            g.owner = false;
-            g.destroyRef = true;
-            output += "  class NoParent;\n\n";
-            g.generate(output);
+      static void * VKAPI_PTR reallocation( void * user, void * original, size_t size, size_t alignment, VkSystemAllocationScope scope )
+      {
+        Derived & allocator = *static_cast<Derived *>( user );
+        if ( !original )
+        {
+          return allocator.allocate( size, alignment, scope );
+        }
+        if ( !size )
+        {
+          allocator.free( original );
+          return nullptr;
+        }
+        void * memory = allocator.allocate( size, alignment, scope );
+        if ( memory )
+        {
+          size_t const previous = static_cast<size_t>( hostBlockHeader( original ).size );
+          std::memcpy( memory, original, previous < size ? previous : size );
+          allocator.free( original );
+        }
+        return memory;
+      }
 
-            g.name        = "ObjectFree";
-            g.templ       = "typename OwnerType";
-            g.destroyType = "free";
-            g.specialization.clear();
-            g.owner = true;
-            g.destroyRef = false;
-            g.generate(output);
+      static void VKAPI_PTR deallocation( void * user, void * memory )
+      {
+        if ( memory )
+        {
+          static_cast<Derived *>( user )->free( memory );
+        }
+      }
+    };
+  }  // namespace alloc_detail
 
-            g.name        = "ObjectRelease";
-            g.destroyType = "release";
-            g.alloc       = false;
-            g.generate(output);
+  // Command scope allocations are bumped from a thread local arena, rewound once all of them are freed.
+  // Drivers free command scope memory before the command returns, so it has to be freed on the allocating thread.
+  class ArenaAllocator : public alloc_detail::HostAllocatorBase<ArenaAllocator>
+  {
+  public:
+    static constexpr size_t chunkSize = 64 * 1024;
 
-            g.name        = "PoolFree";
-            g.destroyType = "free";
-            g.pool        = true;
-            g.generate(output);
-        });
+    explicit ArenaAllocator( AllocationCallbacks const * upstream = nullptr ) VULKAN_HPP_NOEXCEPT : HostAllocatorBase( upstream ) {}
 
-        if (!cfg.gen.globalMode) {
-            generateDispatch(output);
-            output += RES_BASE_TYPES;
-        }
+    void * allocate( size_t size, size_t alignment, VkSystemAllocationScope scope ) VULKAN_HPP_NOEXCEPT
+    {
+      if ( scope != VK_SYSTEM_ALLOCATION_SCOPE_COMMAND )
+      {
+        return alloc_detail::hostAllocateUpstream( m_upstream, size, alignment, scope );
+      }
+      return arena().allocate( size, alignment );
+    }
 
-        if (cfg.gen.globalMode) {
-            output += R"(
-  VULKAN_HPP_INLINE std::string toHexString( uint32_t value )
-  {
-    std::string str;
-    str.resize(6);
-    int n = std::snprintf(str.data(), str.size(), "%x", value);
-    VULKAN_HPP_ASSERT( n > 0 );
-    return str;
-  }
-)";
+    void free( void * memory ) VULKAN_HPP_NOEXCEPT
+    {
+      if ( alloc_detail::hostBlockHeader( memory ).tag == alloc_detail::eHostBlockArena )
+      {
+        arena().free();
+      }
+      else
+      {
+        alloc_detail::hostFreeUpstream( m_upstream, memory );
+      }
+    }
 
+  private:
+    struct Arena
+    {
+      struct Chunk
+      {
+        Chunk * prev;
+        size_t  size;
+      };
+
+      Chunk * current = nullptr;
+      size_t  offset  = 0;
+      size_t  live    = 0;
+
+      ~Arena()
+      {
+        release( nullptr );
+      }
+
+      void release( Chunk * last ) VULKAN_HPP_NOEXCEPT
+      {
+        while ( current != last )
+        {
+          Chunk * prev = current->prev;
+          std::free( current );
+          current = prev;
         }
-        else if (cfg.gen.expApi) {
-            output += R"(
-  VULKAN_HPP_INLINE std::string toHexString( uint32_t value )
-  {
-#ifdef VULKAN_HPP_EXPERIMENTAL_HEX
-    std::string str;
-    str.resize(6);
-    int n = std::snprintf(str.data(), str.size(), "%x", value);
-    VULKAN_HPP_ASSERT( n > 0 );
-    return str;
-#elif __cpp_lib_format
-    return std::format( "{:x}", value );
-#else
-    std::stringstream stream;
-    stream << std::hex << value;
-    return stream.str();
-#endif
-  }
-)";
-        } else {
-            output += R"(
-  VULKAN_HPP_INLINE std::string toHexString( uint32_t value )
-  {
-#if __cpp_lib_format
-    return std::format( "{:x}", value );
-#else
-    std::stringstream stream;
-    stream << std::hex << value;
-    return stream.str();
-#endif
-  }
-)";
-        }
+      }
 
+      void * allocate( size_t size, size_t alignment ) VULKAN_HPP_NOEXCEPT
+      {
+        alignment            = alloc_detail::hostBlockAlignment( alignment );
+        size_t const padding = alloc_detail::hostBlockPadding( alignment );
+        uintptr_t    base    = reinterpret_cast<uintptr_t>( current );
+        uintptr_t    user    = ( base + offset + padding + alignment - 1 ) & ~uintptr_t( alignment - 1 );
+        if ( !current || user + size > base + current->size )
+        {
+          size_t const required = sizeof( Chunk ) + padding + alignment + size;
+          size_t const bytes    = required > chunkSize ? required : chunkSize;
+          Chunk *      chunk    = static_cast<Chunk *>( std::malloc( bytes ) );
+          if ( !chunk )
+          {
+            return nullptr;
+          }
+          chunk->prev = current;
+          chunk->size = bytes;
+          current     = chunk;
+          base        = reinterpret_cast<uintptr_t>( chunk );
+          user        = ( base + sizeof( Chunk ) + padding + alignment - 1 ) & ~uintptr_t( alignment - 1 );
+        }
+        offset = user + size - base;
+        ++live;
+        void * memory                     = reinterpret_cast<void *>( user );
+        alloc_detail::hostBlockHeader( memory ) = { size, 0, alloc_detail::eHostBlockArena };
+        return memory;
+      }
 
-        output += endNamespace();
-        if (!cfg.gen.onlyC) {
-            output += "#include \"vulkan_enums.hpp\"\n";
-            output += R"(#if !defined( VULKAN_HPP_NO_TO_STRING )
-#  include "vulkan_to_string.hpp"
-#endif
-)";
+      void free() VULKAN_HPP_NOEXCEPT
+      {
+        VULKAN_HPP_ASSERT( live > 0 && "command scope memory freed on other thread" );
+        if ( --live == 0 )
+        {
+          // keeps newest chunk for next command
+          Chunk * keep = current;
+          current      = current->prev;
+          release( nullptr );
+          keep->prev = nullptr;
+          current    = keep;
+          offset     = sizeof( Chunk );
         }
-        output += beginNamespace();
-        generateErrorClasses(output);
-        output += "\n";
-        generateResultValue(output);
+      }
+    };
 
-        generateApiConstants(output);
+    static Arena & arena() VULKAN_HPP_NOEXCEPT
+    {
+      static thread_local Arena instance;
+      return instance;
+    }
+  };
 
-        output += R"(
-  //=========================
-  //=== CONSTEXPR CALLEEs ===
-  //=========================
-  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
-  VULKAN_HPP_CONSTEXPR uint32_t apiVersionMajor( T const version )
-  {
-    return ( ( ( uint32_t )( version ) >> 22U ) & 0x7FU );
-  }
-  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
-  VULKAN_HPP_CONSTEXPR uint32_t apiVersionMinor( T const version )
-  {
-    return ( ( ( uint32_t )( version ) >> 12U ) & 0x3FFU );
-  }
-  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
-  VULKAN_HPP_CONSTEXPR uint32_t apiVersionPatch( T const version )
-  {
-    return ( ( uint32_t )(version)&0xFFFU );
-  }
-  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
-  VULKAN_HPP_CONSTEXPR uint32_t apiVersionVariant( T const version )
-  {
-    return ( ( uint32_t )( version ) >> 29U );
-  }
-  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
-  VULKAN_HPP_CONSTEXPR uint32_t makeApiVersion( T const variant, T const major, T const minor, T const patch )
-  {
-    return ( ( ( ( uint32_t )( variant ) ) << 29U ) | ( ( ( uint32_t )( major ) ) << 22U ) | ( ( ( uint32_t )( minor ) ) << 12U ) | ( ( uint32_t )( patch ) ) );
-  }
-  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
-  VULKAN_HPP_DEPRECATED( "This define is deprecated. VK_MAKE_API_VERSION should be used instead." )
-  VULKAN_HPP_CONSTEXPR uint32_t makeVersion( T const major, T const minor, T const patch )
-  {
-    return ( ( ( ( uint32_t )( major ) ) << 22U ) | ( ( ( uint32_t )( minor ) ) << 12U ) | ( ( uint32_t )( patch ) ) );
-  }
-  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
-  VULKAN_HPP_DEPRECATED( "This define is deprecated. VK_API_VERSION_MAJOR should be used instead." )
-  VULKAN_HPP_CONSTEXPR uint32_t versionMajor( T const version )
-  {
-    return ( ( uint32_t )( version ) >> 22U );
-  }
-  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
-  VULKAN_HPP_DEPRECATED( "This define is deprecated. VK_API_VERSION_MINOR should be used instead." )
-  VULKAN_HPP_CONSTEXPR uint32_t versionMinor( T const version )
-  {
-    return ( ( ( uint32_t )( version ) >> 12U ) & 0x3FFU );
-  }
-  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
-  VULKAN_HPP_DEPRECATED( "This define is deprecated. VK_API_VERSION_PATCH should be used instead." )
-  VULKAN_HPP_CONSTEXPR uint32_t versionPatch( T const version )
+  // Object scope allocations up to maxSize come from per size class free lists. Freed blocks return to their list,
+  // memory is released with the allocator, which has to outlive every object created with it.
+  class PoolAllocator : public alloc_detail::HostAllocatorBase<PoolAllocator>
   {
-    return ( ( uint32_t )(version)&0xFFFU );
-  }
-
-  //=========================
-  //=== CONSTEXPR CALLERs ===
-  //=========================
-  VULKAN_HPP_CONSTEXPR_INLINE auto ApiVersion            = makeApiVersion( 0, 1, 0, 0 );
-  VULKAN_HPP_CONSTEXPR_INLINE auto ApiVersion10          = makeApiVersion( 0, 1, 0, 0 );
-  VULKAN_HPP_CONSTEXPR_INLINE auto ApiVersion11          = makeApiVersion( 0, 1, 1, 0 );
-  VULKAN_HPP_CONSTEXPR_INLINE auto ApiVersion12          = makeApiVersion( 0, 1, 2, 0 );
-  VULKAN_HPP_CONSTEXPR_INLINE auto ApiVersion13          = makeApiVersion( 0, 1, 3, 0 );
-  VULKAN_HPP_CONSTEXPR_INLINE auto HeaderVersionComplete = makeApiVersion( 0, 1, 3, VK_HEADER_VERSION );
-)";
+  public:
+    static constexpr size_t minSize    = 16;
+    static constexpr size_t maxSize    = 4096;
+    static constexpr size_t classCount = 9;
+    static constexpr size_t chunkSize  = 64 * 1024;
 
-        output += endNamespace();
+    explicit PoolAllocator( AllocationCallbacks const * upstream = nullptr ) VULKAN_HPP_NOEXCEPT : HostAllocatorBase( upstream ) {}
 
-        if (cfg.gen.globalMode) {
-            output += "#include \"vulkan_types.hpp\"\n";
-        }
-        else {
-            output += "#include \"vulkan_handles.hpp\"\n";
-            output += "#include \"vulkan_structs.hpp\"\n";
-        }
-        if (cfg.gen.expApi || true) {
-            output += "#include \"vulkan_context.hpp\"\n";
-        }
-        if (cfg.gen.globalMode) {
-            output += "\n";
-            output += beginNamespace();
-            output += "  extern " + m_ns + "::" + loader.name + " " + strFirstLower(loader.name) + ";\n";
-            for (const Handle &t : topLevelHandles) {
-                output += "  extern " + m_ns + "::" + t.name + " " + strFirstLower(t.name) + ";\n";
-            }
-            // output += "  extern vk::Dispatch dispatch;\n";
-            output += "\n";
-            for (Handle &t : topLevelHandles) {
-                for (auto &cmd : t.ctorCmds) {
-                    output += "  // " + cmd.name.original + "\n";
-                    /* in progress
-                    GuardedOutput decl;
-                    MemberGeneratorExperimental g{ *this, cmd, decl, outputFuncs, true };
-                    g.generate();
-                    std::stringstream str;
-                    decl.write(str);
-                    output += std::move(str.str());
-                    */
-                }
-            }
-            output += endNamespace();
-            output += "\n";
+    ~PoolAllocator()
+    {
+      for ( auto & c : m_classes )
+      {
+        while ( c.chunks )
+        {
+          Chunk * next = c.chunks->next;
+          std::free( c.chunks );
+          c.chunks = next;
         }
+      }
+    }
 
+    void * allocate( size_t size, size_t alignment, VkSystemAllocationScope scope ) VULKAN_HPP_NOEXCEPT
+    {
+      if ( scope != VK_SYSTEM_ALLOCATION_SCOPE_OBJECT || size > maxSize || alignment > sizeof( alloc_detail::HostBlockHeader ) )
+      {
+        return alloc_detail::hostAllocateUpstream( m_upstream, size, alignment, scope );
+      }
+      uint32_t index = 0;
+      while ( ( minSize << index ) < size )
+      {
+        ++index;
+      }
+      SizeClass &                 c = m_classes[index];
+      std::lock_guard<std::mutex> lock( c.mutex );
+      if ( !c.free && !refill( c, minSize << index ) )
+      {
+        return nullptr;
+      }
+      Block * block = c.free;
+      c.free        = block->next;
+      void * memory = reinterpret_cast<unsigned char *>( block ) + sizeof( alloc_detail::HostBlockHeader );
+      alloc_detail::hostBlockHeader( memory ) = { size, 0, alloc_detail::eHostBlockPool + index };
+      return memory;
+    }
 
+    void free( void * memory ) VULKAN_HPP_NOEXCEPT
+    {
+      uint32_t const tag = alloc_detail::hostBlockHeader( memory ).tag;
+      if ( tag < alloc_detail::eHostBlockPool )
+      {
+        alloc_detail::hostFreeUpstream( m_upstream, memory );
+        return;
+      }
+      SizeClass &                 c     = m_classes[tag - alloc_detail::eHostBlockPool];
+      Block *                     block = reinterpret_cast<Block *>( &alloc_detail::hostBlockHeader( memory ) );
+      std::lock_guard<std::mutex> lock( c.mutex );
+      block->next = c.free;
+      c.free      = block;
+    }
 
-        // if (cfg.gen.structChain)
-        if (!cfg.gen.onlyC) {
-            output += "#ifndef VULKAN_HPP_NO_STRUCT_CHAIN\n";
-            generateStructChain(files, output);
-            output += "#endif // VULKAN_HPP_NO_STRUCT_CHAIN\n";
-        }
-
+  private:
+    struct Block
+    {
+      Block * next;
+    };
 
-        // output += "#  ifndef VULKAN_HPP_EXPERIMENTAL_NO_VK_FUNCS\n";
-        // output += "#  endif // VULKAN_HPP_EXPERIMENTAL_NO_VK_FUNCS\n";
-//         if (cfg.gen.structMock > 0) {
-//             return;
-//         }
-        /*
-        std::string ifdef;
-        for (const auto &p : platforms) {
-            const auto &protect = p.protect;
-            if (!protect.empty()) {
-                ifdef += "    defined( ";
-                ifdef += protect;
-                ifdef += " ) ||\\\n";
-            }
-        }
-        if (!ifdef.empty()) {
-            strStripPrefix(ifdef, "    ");
-            strStripSuffix(ifdef, " ||\\\n");
-            output += vkgen::format(R"(
-#if {0}
-#include "vulkan_platforms.hpp"
-#endif
-
-)",
-                                    ifdef);
-        }
-        */
-
-        output += "#include \"vulkan_funcs.hpp\"\n\n";
+    struct alignas( 16 ) Chunk
+    {
+      Chunk * next;
+    };
 
-#ifdef INST
-        output += Inst::mainFileEnd();
-#endif
-    }
+    struct SizeClass
+    {
+      std::mutex mutex;
+      Block *    free   = nullptr;
+      Chunk *    chunks = nullptr;
+    };
 
-    static void createPath(const std::filesystem::path &path) {
-        if (std::filesystem::exists(path)) {
-            return;
-        }
-        std::error_code ec;
-        std::filesystem::create_directories(path, ec);
-        if (ec) {
-            throw std::runtime_error{ "Can't create directory " + path.string() + ": " + ec.message() };
-        }
+    static bool refill( SizeClass & c, size_t size ) VULKAN_HPP_NOEXCEPT
+    {
+      size_t const stride = sizeof( alloc_detail::HostBlockHeader ) + size;
+      size_t const count  = chunkSize / stride ? chunkSize / stride : 1;
+      Chunk *      chunk  = static_cast<Chunk *>( std::malloc( sizeof( Chunk ) + stride * count ) );
+      if ( !chunk )
+      {
+        return false;
+      }
+      chunk->next            = c.chunks;
+      c.chunks               = chunk;
+      unsigned char * blocks = reinterpret_cast<unsigned char *>( chunk + 1 );
+      for ( size_t i = count; i-- > 0; )
+      {
+        Block * block = reinterpret_cast<Block *>( blocks + i * stride );
+        block->next   = c.free;
+        c.free        = block;
+      }
+      return true;
     }
 
-    void Generator::generateModuleEnums(OutputBuffer &output) {
-        gen(output, cfg.gen.handleTemplates, [&](auto &output) {
-            output += vkgen::format(R"(
-  //=============
-  //=== ENUMs ===
-  //=============
-  using {0}::CppType;
-)",
-                                    m_ns);
-        });
-
-        GuardedOutput out;
-
-        std::unordered_set<std::string> generated;
-        std::array<Protect, 1>          protect;
-        protect[0].second = true;
-        for (const auto &e : enums) {
-            if (!e.version) {
-                continue;
-            }
+    SizeClass m_classes[classCount];
+  };
 
-            const auto *t = find(e.name.original);
-            if (t && !t->canGenerate()) {
-                continue;
-            }
+  // Counts host memory requested through it per allocation scope and forwards it to upstream,
+  // one instance per subsystem measures allocation volume of each.
+  class CountingAllocator : public alloc_detail::HostAllocatorBase<CountingAllocator>
+  {
+  public:
+    struct Counters
+    {
+      uint64_t allocations   = 0;
+      uint64_t frees         = 0;
+      uint64_t bytes         = 0;  // currently allocated
+      uint64_t peakBytes     = 0;
+      uint64_t totalBytes    = 0;
+      int64_t  internalBytes = 0;  // reported by driver through internal allocation notifications
+    };
 
-            protect[0].first = e.getProtect();
-            auto &output     = out.get(protect);
-            if (generated.contains(e.name)) {
-                // std::cout << ">> skip enum: " << e.name << std::endl;
-                // output += std::move("  // skip: " + e.name + "\n");
-                // continue;
-            } else {
-                output += std::move("  using " + m_ns + "::" + e.name + ";\n");
-                std::string name = e.name;
-                auto        tag  = strRemoveTag(name);
-                if (name.ends_with("FlagBits")) {
-                    name = std::regex_replace(e.name, std::regex("FlagBits"), "Flags");
-                    output += std::move("  using " + m_ns + "::" + name + ";\n");
-                }
-            }
+    explicit CountingAllocator( AllocationCallbacks const * upstream = nullptr ) VULKAN_HPP_NOEXCEPT : HostAllocatorBase( upstream )
+    {
+      m_callbacks.pfnInternalAllocation = &internalAllocation;
+      m_callbacks.pfnInternalFree       = &internalFree;
+    }
 
-            generated.insert(e.name);
+    void * allocate( size_t size, size_t alignment, VkSystemAllocationScope scope ) VULKAN_HPP_NOEXCEPT
+    {
+      void * memory = alloc_detail::hostAllocateUpstream( m_upstream, size, alignment, scope );
+      if ( memory )
+      {
+        alloc_detail::hostBlockHeader( memory ).tag = static_cast<uint32_t>( scope );
+        Scope &        s                      = m_scopes[scope];
+        uint64_t const bytes                  = s.bytes.fetch_add( size, std::memory_order_relaxed ) + size;
+        s.allocations.fetch_add( 1, std::memory_order_relaxed );
+        s.totalBytes.fetch_add( size, std::memory_order_relaxed );
+        uint64_t peak = s.peakBytes.load( std::memory_order_relaxed );
+        while ( peak < bytes && !s.peakBytes.compare_exchange_weak( peak, bytes, std::memory_order_relaxed ) )
+        {
         }
+      }
+      return memory;
+    }
 
-        output += std::move(out);
+    void free( void * memory ) VULKAN_HPP_NOEXCEPT
+    {
+      alloc_detail::HostBlockHeader const & header = alloc_detail::hostBlockHeader( memory );
+      Scope &                         s      = m_scopes[header.tag];
+      s.bytes.fetch_sub( header.size, std::memory_order_relaxed );
+      s.frees.fetch_add( 1, std::memory_order_relaxed );
+      alloc_detail::hostFreeUpstream( m_upstream, memory );
     }
 
-    void Generator::generateModuleHandles(OutputBuffer &output) {
-        output += R"(
-  //===============
-  //=== HANDLEs ===
-  //===============
-)";
+    Counters counters( SystemAllocationScope scope ) const VULKAN_HPP_NOEXCEPT
+    {
+      Scope const & s = m_scopes[static_cast<size_t>( scope )];
+      Counters      c;
+      c.allocations   = s.allocations.load( std::memory_order_relaxed );
+      c.frees         = s.frees.load( std::memory_order_relaxed );
+      c.bytes         = s.bytes.load( std::memory_order_relaxed );
+      c.peakBytes     = s.peakBytes.load( std::memory_order_relaxed );
+      c.totalBytes    = s.totalBytes.load( std::memory_order_relaxed );
+      c.internalBytes = s.internalBytes.load( std::memory_order_relaxed );
+      return c;
+    }
+
+    // sum of all scopes, peak is sum of per scope peaks
+    Counters total() const VULKAN_HPP_NOEXCEPT
+    {
+      Counters sum;
+      for ( size_t i = 0; i < scopeCount; ++i )
+      {
+        Counters const c = counters( static_cast<SystemAllocationScope>( i ) );
+        sum.allocations += c.allocations;
+        sum.frees += c.frees;
+        sum.bytes += c.bytes;
+        sum.peakBytes += c.peakBytes;
+        sum.totalBytes += c.totalBytes;
+        sum.internalBytes += c.internalBytes;
+      }
+      return sum;
+    }
 
-        if (cfg.gen.expApi) {
-            output += "using " + m_ns + "::" + loader.name + ";\n";
-        }
-        for (const Handle &e : handles.ordered) {
-            genOptional(output, e, [&](auto &output) { output += "  using " + m_ns + "::" + e.name + ";\n"; });
-        }
+  private:
+    static constexpr size_t scopeCount = VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE + 1;
 
-        gen(output, cfg.gen.smartHandles, [&](auto &output) {
-            output += R"(
-  //======================
-  //=== UNIQUE HANDLEs ===
-  //======================
-#ifndef  VULKAN_HPP_NO_SMART_HANDLE
-)";
+    struct Scope
+    {
+      std::atomic<uint64_t> allocations{ 0 };
+      std::atomic<uint64_t> frees{ 0 };
+      std::atomic<uint64_t> bytes{ 0 };
+      std::atomic<uint64_t> peakBytes{ 0 };
+      std::atomic<uint64_t> totalBytes{ 0 };
+      std::atomic<int64_t>  internalBytes{ 0 };
+    };
 
-            for (const Handle &e : handles.ordered) {
-                if (e.uniqueVariant()) {
-                    genOptional(output, e, [&](auto &output) { output += "  using " + m_ns + "::Unique" + e.name + ";\n"; });
-                }
-            }
+    static void VKAPI_PTR internalAllocation( void * user, size_t size, VkInternalAllocationType, VkSystemAllocationScope scope )
+    {
+      static_cast<CountingAllocator *>( user )->m_scopes[scope].internalBytes.fetch_add( static_cast<int64_t>( size ), std::memory_order_relaxed );
+    }
 
-            output += "#endif // VULKAN_HPP_NO_SMART_HANDLE\n";
-        });
+    static void VKAPI_PTR internalFree( void * user, size_t size, VkInternalAllocationType, VkSystemAllocationScope scope )
+    {
+      static_cast<CountingAllocator *>( user )->m_scopes[scope].internalBytes.fetch_sub( static_cast<int64_t>( size ), std::memory_order_relaxed );
     }
 
-    void Generator::generateModuleStructs(OutputBuffer &output) {
-        output += R"(
-  //===============
-  //=== STRUCTs ===
-  //===============
-)";
-        GuardedOutput out;
+    Scope m_scopes[scopeCount];
+  };
+)" };
 
-        std::array<Protect, 1> protect;
-        protect[0].second = true;
-        for (const auto &e : structs) {
-            if (!e.version) {
-                continue;
-            }
+static constexpr char const *RES_STUB_DRIVER{ R"(
+    inline std::atomic<uint64_t> handleCounter{ 0x1000 };
 
-            protect[0].first = e.getProtect();
-            auto &output     = out.get(protect);
-            output += std::move("  using " + m_ns + "::" + e.name + ";\n");
-        }
+    // unique non-null handle, never dereferenced
+    template <typename T>
+    inline T fabricate() VULKAN_HPP_NOEXCEPT {
+      return (T)( uintptr_t )handleCounter.fetch_add( 0x10, std::memory_order_relaxed );
+    }
 
-        output += std::move(out);
+    // zeroes an output structure, keeps the chain set up by the caller
+    template <typename T>
+    inline void clearChained( T & value ) VULKAN_HPP_NOEXCEPT {
+      const auto sType = value.sType;
+      const auto pNext = value.pNext;
+      value            = {};
+      value.sType      = sType;
+      value.pNext      = pNext;
     }
 
-    void Generator::generateModules(GenOutput &main, std::filesystem::path path) {
-        GenOutput outModule{ "vulkan", ".cppm", path };
-        auto     &module_output = outModule.addFile("", ".cppm");
+    inline PFN_vkVoidFunction getProcAddr( const char * pName ) VULKAN_HPP_NOEXCEPT;
 
-        module_output += "module;\n\n";
+    inline VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr( VkInstance, const char * pName ) {
+      return getProcAddr( pName );
+    }
 
-        module_output += "#include \"" + main.getFilename("") + "\"\n";
-        if (cfg.gen.raii.enabled) {
-            module_output += "#include \"" + main.getFilename("_raii") + "\"\n";
-        }
+    inline VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr( VkDevice, const char * pName ) {
+      return getProcAddr( pName );
+    }
+)" };
 
-        module_output += "\nexport module vulkan;\n\n";
+// static constexpr char const *RES_{R"()"};
 
-        module_output += "  // VULKAN CORE\n";
-        module_output += "export {\n";
 
-        module_output += R"(
-  //=============
-  //=== ENUMs ===
-  //=============
-)";
+namespace vkgen
+{
 
-        for (const auto &e : enums) {
-            if (!e.version) {
-                continue;
-            }
-            const auto *t = find(e.name.original);
-            if (t && !t->canGenerate()) {
-                continue;
-            }
+//    std::string Generator::genWithProtect(const std::string &code, const std::string &protect) const {
+//        std::string output;
+//        if (code.empty()) {
+//            return output;
+//        }
+//        if (!protect.empty()) {
+//            output += "#if defined(" + protect + ")\n";
+//        }
+//        output += code;
+//        if (!protect.empty()) {
+//            output += "#endif // " + protect + "\n";
+//        }
+//        return output;
+//    }
+//
+//    std::string Generator::genWithProtectNegate(const std::string &code, const std::string &protect) const {
+//        std::string output;
+//        if (code.empty()) {
+//            return output;
+//        }
+//        if (!protect.empty()) {
+//            output += "#ifndef " + protect + "\n";
+//        }
+//        output += code;
+//        if (!protect.empty()) {
+//            output += "#endif // " + protect + "\n";
+//        }
+//        return output;
+//    }
 
-            const auto *base = reinterpret_cast<const GenericType *>(&e);
-            if (t) {
-                base = reinterpret_cast<const GenericType *>(t);
-            }
+//    std::pair<std::string, std::string>
+//      Generator::genCodeAndProtect(const GenericType &type, const std::function<void(std::string &)> &function, bool bypass) const {
+//        if (!type.canGenerate() && !bypass) {
+//            return std::make_pair("", "");
+//        }
+//        std::string       output;
+//        std::string const protect = std::string{ type.getProtect() };
+//        function(output);
+//        return std::make_pair(output, protect);
+//    }
 
-            genOptional(module_output, *base, [&](auto &output) {
-                std::string name = e.name.original;
-                if (e.members.empty()) {
-                    name = std::regex_replace(name, std::regex("FlagBits"), "Flags");
-                }
-                output += "  using ::" + name + ";";
-                // output += " // " + std::to_string(e.isSuppored()) + " " + e.name.original;
-                output += "\n";
-            });
+    // TODO rename
+    void Generator::genOptional(OutputBuffer &output, const GenericType &type, const std::function<void(OutputBuffer&)> &function) const {
+        if (!type.canGenerate()) {
+            return;
         }
-
-        module_output += R"(
-  //===============
-  //=== STRUCTs ===
-  //===============
-)";
-
-        for (const auto &e : this->structs) {
-            if (!e.version) {
-                continue;
-            }
-            genOptional(module_output, e, [&](auto &output) { output += "  using ::" + e.name.original + ";\n"; });
+        const auto &protect = type.getProtect();
+        if (!protect.empty()) {
+            output += "#if defined(";
+            output += protect;
+            output += ")\n";
         }
-
-        module_output += R"(
-  //===============
-  //=== HANDLEs ===
-  //===============
-)";
-
-        for (const auto &e : this->handles) {
-            if (!e.version) {
-                continue;
-            }
-            genOptional(module_output, e, [&](auto &output) { output += "  using ::" + e.name.original + ";\n"; });
+        function(output);
+        if (!protect.empty()) {
+            output += "#endif // ";
+            output += protect;
+            output += "\n";
         }
+    }
 
-        module_output += "}\n";
-
-        module_output += "export " + beginNamespace();
-
-        module_output += vkgen::format(R"(
-  //=====================================
-  //=== HARDCODED TYPEs AND FUNCTIONs ===
-  //=====================================
-  using {0}::ArrayWrapper1D;
-  using {0}::ArrayWrapper2D;
-  // using {0}::DispatchLoaderBase;
-  using {0}::Flags;
-  using {0}::FlagTraits;
-
-#if !defined( VK_NO_PROTOTYPES )
-  // using {0}::DispatchLoaderStatic;
-#endif /*VK_NO_PROTOTYPES*/
-
-  using {0}::operator&;
-  using {0}::operator|;
-  using {0}::operator^;
-  using {0}::operator~;
-  // using VULKAN_HPP_DEFAULT_DISPATCHER_TYPE;
+//    std::string Generator::genOptional(const GenericType &type, std::function<void(std::string &)> function, bool bypass) const {
+//        auto [code, protect] = genCodeAndProtect(type, function, bypass);
+//        return genWithProtect(code, protect);
+//    }
 
-#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
-  using {0}::ArrayProxy;
-  using {0}::ArrayProxyNoTemporaries;
-  using {0}::Optional;
-  // using {0}::StridedArrayProxy;
-  using {0}::StructureChain;
-  // using {0}::UniqueHandle;
-#endif /*VULKAN_HPP_DISABLE_ENHANCED_MODE*/
+    void Generator::genPlatform(OutputBuffer &output, const GenericType &type, const std::function<void(OutputBuffer&)> &function) {
+        const auto &p = type.getProtect();
+        // if (!p.empty()) {
+            // outputFuncs.platform.add(type, function);
+//        }
+//        else {
+            genOptional(output, type, function);
+        // }
+    }
 
-#if !defined( VULKAN_HPP_NO_SMART_HANDLE )
-  // using {0}::ObjectDestroy;
-  // using {0}::ObjectFree;
-  // using {0}::ObjectRelease;
-  // using {0}::PoolFree;
-#endif /*VULKAN_HPP_NO_SMART_HANDLE*/
+//    std::string Generator::genPlatform(const GenericType &type, std::function<void(std::string &)> function, bool bypass) {
+//        const auto &p = type.getProtect();
+//        if (!p.empty()) {
+//            outputFuncs.platform.add(type, function);
+//            return "";
+//        }
+//        return genOptional(type, function);
+//    }
 
-  //==================
-  //=== BASE TYPEs ===
-  //==================
-  using {0}::Bool32;
-  using {0}::DeviceAddress;
-  using {0}::DeviceSize;
-  using {0}::RemoteAddressNV;
-  using {0}::SampleMask;
+//    static std::string genDefine(const std::string &define, const Define::State state, const bool neg, const std::function<void(OutputBuffer&)> &function) {
+//        if (state == Define::DISABLED) {
+//            return "";
+//        }
+//        std::string code;
+//        function(code);
+//        if (state == Define::COND_ENABLED) {
+//            std::string output;
+//            if (!code.empty()) {
+//                output += "#if ";
+//                if (neg) {
+//                    output += '!';
+//                }
+//                output += "defined( " + define + " )\n";
+//                output += code;
+//                output += "#endif // " + define + "\n";
+//            }
+//            return output;
+//        }
+//        return code;
+//    }
 
-)",
-                                       m_ns);
+    void Generator::gen(OutputBuffer &output, const Define &define, const std::function<void(OutputBuffer&)> &function) const {
+        if (define.state == Define::DISABLED) {
+            return;
+        }
+        output += "#if ";
+        if (define.type == Define::IF_NOT) {
+            output += "!";
+        }
+        output += "defined( ";
+        output += define.define;
+        output += " )\n";
 
-        generateModuleEnums(module_output);
+        function(output);
 
-        module_output += vkgen::format(R"(
-  //=========================
-  //=== Index Type Traits ===
-  //=========================
-  //using {0}::IndexTypeValue;
+        output += "#endif // ";
+        output += define.define;
+        output += "\n";
+    }
 
-  //======================
-  //=== ENUM to_string ===
-  //======================
-#if !defined( VULKAN_HPP_NO_TO_STRING )
-  using {0}::to_string;
-  using {0}::toHexString;
-#endif /*VULKAN_HPP_NO_TO_STRING*/
+//    std::string Generator::gen(const Define &define, std::function<void(std::string &)> function) const {
+//        return genDefine(define.define, define.state, false, function);
+//    }
+//
+//    std::string Generator::gen(const NDefine &define, std::function<void(std::string &)> function) const {
+//        return genDefine(define.define, define.state, true, function);
+//    }
 
-  //=============================
-  //=== EXCEPTIONs AND ERRORs ===
-  //=============================
-#if !defined( VULKAN_HPP_NO_EXCEPTIONS )
-)",
-                                       m_ns);
-        if (cfg.gen.unifiedException) {
-            module_output += vkgen::format(R"(
-#  ifdef VULKAN_HPP_UNIFIED_EXCEPTION
-  using {0}::Error;
-#  else
-)",
-                                           m_ns);
+    std::string Generator::genNamespaceMacro(const Macro &m) {
+        std::string output    = genMacro(m);
+        const bool  stringify = true;
+        if (m.usesDefine || stringify) {
+            output += vkgen::format("#define {0}_STRING  VULKAN_HPP_STRINGIFY({1})\n", m.define, m.value);
+        } else {
+            output += vkgen::format("#define {0}_STRING  \"{1}\"\n", m.define, m.value);
         }
+        return output;
+    }
 
-        std::set<std::string>        errors;
-        std::set<const ErrorClass *> platformErrors;
-        for (const auto &e : errorClasses) {
-            if (e.value.getProtect().empty()) {
-                errors.insert(e.name);
-            } else {
-                platformErrors.insert(&e);
-            }
-        }
-        errors.insert("make_error_code");
-        errors.insert("make_error_condition");
-        errors.insert("Error");
-        errors.insert("LogicError");
-        errors.insert("SystemError");
-        for (const auto &e : errors) {
-            module_output += "  using " + m_ns + "::" + e + ";\n";
+    void Generator::generateMacros(OutputBuffer &output) {
+        output += R"(
+#if defined( _MSVC_LANG )
+#  define VULKAN_HPP_CPLUSPLUS _MSVC_LANG
+#else
+#  define VULKAN_HPP_CPLUSPLUS __cplusplus
+#endif
+)";
+        if (cfg.gen.cppStd == 20) {
+            output += R"(
+#if 202002L < VULKAN_HPP_CPLUSPLUS
+#  define VULKAN_HPP_CPP_VERSION 23
+#elif 201703L < VULKAN_HPP_CPLUSPLUS
+#  define VULKAN_HPP_CPP_VERSION 20
+#else
+#  error "vulkan.hpp needs at least c++ standard version 20"
+#endif
+)";
         }
-        for (const auto &e : platformErrors) {
-            genOptional(module_output, e->value, [&](auto &output) { output += "  using " + m_ns + "::" + e->name + ";\n"; });
+        else if (cfg.gen.cppStd == 17) {
+            output += R"(
+#if 202002L < VULKAN_HPP_CPLUSPLUS
+#  define VULKAN_HPP_CPP_VERSION 23
+#elif 201703L < VULKAN_HPP_CPLUSPLUS
+#  define VULKAN_HPP_CPP_VERSION 20
+#elif 201402L < VULKAN_HPP_CPLUSPLUS
+#  define VULKAN_HPP_CPP_VERSION 17
+#else
+#  error "vulkan.hpp needs at least c++ standard version 17"
+#endif
+)";
         }
-        if (cfg.gen.unifiedException) {
-            module_output += "#  endif // VULKAN_HPP_UNIFIED_EXCEPTION\n";
+        else {
+            output += R"(
+#if 202002L < VULKAN_HPP_CPLUSPLUS
+#  define VULKAN_HPP_CPP_VERSION 23
+#elif 201703L < VULKAN_HPP_CPLUSPLUS
+#  define VULKAN_HPP_CPP_VERSION 20
+#elif 201402L < VULKAN_HPP_CPLUSPLUS
+#  define VULKAN_HPP_CPP_VERSION 17
+#elif 201103L < VULKAN_HPP_CPLUSPLUS
+#  define VULKAN_HPP_CPP_VERSION 14
+#elif 199711L < VULKAN_HPP_CPLUSPLUS
+#  define VULKAN_HPP_CPP_VERSION 11
+#else
+#  error "vulkan.hpp needs at least c++ standard version 11"
+#endif
+)";
         }
+        output += R"(
+#if defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
+#  if !defined( VULKAN_HPP_NO_SMART_HANDLE )
+#    define VULKAN_HPP_NO_SMART_HANDLE
+#  endif
+#endif
 
-        module_output += vkgen::format(R"(#endif /*VULKAN_HPP_NO_EXCEPTIONS*/
-
-  using {0}::createResultValueType;
-  using {0}::ignore;
-  using {0}::resultCheck;
-  using {0}::ResultValue;
-  using {0}::ResultValueType;
+#if defined( VULKAN_HPP_NO_CONSTRUCTORS )
+#  if !defined( VULKAN_HPP_NO_STRUCT_CONSTRUCTORS )
+#    define VULKAN_HPP_NO_STRUCT_CONSTRUCTORS
+#  endif
+#  if !defined( VULKAN_HPP_NO_UNION_CONSTRUCTORS )
+#    define VULKAN_HPP_NO_UNION_CONSTRUCTORS
+#  endif
+#endif
 
-  //=========================================
-  //=== CONSTEXPR CONSTANTs AND FUNCTIONs ===
-  //=========================================
-)",
-                                       m_ns);
+#if defined( VULKAN_HPP_NO_SETTERS )
+#  if !defined( VULKAN_HPP_NO_STRUCT_SETTERS )
+#    define VULKAN_HPP_NO_STRUCT_SETTERS
+#  endif
+#  if !defined( VULKAN_HPP_NO_UNION_SETTERS )
+#    define VULKAN_HPP_NO_UNION_SETTERS
+#  endif
+#endif
 
-        for (const auto &a : apiConstants) {
-            genOptional(module_output, a, [&](auto &output) { output += "  using " + m_ns + "::" + a.name + ";\n"; });
-        }
+#if defined( __clang__ )
+#include <cassert>
+#else
+#include <assert.h>
+#endif
 
-        module_output += vkgen::format(R"(
-  //========================
-  //=== CONSTEXPR VALUEs ===
-  //========================
-  using {0}::HeaderVersion;
+#if !defined( VULKAN_HPP_ASSERT )
+#  define VULKAN_HPP_ASSERT assert
+#endif
 
-  //=========================
-  //=== CONSTEXPR CALLEEs ===
-  //=========================
-  using {0}::apiVersionMajor;
-  using {0}::apiVersionMinor;
-  using {0}::apiVersionPatch;
-  using {0}::apiVersionVariant;
-  using {0}::makeApiVersion;
-  using {0}::makeVersion;
-  using {0}::versionMajor;
-  using {0}::versionMinor;
-  using {0}::versionPatch;
+#if !defined( VULKAN_HPP_ASSERT_ON_RESULT )
+#  define VULKAN_HPP_ASSERT_ON_RESULT VULKAN_HPP_ASSERT
+#endif
 
-  //==========================
-  //=== CONSTEXPR CALLERSs ===
-  //==========================
-  using {0}::ApiVersion;
-  using {0}::ApiVersion10;
-  using {0}::ApiVersion11;
-  using {0}::ApiVersion12;
-  using {0}::ApiVersion13;
-  using {0}::HeaderVersionComplete;
+#if !defined( VULKAN_HPP_STATIC_ASSERT )
+#  define VULKAN_HPP_STATIC_ASSERT static_assert
+#endif
 
-)",
-                                       m_ns);
-        // === STRUCTs ===
-        generateModuleStructs(module_output);
+#if !defined( VULKAN_HPP_ENABLE_DYNAMIC_LOADER_TOOL )
+#  define VULKAN_HPP_ENABLE_DYNAMIC_LOADER_TOOL 1
+#endif
 
-        // === HANDLEs ===
-        generateModuleHandles(module_output);
+#if !defined( __has_include )
+#  define __has_include( x ) false
+#endif
 
-        /*
-            module_output += R"(
-          //=====================
-          //=== Format Traits ===
-          //=====================
+)";
+        if (cfg.gen.spaceshipOperator && !cfg.gen.globalMode) {
+            output += R"(
+//#if ( 201907 <= __cpp_lib_three_way_comparison ) && __has_include( <compare> ) && !defined( VULKAN_HPP_NO_SPACESHIP_OPERATOR )
+//#  define VULKAN_HPP_HAS_SPACESHIP_OPERATOR
+//#endif
+#ifndef VULKAN_HPP_NO_SPACESHIP_OPERATOR
+#  if __has_include( <compare> )
+#    include <compare>
+#    if ( 201907L <= __cpp_lib_three_way_comparison )
+#      define VULKAN_HPP_HAS_SPACESHIP_OPERATOR
+#    endif
+#  endif
+#endif
+)";
+        }
+        else if (cfg.gen.spaceshipOperator && cfg.gen.structCompare.data.enabled()) {
+            // defaulted operator<=> of global mode structs
+            output += "\n#include <compare>\n";
+        }
 
-          //======================================
-          //=== Extension inspection functions ===
-          //======================================
-        )";
-        */
+        if (cfg.gen.branchHint) {
+            output += R"(
+#if !defined( VULKAN_HPP_LIKELY )
+#  if defined( __clang__ )
+#    define VULKAN_HPP_LIKELY [[likely]]
+#  else
+#    define VULKAN_HPP_LIKELY
+#  endif
+#endif
 
-        //    if (false) {
-        //        module_output += R"(
-        //  //===========================
-        //  //=== COMMANDs ===
-        //  //===========================
-        //)";
-        //        module_output += std::move(functionsPublic);
-        //    }
+#if !defined( VULKAN_HPP_UNLIKELY )
+#  if defined( __clang__ )
+#    define VULKAN_HPP_UNLIKELY [[unlikely]]
+#  else
+#    define VULKAN_HPP_UNLIKELY
+#  endif
+#endif
+)";
+        }
 
-        if (cfg.gen.raii.enabled) {
-            module_output += "  namespace VULKAN_HPP_RAII_NAMESPACE {\n";
+        if (cfg.gen.coldErrorPaths) {
+            output += R"(
+#if !defined( VULKAN_HPP_NOINLINE )
+#  if defined( __clang__ ) || defined( __GNUC__ )
+#    define VULKAN_HPP_NOINLINE __attribute__( ( noinline ) )
+#  elif defined( _MSC_VER )
+#    define VULKAN_HPP_NOINLINE __declspec( noinline )
+#  else
+#    define VULKAN_HPP_NOINLINE
+#  endif
+#endif
 
-            module_output += R"(
-  //======================
-  //=== RAII HARDCODED ===
-  //======================
+#if !defined( VULKAN_HPP_COLD )
+#  if defined( __clang__ ) || defined( __GNUC__ )
+#    define VULKAN_HPP_COLD __attribute__( ( cold, noinline ) )
+#  else
+#    define VULKAN_HPP_COLD VULKAN_HPP_NOINLINE
+#  endif
+#endif
 )";
-            module_output += vkgen::format(R"(
-    using {0}::{1};
-  // using {0}::{1}Dispatcher;
-  using {0}::DeviceDispatcher;
-  using {0}::InstanceDispatcher;
-  using {0}::exchange;
-  )",
-                                           m_ns_raii,
-                                           loader.name);
+        }
 
-            module_output += R"(
-  //====================
-  //=== RAII HANDLEs ===
-  //====================
-)";
+        output += R"(
+#if ( 201803 <= __cpp_lib_span )
+#  define VULKAN_HPP_SUPPORT_SPAN
+#endif
 
-            for (const Handle &e : this->handles.ordered) {
-                genOptional(module_output, e, [&](auto &output) { output += "  using " + m_ns_raii + "::" + e.name + ";\n"; });
-            }
+#ifndef VK_USE_64_BIT_PTR_DEFINES
+#  if defined( __LP64__ ) || defined( _WIN64 ) || ( defined( __x86_64__ ) && !defined( __ILP32__ ) ) || defined( _M_X64 ) || defined( __ia64 ) || \
+    defined( _M_IA64 ) || defined( __aarch64__ ) || defined( __powerpc64__ ) || ( defined( __riscv ) && __riscv_xlen == 64 )
+#    define VK_USE_64_BIT_PTR_DEFINES 1
+#  else
+#    define VK_USE_64_BIT_PTR_DEFINES 0
+#  endif
+#endif
 
-            module_output += "  } // VULKAN_HPP_RAII_NAMESPACE\n";
-        }
+// 32-bit vulkan is not typesafe for non-dispatchable handles, so don't allow copy constructors on this platform by default.
+// To enable this feature on 32-bit platforms please define VULKAN_HPP_TYPESAFE_CONVERSION
+#if ( VK_USE_64_BIT_PTR_DEFINES == 1 )
+#  if !defined( VULKAN_HPP_TYPESAFE_CONVERSION )
+#    define VULKAN_HPP_TYPESAFE_CONVERSION
+#  endif
+#endif
 
-        module_output += endNamespace();
+// <tuple> includes <sys/sysmacros.h> through some other header
+// this results in major(x) being resolved to gnu_dev_major(x)
+// which is an expression in a constructor initializer list.
+#if defined( major )
+#  undef major
+#endif
+#if defined( minor )
+#  undef minor
+#endif
 
-//        module_output += "module : private;\n";
-//        module_output += beginNamespace();
-//        module_output += endNamespace();
+// Windows defines MemoryBarrier which is deprecated and collides
+// with the VULKAN_HPP_NAMESPACE::MemoryBarrier struct.
+#if defined( MemoryBarrier )
+#  undef MemoryBarrier
+#endif
 
-        outModule.writeFiles(*this);
-    }
+#if !defined( VULKAN_HPP_HAS_UNRESTRICTED_UNIONS )
+#  if defined( __clang__ )
+#    if __has_feature( cxx_unrestricted_unions )
+#      define VULKAN_HPP_HAS_UNRESTRICTED_UNIONS
+#    endif
+#  elif defined( __GNUC__ )
+#    define GCC_VERSION ( __GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__ )
+#    if 40600 <= GCC_VERSION
+#      define VULKAN_HPP_HAS_UNRESTRICTED_UNIONS
+#    endif
+#  elif defined( _MSC_VER )
+#    if 1900 <= _MSC_VER
+#      define VULKAN_HPP_HAS_UNRESTRICTED_UNIONS
+#    endif
+#  endif
+#endif
 
-    template <typename T>
-    static void generateForwardDeclarations(vkgen::OutputBuffer &output, const std::vector<T> &items, vkgen::Generator &gen) {
-        output += gen.beginNamespace();
-        for (const vkgen::GenericType &i : items) {
-            output += gen.genOptional(i, [&](auto &output) { output += "  " + i.metaTypeDeclaration() + " " + i.name + ";\n"; });
-        }
-        output += gen.endNamespace();
-    }
+#if !defined( VULKAN_HPP_INLINE )
+#  if defined( __clang__ )
+#    if __has_attribute( always_inline )
+#      define VULKAN_HPP_INLINE __attribute__( ( always_inline ) ) __inline__
+#    else
+#      define VULKAN_HPP_INLINE inline
+#    endif
+#  elif defined( __GNUC__ )
+#    define VULKAN_HPP_INLINE __attribute__( ( always_inline ) ) __inline__
+#  elif defined( _MSC_VER )
+#    define VULKAN_HPP_INLINE inline
+#  else
+#    define VULKAN_HPP_INLINE inline
+#  endif
+#endif
 
-    void Generator::wrapNamespace(OutputBuffer &output, std::function<void(OutputBuffer &)> func) {
-        output += beginNamespace();
-        func(output);
-        output += endNamespace();
-    }
+#if defined( VULKAN_HPP_TYPESAFE_CONVERSION )
+#  define VULKAN_HPP_TYPESAFE_EXPLICIT
+#else
+#  define VULKAN_HPP_TYPESAFE_EXPLICIT explicit
+#endif
 
-    void Generator::generateForwardHandles(OutputBuffer &output) {
-        output += beginNamespace();
-        for (const auto &e : handles.ordered) {
-            generateClassDecl(output, e);
+#if defined( __cpp_constexpr )
+#  define VULKAN_HPP_CONSTEXPR constexpr
+#  if __cpp_constexpr >= 201304
+#    define VULKAN_HPP_CONSTEXPR_14 constexpr
+#  else
+#    define VULKAN_HPP_CONSTEXPR_14
+#  endif
+#  define VULKAN_HPP_CONST_OR_CONSTEXPR constexpr
+#else
+#  define VULKAN_HPP_CONSTEXPR
+#  define VULKAN_HPP_CONSTEXPR_14
+#  define VULKAN_HPP_CONST_OR_CONSTEXPR const
+#endif
+
+#if !defined( VULKAN_HPP_CONSTEXPR_INLINE )
+#  if 201606L <= __cpp_inline_variables
+#    define VULKAN_HPP_CONSTEXPR_INLINE VULKAN_HPP_CONSTEXPR inline
+#  else
+#    define VULKAN_HPP_CONSTEXPR_INLINE VULKAN_HPP_CONSTEXPR
+#  endif
+#endif
+
+#if !defined( VULKAN_HPP_NOEXCEPT )
+#  if defined( _MSC_VER ) && ( _MSC_VER <= 1800 )
+#    define VULKAN_HPP_NOEXCEPT
+#  else
+#    define VULKAN_HPP_NOEXCEPT     noexcept
+#    define VULKAN_HPP_HAS_NOEXCEPT 1
+#    if defined( VULKAN_HPP_NO_EXCEPTIONS )
+#      define VULKAN_HPP_NOEXCEPT_WHEN_NO_EXCEPTIONS noexcept
+#    else
+#      define VULKAN_HPP_NOEXCEPT_WHEN_NO_EXCEPTIONS
+#    endif
+#  endif
+#endif
+
+#if 14 <= VULKAN_HPP_CPP_VERSION
+#  define VULKAN_HPP_DEPRECATED( msg ) [[deprecated( msg )]]
+#else
+#  define VULKAN_HPP_DEPRECATED( msg )
+#endif
+
+#if ( 17 <= VULKAN_HPP_CPP_VERSION ) && !defined( VULKAN_HPP_NO_NODISCARD_WARNINGS )
+#  define VULKAN_HPP_NODISCARD [[nodiscard]]
+#  if defined( VULKAN_HPP_NO_EXCEPTIONS )
+#    define VULKAN_HPP_NODISCARD_WHEN_NO_EXCEPTIONS [[nodiscard]]
+#  else
+#    define VULKAN_HPP_NODISCARD_WHEN_NO_EXCEPTIONS
+#  endif
+#else
+#  define VULKAN_HPP_NODISCARD
+#  define VULKAN_HPP_NODISCARD_WHEN_NO_EXCEPTIONS
+#endif
+
+#if defined( VULKAN_HPP_NO_DEFAULT_DISPATCHER )
+#  define VULKAN_HPP_DEFAULT_ARGUMENT_ASSIGNMENT
+#  define VULKAN_HPP_DEFAULT_ARGUMENT_NULLPTR_ASSIGNMENT
+#  define VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT
+#else
+#  define VULKAN_HPP_DEFAULT_ARGUMENT_ASSIGNMENT         = {}
+#  define VULKAN_HPP_DEFAULT_ARGUMENT_NULLPTR_ASSIGNMENT = nullptr
+#  define VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT       = VULKAN_HPP_DEFAULT_DISPATCHER
+#endif
+
+#ifndef VULKAN_HPP_DEFAULT_ALLOCATOR_ASSIGNMENT
+#  define VULKAN_HPP_DEFAULT_ALLOCATOR_ASSIGNMENT        VULKAN_HPP_DEFAULT_ARGUMENT_NULLPTR_ASSIGNMENT
+#endif
+
+)";
+
+        output += R"(
+#define VULKAN_HPP_STRINGIFY2( text ) #text
+#define VULKAN_HPP_STRINGIFY( text )  VULKAN_HPP_STRINGIFY2( text )
+)";
+        output += genNamespaceMacro(cfg.macro.mNamespace);
+
+        if (cfg.gen.raii.interop) {
+            output += R"(
+#ifdef VULKAN_HPP_EXPERIMENTAL_INTEROP
+#   undef VULKAN_HPP_EXPERIMENTAL_NO_INTEROP
+#else
+#   define VULKAN_HPP_EXPERIMENTAL_NO_INTEROP
+#endif
+
+#ifdef VULKAN_HPP_EXPERIMENTAL_NO_INDIRECT_CMDS
+#   undef VULKAN_HPP_EXPERIMENTAL_NO_RAII_INDIRECT
+#   define VULKAN_HPP_EXPERIMENTAL_NO_RAII_INDIRECT_SUB
+#else
+#   undef VULKAN_HPP_EXPERIMENTAL_NO_RAII_INDIRECT_SUB
+#   define VULKAN_HPP_EXPERIMENTAL_NO_RAII_INDIRECT
+#endif
+
+)";
         }
-        //        for (const Handle &e : handles.ordered) {
-        //            if (e.uniqueVariant()) {
-        //                output += generateClassDecl(e, "Unique" + e.name);
-        //            }
-        //        }
-        output += endNamespace();
+
+        output += "\n";
+    }
+
+    std::string Generator::generateHeader() {
+        std::string output;
+
+        output += "#include \"vulkan.h\"\n";
+        output += "#include \"vulkan_hpp_macros.hpp\"\n";
+        // output += "#include <vulkan/vulkan.h>\n";
+
+        output += vkgen::format(R"(
+static_assert(VK_HEADER_VERSION == {0}, "Wrong VK_HEADER_VERSION!");
+)",
+                                headerVersion);
+        if (cfg.gen.importStdMacro) {
+            output += R"(
+#ifdef USE_IMPORT_STD
+import std;
+#else
+)";
+        }
+
+        if (cfg.gen.cppStd >= 20) {
+            output += R"(
+#include <bit>   // std::bit_cast
+#include <version> // __cpp_lib_span
+)";
+        }
+
+        output += R"(
+#include <algorithm> // std::find
+)";
+        if (cfg.gen.globalMode) {
+            output += R"(
+#include <type_traits>
+)";
+        }
+        if (!cfg.gen.globalMode) {
+            output += R"(
+#include <array>   // ArrayWrapperND
+)";
+        }
+        output += R"(
+#include <cstring> // strcmp, std::memcpy
+)";
+        output += R"(
+#include <string>  // std::string
+
+/*
+#if 17 <= VULKAN_HPP_CPP_VERSION
+#  include <string_view>  // std::string_view
+#endif
+*/
+
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
+#  include <tuple>   // std::tie
+)";
+        if (!cfg.gen.globalMode) {
+            output += "#  include <vector>  // std::vector\n";
+        }
+        output += R"(
+#endif
+
+#if !defined( VULKAN_HPP_NO_EXCEPTIONS )
+#  include <system_error>  // std::is_error_code_enum
+#endif
+
+#if defined( VULKAN_HPP_SUPPORT_SPAN )
+#  include <span>
+#endif
+)";
+
+        if (cfg.gen.globalMode) {
+            output += R"(
+#  include <cstdio>   // std::snprintf
+)";
+        }
+        else if (cfg.gen.expApi) {
+            output += R"(
+#ifdef VULKAN_HPP_EXPERIMENTAL_HEX
+#  include <cstdio>   // std::snprintf
+#elif __cpp_lib_format
+#  include <format>   // std::format
+#else
+#  include <sstream>  // std::stringstream
+#endif
+)";
+        } else {
+            output += R"(
+#if __cpp_lib_format
+#  include <format>   // std::format
+#else
+#  include <sstream>  // std::stringstream
+#endif
+)";
+        }
+
+        if (cfg.gen.importStdMacro) {
+            output += R"(
+#endif
+)";
+        }
+
+        output += "\n";
+        return output;
+    }
+
+    void Generator::generateFlags(vkgen::OutputBuffer &output) const {
+        if (cfg.gen.enumMock >= 2) {
+            output += R"(
+  template <typename BitType>
+  class Flags
+  {
+  public:
+    using MaskType = typename std::underlying_type<BitType>::type;
+
+    // constructors
+    VULKAN_HPP_CONSTEXPR Flags() VULKAN_HPP_NOEXCEPT : m_mask( 0 ) {}
+
+    VULKAN_HPP_CONSTEXPR Flags( BitType bit ) VULKAN_HPP_NOEXCEPT : m_mask( static_cast<MaskType>( bit ) ) {}
+
+    VULKAN_HPP_CONSTEXPR Flags( Flags<BitType> const & rhs ) VULKAN_HPP_NOEXCEPT = default;
+
+    VULKAN_HPP_CONSTEXPR explicit Flags( MaskType flags ) VULKAN_HPP_NOEXCEPT : m_mask( flags ) {}
+
+    // relational operators
+  #if defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
+    auto operator<=>( Flags<BitType> const & ) const = default;
+  #else
+    VULKAN_HPP_CONSTEXPR bool operator<( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return m_mask < rhs.m_mask;
+    }
+
+    VULKAN_HPP_CONSTEXPR bool operator<=( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return m_mask <= rhs.m_mask;
+    }
+
+    VULKAN_HPP_CONSTEXPR bool operator>( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return m_mask > rhs.m_mask;
     }
 
-    class CCodeGenerator {
-        Generator &gen;
-        OutputBuffer &output;
-        std::unordered_set<std::string> generated;
-        bool dbg = true;
+    VULKAN_HPP_CONSTEXPR bool operator>=( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return m_mask >= rhs.m_mask;
+    }
+
+    VULKAN_HPP_CONSTEXPR bool operator==( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return m_mask == rhs.m_mask;
+    }
+
+    VULKAN_HPP_CONSTEXPR bool operator!=( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return m_mask != rhs.m_mask;
+    }
+  #endif
+
+    // logical operator
+    VULKAN_HPP_CONSTEXPR bool operator!() const VULKAN_HPP_NOEXCEPT
+    {
+      return !m_mask;
+    }
+
+    // bitwise operators
+    VULKAN_HPP_CONSTEXPR Flags<BitType> operator&( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return Flags<BitType>( m_mask & rhs.m_mask );
+    }
+
+    VULKAN_HPP_CONSTEXPR Flags<BitType> operator|( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return Flags<BitType>( m_mask | rhs.m_mask );
+    }
+
+    VULKAN_HPP_CONSTEXPR Flags<BitType> operator^( Flags<BitType> const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {
+      return Flags<BitType>( m_mask ^ rhs.m_mask );
+    }
+
+    VULKAN_HPP_CONSTEXPR Flags<BitType> operator~() const VULKAN_HPP_NOEXCEPT
+    {
+      return Flags<BitType>( m_mask ^ static_cast<MaskType>(BitType::allFlags) );
+    }
+
+    // assignment operators
+    VULKAN_HPP_CONSTEXPR_14 Flags<BitType> & operator=( Flags<BitType> const & rhs ) VULKAN_HPP_NOEXCEPT = default;
+
+    VULKAN_HPP_CONSTEXPR_14 Flags<BitType> & operator|=( Flags<BitType> const & rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      m_mask |= rhs.m_mask;
+      return *this;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 Flags<BitType> & operator&=( Flags<BitType> const & rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      m_mask &= rhs.m_mask;
+      return *this;
+    }
+
+    VULKAN_HPP_CONSTEXPR_14 Flags<BitType> & operator^=( Flags<BitType> const & rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      m_mask ^= rhs.m_mask;
+      return *this;
+    }
+
+    // cast operators
+    explicit VULKAN_HPP_CONSTEXPR operator bool() const VULKAN_HPP_NOEXCEPT
+    {
+      return !!m_mask;
+    }
+
+    explicit VULKAN_HPP_CONSTEXPR operator MaskType() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_mask;
+    }
+
+  #if defined( VULKAN_HPP_FLAGS_MASK_TYPE_AS_PUBLIC )
+  public:
+  #else
+  private:
+  #endif
+    MaskType m_mask;
+  };
+
+  #if !defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
+  // relational operators only needed for pre C++20
+  template <typename BitType>
+  VULKAN_HPP_CONSTEXPR bool operator<( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
+  {
+    return flags.operator>( bit );
+  }
+
+  template <typename BitType>
+  VULKAN_HPP_CONSTEXPR bool operator<=( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
+  {
+    return flags.operator>=( bit );
+  }
+
+  template <typename BitType>
+  VULKAN_HPP_CONSTEXPR bool operator>( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
+  {
+    return flags.operator<( bit );
+  }
+
+  template <typename BitType>
+  VULKAN_HPP_CONSTEXPR bool operator>=( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
+  {
+    return flags.operator<=( bit );
+  }
+
+  template <typename BitType>
+  VULKAN_HPP_CONSTEXPR bool operator==( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
+  {
+    return flags.operator==( bit );
+  }
+
+  template <typename BitType>
+  VULKAN_HPP_CONSTEXPR bool operator!=( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
+  {
+    return flags.operator!=( bit );
+  }
+  #endif
+
+  // bitwise operators
+  template <typename BitType>
+  VULKAN_HPP_CONSTEXPR Flags<BitType> operator&( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
+  {
+    return flags.operator&( bit );
+  }
+
+  template <typename BitType>
+  VULKAN_HPP_CONSTEXPR Flags<BitType> operator|( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
+  {
+    return flags.operator|( bit );
+  }
+
+  template <typename BitType>
+  VULKAN_HPP_CONSTEXPR Flags<BitType> operator^( BitType bit, Flags<BitType> const & flags ) VULKAN_HPP_NOEXCEPT
+  {
+    return flags.operator^( bit );
+  }
+
+
+  // bitwise operators on BitType
+  template <typename BitType>
+  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator&( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return Flags<BitType>( lhs ) & rhs;
+  }
+  template <typename BitType>
+  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator~( BitType bit ) VULKAN_HPP_NOEXCEPT
+  {
+    return ~( Flags<BitType>( bit ) );
+  }
+
+  template <typename BitType>
+  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator|( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return Flags<BitType>( lhs ) | rhs;
+  }
+
+  template <typename BitType>
+  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator^( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return Flags<BitType>( lhs ) ^ rhs;
+  }
+)";
+            return;
+        }
+
+        if (cfg.gen.enumMock == 1) {
+            return;
+        }
+
+        if (useCompactFlags()) {
+            output += RES_FLAGS_COMPACT;
+            return;
+        }
+
+        output += expIfndef("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
+        output += RES_FLAG_TRAITS;
+        output += expEndif("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
+        output += RES_FLAGS_1;
+        output += expIfndef("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
+        output += R"(
+    VULKAN_HPP_CONSTEXPR Flags<BitType> operator~() const VULKAN_HPP_NOEXCEPT
+    {
+      return Flags<BitType>( m_mask ^ FlagTraits<BitType>::allFlags.m_mask );
+    }
+)";
+        output += expEndif("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
+        output += RES_FLAGS_2;
+        output += expIfndef("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
+        output += R"(
+  // bitwise operators on BitType
+  template <typename BitType, typename std::enable_if<FlagTraits<BitType>::isBitmask, bool>::type = true>
+  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator&( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return Flags<BitType>( lhs ) & rhs;
+  }
+  template <typename BitType, typename std::enable_if<FlagTraits<BitType>::isBitmask, bool>::type = true>
+  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator~( BitType bit ) VULKAN_HPP_NOEXCEPT
+  {
+    return ~( Flags<BitType>( bit ) );
+  }
+)";
+
+        if (cfg.gen.expApi) {
+            output += R"(
+#ifndef VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS
+  template <typename BitType, typename std::enable_if<FlagTraits<BitType>::isBitmask, bool>::type = true>
+#else
+  template <typename BitType>
+#endif
+  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator|( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return Flags<BitType>( lhs ) | rhs;
+  }
+#ifndef VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS
+  template <typename BitType, typename std::enable_if<FlagTraits<BitType>::isBitmask, bool>::type = true>
+#else
+  template <typename BitType>
+#endif
+  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator^( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return Flags<BitType>( lhs ) ^ rhs;
+  }
+)";
+        } else {
+            output += R"(
+  template <typename BitType, typename std::enable_if<FlagTraits<BitType>::isBitmask, bool>::type = true>
+  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator|( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return Flags<BitType>( lhs ) | rhs;
+  }
+
+  template <typename BitType, typename std::enable_if<FlagTraits<BitType>::isBitmask, bool>::type = true>
+  VULKAN_HPP_INLINE VULKAN_HPP_CONSTEXPR Flags<BitType> operator^( BitType lhs, BitType rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    return Flags<BitType>( lhs ) ^ rhs;
+  }
+)";
+        }
+
+        output += expEndif("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
+    }
+
+    std::string FunctionGenerator::getTemplate() const {
+        return additonalTemplate;
+    }
+
+    void FunctionGenerator::generatePrefix(std::string &output, bool declaration, bool isInline) {
+        const auto &cfg = gen.getConfig();
+
+        if (specifierInline) {
+            if (isInline || ! cfg.gen.cppFiles) {
+                output += cfg.macro.mInline.get() + " ";
+            }
+        }
+        if (specifierExplicit && declaration) {
+            output += cfg.macro.mExplicit.get() + " ";
+        }
+        if (specifierConstexpr) {
+            output += cfg.macro.mConstexpr.get() + " ";
+        } else if (specifierConstexpr14) {
+            output += cfg.macro.mConstexpr14.get() + " ";
+        }
+    }
+
+    void FunctionGenerator::generateSuffix(std::string &output, bool declaration) {
+        if (specifierConst) {
+            output += " const";
+        }
+        if (specifierNoexcept) {
+            output += " VULKAN_HPP_NOEXCEPT";
+        }
+    }
+
+    void FunctionGenerator::generateArgument(std::string &output, const Argument &arg, bool declaration) {
+        output += arg.type;
+        output += ' ';
+        output += arg.id;
+        if (declaration) {
+            output += arg.assignment;
+        }
+    }
+
+    void FunctionGenerator::generateArgument(std::string &output, const VariableData *var, bool declaration) {
+        output += "/*V*/";
+    }
+
+    void FunctionGenerator::generateArguments(std::string &output, bool declaration) {
+        for (const auto &a : arguments) {
+
+            std::visit([&](auto&& arg) {
+                generateArgument(output, arg, declaration);
+                output += ", ";
+            }, a);
+
+        }
+        if (output.ends_with(", ")) {
+            output.erase(output.end() - 2);
+        }
+    }
+
+    void FunctionGenerator::generatePrototype(std::string &output, bool declaration, bool isInline) {
+        generatePrefix(output, declaration, isInline);
+        std::string templ = getTemplate();
+        if (!templ.empty()) {
+            output += "template<";
+            output += templ;
+            output += ">\n";
+            output += indent;
+        }
+        output += type;
+        if (!type.empty()) {
+            output += ' ';
+        }
+        if (!declaration && !className.empty()) {
+            output += className;
+            output += "::";
+        }
+        output += name;
+        output += '(';
+        generateArguments(output, declaration);
+        output += ")";
+        generateSuffix(output, declaration);
+    }
+
+    std::string FunctionGenerator::generate(bool declaration, bool isInline) {
+        std::string output = indent;
+        generatePrototype(output, declaration, isInline);
+        output += '\n';
+        if (!inits.empty()) {
+            output += indent;
+            output += "  : ";
+            for (size_t i = 0; i < inits.size(); ++i) {
+
+                output += inits[i].dst;
+                output += '(';
+                output += inits[i].src;
+                output += ')';
+                if (i != inits.size() - 1) {
+                    output += ',';
+                }
+                output += '\n';
+                output += indent;
+                output += "    ";
+            }
+            strStripSuffix(output, "    ");
+        }
+        output += indent;
+        output += "{\n";
+        output += code;
+        output += indent;
+        output += "}\n\n";
+        return output;
+    }
+
+    std::string FunctionGenerator::generate() {
+        return generate(true, true);
+    }
+
+    std::string FunctionGenerator::generate(GuardedOutputFuncs &impl) {
+        const bool hasTemplate = !getTemplate().empty();
+        bool genInline = allowInline;
+        if (gen.getConfig().gen.cppFiles && (!hasTemplate || !allowInline)) {
+            genInline = false;
+        }
+        if (genInline) {
+            return generate();
+        }
+        std::string output = indent;
+        generatePrototype(output, true);
+        output += ";\n\n";
+
+        std::vector<Protect> protects;
+        if (!optionalProtect.first.empty()) {
+            protects.emplace_back(optionalProtect);
+        }
+        if (base) {
+            const auto &p = base->getProtect();
+            if (!p.empty()) {
+                protects.emplace_back(p, true);
+            }
+        }
+
+        std::string def = generate(false);
+        if (hasTemplate) {
+            impl.templ.get(protects) += std::move(def);
+        }
+        else {
+            impl.def.get(protects) += std::move(def);
+        }
+        return output;
+    }
+
+    class UniqueBaseGenerator
+    {
+        const Generator &gen;
+        bool             exp;
+        bool             global;
+
+      public:
+        bool        alloc;
+        bool        dispatch;
+        bool        owner   = true;
+        bool        destroy = true;
+        bool        destroyRef = false;
+        bool        pool    = false;
+        bool        compact = false;
+        std::string name;
+        std::string templ;
+        std::string specialization;
+        std::string destroyType;
+
+        UniqueBaseGenerator(const Generator &gen) noexcept
+          : gen(gen), exp(gen.getConfig().gen.expApi), global(gen.getConfig().gen.globalMode), alloc(gen.getConfig().gen.allocatorParam) {
+            dispatch = !exp;
+            // global mode deleters destroy through vk::device, compact ones don't store the owner
+            compact = gen.getConfig().gen.uniqueCompact && (global || !exp);
+        }
+
+        void generate(OutputBuffer &output) {
+            OutputClass out {
+                .name = this->name + specialization
+            };
+            std::string    ownerType = exp ? "OwnerType*" : "OwnerType";
+            const bool     stored    = owner && !(global && compact);
+
+            out.sPublic += "    " + name + "() = default;\n";
+
+            ArgumentBuilder args(false);
+            if (stored) {
+                args.append( exp ? "OwnerType&" : "OwnerType", " owner", "", "m_owner", exp);
+                out.sPrivate += "    " + ownerType + " m_owner = {};\n";
+            }
+            if (pool) {
+                args.append("PoolType", " pool", "", "m_pool");
+                out.sPrivate += "    PoolType m_pool = {};\n";
+            }
+            if (alloc) {
+                args.append("Optional<const AllocationCallbacks>", " allocationCallbacks", " VULKAN_HPP_DEFAULT_ALLOCATOR_ASSIGNMENT", "m_allocationCallbacks");
+                out.sPrivate += "    Optional<const AllocationCallbacks> m_allocationCallbacks = nullptr;\n";
+            }
+            if (dispatch && compact) {
+                // empty base for default dispatcher
+                out.inherits += "public detail::UniqueDispatch<Dispatch>";
+                args.append("Dispatch const &", "dispatch", " VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT");
+            } else if (dispatch) {
+                args.append("Dispatch const &", "dispatch", " VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT", "m_dispatch", true);
+                out.sPrivate += "    Dispatch const *                    m_dispatch            = nullptr;\n";
+            }
+
+            if (args.size() > 0) {
+                std::string init = args.initializer();
+                if (dispatch && compact) {
+                    // base is initialized first
+                    init = " : detail::UniqueDispatch<Dispatch>(dispatch)" + (init.empty() ? "" : ", " + init.substr(3));
+                }
+                out.sPublic += "    " + name + "(" + args.string() + ") VULKAN_HPP_NOEXCEPT\n";
+                out.sPublic += "     " + init + "\n";
+                out.sPublic += "    {\n";
+                out.sPublic += "    }\n";
+            }
+
+            if (stored) {
+                out.sPublic += vkgen::format(R"(
+    {0} getOwner() const VULKAN_HPP_NOEXCEPT
+    {{
+      return m_owner;
+    }}
+)",
+                                             ownerType);
+            }
+            if (alloc) {
+                out.sPublic += vkgen::format(R"(
+    Optional<const AllocationCallbacks> getAllocator() const VULKAN_HPP_NOEXCEPT
+    {{
+      return m_allocationCallbacks;
+    }}
+)");
+            }
+            if (dispatch) {
+                out.sPublic += vkgen::format(R"(
+    Dispatch const & getDispatch() const VULKAN_HPP_NOEXCEPT
+    {{
+      return {0};
+    }}
+)",
+                                             compact ? "detail::UniqueDispatch<Dispatch>::get()" : "*m_dispatch");
+            }
+            if (destroy && global && owner) {
+                std::string code = "detail::unique" + strFirstUpper(destroyType) + "( ";
+                code += pool ? "m_pool, t" : "t";
+                if (alloc) {
+                    code += ", m_allocationCallbacks";
+                }
+                out.sProtected += vkgen::format(R"(
+    template <typename T>
+    void destroy( T t ) VULKAN_HPP_NOEXCEPT
+    {{
+      {0} );
+    }}
+)",
+                                                code);
+            } else if (destroy) {
+                std::string assert;
+                std::string code = "      ";
+                if (owner) {
+                    assert += "m_owner";
+                    code += "m_owner";
+                    code += exp? "->" : ".";
+                } else {
+                    code += "t.";
+                }
+                if (dispatch && !compact) {
+                    if (!assert.empty()) {
+                        assert += " && ";
+                    }
+                    assert += "m_dispatch";
+                }
+                if (!assert.empty()) {
+                    assert = "VULKAN_HPP_ASSERT ( " + assert + " );\n";
+                }
+                code += destroyType;
+                code += "(";
+                if (pool) {
+                    code += "m_pool";
+                }
+                if (owner) {
+                    if (pool) {
+                        code += ", ";
+                    }
+                    code += "t";
+                }
+                if (alloc) {
+                    if (owner) {
+                        code += ", ";
+                    }
+                    code += "m_allocationCallbacks";
+                }
+                if (dispatch) {
+                    if (owner || alloc) {
+                        code += ", ";
+                    }
+                    code += compact ? "this->getDispatch()" : "*m_dispatch";
+                }
+                code += ");\n";
+                out.sProtected += vkgen::format(R"(
+    template <typename T>
+    void destroy( {2} t ) VULKAN_HPP_NOEXCEPT
+    {{
+      {0}{1}
+    }}
+)",
+                                                assert,
+                                                code,
+                                                destroyRef? "const T&" : "T");
+            }
+
+            std::string t = templ;
+
+            if (pool) {
+                if (!t.empty()) {
+                    t += ", ";
+                }
+                t += "typename PoolType";
+            }
+            if (dispatch) {
+                if (!t.empty()) {
+                    t += ", ";
+                }
+                t += "typename Dispatch";
+            }
+            output += "  template <";
+            output += t;
+            output += ">\n";
+            output += std::move(out);
+            output += "\n";
+        }
+    };
+
+    void Generator::generateMainFile(GenOutput &files) {
+        auto &output          = files.addFile("");
+
+        output += generateHeader();
+#ifdef INST
+        output += Inst::mainFileBegin();
+#endif
+
+        generateArrays(files, output);
+        generateVector(files, output);
+
+        output += beginNamespace();
+
+        output += RES_OPTIONAL;
+
+        gen(output, cfg.gen.smartHandles, [&](auto &output) {
+            if (cfg.gen.expApi) {
+                output += RES_UNIQUE_HANDLE_EXP;
+            } else {
+                output += RES_UNIQUE_HANDLE;
+            }
+
+            if (cfg.gen.uniqueCompact && !cfg.gen.expApi && !cfg.gen.globalMode) {
+                output += "  namespace detail\n  {\n    template <typename Dispatch>\n    class UniqueDispatch;\n  }\n\n";
+            }
+            if (cfg.gen.globalMode) {
+                output += RES_UNIQUE_GLOBAL_DESTROY;
+            }
+
+            UniqueBaseGenerator g(*this);
+            g.name        = "ObjectDestroy";
+            g.templ       = "typename OwnerType";
+            g.destroyType = "destroy";
+            output += "  struct AllocationCallbacks;\n\n";
+            g.generate(output);
+
+            g.templ.clear();
+            g.specialization = "<NoParent";
+            g.specialization += (g.dispatch ? ", Dispatch>" : ">");
+            g.owner = false;
+            g.destroyRef = true;
+            output += "  class NoParent;\n\n";
+            g.generate(output);
+
+            g.name        = "ObjectFree";
+            g.templ       = "typename OwnerType";
+            g.destroyType = "free";
+            g.specialization.clear();
+            g.owner = true;
+            g.destroyRef = false;
+            g.generate(output);
+
+            g.name        = "ObjectRelease";
+            g.destroyType = "release";
+            g.alloc       = false;
+            g.generate(output);
+
+            g.name        = "PoolFree";
+            g.destroyType = "free";
+            g.pool        = true;
+            g.generate(output);
+        });
+
+        if (!cfg.gen.globalMode) {
+            generateDispatch(output);
+            output += RES_BASE_TYPES;
+        }
+
+        if (cfg.gen.uniqueCompact && !cfg.gen.expApi && !cfg.gen.globalMode) {
+            gen(output, cfg.gen.smartHandles, [&](auto &output) { output += RES_UNIQUE_DISPATCH; });
+        }
+
+        if (cfg.gen.globalMode) {
+            output += R"(
+  VULKAN_HPP_INLINE std::string toHexString( uint32_t value )
+  {
+    std::string str;
+    str.resize(6);
+    int n = std::snprintf(str.data(), str.size(), "%x", value);
+    VULKAN_HPP_ASSERT( n > 0 );
+    return str;
+  }
+)";
+
+        }
+        else if (cfg.gen.expApi) {
+            output += R"(
+  VULKAN_HPP_INLINE std::string toHexString( uint32_t value )
+  {
+#ifdef VULKAN_HPP_EXPERIMENTAL_HEX
+    std::string str;
+    str.resize(6);
+    int n = std::snprintf(str.data(), str.size(), "%x", value);
+    VULKAN_HPP_ASSERT( n > 0 );
+    return str;
+#elif __cpp_lib_format
+    return std::format( "{:x}", value );
+#else
+    std::stringstream stream;
+    stream << std::hex << value;
+    return stream.str();
+#endif
+  }
+)";
+        } else {
+            output += R"(
+  VULKAN_HPP_INLINE std::string toHexString( uint32_t value )
+  {
+#if __cpp_lib_format
+    return std::format( "{:x}", value );
+#else
+    std::stringstream stream;
+    stream << std::hex << value;
+    return stream.str();
+#endif
+  }
+)";
+        }
+
+
+        output += endNamespace();
+        if (!cfg.gen.onlyC) {
+            output += "#include \"vulkan_enums.hpp\"\n";
+            output += R"(#if !defined( VULKAN_HPP_NO_TO_STRING )
+#  include "vulkan_to_string.hpp"
+#endif
+)";
+        }
+        output += beginNamespace();
+        generateErrorClasses(output);
+        output += "\n";
+        generateResultValue(output);
+
+        generateApiConstants(output);
+
+        output += R"(
+  //=========================
+  //=== CONSTEXPR CALLEEs ===
+  //=========================
+  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+  VULKAN_HPP_CONSTEXPR uint32_t apiVersionMajor( T const version )
+  {
+    return ( ( ( uint32_t )( version ) >> 22U ) & 0x7FU );
+  }
+  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+  VULKAN_HPP_CONSTEXPR uint32_t apiVersionMinor( T const version )
+  {
+    return ( ( ( uint32_t )( version ) >> 12U ) & 0x3FFU );
+  }
+  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+  VULKAN_HPP_CONSTEXPR uint32_t apiVersionPatch( T const version )
+  {
+    return ( ( uint32_t )(version)&0xFFFU );
+  }
+  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+  VULKAN_HPP_CONSTEXPR uint32_t apiVersionVariant( T const version )
+  {
+    return ( ( uint32_t )( version ) >> 29U );
+  }
+  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+  VULKAN_HPP_CONSTEXPR uint32_t makeApiVersion( T const variant, T const major, T const minor, T const patch )
+  {
+    return ( ( ( ( uint32_t )( variant ) ) << 29U ) | ( ( ( uint32_t )( major ) ) << 22U ) | ( ( ( uint32_t )( minor ) ) << 12U ) | ( ( uint32_t )( patch ) ) );
+  }
+  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+  VULKAN_HPP_DEPRECATED( "This define is deprecated. VK_MAKE_API_VERSION should be used instead." )
+  VULKAN_HPP_CONSTEXPR uint32_t makeVersion( T const major, T const minor, T const patch )
+  {
+    return ( ( ( ( uint32_t )( major ) ) << 22U ) | ( ( ( uint32_t )( minor ) ) << 12U ) | ( ( uint32_t )( patch ) ) );
+  }
+  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+  VULKAN_HPP_DEPRECATED( "This define is deprecated. VK_API_VERSION_MAJOR should be used instead." )
+  VULKAN_HPP_CONSTEXPR uint32_t versionMajor( T const version )
+  {
+    return ( ( uint32_t )( version ) >> 22U );
+  }
+  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+  VULKAN_HPP_DEPRECATED( "This define is deprecated. VK_API_VERSION_MINOR should be used instead." )
+  VULKAN_HPP_CONSTEXPR uint32_t versionMinor( T const version )
+  {
+    return ( ( ( uint32_t )( version ) >> 12U ) & 0x3FFU );
+  }
+  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+  VULKAN_HPP_DEPRECATED( "This define is deprecated. VK_API_VERSION_PATCH should be used instead." )
+  VULKAN_HPP_CONSTEXPR uint32_t versionPatch( T const version )
+  {
+    return ( ( uint32_t )(version)&0xFFFU );
+  }
+
+  //=========================
+  //=== CONSTEXPR CALLERs ===
+  //=========================
+  VULKAN_HPP_CONSTEXPR_INLINE auto ApiVersion            = makeApiVersion( 0, 1, 0, 0 );
+  VULKAN_HPP_CONSTEXPR_INLINE auto ApiVersion10          = makeApiVersion( 0, 1, 0, 0 );
+  VULKAN_HPP_CONSTEXPR_INLINE auto ApiVersion11          = makeApiVersion( 0, 1, 1, 0 );
+  VULKAN_HPP_CONSTEXPR_INLINE auto ApiVersion12          = makeApiVersion( 0, 1, 2, 0 );
+  VULKAN_HPP_CONSTEXPR_INLINE auto ApiVersion13          = makeApiVersion( 0, 1, 3, 0 );
+  VULKAN_HPP_CONSTEXPR_INLINE auto HeaderVersionComplete = makeApiVersion( 0, 1, 3, VK_HEADER_VERSION );
+)";
+
+        output += endNamespace();
+
+        if (cfg.gen.globalMode) {
+            output += "#include \"vulkan_types.hpp\"\n";
+        }
+        else {
+            output += "#include \"vulkan_handles.hpp\"\n";
+            output += "#include \"vulkan_structs.hpp\"\n";
+        }
+        if (cfg.gen.expApi || true) {
+            output += "#include \"vulkan_context.hpp\"\n";
+        }
+        if (cfg.gen.globalMode) {
+            output += "\n";
+            output += beginNamespace();
+            output += "  extern " + m_ns + "::" + loader.name + " " + strFirstLower(loader.name) + ";\n";
+            for (const Handle &t : topLevelHandles) {
+                output += "  extern " + m_ns + "::" + t.name + " " + strFirstLower(t.name) + ";\n";
+            }
+            // output += "  extern vk::Dispatch dispatch;\n";
+            output += "\n";
+            for (Handle &t : topLevelHandles) {
+                for (auto &cmd : t.ctorCmds) {
+                    output += "  // " + cmd.name.original + "\n";
+                    /* in progress
+                    GuardedOutput decl;
+                    MemberGeneratorExperimental g{ *this, cmd, decl, outputFuncs, true };
+                    g.generate();
+                    std::stringstream str;
+                    decl.write(str);
+                    output += std::move(str.str());
+                    */
+                }
+            }
+            output += endNamespace();
+            output += "\n";
+        }
+
+
+
+        // if (cfg.gen.structChain)
+        if (!cfg.gen.onlyC) {
+            output += "#ifndef VULKAN_HPP_NO_STRUCT_CHAIN\n";
+            generateStructChain(files, output);
+            output += "#endif // VULKAN_HPP_NO_STRUCT_CHAIN\n";
+        }
+
+
+        // output += "#  ifndef VULKAN_HPP_EXPERIMENTAL_NO_VK_FUNCS\n";
+        // output += "#  endif // VULKAN_HPP_EXPERIMENTAL_NO_VK_FUNCS\n";
+//         if (cfg.gen.structMock > 0) {
+//             return;
+//         }
+        /*
+        std::string ifdef;
+        for (const auto &p : platforms) {
+            const auto &protect = p.protect;
+            if (!protect.empty()) {
+                ifdef += "    defined( ";
+                ifdef += protect;
+                ifdef += " ) ||\\\n";
+            }
+        }
+        if (!ifdef.empty()) {
+            strStripPrefix(ifdef, "    ");
+            strStripSuffix(ifdef, " ||\\\n");
+            output += vkgen::format(R"(
+#if {0}
+#include "vulkan_platforms.hpp"
+#endif
+
+)",
+                                    ifdef);
+        }
+        */
+
+        output += "#include \"vulkan_funcs.hpp\"\n\n";
+
+#ifdef INST
+        output += Inst::mainFileEnd();
+#endif
+    }
+
+    static void createPath(const std::filesystem::path &path) {
+        if (std::filesystem::exists(path)) {
+            return;
+        }
+        std::error_code ec;
+        std::filesystem::create_directories(path, ec);
+        if (ec) {
+            throw std::runtime_error{ "Can't create directory " + path.string() + ": " + ec.message() };
+        }
+    }
+
+    void Generator::generateModuleEnums(OutputBuffer &output) {
+        gen(output, cfg.gen.handleTemplates, [&](auto &output) {
+            output += vkgen::format(R"(
+  //=============
+  //=== ENUMs ===
+  //=============
+  using {0}::CppType;
+)",
+                                    m_ns);
+        });
+
+        GuardedOutput out;
+
+        std::unordered_set<std::string> generated;
+        std::array<Protect, 1>          protect;
+        protect[0].second = true;
+        for (const auto &e : enums) {
+            if (!e.version) {
+                continue;
+            }
+
+            const auto *t = find(e.name.original);
+            if (t && !t->canGenerate()) {
+                continue;
+            }
+
+            protect[0].first = e.getProtect();
+            auto &output     = out.get(protect);
+            if (generated.contains(e.name)) {
+                // std::cout << ">> skip enum: " << e.name << std::endl;
+                // output += std::move("  // skip: " + e.name + "\n");
+                // continue;
+            } else {
+                output += std::move("  using " + m_ns + "::" + e.name + ";\n");
+                std::string name = e.name;
+                auto        tag  = strRemoveTag(name);
+                if (name.ends_with("FlagBits")) {
+                    name = std::regex_replace(e.name, std::regex("FlagBits"), "Flags");
+                    output += std::move("  using " + m_ns + "::" + name + ";\n");
+                }
+            }
+
+            generated.insert(e.name);
+        }
+
+        output += std::move(out);
+    }
+
+    void Generator::generateModuleHandles(OutputBuffer &output) {
+        output += R"(
+  //===============
+  //=== HANDLEs ===
+  //===============
+)";
+
+        if (cfg.gen.expApi) {
+            output += "using " + m_ns + "::" + loader.name + ";\n";
+        }
+        for (const Handle &e : handles.ordered) {
+            genOptional(output, e, [&](auto &output) { output += "  using " + m_ns + "::" + e.name + ";\n"; });
+        }
+
+        gen(output, cfg.gen.smartHandles, [&](auto &output) {
+            output += R"(
+  //======================
+  //=== UNIQUE HANDLEs ===
+  //======================
+#ifndef  VULKAN_HPP_NO_SMART_HANDLE
+)";
+
+            for (const Handle &e : handles.ordered) {
+                if (e.uniqueVariant()) {
+                    genOptional(output, e, [&](auto &output) { output += "  using " + m_ns + "::Unique" + e.name + ";\n"; });
+                }
+            }
+
+            output += "#endif // VULKAN_HPP_NO_SMART_HANDLE\n";
+        });
+    }
+
+    void Generator::generateModuleStructs(OutputBuffer &output) {
+        output += R"(
+  //===============
+  //=== STRUCTs ===
+  //===============
+)";
+        GuardedOutput out;
+
+        std::array<Protect, 1> protect;
+        protect[0].second = true;
+        for (const auto &e : structs) {
+            if (!e.version) {
+                continue;
+            }
+
+            protect[0].first = e.getProtect();
+            auto &output     = out.get(protect);
+            output += std::move("  using " + m_ns + "::" + e.name + ";\n");
+        }
+
+        output += std::move(out);
+    }
+
+    void Generator::generateModules(GenOutput &main, std::filesystem::path path) {
+        GenOutput outModule{ "vulkan", ".cppm", path };
+        auto     &module_output = outModule.addFile("", ".cppm");
+
+        module_output += "module;\n\n";
+
+        module_output += "#include \"" + main.getFilename("") + "\"\n";
+        if (cfg.gen.raii.enabled) {
+            module_output += "#include \"" + main.getFilename("_raii") + "\"\n";
+        }
+
+        module_output += "\nexport module vulkan;\n\n";
+
+        module_output += "  // VULKAN CORE\n";
+        module_output += "export {\n";
+
+        module_output += R"(
+  //=============
+  //=== ENUMs ===
+  //=============
+)";
+
+        for (const auto &e : enums) {
+            if (!e.version) {
+                continue;
+            }
+            const auto *t = find(e.name.original);
+            if (t && !t->canGenerate()) {
+                continue;
+            }
+
+            const auto *base = reinterpret_cast<const GenericType *>(&e);
+            if (t) {
+                base = reinterpret_cast<const GenericType *>(t);
+            }
+
+            genOptional(module_output, *base, [&](auto &output) {
+                std::string name = e.name.original;
+                if (e.members.empty()) {
+                    name = std::regex_replace(name, std::regex("FlagBits"), "Flags");
+                }
+                output += "  using ::" + name + ";";
+                // output += " // " + std::to_string(e.isSuppored()) + " " + e.name.original;
+                output += "\n";
+            });
+        }
+
+        module_output += R"(
+  //===============
+  //=== STRUCTs ===
+  //===============
+)";
+
+        for (const auto &e : this->structs) {
+            if (!e.version) {
+                continue;
+            }
+            genOptional(module_output, e, [&](auto &output) { output += "  using ::" + e.name.original + ";\n"; });
+        }
+
+        module_output += R"(
+  //===============
+  //=== HANDLEs ===
+  //===============
+)";
+
+        for (const auto &e : this->handles) {
+            if (!e.version) {
+                continue;
+            }
+            genOptional(module_output, e, [&](auto &output) { output += "  using ::" + e.name.original + ";\n"; });
+        }
+
+        module_output += "}\n";
+
+        module_output += "export " + beginNamespace();
+
+        module_output += vkgen::format(R"(
+  //=====================================
+  //=== HARDCODED TYPEs AND FUNCTIONs ===
+  //=====================================
+  using {0}::ArrayWrapper1D;
+  using {0}::ArrayWrapper2D;
+  // using {0}::DispatchLoaderBase;
+  using {0}::Flags;
+{1}
+
+#if !defined( VK_NO_PROTOTYPES )
+  // using {0}::DispatchLoaderStatic;
+#endif /*VK_NO_PROTOTYPES*/
+
+  using {0}::operator&;
+  using {0}::operator|;
+  using {0}::operator^;
+  using {0}::operator~;
+  // using VULKAN_HPP_DEFAULT_DISPATCHER_TYPE;
+
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
+  using {0}::ArrayProxy;
+  using {0}::ArrayProxyNoTemporaries;
+  using {0}::Optional;
+  // using {0}::StridedArrayProxy;
+  using {0}::StructureChain;
+  // using {0}::UniqueHandle;
+#endif /*VULKAN_HPP_DISABLE_ENHANCED_MODE*/
+
+#if !defined( VULKAN_HPP_NO_SMART_HANDLE )
+  // using {0}::ObjectDestroy;
+  // using {0}::ObjectFree;
+  // using {0}::ObjectRelease;
+  // using {0}::PoolFree;
+#endif /*VULKAN_HPP_NO_SMART_HANDLE*/
+
+  //==================
+  //=== BASE TYPEs ===
+  //==================
+  using {0}::Bool32;
+  using {0}::DeviceAddress;
+  using {0}::DeviceSize;
+  using {0}::RemoteAddressNV;
+  using {0}::SampleMask;
+
+)",
+                                       m_ns,
+                                       useCompactFlags()? "  using " + m_ns + "::BitmaskType;\n  using " + m_ns + "::allFlagsOf;" : "  using " + m_ns + "::FlagTraits;");
+        if (useUninitializedStructs()) {
+            module_output += "  using " + m_ns + "::uninitialized_t;\n";
+            module_output += "  using " + m_ns + "::uninitialized;\n\n";
+        }
+
+        generateModuleEnums(module_output);
+
+        module_output += vkgen::format(R"(
+  //=========================
+  //=== Index Type Traits ===
+  //=========================
+  //using {0}::IndexTypeValue;
+
+  //======================
+  //=== ENUM to_string ===
+  //======================
+#if !defined( VULKAN_HPP_NO_TO_STRING )
+  using {0}::to_string;
+  using {0}::toHexString;
+#endif /*VULKAN_HPP_NO_TO_STRING*/
+
+  //=============================
+  //=== EXCEPTIONs AND ERRORs ===
+  //=============================
+#if !defined( VULKAN_HPP_NO_EXCEPTIONS )
+)",
+                                       m_ns);
+        if (cfg.gen.unifiedException) {
+            module_output += vkgen::format(R"(
+#  ifdef VULKAN_HPP_UNIFIED_EXCEPTION
+  using {0}::Error;
+#  else
+)",
+                                           m_ns);
+        }
+
+        std::set<std::string>        errors;
+        std::set<const ErrorClass *> platformErrors;
+        for (const auto &e : errorClasses) {
+            if (e.value.getProtect().empty()) {
+                errors.insert(e.name);
+            } else {
+                platformErrors.insert(&e);
+            }
+        }
+        errors.insert("make_error_code");
+        errors.insert("make_error_condition");
+        errors.insert("Error");
+        errors.insert("LogicError");
+        errors.insert("SystemError");
+        for (const auto &e : errors) {
+            module_output += "  using " + m_ns + "::" + e + ";\n";
+        }
+        for (const auto &e : platformErrors) {
+            genOptional(module_output, e->value, [&](auto &output) { output += "  using " + m_ns + "::" + e->name + ";\n"; });
+        }
+        if (cfg.gen.unifiedException) {
+            module_output += "#  endif // VULKAN_HPP_UNIFIED_EXCEPTION\n";
+        }
+
+        module_output += vkgen::format(R"(#endif /*VULKAN_HPP_NO_EXCEPTIONS*/
+
+  using {0}::createResultValueType;
+  using {0}::ignore;
+  using {0}::resultCheck;
+  using {0}::ResultValue;
+  using {0}::ResultValueType;
+
+  //=========================================
+  //=== CONSTEXPR CONSTANTs AND FUNCTIONs ===
+  //=========================================
+)",
+                                       m_ns);
+
+        for (const auto &a : apiConstants) {
+            genOptional(module_output, a, [&](auto &output) { output += "  using " + m_ns + "::" + a.name + ";\n"; });
+        }
+
+        module_output += vkgen::format(R"(
+  //========================
+  //=== CONSTEXPR VALUEs ===
+  //========================
+  using {0}::HeaderVersion;
+
+  //=========================
+  //=== CONSTEXPR CALLEEs ===
+  //=========================
+  using {0}::apiVersionMajor;
+  using {0}::apiVersionMinor;
+  using {0}::apiVersionPatch;
+  using {0}::apiVersionVariant;
+  using {0}::makeApiVersion;
+  using {0}::makeVersion;
+  using {0}::versionMajor;
+  using {0}::versionMinor;
+  using {0}::versionPatch;
+
+  //==========================
+  //=== CONSTEXPR CALLERSs ===
+  //==========================
+  using {0}::ApiVersion;
+  using {0}::ApiVersion10;
+  using {0}::ApiVersion11;
+  using {0}::ApiVersion12;
+  using {0}::ApiVersion13;
+  using {0}::HeaderVersionComplete;
+
+)",
+                                       m_ns);
+        // === STRUCTs ===
+        generateModuleStructs(module_output);
+
+        // === HANDLEs ===
+        generateModuleHandles(module_output);
+
+        /*
+            module_output += R"(
+          //=====================
+          //=== Format Traits ===
+          //=====================
+
+          //======================================
+          //=== Extension inspection functions ===
+          //======================================
+        )";
+        */
+
+        //    if (false) {
+        //        module_output += R"(
+        //  //===========================
+        //  //=== COMMANDs ===
+        //  //===========================
+        //)";
+        //        module_output += std::move(functionsPublic);
+        //    }
+
+        if (cfg.gen.raii.enabled) {
+            module_output += "  namespace VULKAN_HPP_RAII_NAMESPACE {\n";
+
+            module_output += R"(
+  //======================
+  //=== RAII HARDCODED ===
+  //======================
+)";
+            module_output += vkgen::format(R"(
+    using {0}::{1};
+  // using {0}::{1}Dispatcher;
+  using {0}::DeviceDispatcher;
+  using {0}::InstanceDispatcher;
+  using {0}::exchange;
+  )",
+                                           m_ns_raii,
+                                           loader.name);
+
+            module_output += R"(
+  //====================
+  //=== RAII HANDLEs ===
+  //====================
+)";
+
+            for (const Handle &e : this->handles.ordered) {
+                genOptional(module_output, e, [&](auto &output) { output += "  using " + m_ns_raii + "::" + e.name + ";\n"; });
+            }
+
+            module_output += "  } // VULKAN_HPP_RAII_NAMESPACE\n";
+        }
+
+        module_output += endNamespace();
+
+//        module_output += "module : private;\n";
+//        module_output += beginNamespace();
+//        module_output += endNamespace();
+
+        outModule.writeFiles(*this);
+    }
+
+    template <typename T>
+    static void generateForwardDeclarations(vkgen::OutputBuffer &output, const std::vector<T> &items, vkgen::Generator &gen) {
+        output += gen.beginNamespace();
+        for (const vkgen::GenericType &i : items) {
+            output += gen.genOptional(i, [&](auto &output) { output += "  " + i.metaTypeDeclaration() + " " + i.name + ";\n"; });
+        }
+        output += gen.endNamespace();
+    }
+
+    void Generator::wrapNamespace(OutputBuffer &output, std::function<void(OutputBuffer &)> func) {
+        output += beginNamespace();
+        func(output);
+        output += endNamespace();
+    }
+
+    void Generator::generateForwardHandles(OutputBuffer &output) {
+        output += beginNamespace();
+        for (const auto &e : handles.ordered) {
+            generateClassDecl(output, e);
+        }
+        //        for (const Handle &e : handles.ordered) {
+        //            if (e.uniqueVariant()) {
+        //                output += generateClassDecl(e, "Unique" + e.name);
+        //            }
+        //        }
+        output += endNamespace();
+    }
+
+    class CCodeGenerator {
+        Generator &gen;
+        OutputBuffer &output;
+        std::unordered_set<std::string> generated;
+        bool dbg = true;
+
+        template<typename T>
+        void generate(const T &elem) {
+            const auto &type = elem.name.original;
+            if (generated.find(type) != generated.end()) {
+                return;
+            }
+            generated.insert(type);
+            generateElement(elem);
+        }
+      public:
+        CCodeGenerator(Generator &gen, OutputBuffer &output) : gen(gen), output(output)
+        {}
+
+        std::string extDebug(const GenericType &type) {
+            std::string out = "// ";
+            out += type.metaTypeString();
+            if (type.version) {
+                out += "ver: ";
+                out += type.version;
+            }
+            auto *ext = type.getExtension();
+            if (ext) {
+                out += " ext: ";
+                out += ext->name.original;
+            }
+            if (type.parentExtension) {
+                out += "->";
+                out += type.parentExtension->name.original;
+            }
+            out += "\n";
+            return out;
+        }
+
+        void generate(const Platform &platfrom) {
+            const auto &protect = platfrom.protect;
+            output += "// PLATFORM ";
+            output += platfrom.name;
+            output += "\n";
+            output += "#ifdef ";
+            output += protect;
+            output += "\n";
+            for (const auto &i : platfrom.includes) {
+                output += i;
+                // std::cout << i << "\n";
+                output += "\n";
+            }
+            for (const Extension &extension : platfrom.extensions) {
+                generate(extension);
+            }
+            output += "#endif // ";
+            output += protect;
+            output += "\n";
+            output += "\n";
+        }
+
+        void generate(const Extension &extension) {
+            //            const auto &protect = extension.protect;
+            //            if (!protect.empty()) {
+            //                output += "#ifdef " + protect + "\n";
+            //            }
+            const auto &name = extension.name.original;
+            if (!extension.comment.empty()) {
+                output += "// " + extension.comment + "\n";
+            }
+            output += "// " + name + " is a preprocessor guard. Do not pass it to API calls.\n";
+            output += "#define " + name + " 1\n";
+
+            for (const auto &i : extension.includes) {
+                output += i;
+                output += "\n";
+            }
+            for (const auto &c : extension.constants) {
+                output += c;
+            }
+            //            const auto* platformm = extension.getPlatfrom();
+            //            for (const auto &c : extension.) {
+            //                output += c;
+            //            }
+            output += "\n";
+            const Feature &contents = extension;
+            generate(contents);
+            //            if (!protect.empty()) {
+            //                output += "#endif // " + protect + "\n";
+            //            }
+            output += "\n";
+        }
+
+        void generate(const Feature &feature) {
+            // output += "// " + feature.name.original;
+            output += "\n";
+            output += "// ";
+            output += feature.name.original;
+            output += " is a preprocessor guard. Do not pass it to API calls.\n";
+            output += "#define ";
+            output += feature.name.original;
+            output += " 1\n";
+            for (const Snippet &t : feature.defines) {
+                continue;
+                generate(t);
+            }
+            for (const Snippet &t : feature.baseTypes) {
+                generate(t);
+            }
+            for (const Handle &t : feature.handles) {
+                generate(t);
+            }
+            for (const Enum &t : feature.enums) {
+                generate(t);
+            }
+            for (const Struct &s : feature.forwardStructs) {
+                const auto &name = s.name.original;
+                output += "typedef struct " + name + " " + name + ";\n\n";
+            }
+            for (const FuncPointer &t : feature.funcPointers) {
+                if (t.inStruct) {
+                    generate(t);
+                }
+            }
+            for (const Struct &t : feature.structs) {
+                generate(t);
+            }
+            for (const FuncPointer &t : feature.funcPointers) {
+                if (!t.inStruct) {
+                    generate(t);
+                }
+            }
+            for (const Command &t : feature.commands) {
+                generate(t);
+            }
+            output += "\n";
+        }
+
+        void generateElement(const Command &elem) {
+            const auto &name = elem.name.original;
+            // output += "// " + elem.name.original + "\n";
+            output += extDebug(elem);
+            output += "typedef ";
+            output += elem.type;
+            output += " (VKAPI_PTR *PFN_";
+            output += name;
+            output += ")(";
+            auto it = elem.params.begin();
+            const auto end = elem.params.end();
+            while (it != end) {
+                const VariableData &p = *it;
+
+                output += p.originalFullType();
+                output += " ";
+                output += p.identifier();
+                output += p.optionalArraySuffix();
+
+                it++;
+                bool last = it == end;
+                if (!last) {
+                    output += ", ";
+                }
+            }
+            output += ");\n\n";
+        }
+
+        void generateElement(const Handle &type) {
+            output += extDebug(type);
+            output += type.code;
+            output += "\n";
+        }
+
+        void generateElement(const Struct &elem) {
+            const auto &name = elem.name.original;
+            const auto &type = elem.isUnion() ? "union" : "struct";
+            output += extDebug(elem);
+            output += "typedef ";
+            output += type;
+            output += " " + name + " {\n";
+            for (const auto &m : elem.members) {
+                output += "    " + m->originalFullType() + "    " + m->identifier() + m->optionalArraySuffix() + m->getNameSuffix() + ";\n";
+            }
+            output += "} " + name + ";\n";
+            for (const auto &a : elem.aliases) {
+                output += "typedef " + name + " " + a.name.original + ";";
+                output += dbg? extDebug(a) : "\n";
+            }
+            output += "\n";
+        }
+
+        template <typename T>
+        void generate(const std::vector<T> &elements, const std::function<void(OutputBuffer&, const T&, bool)> &func) {
+            auto it = elements.begin();
+            const auto end = elements.end();
+            while (it != end) {
+                const auto &m = *it;
+                it++;
+                const bool last = it == end;
+                // TODO
+                gen.genOptional(output, m, [&](auto &output) {
+                    func(output, m, last);
+                });
+            }
+        }
+
+        void generateElement(const Enum &type) {
+            output += extDebug(type);
+            const auto &name = type.isBitmask() ? type.bitmask.original : type.name.original;
+            if (type.type == "VkFlags") {
+                output += "typedef enum " + name + " {\n";
+
+                generate<EnumValue>(type.members, [&](auto &output, const EnumValue &m, bool last){
+                    output += "    " + m.name.original;
+                    output += " = ";
+                    output += m.value;
+
+                    if (!last) {
+                        output += ",";
+                    }
+//                    if (!m.alias.empty()) {
+//                        output += " // " + m.alias;
+//                    }
+//                    output += dbg? extDebug(m) : "\n";
+//                    for (const auto &a : m.aliases) {
+//                        output += "  // ";
+//                        output += a.name;
+//                        output += "\n";
+//                    }
+                    output += "\n";
+                });
+                output += "} " + name + ";\n";
+
+            }
+            else {
+                output += "typedef " + type.type + " " + name + ";\n";
+
+                generate<EnumValue>(type.members, [&](auto &output, const EnumValue &m, bool last){
+                    output += "static const " + name + " " + m.name.original;
+                    output += " = ";
+                    output += m.value;
+                    output += ";";
+//                    if (!m.alias.empty()) {
+//                        output += " // " + m.alias;
+//                    }
+//                    output += "\n";
+//                    for (const auto &a : m.aliases) {
+//                        output += "  // ";
+//                        output += a.name;
+//                        output += "\n";
+//                    }
+                    output += "\n";
+                });
+            }
+
+
+            if (type.isBitmask()) {
+                output += "typedef " + type.type + " " + type.name.original + ";\n";
+            }
+            for (const auto &a : type.aliases) {
+                // output += "  // A: ";
+                // output += a.name;
+                const auto &name =
+                  (a.name.find("FlagBits") != std::string::npos)? type.bitmask.original : type.name.original;
+                output += "typedef " + name + " " + a.name.original + "; ";
+                output += dbg? extDebug(a) : "\n";
+            }
+
+            output += "\n";
+
+        }
+
+        void generateElement(const Snippet &type) {
+            output += type.code;
+            output += "\n\n";
+        }
+
+    };
+
+    static void generateTypeDebug(GenericType &type, OutputBuffer &output) {
+        output += std::move(type.getVersionDebug());
+        //        debugGen.insert(type.name.original);
+        //        for (const auto &d : type.dependencies) {
+        //            if (debugGen.find(d->name.original) == debugGen.end()) {
+        //                output += "//     " + d->name.original;
+        //                output += "  MISSING";
+        //                output += "\n";
+        //            }
+        //        }
+        output += "\n";
+        // generateDebugMock(type, output);
+    }
+
+    static void generateFeatureDebgug(const Feature &f, OutputBuffer &output) {
+        for (const auto &t : f.baseTypes) {
+            generateTypeDebug(t, output);
+        }
+        for (const auto &t : f.handles) {
+            generateTypeDebug(t, output);
+        }
+        for (const auto &t : f.enums) {
+            generateTypeDebug(t, output);
+        }
+        for (const auto &t : f.structs) {
+            generateTypeDebug(t, output);
+        }
+        for (const auto &t : f.funcPointers) {
+            generateTypeDebug(t, output);
+        }
+        for (const auto &t : f.commands) {
+            generateTypeDebug(t, output);
+        }
+    }
+
+    static void printDebugExtensionDepends(const Extension *ext, int indent, OutputBuffer &output) {
+        if (!ext->versiondepends.empty()) {
+            for (int i = 0; i < indent; ++i) {
+                output += " ";
+            }
+            output += "// -> " + ext->versiondepends + "\n";
+        }
+
+        for (const auto *dep : ext->depends) {
+            for (int i = 0; i < indent; ++i) {
+                output += " ";
+            }
+            output += "// -> " + dep->name + "\n";
+            printDebugExtensionDepends(dep, indent + 2, output);
+        }
+    }
+
+    void Generator::generateCore(OutputBuffer &output) {
+
+        output += vkgen::format(RES_HEADER_C, headerVersion);
+
+        for (const auto &c : apiConstants) {
+            output += "#define " + c.name.original + "  " + c.value + "\n";
+        }
+
+        /*
+        for (const auto &feature : features) {
+            output += "\n\n// feature: " + feature.name + "\n";
+            generateFeatureDebgug(feature, output);
+        }
+        for (const Extension &extension : extensions.ordered) {
+            output += "\n\n// ext " + std::to_string(extension.number) + ": " + extension.name + " (" + std::to_string(extension.elements) + ")\n";
+            // printDebugExtensionDepends(&extension, 2, output);
+            generateFeatureDebgug(extension, output);
+        }
+        */
+
+        CCodeGenerator cgen{*this, output};
+
+        for (const auto &feature : features) {
+            cgen.generate(feature);
+        }
+        for (const Extension &extension : extensions.ordered) {
+            if (!extension.platform) {
+                cgen.generate(extension);
+            }
+        }
+        for (const Platform &platform : platforms.ordered) {
+            cgen.generate(platform);
+        }
+
+        /*
+                output += "\n// basetypes\n";
+                for (const auto &b : baseTypes) {
+                    output += std::move(b.second.getVersionDebug());
+                    output += b.second.code;
+                    output += "\n\n";
+                }
+
+                output += "\n// funcpointers\n";
+                for (const auto &b : funcPointers) {
+                    output += std::move(b.second.getVersionDebug());
+                    output += b.second.code;
+                    output += "\n\n";
+                }
+
+                output += "\n// enums\n";
+                for (const auto &e : enums) {
+                    output += std::move(e.getVersionDebug());
+                    output += "// enum " + e.name.original + "\n\n";
+                }
+
+                for (const auto &e : structs) {
+                    output += std::move(e.getVersionDebug());
+                    output += std::string("// ") + (e.isUnion()? "union" : "struct") + " " + e.name.original + "\n\n";
+                }
+        */
+
+    }
+
+    void Generator::generateApiVideo(std::filesystem::path path) {
+        if (!video) {
+            return;
+        }
+        GenOutput files{ "", ".h", path };
+        files.cguard = true;
+        for (const auto &e : video->extensions) {
+            if (e.comment.starts_with("protect with ")) {
+                const auto guard = e.comment.substr(14);
+            }
+            auto &file = files.addFile(e.name);
+            CCodeGenerator cgen{*this, file};
+            cgen.generate(e);
+        }
+        files.writeFiles(*this);
+    }
+
+    void Generator::generateApiC(std::filesystem::path path) {
+        GenOutput vkfiles{ "vk", ".h", path };
+        vkfiles.cguard = true;
+        auto &platform = vkfiles.addFile("_platform");
+        platform += CODE_PLATFORM_H;
+
+        vkfiles.writeFiles(*this);
+
+        GenOutput files{ "vulkan", ".h", path };
+        files.cguard = true;
+        auto &main = files.addFile("");
+        // main += "#include \"vk_platform.h\"\n\n";
+
+        generateCore(main);
+
+        files.writeFiles(*this);
+    }
+
+    void Generator::generateApiCpp(std::filesystem::path path) {
+        // std::cout << "gen files " << '\n';
+
+        GenOutput out{ "vulkan", ".hpp", path };
+
+        auto &enums           = out.addFile("_enums");
+        auto &enums_forward   = out.addFile("_enums_forward");
+        auto &to_string       = out.addFile("_to_string");
+        auto &handles         = out.addFile("_handles");
+        auto &smart_handles   = out.addFile("_smart");
+        auto &forward         = out.addFile("_forward");
+        auto &handles_forward = out.addFile("_handles_forward");
+        auto &structs_forward = out.addFile("_structs_forward");
+        auto &structs         = out.addFile("_structs");
+        auto &types           = out.addFile("_types");
+
+        // auto &platforms       = out.addFile("_platforms");
+        auto &macros          = out.addFile("_hpp_macros");
+
+        generateMacros(macros);
+
+        generateEnums(enums, enums_forward);
+
+
+        generateForwardHandles(handles_forward);
+
+        structs_forward += beginNamespace();
+        for (const Struct &e : this->structs.ordered) {
+            generateStructDecl(structs_forward, e);
+        }
+        structs_forward += endNamespace();
+
+        // forward += "#include \"" + out.getFilename("_enums_forward") + "\"\n";
+        forward += "#include \"" + out.getFilename("_structs_forward") + "\"\n";
+        forward += "#include \"" + out.getFilename("_handles_forward") + "\"\n";
+
+        types += "#include \"vulkan.h\"\n";
+        types += "#include \"vulkan_hpp_macros.hpp\"\n";
+        types += beginNamespace();
+        types += RES_BASE_TYPES;
+        types += "\n";
+        types += endNamespace();
+        if (!cfg.gen.onlyC) {
+            types += "#include \"vulkan_enums.hpp\"\n";
+        }
+        types += "#include \"vulkan_handles.hpp\"\n";
+        if (!cfg.gen.onlyC) {
+            types += "#include \"vulkan_structs.hpp\"\n";
+        }
+
+        generateHandles(handles, smart_handles, out);
+
+        generateStructs(structs);
+
+        if (cfg.gen.structHash) {
+            auto &hash = out.addFile("_hash");
+            generateHash(hash);
+        }
+
+        if (cfg.gen.structFormat) {
+            auto &format = out.addFile("_format");
+            generateFormat(format);
+        }
+
+        generateMainFile(out);
+
+        if (cfg.gen.globalMode) {
+            auto &global         = out.addFile("_global");
+            global += "#include \"vulkan.hpp\"\n";
+            global += beginNamespace();
+            global += "  " + loader.name + " " + strFirstLower(loader.name) + ";\n";
+            for (const Handle &t : topLevelHandles) {
+                global += "  " + t.name + " " + strFirstLower(t.name) + ";\n";
+            }
+            // global += "  Dispatch dispatch;\n";
+//            for (const Handle &t : topLevelHandles) {
+//                global += "  " + t.name.original + " " + t.name + "::m_handle = {};\n";
+//            }
+//            global += "  " + loader.name + "Dispatcher " + loader.name + "::m_dispatcher = {};\n";
+//            for (const Handle &t : topLevelHandles) {
+//                global += "  " + t.name + "Dispatcher " + t.name + "::m_dispatcher = {};\n";
+//            }
+            global += endNamespace();
+
+            {
+                auto &output = out.addFile("_enum_string", ".h");
+                // output += "#include <iostream>\n";
+                // output += "#include \"vulkan.h\"\n";
+                output += "#include \"vulkan.hpp\"\n";
+                output += "#include <string>\n";
+                output += "\n";
+                if (cfg.gen.enumStringTables) {
+                    output += "#include <iterator>\n";
+                    output += "\n";
+                }
+                for (const Enum &e : this->enums.ordered) {
+                    genOptional(output, e, [&](auto &output) {
+                        if (cfg.gen.enumStringTables) {
+                            const std::string table = generateEnumNameTable(getEnumStringEntries(e, true));
+                            if (e.isBitmask()) {
+                                output += "  " + m_inline + " std::string string_" + e.name.original + "(" + e.name.original + " value)";
+                                output += "  {\n";
+                                output += table;
+                                output += "    std::string result;\n";
+                                output += "    " + m_ns + "::detail::writeFlags( std::back_inserter( result ), static_cast<uint64_t>( value ), { names, sizeof( names ) / sizeof( names[0] ) - 1 } );\n";
+                                output += "    return result;\n";
+                            } else {
+                                output += "  " + m_inline + " std::string_view string_view_" + e.name.original + "(" + e.name.original + " value)";
+                                output += "  {\n";
+                                output += table;
+                                output += "    return " + m_ns + "::detail::findEnumName( { names, sizeof( names ) / sizeof( names[0] ) - 1 }, static_cast<int64_t>( value ) );\n";
+                                output += "  }\n";
+                                output += "  " + m_inline + " std::string string_" + e.name.original + "(" + e.name.original + " value)";
+                                output += "  {\n";
+                                output += "    std::string_view const name = string_view_" + e.name.original + "( value );\n";
+                                output += "    if ( !name.empty() )\n";
+                                output += "      return std::string( name );\n";
+                                output += "    return \"invalid ( \" + vk::toHexString(value)  + \" )\";\n";
+                            }
+                        } else {
+                            output += "  " + m_inline + " std::string string_" + e.name.original + "(" + e.name.original + " value)";
+                            output += "  {\n";
+                            if (e.isBitmask()) {
+                                if (e.members.empty()) {
+                                    output += "     return \"{}\";\n";
+                                } else {
+                                    output += R"(
+    if ( !value )
+      return "{}";
+    std::string result;
+)";
+                                    for (const auto &m : e.members) {
+                                        if (m.isAlias) {
+                                            continue;
+                                        }
+                                        genOptional(output, m, [&](auto &output) {
+                                            output += "    if (value & " + m.name.original + ")\n";
+                                            output += "       result += \"" + m.name.original + " | \";\n";
+                                        });
+                                    }
+                                    output += "    return \"{ \" + result.substr( 0, result.size() - 3 ) + \" }\";\n";
+                                }
+                            } else {
+                                output += "    switch (value) {\n";
+                                if (e.members.empty()) {
+                                    output += "      // no values\n";
+                                }
+                                for (const auto &m : e.members) {
+                                    if (m.isAlias) {
+                                        continue;
+                                    }
+                                    genOptional(
+                                      output, m, [&](auto &output) { output += "      case " + m.name.original + ": return \"" + m.name.original + "\";\n"; });
+                                }
+                                output += "      default: return \"invalid ( \" + vk::toHexString(value)  + \" )\";\n";
+                                output += "    }\n";
+                            }
+                        }
+                        output += "  }\n";
+
+                        for (const auto &a : e.aliases) {
+                            output += "  " + m_inline + " std::string string_" + a.name.original + "(" + e.name.original + " value) {\n";
+                            output += "    return string_" + e.name.original + "(value);\n";
+                            output += "  }\n";
+                        }
+                    });
+                }
+
+            }
+
+            {
+                auto &output = out.addFile("_struct_string", ".h");
+                output += "#include \"vulkan_enum_string.h\"\n";
+                output += beginNamespace();
+                for (const Struct &s : this->structs.ordered) {
+                    genOptional(output, s, [&](auto &output) {
+                        output += "  " + m_inline + " std::string to_string(const " + s.name.original + " &value)";
+                        output += "  {\n";
+                        output += "    std::string result;\n";
+                        output += "    result += \"" + s.name.original + " {\\n\";\n";
+                        for (const auto &m : s.members) {
+                            output += "    result.append(\"\\n  " + m->identifier() + ": \").append(";
+                            if (m->isPointer() || m->isArray() || m->hasArrayLength() || m->original.type().starts_with("PFN") || m->isHandle()) {
+                                // output += "std::hex << value." + m->identifier() + " << std::dec << '\\n';\n";
+                                // output += "\"Pointer\"";
+                                output += "std::to_string(reinterpret_cast<uintptr_t>(value." + m->identifier() + "))";
+                            }
+                            else if (m->isUnion()) {
+                                output += "\"Union: " + m->original.type() + "\"";
+                            }
+                            else if (m->isStruct()) {
+                                output += "to_string(value." + m->identifier() + ")";
+                            }
+                            else if (m->isEnum()) {
+                                std::string type = std::regex_replace(m->original.type(), std::regex("FlagBits"), "Flags");
+                                output += "string_" + type + "(value." + m->identifier() + ")";
+                            }
+                            else {
+                                output += "std::to_string(value." + m->identifier() + ")";
+                            }
+                            output += ");\n";
+                        }
+                        output += "    result += \"\\n}\\n\";\n";
+                        output += "    return result;\n";
+                        output += "  }\n";
+                    });
+                }
+                output += endNamespace();
+            }
+
+            /*
+            for (const Enum &e: this->enums.ordered) {
+                to_stream += "// " + e.name.original + "\n";
+                for (const auto &m : e.members) {
+                    to_stream += "  // " + m.name.original + "    " + m.name + "\n";
+
+                }
+                to_stream += "\n";
+            }
+            */
+            // to_stream += endNamespace();
+        }
+
+        OutputBuffer *raii_funcs = nullptr;
+        if (cfg.gen.raii.enabled) {
+            auto &raii         = out.addFile("_raii");
+            auto &raii_forward = out.addFile("_raii_forward");
+            raii_funcs         = &out.addFile("_raii_funcs");
+
+            generateRAII(raii, raii_forward, out);
+        }
+
+        if (cfg.gen.stubDriver) {
+            auto &stub = out.addFile("_stub");
+            generateStubDriver(stub);
+        }
+
+        if (cfg.gen.expApi || true) {
+            auto                   &context = out.addFile("_context");
+            generateContext(context);
+        }
+
+        // context loader adds definitions to outputFuncsRAII
+        if (raii_funcs) {
+            generateFuncsRAII(*raii_funcs);
+        }
+
+        auto &funcs           = out.addFile("_funcs");
+        auto &funcs_impl           = out.addFile("_funcs_impl");
+        // auto &funcs2           = out.addFile("_funcs2");
+
+        // OutputBuffer *impl = nullptr;
+        // if (cfg.gen.cppFiles) {
+        if (cfg.gen.globalMode) {
+            auto& impl = out.addFile("_impl", ".cpp");
+            impl += "#include \"vulkan.hpp\"\n";
+//            impl += R"(
+//#ifdef VULKAN_HPP_HAS_SPACESHIP_OPERATOR
+//#  define VULKAN_HPP_USE_SPACESHIP_OPERATOR
+//#endif
+//)";
+            impl += "#undef VULKAN_HPP_INLINE\n";
+            impl += "#define VULKAN_HPP_INLINE\n";
+            impl += "#include \"vulkan_funcs_impl.hpp\"\n\n";
+            impl += "#include \"vulkan_to_string_impl.hpp\"\n\n";
+            impl += "#include \"vulkan_global.hpp\"\n\n";
+            // impl += beginNamespace();
+        }
+
+        const auto appendFuncs = [&](OutputBuffer &output, GuardedOutputFuncs &funcs) {
+
+//            if (impl) {
+//                *impl += std::move(funcs.def);
+//            } else {
+//                output += "// definitions: \n";
+//                output += std::move(funcs.def);
+//            }
+            funcs_impl += std::move(funcs.def);
+
+            output += std::move(funcs.decl);
+            output += std::move(funcs.templ);
+
+            output += std::move(funcs.platform);
+            // platforms += std::move(funcs.platform);
+
+        };
+
+        const auto genFuncs = [&](OutputBuffer &output, bool useC){
+            GuardedOutputFuncs funcs;
+            generateGlobalFuncs(funcs, useC);
+            appendFuncs(output, funcs);
+        };
+
+        if (cfg.gen.globalMode) {
+            funcs += R"(
+#if ( __cpp_lib_span >= 201803L )
+#  include <span>
+#endif
+)";
+            funcs += "#include \"vulkan_context.hpp\"\n";
+            funcs += "#include \"vulkan_array.hpp\"\n";
+            funcs += "#include \"vulkan_types.hpp\"\n";
+            if ((cfg.gen.raii.commandStream || cfg.gen.raii.submitBatcher) && !cfg.gen.onlyC) {
+                funcs += "#include <memory>\n";
+            }
+            if (cfg.gen.raii.commandStream && !cfg.gen.onlyC) {
+                funcs += "#include <utility>  // std::exchange\n";
+            }
+            if (cfg.gen.raii.submitBatcher && !cfg.gen.onlyC) {
+                funcs += "#include <atomic>\n";
+                funcs += "#include <vector>\n";
+            }
+            if (cfg.gen.raii.deferredDestroy && !cfg.gen.onlyC) {
+                funcs += "#include <atomic>\n";
+                funcs += "#include <cstring>\n";
+                funcs += "#include <new>\n";
+            }
+            if (cfg.gen.raii.pooledArrays && !cfg.gen.onlyC) {
+                funcs += "#include <utility>  // std::exchange\n";
+                funcs += "#include <vector>\n";
+            }
+            if (useHostAllocators() && !cfg.gen.onlyC) {
+                funcs += "#include <cstdlib>\n";
+                funcs += "#include <cstring>\n";
+                funcs += "#include <mutex>\n";
+            }
+            if (cfg.gen.raii.externSyncCheck && !cfg.gen.onlyC) {
+                funcs += R"(#if defined( VULKAN_HPP_EXTERN_SYNC_CHECK )
+#  include <atomic>
+#  include <cstdio>
+#  include <cstdlib>
+#  include <cstring>
+#endif
+)";
+            }
+        }
+
+        if (!cfg.gen.onlyC) {
+            funcs += "#include \"vulkan_enums.hpp\"\n";
+            funcs += "#include \"vulkan_structs.hpp\"\n";
+        }
+
+        // platforms += beginNamespace();
+        funcs  += beginNamespace();
+        funcs_impl += beginNamespace();
+
+        funcs += R"(
+  void resultCheck( Result result, char const * message );
+
+  void resultCheck( Result result, char const * message, std::initializer_list<Result> successCodes );
+
+  void resultCheck( VkResult result, char const * message );
+
+  void resultCheck( VkResult result, char const * message, std::initializer_list<VkResult> successCodes );
+)";
+
+        if (cfg.gen.globalMode && cfg.gen.raii.externSyncCheck && !cfg.gen.onlyC) {
+            funcs += RES_EXTERN_SYNC_CHECK;
+        }
+
+        if (cfg.gen.globalMode && useHostAllocators() && !cfg.gen.onlyC) {
+            funcs += RES_HOST_ALLOCATORS;
+        }
+
+        // funcs_impl += vkgen::format(RES_RESULT_CHECK, cfg.gen.branchHint ? "VULKAN_HPP_UNLIKELY" : "");
+        funcs_impl += vkgen::format(RES_RESULT_CHECK_CPP, cfg.gen.branchHint ? "VULKAN_HPP_UNLIKELY" : "");
+
+        if (cfg.gen.coldErrorPaths) {
+            generateSuccessBits(funcs);
+            funcs += vkgen::format(RES_RESULT_CHECK_MASK,
+                                   cfg.gen.branchHint ? "VULKAN_HPP_UNLIKELY" : "",
+                                   cfg.gen.globalMode ? "VkResult" : "Result");
+        }
+
+        if (cfg.gen.globalMode) {
+            // expected mode: init functions hand their result to the caller instead of throwing
+            const std::string initReturn = cfg.gen.expectedResult ? m_nodiscard + " " + m_ns + "::Result" : "void";
+            const auto        initCheck  = [&](const std::string &name) -> std::string {
+                if (cfg.gen.expectedResult) {
+                    return "return result;";
+                }
+                return m_ns + "::resultCheck(static_cast<VkResult>(result), VULKAN_HPP_NAMESPACE_STRING \"::" + name + "\");";
+            };
+
+            funcs += vkgen::format(R"(
+  {1} loadLib();
+
+  {2} initInstance(const {0}::InstanceCreateInfo& createInfo);
+
+  {0}::Result initInstance_noThrow(const {0}::InstanceCreateInfo& createInfo);
+
+  {2} initInstance(const {0}::InstanceCreateInfo& createInfo, bool& vulkan10enforced);
+
+  {2} initDevice({0}::PhysicalDevice physicalDevice, const {0}::DeviceCreateInfo& createInfo);
+
+  {0}::Result initDevice_noThrow({0}::PhysicalDevice physicalDevice, const {0}::DeviceCreateInfo& createInfo);
+
+  bool isExtensionSupported(std::span<{0}::ExtensionProperties> extensionList, const char* extensionName) noexcept;
+)",
+                                   m_ns,
+                                   cfg.gen.expectedResult ? m_nodiscard + " bool" : "void",
+                                   initReturn);
+
+
+            funcs_impl += vkgen::format(R"(
+  VULKAN_HPP_INLINE {1} loadLib() {{
+    {2}
+  }}
+
+  VULKAN_HPP_INLINE {3} initInstance(const {0}::InstanceCreateInfo& createInfo) {{
+    Result result = {0}::instance.init({0}::context, createInfo);
+    {4}
+  }}
+
+  VULKAN_HPP_INLINE {0}::Result initInstance_noThrow(const {0}::InstanceCreateInfo& createInfo) {{
+    return {0}::instance.init({0}::context, createInfo);
+  }}
+
+  VULKAN_HPP_INLINE {3} initInstance(const {0}::InstanceCreateInfo& createInfo, bool& vulkan10enforced) {{
+    Result result = {0}::initInstance_noThrow(createInfo);
+
+    if(result == Result::eErrorIncompatibleDriver && createInfo.pApplicationInfo &&
+       createInfo.pApplicationInfo->apiVersion != vk::ApiVersion10)
+    {{
+      // replace requested Vulkan version by 1.0 to avoid eErrorIncompatibleDriver error
+      ApplicationInfo appInfo2(*createInfo.pApplicationInfo);
+      appInfo2.apiVersion = ApiVersion10;
+      InstanceCreateInfo createInfo2(createInfo);
+      createInfo2.pApplicationInfo = &appInfo2;
 
-        template<typename T>
-        void generate(const T &elem) {
-            const auto &type = elem.name.original;
-            if (generated.find(type) != generated.end()) {
-                return;
-            }
-            generated.insert(type);
-            generateElement(elem);
+      // create instance (second attempt)
+      result = {0}::initInstance_noThrow(createInfo2);
+      vulkan10enforced = true;
+    }}
+    else {{
+      vulkan10enforced = false;
+    }}
+
+    {4}
+  }}
+
+  VULKAN_HPP_INLINE {3} initDevice({0}::PhysicalDevice physicalDevice, const {0}::DeviceCreateInfo& createInfo) {{
+    Result result = {0}::device.init({0}::instance, physicalDevice, createInfo);
+    {5}
+  }}
+
+  VULKAN_HPP_INLINE {0}::Result initDevice_noThrow({0}::PhysicalDevice physicalDevice, const {0}::DeviceCreateInfo& createInfo) {{
+    return {0}::device.init({0}::instance, physicalDevice, createInfo);
+  }}
+
+  VULKAN_HPP_INLINE bool isExtensionSupported(const std::span<{0}::ExtensionProperties> extensionList, const char* extensionName) noexcept
+  {{
+    for(const ExtensionProperties &extension : extensionList)
+      if(strcmp(extension.extensionName, extensionName) == 0)
+        return true;
+    return false;
+  }}
+)",
+                                        m_ns,
+                                        cfg.gen.expectedResult ? "bool" : "void",
+                                        cfg.gen.expectedResult ? "return " + m_ns + "::context.load();"
+                                                               : "if (!" + m_ns + "::context.load()) {\n      throw std::runtime_error(VULKAN_HPP_NAMESPACE_STRING \"::loadLib\");\n    }",
+                                        cfg.gen.expectedResult ? m_ns + "::Result" : "void",
+                                        initCheck("initInstance"),
+                                        initCheck("initDevice"));
         }
-      public:
-        CCodeGenerator(Generator &gen, OutputBuffer &output) : gen(gen), output(output)
-        {}
 
-        std::string extDebug(const GenericType &type) {
-            std::string out = "// ";
-            out += type.metaTypeString();
-            if (type.version) {
-                out += "ver: ";
-                out += type.version;
-            }
-            auto *ext = type.getExtension();
-            if (ext) {
-                out += " ext: ";
-                out += ext->name.original;
-            }
-            if (type.parentExtension) {
-                out += "->";
-                out += type.parentExtension->name.original;
+        // funcs2 += beginNamespace();
+        appendFuncs(funcs, outputFuncs);
+        genFuncs(funcs, cfg.gen.onlyC);
+        if (cfg.gen.globalMode && cfg.gen.raii.commandStream && !cfg.gen.onlyC) {
+            generateCommandStreamRAII(funcs);
+        }
+        if (cfg.gen.globalMode && cfg.gen.raii.submitBatcher && !cfg.gen.onlyC) {
+            generateSubmitBatcherRAII(funcs);
+        }
+        if (cfg.gen.globalMode && cfg.gen.raii.deferredDestroy && !cfg.gen.onlyC) {
+            generateRetireQueue(funcs);
+        }
+        if (cfg.gen.globalMode && cfg.gen.raii.pooledArrays && !cfg.gen.onlyC) {
+            for (const Handle &h : this->handles) {
+                if (h.poolFlag) {
+                    generatePooledArrayRAII(funcs, h);
+                }
             }
-            out += "\n";
-            return out;
         }
+        // genFuncs(funcs2, false);
 
-        void generate(const Platform &platfrom) {
-            const auto &protect = platfrom.protect;
-            output += "// PLATFORM ";
-            output += platfrom.name;
-            output += "\n";
-            output += "#ifdef ";
-            output += protect;
-            output += "\n";
-            for (const auto &i : platfrom.includes) {
-                output += i;
-                // std::cout << i << "\n";
-                output += "\n";
-            }
-            for (const Extension &extension : platfrom.extensions) {
-                generate(extension);
-            }
-            output += "#endif // ";
-            output += protect;
-            output += "\n";
-            output += "\n";
+        funcs += endNamespace();
+        funcs += R"(
+#ifndef VULKAN_USE_CPP
+#include "vulkan_funcs_impl.hpp"
+#endif // VULKAN_USE_CPP
+)";
+
+        // funcs2 += endNamespace();
+        // platforms += endNamespace();
+        funcs_impl += endNamespace();
+
+//        if (impl) {
+//            *impl += endNamespace();
+//        }
+
+
+
+        if (cfg.gen.globalMode) {
+            auto& impl = out.addFile("_to_string_impl");
+            impl += "#include <string>\n";
+            impl += std::move(outputToStringDef);
+
+            to_string += std::move(outputToStringDecl);
+        }
+        else {
+            to_string += std::move(outputToStringDef);
         }
 
-        void generate(const Extension &extension) {
-            //            const auto &protect = extension.protect;
-            //            if (!protect.empty()) {
-            //                output += "#ifdef " + protect + "\n";
-            //            }
-            const auto &name = extension.name.original;
-            if (!extension.comment.empty()) {
-                output += "// " + extension.comment + "\n";
-            }
-            output += "// " + name + " is a preprocessor guard. Do not pass it to API calls.\n";
-            output += "#define " + name + " 1\n";
+        if (cfg.gen.cppModules) {
+            generateModules(out, path);
+        }
 
-            for (const auto &i : extension.includes) {
-                output += i;
-                output += "\n";
+        out.writeFiles(*this);
+    }
+
+    std::vector<Generator::EnumStringEntry> Generator::getEnumStringEntries(const Enum &data, bool originalNames) const {
+        std::vector<EnumStringEntry> entries;
+        for (const auto &m : data.members) {
+            if (m.isAlias || !m.canGenerate()) {
+                continue;
             }
-            for (const auto &c : extension.constants) {
-                output += c;
+            std::string name = originalNames ? m.name.original : m.name;
+            if (!originalNames) {
+                strStripPrefix(name, "e");
             }
-            //            const auto* platformm = extension.getPlatfrom();
-            //            for (const auto &c : extension.) {
-            //                output += c;
-            //            }
-            output += "\n";
-            const Feature &contents = extension;
-            generate(contents);
-            //            if (!protect.empty()) {
-            //                output += "#endif // " + protect + "\n";
-            //            }
-            output += "\n";
+            entries.push_back(EnumStringEntry{ m.numericValue, std::move(name), &m });
         }
+        std::stable_sort(entries.begin(), entries.end(), [](const auto &lhs, const auto &rhs) { return lhs.value < rhs.value; });
+        return entries;
+    }
 
-        void generate(const Feature &feature) {
-            // output += "// " + feature.name.original;
-            output += "\n";
-            output += "// ";
-            output += feature.name.original;
-            output += " is a preprocessor guard. Do not pass it to API calls.\n";
-            output += "#define ";
-            output += feature.name.original;
-            output += " 1\n";
-            for (const Snippet &t : feature.defines) {
+    std::string Generator::generateEnumNameTable(const std::vector<EnumStringEntry> &entries) const {
+        std::string output = "    static constexpr " + m_ns + "::detail::EnumName names[] = {\n";
+        std::optional<int64_t> last;
+        for (const auto &e : entries) {
+            if (last == e.value) {
                 continue;
-                generate(t);
-            }
-            for (const Snippet &t : feature.baseTypes) {
-                generate(t);
             }
-            for (const Handle &t : feature.handles) {
-                generate(t);
+            last = e.value;
+            const auto &protect = e.member->getProtect();
+            if (!protect.empty()) {
+                output += "#if defined(";
+                output += protect;
+                output += ")\n";
             }
-            for (const Enum &t : feature.enums) {
-                generate(t);
+            output += "      { " + std::to_string(e.value) + ", \"" + e.name + "\" },\n";
+            if (!protect.empty()) {
+                output += "#endif // ";
+                output += protect;
+                output += "\n";
             }
-            for (const Struct &s : feature.forwardStructs) {
-                const auto &name = s.name.original;
-                output += "typedef struct " + name + " " + name + ";\n\n";
+        }
+        // sentinel, table is never empty when all entries are disabled
+        output += "      {}\n    };\n";
+        return output;
+    }
+
+    void Generator::generateEnumStringTables(const Enum &data, std::string &to_string_code, std::string &decl, std::string &def) const {
+        const std::string &type    = data.isBitmask() ? data.bitmask : data.name;
+        const auto         entries = getEnumStringEntries(data, false);
+        const std::string  spec    = cfg.macro.mInline.define + " ";
+
+        const auto genFunction = [&](const std::string &proto, const std::string &body) {
+            decl += "  " + proto + ";\n";
+            // explicit specializations take the specifier after template <>
+            const std::string specialization = "template <>\n  ";
+            if (proto.starts_with(specialization)) {
+                def += "  " + specialization + spec + proto.substr(specialization.size()) + "\n  {\n" + body + "  }\n\n";
+            } else {
+                def += "  " + spec + proto + "\n  {\n" + body + "  }\n\n";
             }
-            for (const FuncPointer &t : feature.funcPointers) {
-                if (t.inStruct) {
-                    generate(t);
+        };
+
+        // dense array when values are 0 .. N-1, entries are sorted and may repeat a value
+        bool dense = !entries.empty();
+        {
+            int64_t next = 0;
+            for (const auto &e : entries) {
+                if (e.value == next) {
+                    next++;
+                } else if (e.value != next - 1 || next == 0) {
+                    dense = false;
                 }
-            }
-            for (const Struct &t : feature.structs) {
-                generate(t);
-            }
-            for (const FuncPointer &t : feature.funcPointers) {
-                if (!t.inStruct) {
-                    generate(t);
+                if (!e.member->getProtect().empty()) {
+                    dense = false;
+                }
+                if (!dense) {
+                    break;
                 }
             }
-            for (const Command &t : feature.commands) {
-                generate(t);
-            }
-            output += "\n";
         }
 
-        void generateElement(const Command &elem) {
-            const auto &name = elem.name.original;
-            // output += "// " + elem.name.original + "\n";
-            output += extDebug(elem);
-            output += "typedef ";
-            output += elem.type;
-            output += " (VKAPI_PTR *PFN_";
-            output += name;
-            output += ")(";
-            auto it = elem.params.begin();
-            const auto end = elem.params.end();
-            while (it != end) {
-                const VariableData &p = *it;
-
-                output += p.originalFullType();
-                output += " ";
-                output += p.identifier();
-                output += p.optionalArraySuffix();
-
-                it++;
-                bool last = it == end;
-                if (!last) {
-                    output += ", ";
+        if (data.isBitmask()) {
+            genFunction(vkgen::format("{0}::detail::EnumNames enumNames( {1} ) VULKAN_HPP_NOEXCEPT", m_ns, type),
+                        generateEnumNameTable(entries) + "    return { names, sizeof( names ) / sizeof( names[0] ) - 1 };\n");
+            genFunction("std::string_view to_string_view( " + type + " value ) VULKAN_HPP_NOEXCEPT",
+                        "    return detail::findEnumName( enumNames( value ), static_cast<int64_t>( value ) );\n");
+            if (!entries.empty()) {
+                to_string_code = R"(    std::string result;
+    to_string( std::back_inserter( result ), value );
+    return result;
+)";
+            }
+        } else if (dense) {
+            std::string body = "    static constexpr std::string_view names[] = {\n";
+            std::optional<int64_t> last;
+            for (const auto &e : entries) {
+                if (last != e.value) {
+                    body += "      \"" + e.name + "\",\n";
+                    last = e.value;
                 }
             }
-            output += ");\n\n";
+            body += vkgen::format(R"(    }};
+    return static_cast<uint64_t>( value ) < {0} ? names[static_cast<size_t>( value )] : std::string_view();
+)",
+                                  *last + 1);
+            genFunction("std::string_view to_string_view( " + type + " value ) VULKAN_HPP_NOEXCEPT", body);
+        } else {
+            genFunction("std::string_view to_string_view( " + type + " value ) VULKAN_HPP_NOEXCEPT",
+                        generateEnumNameTable(entries) +
+                          "    return detail::findEnumName( { names, sizeof( names ) / sizeof( names[0] ) - 1 }, static_cast<int64_t>( value ) );\n");
         }
 
-        void generateElement(const Handle &type) {
-            output += extDebug(type);
-            output += type.code;
-            output += "\n";
+        if (!data.isBitmask() && !entries.empty()) {
+            to_string_code = vkgen::format(R"_(    std::string_view const name = to_string_view( value );
+    if ( !name.empty() )
+    {{
+      return std::string( name );
+    }}
+    return "invalid ( " + {0}::toHexString( static_cast<uint32_t>( value ) ) + " )";
+)_",
+                                           m_ns);
         }
 
-        void generateElement(const Struct &elem) {
-            const auto &name = elem.name.original;
-            const auto &type = elem.isUnion() ? "union" : "struct";
-            output += extDebug(elem);
-            output += "typedef ";
-            output += type;
-            output += " " + name + " {\n";
-            for (const auto &m : elem.members) {
-                output += "    " + m->originalFullType() + "    " + m->identifier() + m->optionalArraySuffix() + m->getNameSuffix() + ";\n";
+        // perfect hash, table size and seed are chosen so names do not collide
+        std::string body;
+        if (entries.empty()) {
+            body = "    (void)name;\n    return std::nullopt;\n";
+        } else {
+            const auto hash = [](std::string_view name, uint32_t seed) {
+                uint32_t h = 2166136261u ^ seed;
+                for (char c : name) {
+                    h = (h ^ static_cast<uint8_t>(c)) * 16777619u;
+                }
+                return h ^ (h >> 15);
+            };
+            size_t             size = std::bit_ceil(entries.size() * 2);
+            uint32_t           seed = 0;
+            std::vector<const EnumStringEntry *> slots;
+            while (true) {
+                slots.assign(size, nullptr);
+                bool collision = false;
+                for (const auto &e : entries) {
+                    auto &slot = slots[hash(e.name, seed) & (size - 1)];
+                    if (slot) {
+                        collision = true;
+                        break;
+                    }
+                    slot = &e;
+                }
+                if (!collision) {
+                    break;
+                }
+                if (++seed == 1024) {
+                    seed = 0;
+                    size *= 2;
+                }
             }
-            output += "} " + name + ";\n";
-            for (const auto &a : elem.aliases) {
-                output += "typedef " + name + " " + a.name.original + ";";
-                output += dbg? extDebug(a) : "\n";
+
+            body = vkgen::format("    static constexpr {0}::detail::EnumName names[{1}] = {{\n", m_ns, size);
+            for (const auto *e : slots) {
+                if (!e) {
+                    body += "      {},\n";
+                    continue;
+                }
+                const std::string entry = "      { " + std::to_string(e->value) + ", \"" + e->name + "\" },\n";
+                const auto &protect = e->member->getProtect();
+                if (!protect.empty()) {
+                    body += "#if defined(";
+                    body += protect;
+                    body += ")\n" + entry + "#else\n      {},\n#endif // ";
+                    body += protect;
+                    body += "\n";
+                } else {
+                    body += entry;
+                }
             }
-            output += "\n";
+            body += vkgen::format(R"(    }};
+    {0}::detail::EnumName const & entry = names[detail::hashEnumName( name, {1}u ) & {2}];
+    if ( !entry.name.empty() && entry.name == name )
+    {{
+      return static_cast<{3}>( entry.value );
+    }}
+    return std::nullopt;
+)",
+                                  m_ns,
+                                  seed,
+                                  size - 1,
+                                  type);
         }
+        genFunction(vkgen::format("template <>\n  std::optional<{0}> from_string<{0}>( std::string_view name ) VULKAN_HPP_NOEXCEPT", type), body);
 
-        template <typename T>
-        void generate(const std::vector<T> &elements, const std::function<void(OutputBuffer&, const T&, bool)> &func) {
-            auto it = elements.begin();
-            const auto end = elements.end();
-            while (it != end) {
-                const auto &m = *it;
-                it++;
-                const bool last = it == end;
-                // TODO
-                gen.genOptional(output, m, [&](auto &output) {
-                    func(output, m, last);
-                });
-            }
+        if (data.isBitmask()) {
+            genFunction(vkgen::format("template <>\n  std::optional<{0}> from_string<{0}>( std::string_view name ) VULKAN_HPP_NOEXCEPT", data.name),
+                        "    return detail::parseFlags<" + type + ">( name );\n");
         }
+    }
 
-        void generateElement(const Enum &type) {
-            output += extDebug(type);
-            const auto &name = type.isBitmask() ? type.bitmask.original : type.name.original;
-            if (type.type == "VkFlags") {
-                output += "typedef enum " + name + " {\n";
+    void Generator::generateEnumStr(const Enum &data, OutputBuffer &output) {
+        const auto & name = data.isBitmask()? data.bitmask : data.name;
 
-                generate<EnumValue>(type.members, [&](auto &output, const EnumValue &m, bool last){
-                    output += "    " + m.name.original;
+        GuardedOutput members;
+        GuardedOutput to_string;
+        std::unordered_set<std::string> generated;
+        std::unordered_set<std::string> generatedCase;
+
+        for (const auto &m : data.members) {
+            if (generated.find(m.name) != generated.end()) {
+                continue;
+            }
+            generated.insert(m.name);
+            if (cfg.gen.enumMock == 1 && data.isBitmask()) {
+                members.add(m, [&](auto &output) {
+                    output += "    static constexpr const ";
+                    output += data.is64bit()? "VkFlags64 " : "VkFlags ";
+                    output += m.name;
                     output += " = ";
                     output += m.value;
-
-                    if (!last) {
-                        output += ",";
-                    }
-//                    if (!m.alias.empty()) {
-//                        output += " // " + m.alias;
-//                    }
-//                    output += dbg? extDebug(m) : "\n";
-//                    for (const auto &a : m.aliases) {
-//                        output += "  // ";
-//                        output += a.name;
-//                        output += "\n";
-//                    }
-                    output += "\n";
+                    output += ";\n";
                 });
-                output += "} " + name + ";\n";
-
             }
             else {
-                output += "typedef " + type.type + " " + name + ";\n";
-
-                generate<EnumValue>(type.members, [&](auto &output, const EnumValue &m, bool last){
-                    output += "static const " + name + " " + m.name.original;
-                    output += " = ";
-                    output += m.value;
-                    output += ";";
-//                    if (!m.alias.empty()) {
-//                        output += " // " + m.alias;
-//                    }
-//                    output += "\n";
-//                    for (const auto &a : m.aliases) {
-//                        output += "  // ";
-//                        output += a.name;
-//                        output += "\n";
-//                    }
-                    output += "\n";
+                members.add(m, [&](auto &output) {
+                    output += "    " + m.name + " = " + m.value;
+                    if (cfg.dbg.methodTags) {
+                        output += ", // " + m.name.original + "\n";
+                    } else {
+                        output += ",\n";
+                    }
                 });
             }
 
+            if (!m.isAlias) {
+                if (generatedCase.find(m.value) != generatedCase.end()) {
+                    continue;
+                }
+                generatedCase.insert(m.value);
+                to_string.add(m, [&](auto &output) {
+                    std::string value = m.name;
+                    strStripPrefix(value, "e");
+                    output += "      case " + name;
+                    output += "::" + m.name;
+                    output += ": return \"" + value + "\";\n";
+                });
+            }
+        }
 
-            if (type.isBitmask()) {
-                output += "typedef " + type.type + " " + type.name.original + ";\n";
+        if (cfg.gen.enumMock == 1 && data.isBitmask()) {
+            output += "  namespace " + name + " {\n";
+            output += members.toString();
+            output += "  }\n";
+        }
+        else {
+            output += "  enum class " + name;
+            if (data.isBitmask()) {
+                output += " : " + data.name.original;
             }
-            for (const auto &a : type.aliases) {
-                // output += "  // A: ";
-                // output += a.name;
-                const auto &name =
-                  (a.name.find("FlagBits") != std::string::npos)? type.bitmask.original : type.name.original;
-                output += "typedef " + name + " " + a.name.original + "; ";
-                output += dbg? extDebug(a) : "\n";
+            output += " {\n";
+            output += members.toString();
+            if (cfg.gen.enumMock == 2 && data.isBitmask()) {
+                output += "    allFlags = ";
+                output += std::move(generateAllFlagsValue(data));;
+                output += ",\n";
             }
-
-            output += "\n";
-
+            output += "\n  };\n";
         }
 
-        void generateElement(const Snippet &type) {
-            output += type.code;
-            output += "\n\n";
+        for (const auto &a : data.aliases) {
+            const auto &name =
+              (a.name.find("FlagBits") != std::string::npos)? data.bitmask.original : data.name.original;
+            output += "  using " + a.name + " = " + name + ";\n";
         }
 
-    };
-
-    static void generateTypeDebug(GenericType &type, OutputBuffer &output) {
-        output += std::move(type.getVersionDebug());
-        //        debugGen.insert(type.name.original);
-        //        for (const auto &d : type.dependencies) {
-        //            if (debugGen.find(d->name.original) == debugGen.end()) {
-        //                output += "//     " + d->name.original;
-        //                output += "  MISSING";
-        //                output += "\n";
-        //            }
-        //        }
-        output += "\n";
-        // generateDebugMock(type, output);
-    }
-
-    static void generateFeatureDebgug(const Feature &f, OutputBuffer &output) {
-        for (const auto &t : f.baseTypes) {
-            generateTypeDebug(t, output);
-        }
-        for (const auto &t : f.handles) {
-            generateTypeDebug(t, output);
+        std::string str;
+        if (data.isBitmask()) {
+            genFlagTraits(data, name, output, str);
         }
-        for (const auto &t : f.enums) {
-            generateTypeDebug(t, output);
+        /*
+        FunctionGenerator fun(*this, "std::string", "to_string");
+        fun.indent = "  ";
+        fun.base = &data;
+        fun.optionalProtect = Protect{"VULKAN_HPP_NO_TO_STRING", false};
+        fun.allowInline = true;
+        fun.specifierInline = true;
+        fun.add(data.name, "value");
+        */
+
+        if (data.isBitmask()) {
+            // fun.code = str;
         }
-        for (const auto &t : f.structs) {
-            generateTypeDebug(t, output);
+        else {
+            str = to_string.toString();
+            if (str.empty()) {
+                str = "    return \"\\\"(void)\\\"\";\n";
+            } else {
+                str += "      default: return \"invalid ( \" + " + m_ns + "::toHexString(static_cast<uint32_t>(value))  + \" )\";";
+
+                str = vkgen::format(R"(
+    switch (value) {{
+{0}
+    }}
+)", str);
+            }
         }
-        for (const auto &t : f.funcPointers) {
-            generateTypeDebug(t, output);
+
+        std::string tablesDecl;
+        std::string tables;
+        if (cfg.gen.enumStringTables && (!data.isBitmask() || cfg.gen.enumMock != 1)) {
+            generateEnumStringTables(data, str, tablesDecl, tables);
         }
-        for (const auto &t : f.commands) {
-            generateTypeDebug(t, output);
+
+        std::string proto = "std::string to_string(";
+        proto += data.name;
+        proto += " value)";
+
+        // to_string_output += fun.generate(outputFuncs);
+        if (cfg.gen.globalMode) {
+            outputToStringDecl.add(data, [&](auto &output){
+                output += tablesDecl;
+                output += "  ";
+                output += proto;
+                output += ";\n\n";
+            });
         }
+
+        outputToStringDef.add(data, [&](auto &output){
+            output += tables;
+            output += "  ";
+            output += cfg.macro.mInline.define;
+            output += " ";
+            output += proto;
+            output += " {\n";
+            output += str;
+            output += "  }\n";
+        });
     }
 
-    static void printDebugExtensionDepends(const Extension *ext, int indent, OutputBuffer &output) {
-        if (!ext->versiondepends.empty()) {
-            for (int i = 0; i < indent; ++i) {
-                output += " ";
+    void Generator::generateEnum(const Enum &data, OutputBuffer &output, OutputBuffer &output_forward) {
+        auto p = data.getProtect();
+//        if (!p.empty()) {
+//            outputFuncs.platform.add(data, [&](auto &output) { generateEnumStr(data, output); });
+//        } else {
+            genOptional(output, data, [&](auto &output) {
+                generateEnumStr(data, output);
+            });
+        // }
+
+        genOptional(output_forward, data, [&](auto &output) {
+            output += "  enum class " + data.name;
+            if (data.isBitmask()) {
+                output += " : " + data.name.original;
             }
-            output += "// -> " + ext->versiondepends + "\n";
+            output += ";\n";
+        });
+    }
+
+    std::string Generator::generateToStringInclude() const {
+        std::string output;
+        output += "#include \"vulkan_enums.hpp\"\n";
+        /*
+        if (cfg.gen.importStdMacro) {
+            output += R"(
+#ifndef USE_IMPORT_STD
+)";
         }
 
-        for (const auto *dep : ext->depends) {
-            for (int i = 0; i < indent; ++i) {
-                output += " ";
-            }
-            output += "// -> " + dep->name + "\n";
-            printDebugExtensionDepends(dep, indent + 2, output);
+        if (cfg.gen.importStdMacro) {
+            output += R"(
+#endif
+)";
         }
+        */
+        return output;
     }
 
-    void Generator::generateCore(OutputBuffer &output) {
-
-        output += vkgen::format(RES_HEADER_C, headerVersion);
-
-        for (const auto &c : apiConstants) {
-            output += "#define " + c.name.original + "  " + c.value + "\n";
+    void Generator::generateEnums(OutputBuffer &output, OutputBuffer &output_forward) {
+        if (verbose) {
+            std::cout << "gen enums " << '\n';
         }
 
-        /*
-        for (const auto &feature : features) {
-            output += "\n\n// feature: " + feature.name + "\n";
-            generateFeatureDebgug(feature, output);
+        // outputToStringDecl += generateToStringInclude();
+
+        outputToStringDecl += "#include <string>\n";
+        if (cfg.gen.enumStringTables) {
+            auto &header = cfg.gen.globalMode ? outputToStringDecl : outputToStringDef;
+            header += "#include <iterator>\n";
+            header += "#include <optional>\n";
+            header += "#include <string_view>\n";
         }
-        for (const Extension &extension : extensions.ordered) {
-            output += "\n\n// ext " + std::to_string(extension.number) + ": " + extension.name + " (" + std::to_string(extension.elements) + ")\n";
-            // printDebugExtensionDepends(&extension, 2, output);
-            generateFeatureDebgug(extension, output);
+        outputToStringDecl += beginNamespace();
+        outputToStringDef += beginNamespace();
+        if (cfg.gen.enumStringTables) {
+            auto &header = cfg.gen.globalMode ? outputToStringDecl : outputToStringDef;
+            header += RES_ENUM_STRING_TABLES;
         }
-        */
 
-        CCodeGenerator cgen{*this, output};
+        output += "#include <type_traits>\n";
+        output += "#include \"vulkan_hpp_macros.hpp\"\n";
+        output += "\n";
 
-        for (const auto &feature : features) {
-            cgen.generate(feature);
+        output += beginNamespace();
+        output_forward += beginNamespace();
+
+        generateFlags(output);
+
+        if (!cfg.gen.globalMode) {
+            gen(output, cfg.gen.handleTemplates, [&](auto &output) {
+                output += R"(
+  template <typename EnumType, EnumType value>
+  struct CppType
+  {};
+)";
+            });
         }
-        for (const Extension &extension : extensions.ordered) {
-            if (!extension.platform) {
-                cgen.generate(extension);
+
+        std::unordered_set<std::string> generated;
+        for (const auto &e : enums) {
+            if (generated.contains(e.name)) {
+                continue;
             }
+            generateEnum(e, output, output_forward);
+            generated.insert(e.name);
         }
-        for (const Platform &platform : platforms.ordered) {
-            cgen.generate(platform);
+
+        outputToStringDecl += endNamespace();
+        outputToStringDef += endNamespace();
+        if (cfg.gen.enumStringTables && !cfg.gen.cppModules) {
+            auto &header = cfg.gen.globalMode ? outputToStringDecl : outputToStringDef;
+            header += vkgen::format(RES_ENUM_FORMATTERS, m_ns);
         }
+        output += endNamespace();
+        output_forward += endNamespace();
 
-        /*
-                output += "\n// basetypes\n";
-                for (const auto &b : baseTypes) {
-                    output += std::move(b.second.getVersionDebug());
-                    output += b.second.code;
-                    output += "\n\n";
-                }
+        if (verbose) {
+            std::cout << "gen enums done" << '\n';
+        }
+    }
 
-                output += "\n// funcpointers\n";
-                for (const auto &b : funcPointers) {
-                    output += std::move(b.second.getVersionDebug());
-                    output += b.second.code;
-                    output += "\n\n";
-                }
+    std::string Generator::generateAllFlagsValue(const Enum &data) {
+        std::string output;
 
-                output += "\n// enums\n";
-                for (const auto &e : enums) {
-                    output += std::move(e.getVersionDebug());
-                    output += "// enum " + e.name.original + "\n\n";
-                }
+        // std::map<std::string, std::string> temp;
+        std::map<std::string, uint64_t> values;
 
-                for (const auto &e : structs) {
-                    output += std::move(e.getVersionDebug());
-                    output += std::string("// ") + (e.isUnion()? "union" : "struct") + " " + e.name.original + "\n\n";
-                }
-        */
+        for (const auto & m : data.members) {
+            if (m.isAlias) {
+                continue;
+            }
 
-    }
+            const auto &p = m.getProtect();
+//            std::string &dst = temp[std::string(p)];
+//            if (!dst.empty()) {
+//                dst += "\n        | ";
+//            }
+//            dst += inherit + "::" + m.name + " // " + std::string(m.value) + ", " + std::to_string(m.numericValue);
 
-    void Generator::generateApiVideo(std::filesystem::path path) {
-        if (!video) {
-            return;
+            values[std::string(p)] |= m.numericValue;
         }
-        GenOutput files{ "", ".h", path };
-        files.cguard = true;
-        for (const auto &e : video->extensions) {
-            if (e.comment.starts_with("protect with ")) {
-                const auto guard = e.comment.substr(14);
+
+        if (values.empty()) {
+            output += cfg.gen.enumMock < 2? "{}" : "0";
+        } else {
+            std::string name = std::regex_replace(data.name, std::regex("FlagBits"), "Flags");
+            if (cfg.gen.enumMock < 2) {
+                output += "static_cast<";
+                output += name;
+                output += ">(\n          ";
+            }
+            bool first = true;
+            bool hasProtect = false;
+            for (const auto &v : values) {
+                const auto &p = v.first;
+                hasProtect = !p.empty();
+                if (hasProtect) {
+                    if (cfg.gen.enumMock >= 2 && first) {
+                        output += "\n";
+                    }
+                    output += "#if defined(" + p + ")";
+                    if (first) {
+                        output += "\n";
+                    }
+                }
+                if (first) {
+                    first = false;
+                } else {
+                    output += "\n        | ";
+                }
+                output += EnumValue::toHex(v.second, data.is64bit());
+                output += "\n";
+                if (hasProtect) {
+                    output += "#endif // " + p + "\n";
+                }
+            }
+            if (cfg.gen.enumMock < 2) {
+                output += "    )";
+            }
+            else if (!hasProtect) {
+                strStripSuffix(output, "\n");
             }
-            auto &file = files.addFile(e.name);
-            CCodeGenerator cgen{*this, file};
-            cgen.generate(e);
         }
-        files.writeFiles(*this);
+
+        return output;
     }
 
-    void Generator::generateApiC(std::filesystem::path path) {
-        GenOutput vkfiles{ "vk", ".h", path };
-        vkfiles.cguard = true;
-        auto &platform = vkfiles.addFile("_platform");
-        platform += CODE_PLATFORM_H;
+    void Generator::genFlagTraits(const Enum &data, std::string inherit, OutputBuffer &output, std::string &to_string_code) {
+        std::string name = std::regex_replace(data.name, std::regex("FlagBits"), "Flags");
 
-        vkfiles.writeFiles(*this);
+        OutputBuffer str;
 
-        GenOutput files{ "vulkan", ".h", path };
-        files.cguard = true;
-        auto &main = files.addFile("");
-        // main += "#include \"vk_platform.h\"\n\n";
+        std::map<std::string, std::string> temp;
+        std::map<std::string, uint64_t> values;
 
-        generateCore(main);
+        for (size_t i = 0; i < data.members.size(); ++i) {
+            const auto &m = data.members[i];
+            if (m.isAlias) {
+                continue;
+            }
+//            genOptional(flags, m, [&](auto &output) {
+//                if (output.size() != 0) {
+//                    output += "\n        | ";
+//                }
+//                output += inherit + "::" + m.name;
+//            });
 
-        files.writeFiles(*this);
-    }
+            const auto &p = m.getProtect();
+            std::string &dst = temp[std::string(p)];
+            if (!dst.empty()) {
+                dst += "\n        | ";
+            }
+            dst += inherit + "::" + m.name + " // " + std::string(m.value) + ", " + std::to_string(m.numericValue);
 
-    void Generator::generateApiCpp(std::filesystem::path path) {
-        // std::cout << "gen files " << '\n';
+            values[std::string(p)] |= m.numericValue;
 
-        GenOutput out{ "vulkan", ".hpp", path };
+            genOptional(str, m, [&](auto &output) {
+                std::string value = m.name;
+                strStripPrefix(value, "e");
+                output += vkgen::format(R"(
+    if (value & {0}::{1})
+      result += "{2} | ";
+)",
+                                        inherit,
+                                        m.name,
+                                        value);
+            });
+        }
+
+        if (cfg.gen.enumMock == 1) {
+            output += vkgen::format(R"(  using {0} = {1};
+
+)",
+                                    name,
+                                    data.is64bit()? "VkFlags64" : "VkFlags");
+        }
+        else {
+            output += vkgen::format(R"(  using {0} = Flags<{1}>;
+
+)",
+                                    name,
+                                    inherit);
+            if (useCompactFlags()) {
+                const std::string maskType = data.is64bit()? "VkFlags64" : "VkFlags";
+                output += vkgen::format(R"(  consteval {0} allFlagsOf( {1} ) VULKAN_HPP_NOEXCEPT
+  {{
+    {0} mask = 0;
+)",
+                                        maskType,
+                                        inherit);
+                for (const auto &m : data.members) {
+                    if (m.isAlias) {
+                        continue;
+                    }
+                    genOptional(output, m, [&](auto &output) {
+                        output += "    mask |= static_cast<" + maskType + ">( " + inherit + "::" + m.name + " );\n";
+                    });
+                }
+                output += "    return mask;\n  }\n\n";
+            }
+            else if (cfg.gen.enumMock == 0) {
+                output += expIfndef("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
+                output += vkgen::format(R"(
+  template <>
+  struct FlagTraits<{0}> {{
+)",
+                                        inherit);
+                if (data.isBitmask()) {
+                    output += "    static VULKAN_HPP_CONST_OR_CONSTEXPR bool             isBitmask = true;\n";
+                }
+                output += "    static VULKAN_HPP_CONST_OR_CONSTEXPR " + name + " allFlags = ";
+                output += std::move(generateAllFlagsValue(data));
+                output += ";\n  };\n";
+                output += expEndif("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
+            }
+        }
 
-        auto &enums           = out.addFile("_enums");
-        auto &enums_forward   = out.addFile("_enums_forward");
-        auto &to_string       = out.addFile("_to_string");
-        auto &handles         = out.addFile("_handles");
-        auto &smart_handles   = out.addFile("_smart");
-        auto &forward         = out.addFile("_forward");
-        auto &handles_forward = out.addFile("_handles_forward");
-        auto &structs_forward = out.addFile("_structs_forward");
-        auto &structs         = out.addFile("_structs");
-        auto &types           = out.addFile("_types");
+        if (str.size() == 0) {
+            to_string_code = "    return \"{}\";\n";
+        } else {
+            std::stringstream temp;
+            temp << str;  // TODO
 
-        // auto &platforms       = out.addFile("_platforms");
-        auto &macros          = out.addFile("_hpp_macros");
+            to_string_code = vkgen::format(R"(
+    if ( !value )
+      return "{{}}";
+    std::string result;
+{0}
+    return "{{ " + result.substr( 0, result.size() - 3 ) + " }}";
+)", temp.str());
+        }
+    }
 
-        generateMacros(macros);
+    void Generator::generateDispatch(OutputBuffer &output) {
+        output += generateDispatchLoaderBase();
+        output += "#if !defined( VK_NO_PROTOTYPES )\n";
+        generateDispatchLoaderStatic(output);
+        output += "#endif // VK_NO_PROTOTYPES\n";
+        output += R"(
+  class DispatchLoaderDynamic;
+#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
+#  if defined( VK_NO_PROTOTYPES )
+#    define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
+#  else
+#    define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 0
+#  endif
+#endif
 
-        generateEnums(enums, enums_forward);
+#if !defined( VULKAN_HPP_STORAGE_API )
+#  if defined( VULKAN_HPP_STORAGE_SHARED )
+#    if defined( _MSC_VER )
+#      if defined( VULKAN_HPP_STORAGE_SHARED_EXPORT )
+#        define VULKAN_HPP_STORAGE_API __declspec( dllexport )
+#      else
+#        define VULKAN_HPP_STORAGE_API __declspec( dllimport )
+#      endif
+#    elif defined( __clang__ ) || defined( __GNUC__ )
+#      if defined( VULKAN_HPP_STORAGE_SHARED_EXPORT )
+#        define VULKAN_HPP_STORAGE_API __attribute__( ( visibility( "default" ) ) )
+#      else
+#        define VULKAN_HPP_STORAGE_API
+#      endif
+#    else
+#      define VULKAN_HPP_STORAGE_API
+#      pragma warning Unknown import / export semantics
+#    endif
+#  else
+#    define VULKAN_HPP_STORAGE_API
+#  endif
+#endif
+)";
 
+        output += vkgen::format(R"(
+#if !defined( VULKAN_HPP_DEFAULT_DISPATCHER )
+#  if VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1
+#    define VULKAN_HPP_DEFAULT_DISPATCHER ::{0}::defaultDispatchLoaderDynamic
+#    define VULKAN_HPP_DEFAULT_DISPATCH_LOADER_DYNAMIC_STORAGE                     \
+      namespace {0}                                                        \
+      {{                                                                            \
+        VULKAN_HPP_STORAGE_API DispatchLoaderDynamic defaultDispatchLoaderDynamic; \
+      }}
+  extern VULKAN_HPP_STORAGE_API DispatchLoaderDynamic defaultDispatchLoaderDynamic;
+#  else
+  static inline ::{0}::DispatchLoaderStatic & getDispatchLoaderStatic()
+  {{
+    static ::{0}::DispatchLoaderStatic dls;
+    return dls;
+  }}
+#    define VULKAN_HPP_DEFAULT_DISPATCHER ::{0}::getDispatchLoaderStatic()
+#    define VULKAN_HPP_DEFAULT_DISPATCH_LOADER_DYNAMIC_STORAGE
+#  endif
+#endif
 
-        generateForwardHandles(handles_forward);
+#if !defined( VULKAN_HPP_DEFAULT_DISPATCHER_TYPE )
+#  if VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1
+#    define VULKAN_HPP_DEFAULT_DISPATCHER_TYPE ::{0}::DispatchLoaderDynamic
+#  else
+#    define VULKAN_HPP_DEFAULT_DISPATCHER_TYPE ::{0}::DispatchLoaderStatic
+#  endif
+#endif
+)",
+                                m_ns);
+    }
 
-        structs_forward += beginNamespace();
-        for (const Struct &e : this->structs.ordered) {
-            generateStructDecl(structs_forward, e);
-        }
-        structs_forward += endNamespace();
+    void Generator::generateApiConstants(OutputBuffer &output) {
 
-        // forward += "#include \"" + out.getFilename("_enums_forward") + "\"\n";
-        forward += "#include \"" + out.getFilename("_structs_forward") + "\"\n";
-        forward += "#include \"" + out.getFilename("_handles_forward") + "\"\n";
+        output += R"(
+    //===========================
+    //=== CONSTEXPR CONSTANTs ===
+    //===========================
+)";
 
-        types += "#include \"vulkan.h\"\n";
-        types += "#include \"vulkan_hpp_macros.hpp\"\n";
-        types += beginNamespace();
-        types += RES_BASE_TYPES;
-        types += "\n";
-        types += endNamespace();
-        if (!cfg.gen.onlyC) {
-            types += "#include \"vulkan_enums.hpp\"\n";
-        }
-        types += "#include \"vulkan_handles.hpp\"\n";
-        if (!cfg.gen.onlyC) {
-            types += "#include \"vulkan_structs.hpp\"\n";
+        for (const auto &a : apiConstants) {
+            genOptional(output,
+              a, [&](auto &output) { output += "    VULKAN_HPP_CONSTEXPR_INLINE " + a.type + " " + a.name + " = " + a.name.original + ";\n"; });
         }
 
-        generateHandles(handles, smart_handles, out);
-
-        generateStructs(structs);
+        output += R"(
+    //========================
+    //=== CONSTEXPR VALUEs ===
+    //========================
+    VULKAN_HPP_CONSTEXPR_INLINE uint32_t HeaderVersion = VK_HEADER_VERSION;
+)";
 
-        generateMainFile(out);
+    }
 
-        if (cfg.gen.globalMode) {
-            auto &global         = out.addFile("_global");
-            global += "#include \"vulkan.hpp\"\n";
-            global += beginNamespace();
-            global += "  " + loader.name + " " + strFirstLower(loader.name) + ";\n";
-            for (const Handle &t : topLevelHandles) {
-                global += "  " + t.name + " " + strFirstLower(t.name) + ";\n";
+    void Generator::generateResultValue(OutputBuffer &output) {
+        if (cfg.gen.expectedResult) {
+            output += vkgen::format(RES_RESULT_VALUE_EXPECTED, cfg.gen.globalMode ? "VkResult" : "Result");
+            if (!cfg.gen.globalMode) {
+                output += RES_RESULT_VALUE_EXPECTED_VK;
             }
-            // global += "  Dispatch dispatch;\n";
-//            for (const Handle &t : topLevelHandles) {
-//                global += "  " + t.name.original + " " + t.name + "::m_handle = {};\n";
-//            }
-//            global += "  " + loader.name + "Dispatcher " + loader.name + "::m_dispatcher = {};\n";
-//            for (const Handle &t : topLevelHandles) {
-//                global += "  " + t.name + "Dispatcher " + t.name + "::m_dispatcher = {};\n";
-//            }
-            global += endNamespace();
+            return;
+        }
 
-            {
-                auto &output = out.addFile("_enum_string", ".h");
-                // output += "#include <iostream>\n";
-                // output += "#include \"vulkan.h\"\n";
-                output += "#include \"vulkan.hpp\"\n";
-                output += "#include <string>\n";
-                output += "\n";
-                for (const Enum &e : this->enums.ordered) {
-                    genOptional(output, e, [&](auto &output) {
-                        output += "  " + m_inline + " std::string string_" + e.name.original + "(" + e.name.original + " value)";
-                        output += "  {\n";
-                        if (e.isBitmask()) {
-                            if (e.members.empty()) {
-                                output += "     return \"{}\";\n";
-                            } else {
-                                output += R"(
-    if ( !value )
-      return "{}";
-    std::string result;
-)";
-                                for (const auto &m : e.members) {
-                                    if (m.isAlias) {
-                                        continue;
-                                    }
-                                    genOptional(output, m, [&](auto &output) {
-                                        output += "    if (value & " + m.name.original + ")\n";
-                                        output += "       result += \"" + m.name.original + " | \";\n";
-                                    });
-                                }
-                                output += "    return \"{ \" + result.substr( 0, result.size() - 3 ) + \" }\";\n";
-                            }
-                        } else {
-                            output += "    switch (value) {\n";
-                            if (e.members.empty()) {
-                                output += "      // no values\n";
-                            }
-                            for (const auto &m : e.members) {
-                                if (m.isAlias) {
-                                    continue;
-                                }
-                                genOptional(
-                                  output, m, [&](auto &output) { output += "      case " + m.name.original + ": return \"" + m.name.original + "\";\n"; });
-                            }
-                            output += "      default: return \"invalid ( \" + vk::toHexString(value)  + \" )\";\n";
-                            output += "    }\n";
-                        }
-                        output += "  }\n";
+        output += R"(
+  template <typename T>
+  void ignore( T const & ) VULKAN_HPP_NOEXCEPT
+  {
+  }
 
-                        for (const auto &a : e.aliases) {
-                            output += "  " + m_inline + " std::string string_" + a.name.original + "(" + e.name.original + " value) {\n";
-                            output += "    return string_" + e.name.original + "(value);\n";
-                            output += "  }\n";
-                        }
-                    });
-                }
+  template <typename T>
+  struct ResultValue
+  {
+)";
 
-            }
+        if (!cfg.gen.globalMode) {
+            output += R"(
+#ifdef VULKAN_HPP_HAS_NOEXCEPT
+    ResultValue( Result r, T & v ) VULKAN_HPP_NOEXCEPT( VULKAN_HPP_NOEXCEPT( T( v ) ) )
+#else
+    ResultValue( Result r, T & v )
+#endif
+      : result( r ), value( v )
+    {
+    }
 
-            {
-                auto &output = out.addFile("_struct_string", ".h");
-                output += "#include \"vulkan_enum_string.h\"\n";
-                output += beginNamespace();
-                for (const Struct &s : this->structs.ordered) {
-                    genOptional(output, s, [&](auto &output) {
-                        output += "  " + m_inline + " std::string to_string(const " + s.name.original + " &value)";
-                        output += "  {\n";
-                        output += "    std::string result;\n";
-                        output += "    result += \"" + s.name.original + " {\\n\";\n";
-                        for (const auto &m : s.members) {
-                            output += "    result.append(\"\\n  " + m->identifier() + ": \").append(";
-                            if (m->isPointer() || m->isArray() || m->hasArrayLength() || m->original.type().starts_with("PFN") || m->isHandle()) {
-                                // output += "std::hex << value." + m->identifier() + " << std::dec << '\\n';\n";
-                                // output += "\"Pointer\"";
-                                output += "std::to_string(reinterpret_cast<uintptr_t>(value." + m->identifier() + "))";
-                            }
-                            else if (m->isUnion()) {
-                                output += "\"Union: " + m->original.type() + "\"";
-                            }
-                            else if (m->isStruct()) {
-                                output += "to_string(value." + m->identifier() + ")";
-                            }
-                            else if (m->isEnum()) {
-                                std::string type = std::regex_replace(m->original.type(), std::regex("FlagBits"), "Flags");
-                                output += "string_" + type + "(value." + m->identifier() + ")";
-                            }
-                            else {
-                                output += "std::to_string(value." + m->identifier() + ")";
-                            }
-                            output += ");\n";
-                        }
-                        output += "    result += \"\\n}\\n\";\n";
-                        output += "    return result;\n";
-                        output += "  }\n";
-                    });
-                }
-                output += endNamespace();
-            }
+#ifdef VULKAN_HPP_HAS_NOEXCEPT
+    ResultValue( Result r, T && v ) VULKAN_HPP_NOEXCEPT( VULKAN_HPP_NOEXCEPT( T( std::move( v ) ) ) )
+#else
+    ResultValue( Result r, T && v )
+#endif
+      : result( r ), value( std::move( v ) )
+    {
+    }
 
-            /*
-            for (const Enum &e: this->enums.ordered) {
-                to_stream += "// " + e.name.original + "\n";
-                for (const auto &m : e.members) {
-                    to_stream += "  // " + m.name.original + "    " + m.name + "\n";
+    Result result;
+    T      value;
+
+    operator std::tuple<Result &, T &>() VULKAN_HPP_NOEXCEPT
+    {
+      return std::tuple<Result &, T &>( result, value );
+    }
+  };
+)";
 
-                }
-                to_stream += "\n";
-            }
-            */
-            // to_stream += endNamespace();
         }
+        else {
+            output += R"(
+#ifdef VULKAN_HPP_HAS_NOEXCEPT
+    ResultValue( VkResult r, T & v ) VULKAN_HPP_NOEXCEPT( VULKAN_HPP_NOEXCEPT( T( v ) ) )
+#else
+    ResultValue( VkResult r, T & v )
+#endif
+      : result( r ), value( v )
+    {
+    }
 
-        if (cfg.gen.raii.enabled) {
-            auto &raii         = out.addFile("_raii");
-            auto &raii_forward = out.addFile("_raii_forward");
-            auto &raii_funcs   = out.addFile("_raii_funcs");
+#ifdef VULKAN_HPP_HAS_NOEXCEPT
+    ResultValue( VkResult r, T && v ) VULKAN_HPP_NOEXCEPT( VULKAN_HPP_NOEXCEPT( T( std::move( v ) ) ) )
+#else
+    ResultValue( VkResult r, T && v )
+#endif
+      : result( r ), value( std::move( v ) )
+    {
+    }
 
-            generateRAII(raii, raii_forward, out);
-            generateFuncsRAII(raii_funcs);
-        }
+    VkResult result;
+    T      value;
 
-        if (cfg.gen.expApi || true) {
-            auto                   &context = out.addFile("_context");
-            generateContext(context);
+    operator std::tuple<VkResult &, T &>() VULKAN_HPP_NOEXCEPT
+    {
+      return std::tuple<VkResult &, T &>( result, value );
+    }
+};
+)";
         }
 
-        auto &funcs           = out.addFile("_funcs");
-        auto &funcs_impl           = out.addFile("_funcs_impl");
-        // auto &funcs2           = out.addFile("_funcs2");
+        output += R"(
+/*
+#if !defined( VULKAN_HPP_NO_SMART_HANDLE )
+  template <typename Type, typename Dispatch>
+  struct ResultValue<UniqueHandle<Type, Dispatch>>
+  {
+#  ifdef VULKAN_HPP_HAS_NOEXCEPT
+    ResultValue( Result r, UniqueHandle<Type, Dispatch> && v ) VULKAN_HPP_NOEXCEPT
+#  else
+    ResultValue( Result r, UniqueHandle<Type, Dispatch> && v )
+#  endif
+      : result( r )
+      , value( std::move( v ) )
+    {
+    }
 
-        // OutputBuffer *impl = nullptr;
-        // if (cfg.gen.cppFiles) {
-        if (cfg.gen.globalMode) {
-            auto& impl = out.addFile("_impl", ".cpp");
-            impl += "#include \"vulkan.hpp\"\n";
-//            impl += R"(
-//#ifdef VULKAN_HPP_HAS_SPACESHIP_OPERATOR
-//#  define VULKAN_HPP_USE_SPACESHIP_OPERATOR
-//#endif
-//)";
-            impl += "#undef VULKAN_HPP_INLINE\n";
-            impl += "#define VULKAN_HPP_INLINE\n";
-            impl += "#include \"vulkan_funcs_impl.hpp\"\n\n";
-            impl += "#include \"vulkan_to_string_impl.hpp\"\n\n";
-            impl += "#include \"vulkan_global.hpp\"\n\n";
-            // impl += beginNamespace();
-        }
+    std::tuple<Result, UniqueHandle<Type, Dispatch>> asTuple()
+    {
+      return std::make_tuple( result, std::move( value ) );
+    }
 
-        const auto appendFuncs = [&](OutputBuffer &output, GuardedOutputFuncs &funcs) {
+    Result                       result;
+    UniqueHandle<Type, Dispatch> value;
+  };
 
-//            if (impl) {
-//                *impl += std::move(funcs.def);
-//            } else {
-//                output += "// definitions: \n";
-//                output += std::move(funcs.def);
-//            }
-            funcs_impl += std::move(funcs.def);
+  template <typename Type, typename Dispatch>
+  struct ResultValue<std::vector<UniqueHandle<Type, Dispatch>>>
+  {
+#  ifdef VULKAN_HPP_HAS_NOEXCEPT
+    ResultValue( Result r, std::vector<UniqueHandle<Type, Dispatch>> && v ) VULKAN_HPP_NOEXCEPT
+#  else
+    ResultValue( Result r, std::vector<UniqueHandle<Type, Dispatch>> && v )
+#  endif
+      : result( r )
+      , value( std::move( v ) )
+    {
+    }
 
-            output += std::move(funcs.decl);
-            output += std::move(funcs.templ);
+    std::tuple<Result, std::vector<UniqueHandle<Type, Dispatch>>> asTuple()
+    {
+      return std::make_tuple( result, std::move( value ) );
+    }
 
-            output += std::move(funcs.platform);
-            // platforms += std::move(funcs.platform);
+    Result                                    result;
+    std::vector<UniqueHandle<Type, Dispatch>> value;
+  };
+#endif
+*/
 
-        };
+  template <typename T>
+  struct ResultValueType
+  {
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    typedef ResultValue<T> type;
+#else
+    typedef T    type;
+#endif
+  };
+)";
+        if (!cfg.gen.globalMode) {
+            output += R"(
+  template <>
+  struct ResultValueType<void>
+  {
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    typedef Result type;
+#else
+    typedef void type;
+#endif
+  };
 
-        const auto genFuncs = [&](OutputBuffer &output, bool useC){
-            GuardedOutputFuncs funcs;
-            generateGlobalFuncs(funcs, useC);
-            appendFuncs(output, funcs);
-        };
+  VULKAN_HPP_INLINE typename ResultValueType<void>::type createResultValueType( Result result )
+  {
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    return result;
+#else
+    ignore( result );
+#endif
+  }
 
-        if (cfg.gen.globalMode) {
-            funcs += R"(
-#if ( __cpp_lib_span >= 201803L )
-#  include <span>
+  template <typename T>
+  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( Result result, T & data )
+  {
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    return ResultValue<T>( result, data );
+#else
+    ignore( result );
+    return data;
+#endif
+  }
+
+  template <typename T>
+  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( Result result, T && data )
+  {
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    return ResultValue<T>( result, std::move( data ) );
+#else
+    ignore( result );
+    return std::move( data );
+#endif
+  }
+
+VULKAN_HPP_INLINE typename ResultValueType<void>::type createResultValueType( VkResult result )
+  {
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    return static_cast<Result>(result);
+#else
+    ignore( result );
+#endif
+  }
+
+  template <typename T>
+  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( VkResult result, T & data )
+  {
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    return ResultValue<T>( static_cast<Result>(result), data );
+#else
+    ignore( result );
+    return data;
+#endif
+  }
+
+  template <typename T>
+  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( VkResult result, T && data )
+  {
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    return ResultValue<T>( static_cast<Result>(result), std::move( data ) );
+#else
+    ignore( result );
+    return std::move( data );
+#endif
+  }
+)";
+        }
+        else {
+            output += R"(
+  template <>
+  struct ResultValueType<void>
+  {
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    typedef VkResult type;
+#else
+    typedef void type;
+#endif
+  };
+
+  VULKAN_HPP_INLINE typename ResultValueType<void>::type createResultValueType( VkResult result )
+  {
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    return result;
+#else
+    ignore( result );
+#endif
+  }
+
+  template <typename T>
+  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( VkResult result, T & data )
+  {
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    return ResultValue<T>( result, data );
+#else
+    ignore( result );
+    return data;
+#endif
+  }
+
+  template <typename T>
+  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( VkResult result, T && data )
+  {
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+    return ResultValue<T>( result, std::move( data ) );
+#else
+    ignore( result );
+    return std::move( data );
 #endif
+  }
 )";
-            funcs += "#include \"vulkan_context.hpp\"\n";
-            funcs += "#include \"vulkan_array.hpp\"\n";
-            funcs += "#include \"vulkan_types.hpp\"\n";
-        }
-
-        if (!cfg.gen.onlyC) {
-            funcs += "#include \"vulkan_enums.hpp\"\n";
-            funcs += "#include \"vulkan_structs.hpp\"\n";
         }
 
-        // platforms += beginNamespace();
-        funcs  += beginNamespace();
-        funcs_impl += beginNamespace();
-
-        funcs += R"(
-  void resultCheck( Result result, char const * message );
-
-  void resultCheck( Result result, char const * message, std::initializer_list<Result> successCodes );
+    }
 
-  void resultCheck( VkResult result, char const * message );
+    void Generator::generateSuccessBits(OutputBuffer &output) {
+        // core success codes map to their own bit, extension codes get dense bits from 32
+        OutputBuffer caseCode;
+        int          bit = 32;
+        for (const auto &m : enums["VkResult"].members) {
+            if (m.isAlias || m.numericValue < 32) {
+                continue;
+            }
+            if (bit == 64) {
+                std::cerr << "generateSuccessBits() too many success codes: " << m.name.original << '\n';
+                break;
+            }
+            genOptional(caseCode, m, [&](auto &output) {
+                output += vkgen::format("        case {0}: return uint64_t( 1 ) << {1};\n", m.name.original, bit);
+            });
+            bit++;
+        }
 
-  void resultCheck( VkResult result, char const * message, std::initializer_list<VkResult> successCodes );
+        output += R"(
+  namespace detail
+  {
+    VULKAN_HPP_CONSTEXPR uint64_t successBit( VkResult result ) VULKAN_HPP_NOEXCEPT
+    {
+      switch ( result )
+      {
 )";
+        output += std::move(caseCode);
+        output += R"(        default: return ( result >= 0 && result < 32 ) ? ( uint64_t( 1 ) << result ) : 0;
+      }
+    }
+  }  // namespace detail
+)";
+    }
 
-        // funcs_impl += vkgen::format(RES_RESULT_CHECK, cfg.gen.branchHint ? "VULKAN_HPP_UNLIKELY" : "");
-        funcs_impl += vkgen::format(RES_RESULT_CHECK_CPP, cfg.gen.branchHint ? "VULKAN_HPP_UNLIKELY" : "");
+    void Generator::generateErrorClasses(OutputBuffer &output) {
+        OutputBuffer caseCode;
+        OutputBuffer throwCode;
 
-        if (cfg.gen.globalMode) {
-            funcs += vkgen::format(R"(
-  void loadLib();
+        output += vkgen::format(RES_ERROR_CAT, m_ns);
+        output += "#ifdef VULKAN_HPP_UNIFIED_EXCEPTION\n";
+        output += vkgen::format(RES_ERRORS_UNIFIED, m_ns);
+        output += "#else\n";
+        output += vkgen::format(RES_ERRORS,
+                                cfg.gen.globalMode? "VkResult" : "Result",
+                                cfg.gen.globalMode? "e" : "static_cast<int>( e )"
+        );
 
-  void initInstance(const {0}::InstanceCreateInfo& createInfo);
+        for (const auto &e : errorClasses) {
+            //        std::string name = e->name;
+            //        strStripPrefix(name, "eError");
+            //        name += "Error";
 
-  {0}::Result initInstance_noThrow(const {0}::InstanceCreateInfo& createInfo);
+            std::string value = cfg.gen.globalMode? e.value.name.original : "Result::" + e.value.name;
 
-  void initInstance(const {0}::InstanceCreateInfo& createInfo, bool& vulkan10enforced);
+            genOptional(output, e.value, [&](auto &output) {
 
-  void initDevice({0}::PhysicalDevice physicalDevice, const {0}::DeviceCreateInfo& createInfo);
+                output += vkgen::format(R"(
+  class {0} : public SystemError
+  {{
+  public:
+    {0}( std::string const & message ) : SystemError( make_error_code( {1} ), message ) {{}}
+    {0}( char const * message ) : SystemError( make_error_code( {1} ), message ) {{}}
+  }};
+)",
+                                        e.name,
+                                        value);
+            });
 
-  {0}::Result initDevice_noThrow({0}::PhysicalDevice physicalDevice, const {0}::DeviceCreateInfo& createInfo);
+            if (cfg.gen.coldErrorPaths) {
+                genOptional(throwCode, e.value, [&](auto &output) {
+                    output += vkgen::format("    [[noreturn]] VULKAN_HPP_COLD inline void throw{0}( char const * message ) {{ throw {0}( message ); }}\n", e.name);
+                });
+                genOptional(caseCode, e.value, [&](auto &output) { output += "        case " + value + ": throw" + e.name + "(message);\n"; });
+            } else {
+                genOptional(caseCode, e.value, [&](auto &output) { output += "        case " + value + ": throw " + e.name + "(message);\n"; });
+            }
+        }
 
-  bool isExtensionSupported(std::span<{0}::ExtensionProperties> extensionList, const char* extensionName) noexcept;
-)",
-                                   m_ns);
+        if (cfg.gen.coldErrorPaths) {
+            output += "  namespace detail {\n";
+            output += std::move(throwCode);
+            output += "  } // namespace detail\n";
+        }
 
+        output += "#endif // VULKAN_HPP_UNIFIED_EXCEPTION\n";
 
-            funcs_impl += vkgen::format(R"(
-  VULKAN_HPP_INLINE void loadLib() {{
-    if (!{0}::context.load()) {{
-      throw std::runtime_error(VULKAN_HPP_NAMESPACE_STRING "::loadLib");
-    }}
-  }}
+        output += "  namespace detail {\n";
+        output += vkgen::format(R"(
+    [[noreturn]] {1} void throwResultException({0} result, char const *message) {{
+)",
+                                cfg.gen.globalMode? "VkResult" : m_ns + "::Result",
+                                cfg.gen.coldErrorPaths? "VULKAN_HPP_COLD inline" : "VULKAN_HPP_INLINE");
+        if (cfg.gen.unifiedException) {
+            output += R"(
+#ifdef VULKAN_HPP_UNIFIED_EXCEPTION
+      throw Error( result, message );
+#else
+)";
+        }
+        output += "      switch (result) {\n";
+        output += std::move(caseCode);
+        output += "        default: throw SystemError( make_error_code( result ) );\n";
+        output += "      }\n";
+        if (cfg.gen.unifiedException) {
+            output += "#endif // VULKAN_HPP_UNIFIED_EXCEPTION\n";
+        }
+        output += "    }\n;";
+        output += "  } // namespace\n";
 
-  VULKAN_HPP_INLINE void initInstance(const {0}::InstanceCreateInfo& createInfo) {{
-    Result result = {0}::instance.init({0}::context, createInfo);
-    {0}::resultCheck(static_cast<VkResult>(result), VULKAN_HPP_NAMESPACE_STRING "::initInstance");
-  }}
+    }
 
-  VULKAN_HPP_INLINE {0}::Result initInstance_noThrow(const {0}::InstanceCreateInfo& createInfo) {{
-    return {0}::instance.init({0}::context, createInfo);
-  }}
+    std::string Generator::generateDispatchLoaderBase() {
+        std::string output;
+        output += R"(
+  class DispatchLoaderBase
+  {
+  public:
+    DispatchLoaderBase() = default;
+    DispatchLoaderBase( std::nullptr_t )
+#if !defined( NDEBUG )
+      : m_valid( false )
+#endif
+    {
+    }
 
-  VULKAN_HPP_INLINE void initInstance(const {0}::InstanceCreateInfo& createInfo, bool& vulkan10enforced) {{
-    Result result = {0}::initInstance_noThrow(createInfo);
+#if !defined( NDEBUG )
+    size_t getVkHeaderVersion() const
+    {
+      VULKAN_HPP_ASSERT( m_valid );
+      return vkHeaderVersion;
+    }
 
-    if(result == Result::eErrorIncompatibleDriver && createInfo.pApplicationInfo &&
-       createInfo.pApplicationInfo->apiVersion != vk::ApiVersion10)
-    {{
-      // replace requested Vulkan version by 1.0 to avoid eErrorIncompatibleDriver error
-      ApplicationInfo appInfo2(*createInfo.pApplicationInfo);
-      appInfo2.apiVersion = ApiVersion10;
-      InstanceCreateInfo createInfo2(createInfo);
-      createInfo2.pApplicationInfo = &appInfo2;
+  private:
+    size_t vkHeaderVersion = VK_HEADER_VERSION;
+    bool   m_valid         = true;
+#endif
+  };
 
-      // create instance (second attempt)
-      result = {0}::initInstance_noThrow(createInfo2);
-      vulkan10enforced = true;
-    }}
-    else {{
-      vulkan10enforced = false;
-    }}
+)";
+        return output;
+    }
 
-    {0}::resultCheck(static_cast<VkResult>(result), VULKAN_HPP_NAMESPACE_STRING "::initInstance");
-  }}
+    void Generator::generateDispatchLoaderStatic(OutputBuffer &output) {
+        output += "//#if !defined( VK_NO_PROTOTYPES )\n";
+        output += "  class DispatchLoaderStatic : public DispatchLoaderBase {\n";
+        output += "  public:\n";
 
-  VULKAN_HPP_INLINE void initDevice({0}::PhysicalDevice physicalDevice, const {0}::DeviceCreateInfo& createInfo) {{
-    Result result = {0}::device.init({0}::instance, physicalDevice, createInfo);
-    {0}::resultCheck(static_cast<VkResult>(result), VULKAN_HPP_NAMESPACE_STRING "::initDevice");
-  }}
+        Handle     empty{ *this };
+        for (auto &command : commands) {
+            genOptional(output, command, [&](auto &output) {
+                ClassCommand                       d{ this, &empty, command };
+                MemberContext                      ctx{ .ns = Namespace::VK, .disableDispatch = true, .disableAllocatorRemoval = true };
+                MemberResolverStaticDispatch const r{ *this, d, ctx };
+                // TODO
+                output += r.temporary();
+            });
+        }
 
-  VULKAN_HPP_INLINE {0}::Result initDevice_noThrow({0}::PhysicalDevice physicalDevice, const {0}::DeviceCreateInfo& createInfo) {{
-    return {0}::device.init({0}::instance, physicalDevice, createInfo);
-  }}
+        output += "  };\n";
+        output += "//#endif\n";
+    }
 
-  VULKAN_HPP_INLINE bool isExtensionSupported(const std::span<{0}::ExtensionProperties> extensionList, const char* extensionName) noexcept
-  {{
-    for(const ExtensionProperties &extension : extensionList)
-      if(strcmp(extension.extensionName, extensionName) == 0)
-        return true;
-    return false;
-  }}
-)",
-                                        m_ns);
+    void Generator::generateUnit(const std::string_view file, GenOutput &out, OutputBuffer &parent, OutputBuffer &&code) {
+        if (!cfg.gen.splitFiles) {
+            parent += beginNamespace();
+            parent += std::move(code);
+            parent += endNamespace();
+        }
+        else {
+            out.writeFile(*this, file, code);
+            parent += "#include \"";
+            parent += file;
+            parent += "\"\n";
         }
 
-        // funcs2 += beginNamespace();
-        appendFuncs(funcs, outputFuncs);
-        genFuncs(funcs, cfg.gen.onlyC);
-        // genFuncs(funcs2, false);
+    }
 
-        funcs += endNamespace();
-        funcs += R"(
-#ifndef VULKAN_USE_CPP
-#include "vulkan_funcs_impl.hpp"
-#endif // VULKAN_USE_CPP
-)";
+    void Generator::generateStructDecl(OutputBuffer &output, const Struct &d) const {
+        genOptional(output, d, [&](auto &output) {
+            output += (d.isStruct()? "  struct " : "  union ");
+            output += d.name + ";\n";
+            for (const auto &a : d.aliases) {
+                output += "  using " + a.name + " = " + d.name + ";\n";
+            }
+        });
+    }
 
-        // funcs2 += endNamespace();
-        // platforms += endNamespace();
-        funcs_impl += endNamespace();
+    void Generator::generateClassDecl(OutputBuffer &output, const Handle &data, const std::string &name) const {
+        genOptional(output, data, [&](auto &output) { output += "  class " + name + ";\n"; });
+    }
 
-//        if (impl) {
-//            *impl += endNamespace();
-//        }
+    void Generator::generateClassDecl(OutputBuffer &output, const Handle &data) const {
+        generateClassDecl(output, data, data.name);
+    }
 
+    /* deprecated
+    std::string Generator::generateClassString(const std::string &className, const OutputClass &from, Namespace ns) const {
+        std::string output = "  class " + className;
+        if (!from.inherits.empty()) {
+            output += " : " + from.inherits;
+        }
+        output += " {\n";
 
+        const auto addSection = [&](const std::string &visibility, const GuardedOutput &segment) {
+            std::stringstream tmp;
+            segment.write(tmp);
+            if (!tmp.str().empty()) {
+                if (!visibility.empty()) {
+                    output += "  " + visibility + ":\n";
+                }
+                output += tmp.str();
+            }
+        };
 
-        if (cfg.gen.globalMode) {
-            auto& impl = out.addFile("_to_string_impl");
-            impl += "#include <string>\n";
-            impl += std::move(outputToStringDef);
+        addSection("public", from.sPublic);
+        addSection("", from.sFuncs);
+        addSection("private", from.sPrivate);
+        addSection("protected", from.sProtected);
+        output += "  };\n";
+        return output;
+    }
+     */
 
-            to_string += std::move(outputToStringDecl);
-        }
-        else {
-            to_string += std::move(outputToStringDef);
+    std::string Generator::generateForwardInclude(GenOutput &out) const {
+        std::string output;
+        if (!cfg.gen.globalMode) {
+            output += "#include \"" + out.getFilename("_forward") + "\"\n";
+            output += "#include \"vulkan_structs_forward.hpp\"\n";
         }
+        output += "#include \"vulkan_handles_forward.hpp\"\n";
 
-        if (cfg.gen.cppModules) {
-            generateModules(out, path);
+        if (cfg.gen.raii.interop) {
+            output += "#include \"" + out.getFilename("_raii_forward") + "\"\n";
         }
 
-        out.writeFiles(*this);
+        return output;
     }
 
-    void Generator::generateEnumStr(const Enum &data, OutputBuffer &output) {
-        const auto & name = data.isBitmask()? data.bitmask : data.name;
-
-        GuardedOutput members;
-        GuardedOutput to_string;
-        std::unordered_set<std::string> generated;
-        std::unordered_set<std::string> generatedCase;
+    void Generator::generateGlobalFuncs(vkgen::GuardedOutputFuncs &output, bool useC) {
+        if (cfg.gen.globalMode) {
 
-        for (const auto &m : data.members) {
-            if (generated.find(m.name) != generated.end()) {
-                continue;
-            }
-            generated.insert(m.name);
-            if (cfg.gen.enumMock == 1 && data.isBitmask()) {
-                members.add(m, [&](auto &output) {
-                    output += "    static constexpr const ";
-                    output += data.is64bit()? "VkFlags64 " : "VkFlags ";
-                    output += m.name;
-                    output += " = ";
-                    output += m.value;
-                    output += ";\n";
-                });
-            }
-            else {
-                members.add(m, [&](auto &output) {
-                    output += "    " + m.name + " = " + m.value;
-                    if (cfg.dbg.methodTags) {
-                        output += ", // " + m.name.original + "\n";
-                    } else {
-                        output += ",\n";
-                    }
-                });
+            const Handle   empty{ *this };
+            GuardedOutput decl;
+            for (const Command &s : staticCommands) {
+                output.def += "  // static cmd: " + s.name.original + "\n";
             }
 
-            if (!m.isAlias) {
-                if (generatedCase.find(m.value) != generatedCase.end()) {
+            for (Command &c : commands.ordered) {
+
+                // std::cout << c.successCodes.size() << "\n";
+
+                bool m = false;
+                for (const Command &s : staticCommands) {
+                    if (c.name.original == s.name.original) {
+                        m = true;
+                        break;
+                    }
+                }
+                if (m) {
+                    // continue;
+                }
+                if (c.name == "createInstance") {
+                    continue;
+                }
+                if (c.name == "createDevice") {
+                    continue;
+                }
+                if (c.name == "enumerateInstanceVersion") {
                     continue;
                 }
-                generatedCase.insert(m.value);
-                to_string.add(m, [&](auto &output) {
-                    std::string value = m.name;
-                    strStripPrefix(value, "e");
-                    output += "      case " + name;
-                    output += "::" + m.name;
-                    output += ": return \"" + value + "\";\n";
-                });
-            }
-        }
 
-        if (cfg.gen.enumMock == 1 && data.isBitmask()) {
-            output += "  namespace " + name + " {\n";
-            output += members.toString();
-            output += "  }\n";
-        }
-        else {
-            output += "  enum class " + name;
-            if (data.isBitmask()) {
-                output += " : " + data.name.original;
-            }
-            output += " {\n";
-            output += members.toString();
-            if (cfg.gen.enumMock == 2 && data.isBitmask()) {
-                output += "    allFlags = ";
-                output += std::move(generateAllFlagsValue(data));;
-                output += ",\n";
+
+//                if (!useC) {
+//                    if (c.params.empty()) {
+//                        continue;
+//                    }
+//                }
+
+
+                // outputFuncs.def += "  // cmd: " + c.name.original + "  " + std::to_string(c.successCodes.size()) + "\n";
+
+                ClassCommand d{ this, &empty, c };
+
+                MemberGenerator g{ *this, d, output.def, output, true };
+                g.ctx.globalModeStatic = true;
+                g.ctx.globalUseCAPI = useC;
+                g.generate();
+
             }
-            output += "\n  };\n";
         }
+    }
 
-        for (const auto &a : data.aliases) {
-            const auto &name =
-              (a.name.find("FlagBits") != std::string::npos)? data.bitmask.original : data.name.original;
-            output += "  using " + a.name + " = " + name + ";\n";
+    void Generator::generateHandles(OutputBuffer &output, OutputBuffer &output_smart, GenOutput &out) {
+        if (verbose) {
+            std::cout << "gen handles " << '\n';
         }
 
-        std::string str;
-        if (data.isBitmask()) {
-            genFlagTraits(data, name, output, str);
-        }
-        /*
-        FunctionGenerator fun(*this, "std::string", "to_string");
-        fun.indent = "  ";
-        fun.base = &data;
-        fun.optionalProtect = Protect{"VULKAN_HPP_NO_TO_STRING", false};
-        fun.allowInline = true;
-        fun.specifierInline = true;
-        fun.add(data.name, "value");
-        */
 
-        if (data.isBitmask()) {
-            // fun.code = str;
+        output += "#include <cstddef>\n";
+        output += "#include \"vulkan_hpp_macros.hpp\"\n";
+        if (cfg.gen.globalMode) {
+            output += "#include \"vulkan_context.hpp\"\n";
         }
-        else {
-            str = to_string.toString();
-            if (str.empty()) {
-                str = "    return \"\\\"(void)\\\"\";\n";
-            } else {
-                str += "      default: return \"invalid ( \" + " + m_ns + "::toHexString(static_cast<uint32_t>(value))  + \" )\";";
 
-                str = vkgen::format(R"(
-    switch (value) {{
-{0}
-    }}
-)", str);
-            }
-        }
 
-        std::string proto = "std::string to_string(";
-        proto += data.name;
-        proto += " value)";
+        // if (!cfg.gen.cppModules) {
+        output += generateForwardInclude(out);
+        // }
 
-        // to_string_output += fun.generate(outputFuncs);
+        // if (!cfg.gen.cppModules) {
+        output += beginNamespace();
+        // }
         if (cfg.gen.globalMode) {
-            outputToStringDecl.add(data, [&](auto &output){
-                output += "  ";
-                output += proto;
-                output += ";\n\n";
-            });
+            output += "  struct InstanceCreateInfo;\n";
+            output += "  struct DeviceCreateInfo;\n";
+            output += "  struct AllocationCallbacks;\n";
         }
 
-        outputToStringDef.add(data, [&](auto &output){
-            output += "  ";
-            output += cfg.macro.mInline.define;
-            output += " ";
-            output += proto;
-            output += " {\n";
-            output += str;
-            output += "  }\n";
-        });
-    }
 
-    void Generator::generateEnum(const Enum &data, OutputBuffer &output, OutputBuffer &output_forward) {
-        auto p = data.getProtect();
-//        if (!p.empty()) {
-//            outputFuncs.platform.add(data, [&](auto &output) { generateEnumStr(data, output); });
-//        } else {
-            genOptional(output, data, [&](auto &output) {
-                generateEnumStr(data, output);
-            });
-        // }
 
-        genOptional(output_forward, data, [&](auto &output) {
-            output += "  enum class " + data.name;
-            if (data.isBitmask()) {
-                output += " : " + data.name.original;
-            }
-            output += ";\n";
-        });
-    }
+        output += "#ifndef VULKAN_HPP_NO_STRUCT_CHAIN\n";
+        output += R"(
+  template <typename... ChainElements>
+  class StructureChain;
+)";
+        output += "#endif // VULKAN_HPP_NO_STRUCT_CHAIN\n";
 
-    std::string Generator::generateToStringInclude() const {
-        std::string output;
-        output += "#include \"vulkan_enums.hpp\"\n";
-        /*
-        if (cfg.gen.importStdMacro) {
+        gen(output, cfg.gen.handleTemplates, [&](auto &output) {
             output += R"(
-#ifndef USE_IMPORT_STD
+  template <typename Type>
+  struct isVulkanHandleType
+  {
+    static VULKAN_HPP_CONST_OR_CONSTEXPR bool value = false;
+  };
 )";
-        }
+        });
+
+        if (cfg.gen.internalFunctions) {
+            std::string spec;
+            if (!cfg.gen.cppModules) {
+                spec = "static";
+            }
 
-        if (cfg.gen.importStdMacro) {
             output += R"(
-#endif
-)";
+  namespace internal {
+
+    template<typename T, typename V, typename S, typename PFN, typename... Args>
+    inline std::vector<T> createArrayVoidPFN(const PFN pfn, const char *const msg, Args&&... args) {
+        std::vector<T> data;
+        S count;
+        pfn(std::forward<Args>(args)..., &count, nullptr);
+
+        data.resize( count );
+
+        pfn(std::forward<Args>(args)..., &count, std::bit_cast<V*>(data.data()));
+
+        if (count < data.size()) {
+            data.resize( count );
         }
-        */
-        return output;
+
+        return data;
     }
 
-    void Generator::generateEnums(OutputBuffer &output, OutputBuffer &output_forward) {
-        if (verbose) {
-            std::cout << "gen enums " << '\n';
+    template<typename T, typename V, typename S, typename PFN, typename... Args>
+    inline typename ResultValueType<std::vector<T>>::type createArray(const PFN pfn, const char *const msg, Args&&... args) {
+        std::vector<T> data;
+        S count;
+        VkResult result;
+
+        do {
+          result = pfn(std::forward<Args>(args)..., &count, nullptr);
+          if (result == VK_SUCCESS && count) {
+            data.resize( count );
+            result = pfn(std::forward<Args>(args)..., &count, std::bit_cast<V*>(data.data()));
+          }
+        } while (result == VK_INCOMPLETE);
+
+        resultCheck(static_cast<Result>(result), msg);
+        if (count < data.size()) {
+            data.resize( count );
         }
 
-        // outputToStringDecl += generateToStringInclude();
+        return createResultValueType(static_cast<Result>(result), data);
+    }
 
-        outputToStringDecl += "#include <string>\n";
-        outputToStringDecl += beginNamespace();
-        outputToStringDef += beginNamespace();
+  }  // namespace internal
 
-        output += "#include <type_traits>\n";
-        output += "#include \"vulkan_hpp_macros.hpp\"\n";
-        output += "\n";
+)";
+        }
 
-        output += beginNamespace();
-        output_forward += beginNamespace();
+        if (cfg.gen.smartHandles->enabled()) {
+            generateUniqueHandles(output_smart);
 
-        generateFlags(output);
+            output += "#ifndef  VULKAN_HPP_NO_SMART_HANDLE\n";
+            output += "#include \"" + out.getFilename("_smart") + "\"\n";
+            output += "#endif // VULKAN_HPP_NO_SMART_HANDLE\n";
+        }
 
-        if (!cfg.gen.globalMode) {
-            gen(output, cfg.gen.handleTemplates, [&](auto &output) {
-                output += R"(
-  template <typename EnumType, EnumType value>
-  struct CppType
-  {};
-)";
-            });
+        if (!cfg.gen.expApi && !cfg.gen.globalMode) {
+            // static commands
+            const Handle   empty{ *this };
+            GuardedOutput decl;
+            for (auto &c : staticCommands) {
+                ClassCommand d{ this, &empty, c };
+                MemberGenerator g{ *this, d, decl, outputFuncs, true };
+                g.generate();
+            }
+            std::stringstream str;
+            decl.write(str);
+            output += std::move(str.str());
         }
 
-        std::unordered_set<std::string> generated;
-        for (const auto &e : enums) {
-            if (generated.contains(e.name)) {
+        for (Handle &h : handles.ordered) {
+            if (cfg.gen.onlyC && h.isSubclass) {
                 continue;
             }
-            generateEnum(e, output, output_forward);
-            generated.insert(e.name);
+            // std::cout << "gen class " << e.name << '\n';
+            // if (!cfg.gen.globalMode && cfg.gen.expApi && !h.isSubclass) {
+            if ((cfg.gen.globalMode || cfg.gen.expApi) && !h.isSubclass) {
+                generateClassWithPFN(output, h);
+            } else {
+                genPlatform(output, h, [&](auto &output) { generateClass(output, h, false); });
+            }
         }
 
-        outputToStringDecl += endNamespace();
-        outputToStringDef += endNamespace();
+        const bool compactUnique = cfg.gen.uniqueCompact && (cfg.gen.globalMode || !cfg.gen.expApi);
+        if (cfg.gen.smartHandles->enabled() && compactUnique) {
+            output += "#ifndef  VULKAN_HPP_NO_SMART_HANDLE\n";
+            for (const Handle &e : handles.ordered) {
+                if (!e.uniqueVariant() || (cfg.gen.globalMode && !e.isSubclass)) {
+                    continue;
+                }
+                genOptional(output, e, [&](auto &output) {
+                    // handle + owner + pool, default dispatcher takes no space, global mode stores no owner
+                    std::string size = "sizeof( Vk" + e.name + " )";
+                    if (e.isSubclass && !cfg.gen.globalMode) {
+                        size += " + sizeof( Vk" + e.superclass + " )";
+                    }
+                    if (e.name == "CommandBuffer") {
+                        size += " + sizeof( VkCommandPool )";
+                    } else if (e.name == "DescriptorSet") {
+                        size += " + sizeof( VkDescriptorPool )";
+                    } else if (cfg.gen.allocatorParam) {
+                        size += " + sizeof( void * )";
+                    }
+                    output += vkgen::format(R"(#if ( VK_USE_64_BIT_PTR_DEFINES == 1 )
+  static_assert( sizeof( Unique{0} ) == {1}, "Unique{0} is not compact" );
+#endif
+)",
+                                            e.name,
+                                            size);
+                });
+            }
+            output += "#endif // VULKAN_HPP_NO_SMART_HANDLE\n";
+        }
+
+        // if (!cfg.gen.cppModules) {
         output += endNamespace();
-        output_forward += endNamespace();
+        // }
 
         if (verbose) {
-            std::cout << "gen enums done" << '\n';
+            std::cout << "gen handles done" << '\n';
         }
     }
 
-    std::string Generator::generateAllFlagsValue(const Enum &data) {
+    static std::string getDeleter(const Handle &h, const std::string_view parent, const std::string &dispatch) {
+        if (h.name == "CommandBuffer") {
+            return "PoolFree<" + std::string(parent) + ", CommandPool" + dispatch + ">";
+        }
+        if (h.name == "DescriptorSet") {
+            return "PoolFree<" + std::string(parent) + ", DescriptorPool" + dispatch + ">";
+        }
         std::string output;
+        switch (h.creationCat) {
+            case Handle::CreationCategory::ALLOCATE:
+                output += "ObjectFree<";
+                break;
+            case vkr::Handle::CreationCategory::CREATE:
+                output +=  "ObjectDestroy<";
+                break;
+            default:
+                break;
+        }
+        output += parent;
+        output += dispatch;
+        output += ">";
+        return output;
+    }
 
-        // std::map<std::string, std::string> temp;
-        std::map<std::string, uint64_t> values;
+    void Generator::generateUniqueHandles(OutputBuffer &output) {
 
-        for (const auto & m : data.members) {
-            if (m.isAlias) {
-                continue;
-            }
+        // output += "#ifndef  VULKAN_HPP_NO_SMART_HANDLE\n";
+        for (Handle const &e : handles.ordered) {
+            if (e.uniqueVariant()) {
+                if (cfg.gen.globalMode && !e.isSubclass) {
+                    continue;
+                }
+                genOptional(output, e, [&](auto &output) {
+                    std::string templ;
+                    std::string templType;
+                    if (!cfg.gen.expApi) {
+                        output += "  template <typename Dispatch>";
+                        templ     = ", Dispatch";
+                        templType = ", VULKAN_HPP_DEFAULT_DISPATCHER_TYPE";
+                    } else {
+                        output += "  template <>";
+                    }
 
-            const auto &p = m.getProtect();
-//            std::string &dst = temp[std::string(p)];
-//            if (!dst.empty()) {
-//                dst += "\n        | ";
-//            }
-//            dst += inherit + "::" + m.name + " // " + std::string(m.value) + ", " + std::to_string(m.numericValue);
+                    std::string_view parent = e.isSubclass ? std::string_view(e.superclass) : "NoParent";
+                    output += vkgen::format(R"(
+  class UniqueHandleTraits<{0}{1}>
+  {{
+  public:
+    using deleter = {3};
+  }};
 
-            values[std::string(p)] |= m.numericValue;
-        }
+  using Unique{0} = UniqueHandle<{0}{2}>;
 
-        if (values.empty()) {
-            output += cfg.gen.enumMock < 2? "{}" : "0";
-        } else {
-            std::string name = std::regex_replace(data.name, std::regex("FlagBits"), "Flags");
-            if (cfg.gen.enumMock < 2) {
-                output += "static_cast<";
-                output += name;
-                output += ">(\n          ";
+)",
+                                            e.name,
+                                            templ,
+                                            templType,
+                                            getDeleter(e, parent, templ));
+                });
             }
-            bool first = true;
-            bool hasProtect = false;
-            for (const auto &v : values) {
-                const auto &p = v.first;
-                hasProtect = !p.empty();
-                if (hasProtect) {
-                    if (cfg.gen.enumMock >= 2 && first) {
-                        output += "\n";
-                    }
-                    output += "#if defined(" + p + ")";
-                    if (first) {
-                        output += "\n";
-                    }
-                }
-                if (first) {
-                    first = false;
+        }
+        // output += "#endif // VULKAN_HPP_NO_SMART_HANDLE\n";
+    }
+
+    std::string Generator::generateStructsInclude() const {
+        std::string out =  "#include <cstring>  // strcmp\n";
+        return out;
+    }
+
+    void Generator::generateStructs(OutputBuffer &output, bool exp) {
+        output += "#include \"vulkan_hpp_macros.hpp\"\n";
+        if (cfg.gen.globalMode && cfg.gen.structMock < 5) {
+            output += "#include \"vulkan_enums.hpp\"\n";
+        }
+        output += "#include \"vulkan_structs_forward.hpp\"\n";
+        if (!cfg.gen.globalMode) {
+            output += R"(
+#ifndef VULKAN_HPP_NO_STRUCT_COMPARE
+#if defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
+#  include <compare>
+#endif
+#endif
+)";
+            if (!exp) {
+                output += "\n";
+                if (cfg.gen.importStdMacro) {
+                    output += R"(
+#include <string.h> // TODO
+#ifndef USE_IMPORT_STD
+#  ifndef VULKAN_HPP_NO_STRUCT_COMPARE
+#    include <cstring>  // strcmp
+#  endif // VULKAN_HPP_NO_STRUCT_COMPARE
+#endif
+)";
                 } else {
-                    output += "\n        | ";
+                    gen(output, cfg.gen.structCompare, [&](auto &output) { output += generateStructsInclude(); });
                 }
-                output += EnumValue::toHex(v.second, data.is64bit());
                 output += "\n";
-                if (hasProtect) {
-                    output += "#endif // " + p + "\n";
-                }
             }
-            if (cfg.gen.enumMock < 2) {
-                output += "    )";
+        }
+        if (useUninitializedStructs() && !cfg.gen.globalMode) {
+            output += R"(
+// every constructor initializes all members, defaults are needed only for aggregate initialization
+#if defined( VULKAN_HPP_NO_STRUCT_CONSTRUCTORS )
+#  define VULKAN_HPP_STRUCT_MEMBER_INITIALIZER = {}
+#else
+#  define VULKAN_HPP_STRUCT_MEMBER_INITIALIZER
+#endif
+)";
+        }
+        output += beginNamespace();
+        for (const Struct &e : structs.ordered) {
+            genPlatform(output, e, [&](auto &output) { generateStruct(output, e, exp); });
+        }
+
+//        if (cfg.gen.globalMode) {
+//            output += "#ifndef VULKAN_HPP_NO_STRUCT_CHAIN\n";
+//            generateStructChains(output);
+//            output += "#endif // VULKAN_HPP_NO_STRUCT_CHAIN\n";
+//        }
+
+        output += endNamespace();
+    }
+
+    void Generator::generateArrays(GenOutput &files, OutputBuffer &parent) {
+        OutputBuffer output;
+        if (cfg.gen.globalMode) {
+            output += "#include \"vulkan.h\"\n";
+            output += "#include \"vulkan_hpp_macros.hpp\"\n";
+        }
+        output += beginNamespace();
+        if (useUninitializedStructs()) {
+            output += RES_UNINITIALIZED;
+            if (cfg.gen.globalMode) {
+                output += RES_DEFAULT_INITIALIZED;
             }
-            else if (!hasProtect) {
-                strStripSuffix(output, "\n");
+        }
+        output += RES_ARRAY_PROXY;
+        // PROXY TEMPORARIES
+        if (!cfg.gen.globalMode) {
+            output += RES_ARRAY_WRAPPER_1;
+            if (useUninitializedStructs()) {
+                output += RES_ARRAY_WRAPPER_UNINITIALIZED;
             }
+            output += RES_ARRAY_WRAPPER_2;
         }
+        output += endNamespace();
+        generateUnit("vulkan_array.hpp", files, parent, std::move(output));
+    }
 
-        return output;
+    void Generator::generateVector(GenOutput &files, OutputBuffer &parent) {
+        if (!cfg.gen.functionsVecAndArray) {
+            return;
+        }
+        OutputBuffer output;
+        output += R"(
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if __has_include( <memory_resource> )
+#  include <memory_resource>
+#endif
+)";
+        if (cfg.gen.globalMode) {
+            output += "#include \"vulkan_hpp_macros.hpp\"\n";
+        }
+        output += beginNamespace();
+        output += RES_VECTOR_1;
+        if (useUninitializedStructs()) {
+            output += RES_VECTOR_UNINITIALIZED;
+        }
+        output += RES_VECTOR_2;
+        if (useUninitializedStructs()) {
+            output += RES_VECTOR_UNINITIALIZED;
+        }
+        output += RES_VECTOR_3;
+        output += endNamespace();
+        generateUnit("vulkan_vector.hpp", files, parent, std::move(output));
     }
 
-    void Generator::genFlagTraits(const Enum &data, std::string inherit, OutputBuffer &output, std::string &to_string_code) {
-        std::string name = std::regex_replace(data.name, std::regex("FlagBits"), "Flags");
+    void Generator::generateStructChain(GenOutput &files, OutputBuffer &parent) {
+        OutputBuffer output;
 
-        OutputBuffer str;
+        bool cstyle = false; // cfg.gen.globalMode
 
-        std::map<std::string, std::string> temp;
-        std::map<std::string, uint64_t> values;
+        if (cfg.gen.structChainVisitor) {
+            output += "#include <cstddef> // std::max_align_t\n";
+        }
+        output += beginNamespaceStandalone();
+        if (cstyle) {
+            output += R"(
+  template <typename Type>
+  struct structureType
+  {
+    static VULKAN_HPP_CONST_OR_CONSTEXPR VkStructureType value = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+  };
+)";
+        }
 
-        for (size_t i = 0; i < data.members.size(); ++i) {
-            const auto &m = data.members[i];
-            if (m.isAlias) {
-                continue;
-            }
-//            genOptional(flags, m, [&](auto &output) {
-//                if (output.size() != 0) {
-//                    output += "\n        | ";
-//                }
-//                output += inherit + "::" + m.name;
-//            });
+        output += R"(
 
-            const auto &p = m.getProtect();
-            std::string &dst = temp[std::string(p)];
-            if (!dst.empty()) {
-                dst += "\n        | ";
-            }
-            dst += inherit + "::" + m.name + " // " + std::string(m.value) + ", " + std::to_string(m.numericValue);
+template <typename X, typename Y>
+  struct StructExtends
+  {
+    enum
+    {
+      value = false
+    };
+  };
 
-            values[std::string(p)] |= m.numericValue;
+  template <typename Type, class...>
+  struct IsPartOfStructureChain
+  {
+    static const bool valid = false;
+  };
 
-            genOptional(str, m, [&](auto &output) {
-                std::string value = m.name;
-                strStripPrefix(value, "e");
-                output += vkgen::format(R"(
-    if (value & {0}::{1})
-      result += "{2} | ";
-)",
-                                        inherit,
-                                        m.name,
-                                        value);
-            });
-        }
+  template <typename Type, typename Head, typename... Tail>
+  struct IsPartOfStructureChain<Type, Head, Tail...>
+  {
+    static const bool valid = std::is_same<Type, Head>::value || IsPartOfStructureChain<Type, Tail...>::valid;
+  };
 
-        if (cfg.gen.enumMock == 1) {
-            output += vkgen::format(R"(  using {0} = {1};
+  template <size_t Index, typename T, typename... ChainElements>
+  struct StructureChainContains
+  {
+    static const bool value = std::is_same<T, typename std::tuple_element<Index, std::tuple<ChainElements...>>::type>::value ||
+                              StructureChainContains<Index - 1, T, ChainElements...>::value;
+  };
 
-)",
-                                    name,
-                                    data.is64bit()? "VkFlags64" : "VkFlags");
-        }
-        else {
-            output += vkgen::format(R"(  using {0} = Flags<{1}>;
+  template <typename T, typename... ChainElements>
+  struct StructureChainContains<0, T, ChainElements...>
+  {
+    static const bool value = std::is_same<T, typename std::tuple_element<0, std::tuple<ChainElements...>>::type>::value;
+  };
 
-)",
-                                    name,
-                                    inherit);
-            if (cfg.gen.enumMock == 0) {
-                output += expIfndef("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
-                output += vkgen::format(R"(
-  template <>
-  struct FlagTraits<{0}> {{
-)",
-                                        inherit);
-                if (data.isBitmask()) {
-                    output += "    static VULKAN_HPP_CONST_OR_CONSTEXPR bool             isBitmask = true;\n";
-                }
-                output += "    static VULKAN_HPP_CONST_OR_CONSTEXPR " + name + " allFlags = ";
-                output += std::move(generateAllFlagsValue(data));
-                output += ";\n  };\n";
-                output += expEndif("VULKAN_HPP_EXPERIMENTAL_NO_FLAG_TRAITS");
-            }
-        }
+  template <size_t Index, typename... ChainElements>
+  struct StructureChainValidation
+  {
+    using TestType          = typename std::tuple_element<Index, std::tuple<ChainElements...>>::type;
+    static const bool valid = StructExtends<TestType, typename std::tuple_element<0, std::tuple<ChainElements...>>::type>::value &&
+                              ( /*TestType::allowDuplicate ||*/ !StructureChainContains<Index - 1, TestType, ChainElements...>::value ) &&
+                              StructureChainValidation<Index - 1, ChainElements...>::valid;
+  };
 
-        if (str.size() == 0) {
-            to_string_code = "    return \"{}\";\n";
-        } else {
-            std::stringstream temp;
-            temp << str;  // TODO
+  template <typename... ChainElements>
+  struct StructureChainValidation<0, ChainElements...>
+  {
+    static const bool valid = true;
+  };
 
-            to_string_code = vkgen::format(R"(
-    if ( !value )
-      return "{{}}";
-    std::string result;
-{0}
-    return "{{ " + result.substr( 0, result.size() - 3 ) + " }}";
-)", temp.str());
+  template <typename... ChainElements>
+  class StructureChain : public std::tuple<ChainElements...>
+  {
+  public:
+    StructureChain() VULKAN_HPP_NOEXCEPT
+    {
+      static_assert( StructureChainValidation<sizeof...( ChainElements ) - 1, ChainElements...>::valid, "The structure chain is not valid!" );
+)";
+        if (cstyle) {
+            output += R"(      init<sizeof...( ChainElements ) - 1>();
+)";
         }
-    }
 
-    void Generator::generateDispatch(OutputBuffer &output) {
-        output += generateDispatchLoaderBase();
-        output += "#if !defined( VK_NO_PROTOTYPES )\n";
-        generateDispatchLoaderStatic(output);
-        output += "#endif // VK_NO_PROTOTYPES\n";
         output += R"(
-  class DispatchLoaderDynamic;
-#if !defined( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC )
-#  if defined( VK_NO_PROTOTYPES )
-#    define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
-#  else
-#    define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 0
-#  endif
-#endif
-
-#if !defined( VULKAN_HPP_STORAGE_API )
-#  if defined( VULKAN_HPP_STORAGE_SHARED )
-#    if defined( _MSC_VER )
-#      if defined( VULKAN_HPP_STORAGE_SHARED_EXPORT )
-#        define VULKAN_HPP_STORAGE_API __declspec( dllexport )
-#      else
-#        define VULKAN_HPP_STORAGE_API __declspec( dllimport )
-#      endif
-#    elif defined( __clang__ ) || defined( __GNUC__ )
-#      if defined( VULKAN_HPP_STORAGE_SHARED_EXPORT )
-#        define VULKAN_HPP_STORAGE_API __attribute__( ( visibility( "default" ) ) )
-#      else
-#        define VULKAN_HPP_STORAGE_API
-#      endif
-#    else
-#      define VULKAN_HPP_STORAGE_API
-#      pragma warning Unknown import / export semantics
-#    endif
-#  else
-#    define VULKAN_HPP_STORAGE_API
-#  endif
-#endif
+      link<sizeof...( ChainElements ) - 1>();
+    }
 )";
-
-        output += vkgen::format(R"(
-#if !defined( VULKAN_HPP_DEFAULT_DISPATCHER )
-#  if VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1
-#    define VULKAN_HPP_DEFAULT_DISPATCHER ::{0}::defaultDispatchLoaderDynamic
-#    define VULKAN_HPP_DEFAULT_DISPATCH_LOADER_DYNAMIC_STORAGE                     \
-      namespace {0}                                                        \
-      {{                                                                            \
-        VULKAN_HPP_STORAGE_API DispatchLoaderDynamic defaultDispatchLoaderDynamic; \
-      }}
-  extern VULKAN_HPP_STORAGE_API DispatchLoaderDynamic defaultDispatchLoaderDynamic;
-#  else
-  static inline ::{0}::DispatchLoaderStatic & getDispatchLoaderStatic()
-  {{
-    static ::{0}::DispatchLoaderStatic dls;
-    return dls;
-  }}
-#    define VULKAN_HPP_DEFAULT_DISPATCHER ::{0}::getDispatchLoaderStatic()
-#    define VULKAN_HPP_DEFAULT_DISPATCH_LOADER_DYNAMIC_STORAGE
-#  endif
-#endif
-
-#if !defined( VULKAN_HPP_DEFAULT_DISPATCHER_TYPE )
-#  if VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1
-#    define VULKAN_HPP_DEFAULT_DISPATCHER_TYPE ::{0}::DispatchLoaderDynamic
-#  else
-#    define VULKAN_HPP_DEFAULT_DISPATCHER_TYPE ::{0}::DispatchLoaderStatic
-#  endif
-#endif
-)",
-                                m_ns);
+        if (useUninitializedStructs()) {
+            // aggregates of global mode take no tag, they are default initialized in place through DefaultInitialized
+            const std::string elements = cfg.gen.globalMode ? "detail::DefaultInitialized<ChainElements>{}"
+                                                            : "typename std::conditional<true, uninitialized_t, ChainElements>::type{}";
+            output += R"(
+    // only sType and pNext of elements are set
+    explicit StructureChain( uninitialized_t ) VULKAN_HPP_NOEXCEPT
+      : std::tuple<ChainElements...>( )" + elements + R"(... )
+    {
+      static_assert( StructureChainValidation<sizeof...( ChainElements ) - 1, ChainElements...>::valid, "The structure chain is not valid!" );
+      link<sizeof...( ChainElements ) - 1>();
+    }
+)";
+        }
+        output += R"(
+    StructureChain( StructureChain const & rhs ) VULKAN_HPP_NOEXCEPT : std::tuple<ChainElements...>( rhs )
+    {
+      static_assert( StructureChainValidation<sizeof...( ChainElements ) - 1, ChainElements...>::valid, "The structure chain is not valid!" );
+      link( &std::get<0>( *this ),
+            &std::get<0>( rhs ),
+            reinterpret_cast<VkBaseOutStructure *>( &std::get<0>( *this ) ),
+            reinterpret_cast<VkBaseInStructure const *>( &std::get<0>( rhs ) ) );
     }
 
-    void Generator::generateApiConstants(OutputBuffer &output) {
-
-        output += R"(
-    //===========================
-    //=== CONSTEXPR CONSTANTs ===
-    //===========================
-)";
-
-        for (const auto &a : apiConstants) {
-            genOptional(output,
-              a, [&](auto &output) { output += "    VULKAN_HPP_CONSTEXPR_INLINE " + a.type + " " + a.name + " = " + a.name.original + ";\n"; });
-        }
+    StructureChain( StructureChain && rhs ) VULKAN_HPP_NOEXCEPT : std::tuple<ChainElements...>( std::forward<std::tuple<ChainElements...>>( rhs ) )
+    {
+      static_assert( StructureChainValidation<sizeof...( ChainElements ) - 1, ChainElements...>::valid, "The structure chain is not valid!" );
+      link( &std::get<0>( *this ),
+            &std::get<0>( rhs ),
+            reinterpret_cast<VkBaseOutStructure *>( &std::get<0>( *this ) ),
+            reinterpret_cast<VkBaseInStructure const *>( &std::get<0>( rhs ) ) );
+    }
 
-        output += R"(
-    //========================
-    //=== CONSTEXPR VALUEs ===
-    //========================
-    VULKAN_HPP_CONSTEXPR_INLINE uint32_t HeaderVersion = VK_HEADER_VERSION;
-)";
+    StructureChain( ChainElements const &... elems ) VULKAN_HPP_NOEXCEPT : std::tuple<ChainElements...>( elems... )
+    {
+      static_assert( StructureChainValidation<sizeof...( ChainElements ) - 1, ChainElements...>::valid, "The structure chain is not valid!" );
+      link<sizeof...( ChainElements ) - 1>();
+    }
 
+    StructureChain & operator=( StructureChain const & rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      std::tuple<ChainElements...>::operator=( rhs );
+      link( &std::get<0>( *this ),
+            &std::get<0>( rhs ),
+            reinterpret_cast<VkBaseOutStructure *>( &std::get<0>( *this ) ),
+            reinterpret_cast<VkBaseInStructure const *>( &std::get<0>( rhs ) ) );
+      return *this;
     }
 
-    void Generator::generateResultValue(OutputBuffer &output) {
+    // StructureChain & operator=( StructureChain && rhs ) = delete;
 
-        output += R"(
-  template <typename T>
-  void ignore( T const & ) VULKAN_HPP_NOEXCEPT
-  {
-  }
+    template <typename T = typename std::tuple_element<0, std::tuple<ChainElements...>>::type, size_t Which = 0>
+    T & get() VULKAN_HPP_NOEXCEPT
+    {
+      return std::get<ChainElementIndex<0, T, Which, void, ChainElements...>::value>( static_cast<std::tuple<ChainElements...> &>( *this ) );
+    }
 
-  template <typename T>
-  struct ResultValue
-  {
-)";
+    template <typename T = typename std::tuple_element<0, std::tuple<ChainElements...>>::type, size_t Which = 0>
+    T const & get() const VULKAN_HPP_NOEXCEPT
+    {
+      return std::get<ChainElementIndex<0, T, Which, void, ChainElements...>::value>( static_cast<std::tuple<ChainElements...> const &>( *this ) );
+    }
 
-        if (!cfg.gen.globalMode) {
-            output += R"(
-#ifdef VULKAN_HPP_HAS_NOEXCEPT
-    ResultValue( Result r, T & v ) VULKAN_HPP_NOEXCEPT( VULKAN_HPP_NOEXCEPT( T( v ) ) )
-#else
-    ResultValue( Result r, T & v )
-#endif
-      : result( r ), value( v )
+    template <typename T0, typename T1, typename... Ts>
+    std::tuple<T0 &, T1 &, Ts &...> get() VULKAN_HPP_NOEXCEPT
     {
+      return std::tie( get<T0>(), get<T1>(), get<Ts>()... );
     }
 
-#ifdef VULKAN_HPP_HAS_NOEXCEPT
-    ResultValue( Result r, T && v ) VULKAN_HPP_NOEXCEPT( VULKAN_HPP_NOEXCEPT( T( std::move( v ) ) ) )
-#else
-    ResultValue( Result r, T && v )
-#endif
-      : result( r ), value( std::move( v ) )
+    template <typename T0, typename T1, typename... Ts>
+    std::tuple<T0 const &, T1 const &, Ts const &...> get() const VULKAN_HPP_NOEXCEPT
     {
+      return std::tie( get<T0>(), get<T1>(), get<Ts>()... );
     }
 
-    Result result;
-    T      value;
+    template <typename ClassType, size_t Which = 0>
+    typename std::enable_if<std::is_same<ClassType, typename std::tuple_element<0, std::tuple<ChainElements...>>::type>::value && ( Which == 0 ), bool>::type
+      isLinked() const VULKAN_HPP_NOEXCEPT
+    {
+      return true;
+    }
 
-    operator std::tuple<Result &, T &>() VULKAN_HPP_NOEXCEPT
+    template <typename ClassType, size_t Which = 0>
+    typename std::enable_if<!std::is_same<ClassType, typename std::tuple_element<0, std::tuple<ChainElements...>>::type>::value || ( Which != 0 ), bool>::type
+      isLinked() const VULKAN_HPP_NOEXCEPT
     {
-      return std::tuple<Result &, T &>( result, value );
+      static_assert( IsPartOfStructureChain<ClassType, ChainElements...>::valid, "Can't unlink Structure that's not part of this StructureChain!" );
+      return isLinked( reinterpret_cast<VkBaseInStructure const *>( &get<ClassType, Which>() ) );
     }
-  };
-)";
 
-        }
-        else {
-            output += R"(
-#ifdef VULKAN_HPP_HAS_NOEXCEPT
-    ResultValue( VkResult r, T & v ) VULKAN_HPP_NOEXCEPT( VULKAN_HPP_NOEXCEPT( T( v ) ) )
-#else
-    ResultValue( VkResult r, T & v )
-#endif
-      : result( r ), value( v )
+    template <typename ClassType, size_t Which = 0>
+    typename std::enable_if<!std::is_same<ClassType, typename std::tuple_element<0, std::tuple<ChainElements...>>::type>::value || ( Which != 0 ), void>::type
+      relink() VULKAN_HPP_NOEXCEPT
     {
+      static_assert( IsPartOfStructureChain<ClassType, ChainElements...>::valid, "Can't relink Structure that's not part of this StructureChain!" );
+      auto pNext = reinterpret_cast<VkBaseInStructure *>( &get<ClassType, Which>() );
+      VULKAN_HPP_ASSERT( !isLinked( pNext ) );
+      auto & headElement = std::get<0>( static_cast<std::tuple<ChainElements...> &>( *this ) );
+      pNext->pNext       = reinterpret_cast<VkBaseInStructure const *>( headElement.pNext );
+      headElement.pNext  = pNext;
     }
 
-#ifdef VULKAN_HPP_HAS_NOEXCEPT
-    ResultValue( VkResult r, T && v ) VULKAN_HPP_NOEXCEPT( VULKAN_HPP_NOEXCEPT( T( std::move( v ) ) ) )
-#else
-    ResultValue( VkResult r, T && v )
-#endif
-      : result( r ), value( std::move( v ) )
+    template <typename ClassType, size_t Which = 0>
+    typename std::enable_if<!std::is_same<ClassType, typename std::tuple_element<0, std::tuple<ChainElements...>>::type>::value || ( Which != 0 ), void>::type
+      unlink() VULKAN_HPP_NOEXCEPT
     {
+      static_assert( IsPartOfStructureChain<ClassType, ChainElements...>::valid, "Can't unlink Structure that's not part of this StructureChain!" );
+      unlink( reinterpret_cast<VkBaseOutStructure const *>( &get<ClassType, Which>() ) );
     }
 
-    VkResult result;
-    T      value;
+  private:
+    template <int Index, typename T, int Which, typename, class First, class... Types>
+    struct ChainElementIndex : ChainElementIndex<Index + 1, T, Which, void, Types...>
+    {
+    };
 
-    operator std::tuple<VkResult &, T &>() VULKAN_HPP_NOEXCEPT
+    template <int Index, typename T, int Which, class First, class... Types>
+    struct ChainElementIndex<Index, T, Which, typename std::enable_if<!std::is_same<T, First>::value, void>::type, First, Types...>
+      : ChainElementIndex<Index + 1, T, Which, void, Types...>
     {
-      return std::tuple<VkResult &, T &>( result, value );
+    };
+
+    template <int Index, typename T, int Which, class First, class... Types>
+    struct ChainElementIndex<Index, T, Which, typename std::enable_if<std::is_same<T, First>::value, void>::type, First, Types...>
+      : ChainElementIndex<Index + 1, T, Which - 1, void, Types...>
+    {
+    };
+
+    template <int Index, typename T, class First, class... Types>
+    struct ChainElementIndex<Index, T, 0, typename std::enable_if<std::is_same<T, First>::value, void>::type, First, Types...>
+      : std::integral_constant<int, Index>
+    {
+    };
+
+    bool isLinked( VkBaseInStructure const * pNext ) const VULKAN_HPP_NOEXCEPT
+    {
+      VkBaseInStructure const * elementPtr =
+        reinterpret_cast<VkBaseInStructure const *>( &std::get<0>( static_cast<std::tuple<ChainElements...> const &>( *this ) ) );
+      while ( elementPtr )
+      {
+        if ( elementPtr->pNext == pNext )
+        {
+          return true;
+        }
+        elementPtr = elementPtr->pNext;
+      }
+      return false;
+    }
+)";
+        if (cstyle) {
+            output += R"(
+    template <size_t Index>
+    void init() VULKAN_HPP_NOEXCEPT
+    {
+        auto &x = std::get<Index>( static_cast<std::tuple<ChainElements...> &>( *this ) );
+        x.sType = vk::structureType<typename std::tuple_element<Index, std::tuple<ChainElements...>>::type>::value;
+        if constexpr (Index != 0) {
+            init<Index - 1>();
+        }
     }
-};
 )";
         }
-
         output += R"(
-/*
-#if !defined( VULKAN_HPP_NO_SMART_HANDLE )
-  template <typename Type, typename Dispatch>
-  struct ResultValue<UniqueHandle<Type, Dispatch>>
-  {
-#  ifdef VULKAN_HPP_HAS_NOEXCEPT
-    ResultValue( Result r, UniqueHandle<Type, Dispatch> && v ) VULKAN_HPP_NOEXCEPT
-#  else
-    ResultValue( Result r, UniqueHandle<Type, Dispatch> && v )
-#  endif
-      : result( r )
-      , value( std::move( v ) )
+    template <size_t Index>
+    typename std::enable_if<Index != 0, void>::type link() VULKAN_HPP_NOEXCEPT
     {
+      auto & x = std::get<Index - 1>( static_cast<std::tuple<ChainElements...> &>( *this ) );
+      x.pNext  = &std::get<Index>( static_cast<std::tuple<ChainElements...> &>( *this ) );
+      link<Index - 1>();
     }
 
-    std::tuple<Result, UniqueHandle<Type, Dispatch>> asTuple()
+    template <size_t Index>
+    typename std::enable_if<Index == 0, void>::type link() VULKAN_HPP_NOEXCEPT
     {
-      return std::make_tuple( result, std::move( value ) );
     }
 
-    Result                       result;
-    UniqueHandle<Type, Dispatch> value;
-  };
+    void link( void * dstBase, void const * srcBase, VkBaseOutStructure * dst, VkBaseInStructure const * src )
+    {
+      while ( src->pNext )
+      {
+        std::ptrdiff_t offset = reinterpret_cast<char const *>( src->pNext ) - reinterpret_cast<char const *>( srcBase );
+        dst->pNext            = reinterpret_cast<VkBaseOutStructure *>( reinterpret_cast<char *>( dstBase ) + offset );
+        dst                   = dst->pNext;
+        src                   = src->pNext;
+      }
+      dst->pNext = nullptr;
+    }
 
-  template <typename Type, typename Dispatch>
-  struct ResultValue<std::vector<UniqueHandle<Type, Dispatch>>>
-  {
-#  ifdef VULKAN_HPP_HAS_NOEXCEPT
-    ResultValue( Result r, std::vector<UniqueHandle<Type, Dispatch>> && v ) VULKAN_HPP_NOEXCEPT
-#  else
-    ResultValue( Result r, std::vector<UniqueHandle<Type, Dispatch>> && v )
-#  endif
-      : result( r )
-      , value( std::move( v ) )
+    void unlink( VkBaseOutStructure const * pNext ) VULKAN_HPP_NOEXCEPT
     {
+      VkBaseOutStructure * elementPtr = reinterpret_cast<VkBaseOutStructure *>( &std::get<0>( static_cast<std::tuple<ChainElements...> &>( *this ) ) );
+      while ( elementPtr && ( elementPtr->pNext != pNext ) )
+      {
+        elementPtr = elementPtr->pNext;
+      }
+      if ( elementPtr )
+      {
+        elementPtr->pNext = pNext->pNext;
+      }
+      else
+      {
+        VULKAN_HPP_ASSERT( false );  // fires, if the ClassType member has already been unlinked !
+      }
     }
+  };
+)";
+
+        if (cfg.gen.flatStructChain) {
+            output += RES_FLAT_STRUCTURE_CHAIN;
+        }
+
+        generateStructChains(output, false && cfg.gen.globalMode);
+        if (cfg.gen.structChainVisitor) {
+            generateChainVisitor(output);
+        }
+        output += endNamespaceStandalone();
+
+        if (cfg.gen.globalMode) {
+            output += R"(
+namespace std {
+  template<typename... ChainElements>
+  class tuple_size<vk::StructureChain<ChainElements...>>:public std::integral_constant<std::size_t, sizeof...(ChainElements)>{};
+
+  template<std::size_t I, typename... ChainElements>
+  class tuple_element<I,vk::StructureChain<ChainElements...>>:public tuple_element<I, std::tuple<ChainElements...>>{};
+}
+)";
+        }
 
-    std::tuple<Result, std::vector<UniqueHandle<Type, Dispatch>>> asTuple()
-    {
-      return std::make_tuple( result, std::move( value ) );
+        generateUnit("vulkan_struct_chains.hpp", files, parent, std::move(output));
     }
 
-    Result                                    result;
-    std::vector<UniqueHandle<Type, Dispatch>> value;
-  };
-#endif
-*/
+    void Generator::generateHash(OutputBuffer &output) {
+        // members are hashed deep: len-annotated pointers and arrays are followed,
+        // strings by content, pNext through detail::hashChain
+        output += "#include \"vulkan.hpp\"\n";
+        output += "#include <functional>\n";
+        output += "#include <iterator>\n";
+        output += "#include <string_view>\n";
+        output += beginNamespace();
+        output += RES_HASH;
 
-  template <typename T>
-  struct ResultValueType
-  {
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    typedef ResultValue<T> type;
-#else
-    typedef T    type;
-#endif
-  };
-)";
-        if (!cfg.gen.globalMode) {
-            output += R"(
-  template <>
-  struct ResultValueType<void>
-  {
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    typedef Result type;
-#else
-    typedef void type;
-#endif
-  };
+        const auto hasNext = [](const Struct &s) {
+            for (const auto &m : s.members) {
+                if (m->original.identifier() == "pNext") {
+                    return true;
+                }
+            }
+            return false;
+        };
 
-  VULKAN_HPP_INLINE typename ResultValueType<void>::type createResultValueType( Result result )
-  {
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    return result;
-#else
-    ignore( result );
-#endif
-  }
+        // len expression of pointer member, empty when it can't be resolved
+        const auto lenExpression = [](const Struct &s, const VariableData &m) -> std::string {
+            if (m.hasLengthVar()) {
+                return "value." + m.getLengthVar()->identifier();
+            }
+            std::string len = m.getAltlenAttrib();
+            if (len.empty()) {
+                return "";
+            }
+            std::string result;
+            std::regex  ident{ "[A-Za-z_][A-Za-z0-9_]*" };
+            auto        last = len.cbegin();
+            for (auto it = std::sregex_iterator(len.begin(), len.end(), ident); it != std::sregex_iterator(); ++it) {
+                const auto &match = *it;
+                result.append(last, match[0].first);
+                auto member = std::find_if(s.members.begin(), s.members.end(), [&](const auto &v) { return v->original.identifier() == match.str(); });
+                if (member == s.members.end()) {
+                    return "";
+                }
+                result += "static_cast<size_t>( value." + (*member)->identifier() + " )";
+                last = match[0].second;
+            }
+            result.append(last, len.cend());
+            return result;
+        };
 
-  template <typename T>
-  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( Result result, T & data )
-  {
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    return ResultValue<T>( result, data );
-#else
-    ignore( result );
-    return data;
-#endif
-  }
+        // platform and video std types are hashed as bytes, pointers to them by address
+        static const std::set<std::string> simpleTypes = { "char",    "double",  "float",   "int",      "int8_t",   "int16_t", "int32_t",
+                                                           "int64_t", "size_t",  "uint8_t", "uint16_t", "uint32_t", "uint64_t" };
+        const auto isKnownType = [&](const VariableData &m) {
+            const auto &type = m.original.type();
+            return m.isStructOrUnion() || m.isHandle() || m.isEnum() || type.starts_with("Vk") || simpleTypes.contains(type);
+        };
 
-  template <typename T>
-  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( Result result, T && data )
-  {
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    return ResultValue<T>( result, std::move( data ) );
-#else
-    ignore( result );
-    return std::move( data );
-#endif
-  }
+        const auto element = [&](const VariableData &m, const std::string &expr) {
+            if (m.isHandle()) {
+                return "hashCombine( seed, static_cast<" + m.original.type() + ">( " + expr + " ) );\n";
+            }
+            return "hashCombine( seed, " + expr + " );\n";
+        };
 
-VULKAN_HPP_INLINE typename ResultValueType<void>::type createResultValueType( VkResult result )
-  {
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    return static_cast<Result>(result);
-#else
-    ignore( result );
-#endif
-  }
+        const auto hashMember = [&](const Struct &s, const VariableData &m) -> std::string {
+            const auto  id    = "value." + m.identifier();
+            const auto &type  = m.original.type();
+            const auto  stars = std::count(m.original.suffix().begin(), m.original.suffix().end(), '*');
+            if (m.hasArrayLength()) {
+                if (!m.arrayLength(1).empty()) {
+                    return "detail::hashBytes( seed, &" + id + ", sizeof( " + id + " ) );\n";
+                }
+                // raw C arrays in global mode, ArrayWrapper1D otherwise
+                if (type == "char") {
+                    return "detail::hashString( seed, std::data( " + id + " ) );\n";
+                }
+                if (!m.isStruct() && !m.isHandle()) {
+                    return "detail::hashBytes( seed, &" + id + ", sizeof( " + id + " ) );\n";
+                }
+                return "for ( auto const & e : " + id + " )\n        " + element(m, "e");
+            }
+            if (stars == 0) {
+                if (type.starts_with("PFN_") || m.isUnion() || !isKnownType(m)) {
+                    return "detail::hashBytes( seed, &" + id + ", sizeof( " + id + " ) );\n";
+                }
+                return element(m, id);
+            }
+            const auto len = lenExpression(s, m);
+            if (stars == 1) {
+                if (type == "char" && m.isNullTerminated() && len.empty()) {
+                    return "detail::hashString( seed, " + id + " );\n";
+                }
+                if (type == "void") {
+                    if (len.empty()) {
+                        return "hashCombine( seed, " + id + " );\n";
+                    }
+                    return "if ( " + id + " )\n        detail::hashBytes( seed, " + id + ", " + len + " );\n";
+                }
+                if (!isKnownType(m)) {
+                    return "hashCombine( seed, " + id + " );\n";
+                }
+                if (len.empty()) {
+                    return "if ( " + id + " )\n        " + element(m, "*" + id);
+                }
+                return "if ( " + id + " )\n        for ( size_t i = 0; i < " + len + "; ++i )\n          " + element(m, id + "[i]");
+            }
+            if (stars == 2 && !len.empty()) {
+                if (type == "char") {
+                    return "if ( " + id + " )\n        for ( size_t i = 0; i < " + len + "; ++i )\n          detail::hashString( seed, " + id + "[i] );\n";
+                }
+                if (m.isStructOrUnion()) {
+                    return "if ( " + id + " )\n        for ( size_t i = 0; i < " + len + "; ++i )\n          if ( " + id + "[i] )\n            " + element(m, "*" + id + "[i]");
+                }
+            }
+            return "hashCombine( seed, " + id + " );\n";
+        };
 
-  template <typename T>
-  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( VkResult result, T & data )
-  {
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    return ResultValue<T>( static_cast<Result>(result), data );
-#else
-    ignore( result );
-    return data;
-#endif
-  }
+        output += "\n";
+        for (const Struct &s : structs.ordered) {
+            genOptional(output, s, [&](auto &output) {
+                output += "  inline void hashCombine( std::size_t & seed, " + s.name + " const & value ) VULKAN_HPP_NOEXCEPT;\n";
+            });
+        }
 
-  template <typename T>
-  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( VkResult result, T && data )
+        output += R"(
+  namespace detail
   {
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    return ResultValue<T>( static_cast<Result>(result), std::move( data ) );
-#else
-    ignore( result );
-    return std::move( data );
-#endif
-  }
 )";
+        // Struct::extends lists the structs extending it, the ones listed anywhere can appear in a pNext chain
+        std::set<const Struct *> extending;
+        for (const Struct &s : structs.ordered) {
+            extending.insert(s.extends.begin(), s.extends.end());
         }
-        else {
-            output += R"(
-  template <>
-  struct ResultValueType<void>
-  {
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    typedef VkResult type;
-#else
-    typedef void type;
-#endif
-  };
 
-  VULKAN_HPP_INLINE typename ResultValueType<void>::type createResultValueType( VkResult result )
-  {
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    return result;
-#else
-    ignore( result );
-#endif
-  }
+        OutputBuffer chainCases;
+        for (const Struct &s : structs.ordered) {
+            if (!s.isStruct() || !hasNext(s)) {
+                continue;
+            }
+            genOptional(output, s, [&](auto &output) {
+                output += "    inline void hashMembers( std::size_t & seed, " + s.name + " const & value ) VULKAN_HPP_NOEXCEPT;\n";
+            });
+            if (s.hasStructType() && extending.contains(&s)) {
+                genOptional(chainCases, s, [&](auto &output) {
+                    output += vkgen::format("          case {0}: hashMembers( seed, *reinterpret_cast<{1} const *>( s ) ); break;\n",
+                                            s.structTypeValue.original, s.name);
+                });
+            }
+        }
+        output += R"(
+    inline void hashChain( std::size_t & seed, void const * pNext ) VULKAN_HPP_NOEXCEPT
+    {
+      for ( auto const * s = reinterpret_cast<VkBaseInStructure const *>( pNext ); s; s = s->pNext )
+      {
+        switch ( s->sType )
+        {
+)";
+        output += std::move(chainCases);
+        output += R"(          default: hashCombine( seed, s->sType ); break;
+        }
+      }
+    }
+  }  // namespace detail
+)";
 
-  template <typename T>
-  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( VkResult result, T & data )
-  {
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    return ResultValue<T>( result, data );
-#else
-    ignore( result );
-    return data;
-#endif
-  }
+        for (const Struct &s : structs.ordered) {
+            genOptional(output, s, [&](auto &output) {
+                std::string body;
+                if (s.isUnion()) {
+                    body = "      detail::hashBytes( seed, &value, sizeof( value ) );\n";
+                }
+                else {
+                    for (const auto &m : s.members) {
+                        if (m->original.identifier() == "pNext") {
+                            continue;
+                        }
+                        body += "      " + hashMember(s, *m);
+                    }
+                }
+                if (s.isStruct() && hasNext(s)) {
+                    output += vkgen::format(R"(
+  inline void detail::hashMembers( std::size_t & seed, {0} const & value ) VULKAN_HPP_NOEXCEPT
+  {{
+{1}  }}
 
-  template <typename T>
-  VULKAN_HPP_INLINE typename ResultValueType<T>::type createResultValueType( VkResult result, T && data )
-  {
-#ifdef VULKAN_HPP_NO_EXCEPTIONS
-    return ResultValue<T>( result, std::move( data ) );
-#else
-    ignore( result );
-    return std::move( data );
-#endif
-  }
-)";
+  inline void hashCombine( std::size_t & seed, {0} const & value ) VULKAN_HPP_NOEXCEPT
+  {{
+    detail::hashMembers( seed, value );
+    detail::hashChain( seed, value.pNext );
+  }}
+)",
+                                            s.name,
+                                            body);
+                }
+                else {
+                    output += vkgen::format(R"(
+  inline void hashCombine( std::size_t & seed, {0} const & value ) VULKAN_HPP_NOEXCEPT
+  {{
+{1}  }}
+)",
+                                            s.name,
+                                            body);
+                }
+            });
         }
+        output += endNamespace();
 
+        output += "\nnamespace std\n{\n";
+        for (const Struct &s : structs.ordered) {
+            genOptional(output, s, [&](auto &output) {
+                output += vkgen::format(R"(
+  template <>
+  struct hash<{0}::{1}>
+  {{
+    std::size_t operator()( {0}::{1} const & value ) const VULKAN_HPP_NOEXCEPT
+    {{
+      std::size_t seed = 0;
+      {0}::hashCombine( seed, value );
+      return seed;
+    }}
+  }};
+)",
+                                        m_ns,
+                                        s.name);
+            });
+        }
+        output += "}  // namespace std\n";
     }
 
-    void Generator::generateErrorClasses(OutputBuffer &output) {
-        OutputBuffer caseCode;
+    void Generator::generateFormat(OutputBuffer &output) {
+        // members are written directly to output iterator, len-annotated pointers and
+        // pNext chains are followed up to depth levels
+        const bool tables = cfg.gen.enumStringTables;
 
-        output += vkgen::format(RES_ERROR_CAT, m_ns);
-        output += "#ifdef VULKAN_HPP_UNIFIED_EXCEPTION\n";
-        output += vkgen::format(RES_ERRORS_UNIFIED, m_ns);
-        output += "#else\n";
-        output += vkgen::format(RES_ERRORS,
-                                cfg.gen.globalMode? "VkResult" : "Result",
-                                cfg.gen.globalMode? "e" : "static_cast<int>( e )"
-        );
+        output += "#include \"vulkan.hpp\"\n";
+        if (tables) {
+            output += "#include \"vulkan_to_string.hpp\"\n";
+        }
+        output += "#include <charconv>\n";
+        output += "#include <iterator>\n";
+        output += "#include <string_view>\n";
+        output += beginNamespace();
+        output += RES_FORMAT;
+
+        const auto lenExpression = [](const Struct &s, const VariableData &m) -> std::string {
+            if (m.hasLengthVar()) {
+                return "value." + m.getLengthVar()->identifier();
+            }
+            std::string len = m.getAltlenAttrib();
+            if (len.empty()) {
+                return "";
+            }
+            std::string result;
+            std::regex  ident{ "[A-Za-z_][A-Za-z0-9_]*" };
+            auto        last = len.cbegin();
+            for (auto it = std::sregex_iterator(len.begin(), len.end(), ident); it != std::sregex_iterator(); ++it) {
+                const auto &match = *it;
+                result.append(last, match[0].first);
+                auto member = std::find_if(s.members.begin(), s.members.end(), [&](const auto &v) { return v->original.identifier() == match.str(); });
+                if (member == s.members.end()) {
+                    return "";
+                }
+                result += "static_cast<size_t>( value." + (*member)->identifier() + " )";
+                last = match[0].second;
+            }
+            result.append(last, len.cend());
+            return result;
+        };
 
-        for (const auto &e : errorClasses) {
-            //        std::string name = e->name;
-            //        strStripPrefix(name, "eError");
-            //        name += "Error";
+        // platform and video std types are written as bytes, pointers to them by address
+        static const std::set<std::string> simpleTypes = { "char",    "double",  "float",   "int",      "int8_t",   "int16_t", "int32_t",
+                                                           "int64_t", "size_t",  "uint8_t", "uint16_t", "uint32_t", "uint64_t" };
+
+        const auto element = [&](const VariableData &m, const std::string &expr, const std::string &depth) -> std::string {
+            const auto &type = m.original.type();
+            if (m.isStructOrUnion()) {
+                return "out = formatTo( out, " + expr + ", " + depth + " );\n";
+            }
+            if (m.isHandle()) {
+                return "out = detail::formatValue( out, static_cast<" + type + ">( " + expr + " ) );\n";
+            }
+            if (m.isEnum() || type.starts_with("Vk")) {
+                const bool flags = type.find("Flags") != std::string::npos && type.find("FlagBits") == std::string::npos;
+                if (tables && !flags && m.isEnum()) {
+                    return "out = detail::formatEnum( out, " + expr + " );\n";
+                }
+                if (tables && flags && m.isEnum() && cfg.gen.enumMock != 1) {
+                    return "out = to_string( out, " + expr + " );\n";
+                }
+                return "out = detail::formatValue( out, static_cast<" + type + ">( " + expr + " ) );\n";
+            }
+            if (simpleTypes.contains(type)) {
+                return "out = detail::formatValue( out, " + expr + " );\n";
+            }
+            return "out = detail::formatBytes( out, &" + expr + ", sizeof( " + expr + " ) );\n";
+        };
+
+        const auto list = [&](const std::string &count, const std::string &body) {
+            return vkgen::format(R"(*out++ = '[';
+      for ( size_t i = 0; i < {0}; ++i )
+      {{
+        out = detail::formatText( out, i ? ", " : " " );
+        {1}      }}
+      out = detail::formatText( out, " ]" );
+)",
+                                 count,
+                                 body);
+        };
+
+        const auto formatMember = [&](const Struct &s, const VariableData &m) -> std::string {
+            const auto  id    = "value." + m.identifier();
+            const auto &type  = m.original.type();
+            const auto  stars = std::count(m.original.suffix().begin(), m.original.suffix().end(), '*');
+            if (m.original.identifier() == "pNext") {
+                return "out = detail::formatChain( out, " + id + ", depth - 1 );\n";
+            }
+            if (m.hasArrayLength()) {
+                if (!m.arrayLength(1).empty()) {
+                    return "out = detail::formatBytes( out, &" + id + ", sizeof( " + id + " ) );\n";
+                }
+                // raw C arrays in global mode, ArrayWrapper1D otherwise
+                if (type == "char") {
+                    return "out = detail::formatString( out, std::data( " + id + " ), std::size( " + id + " ) );\n";
+                }
+                return list("std::size( " + id + " )", element(m, id + "[i]", "depth"));
+            }
+            if (stars == 0) {
+                if (type.starts_with("PFN_")) {
+                    return "out = detail::formatValue( out, reinterpret_cast<void const *>( " + id + " ) );\n";
+                }
+                return element(m, id, "depth");
+            }
+            const auto len  = lenExpression(s, m);
+            const auto addr = "out = detail::formatValue( out, static_cast<void const *>( " + id + " ) );\n";
+            const bool known = m.isStructOrUnion() || m.isHandle() || m.isEnum() || type.starts_with("Vk") || simpleTypes.contains(type);
+            if (stars == 1) {
+                if (type == "char" && m.isNullTerminated() && len.empty()) {
+                    return "out = detail::formatString( out, " + id + " );\n";
+                }
+                if (type == "void" || !known) {
+                    return addr;
+                }
+                if (len.empty()) {
+                    if (!m.isStructOrUnion()) {
+                        return addr;
+                    }
+                    return "if ( " + id + " && depth > 0 )\n        " + element(m, "*" + id, "depth - 1") + "      else\n        " + addr;
+                }
+                return "if ( " + id + " )\n      {\n        " + list(len, element(m, id + "[i]", "depth - 1")) + "      }\n      else\n        " + addr;
+            }
+            if (stars == 2 && !len.empty() && type == "char") {
+                return "if ( " + id + " )\n      {\n        " + list(len, "out = detail::formatString( out, " + id + "[i] );\n") + "      }\n      else\n        " + addr;
+            }
+            return addr;
+        };
+
+        output += "\n";
+        for (const Struct &s : structs.ordered) {
+            genOptional(output, s, [&](auto &output) {
+                output += "  template <typename OutputIt>\n";
+                output += "  OutputIt formatTo( OutputIt out, " + s.name + " const & value, int depth = VULKAN_HPP_FORMAT_DEPTH );\n";
+            });
+        }
 
-            std::string value = cfg.gen.globalMode? e.value.name.original : "Result::" + e.value.name;
+        // Struct::extends lists the structs extending it, the ones listed anywhere can appear in a pNext chain
+        std::set<const Struct *> extending;
+        for (const Struct &s : structs.ordered) {
+            extending.insert(s.extends.begin(), s.extends.end());
+        }
 
-            genOptional(output, e.value, [&](auto &output) {
+        OutputBuffer chainCases;
+        for (const Struct &s : structs.ordered) {
+            if (s.isStruct() && s.hasStructType() && extending.contains(&s)) {
+                genOptional(chainCases, s, [&](auto &output) {
+                    output += vkgen::format("        case {0}: return formatTo( out, *reinterpret_cast<{1} const *>( pNext ), depth );\n",
+                                            s.structTypeValue.original,
+                                            s.name);
+                });
+            }
+        }
+        output += R"(
+  namespace detail
+  {
+    template <typename OutputIt>
+    OutputIt formatChain( OutputIt out, void const * pNext, int depth )
+    {
+      if ( !pNext )
+      {
+        return formatText( out, "null" );
+      }
+      if ( depth < 0 )
+      {
+        return formatText( out, "{...}" );
+      }
+      switch ( reinterpret_cast<VkBaseInStructure const *>( pNext )->sType )
+      {
+)";
+        output += std::move(chainCases);
+        output += R"(        default:
+          out = formatText( out, "{ sType: " );
+          out = formatValue( out, reinterpret_cast<VkBaseInStructure const *>( pNext )->sType );
+          out = formatText( out, ", pNext: " );
+          out = formatChain( out, reinterpret_cast<VkBaseInStructure const *>( pNext )->pNext, depth - 1 );
+          return formatText( out, " }" );
+      }
+    }
+  }  // namespace detail
+)";
 
+        for (const Struct &s : structs.ordered) {
+            genOptional(output, s, [&](auto &output) {
+                std::string body;
+                if (s.isUnion()) {
+                    body = "      return detail::formatBytes( out, &value, sizeof( value ) );\n";
+                } else {
+                    bool first = true;
+                    for (const auto &m : s.members) {
+                        body += vkgen::format("      out = detail::formatText( out, \"{0}{1}: \" );\n      ", first ? "{ " : ", ", m->identifier());
+                        body += formatMember(s, *m);
+                        first = false;
+                    }
+                    body += "      return detail::formatText( out, \" }\" );\n";
+                }
                 output += vkgen::format(R"(
-  class {0} : public SystemError
+  template <typename OutputIt>
+  OutputIt formatTo( OutputIt out, {0} const & value, int depth )
   {{
-  public:
-    {0}( std::string const & message ) : SystemError( make_error_code( {1} ), message ) {{}}
-    {0}( char const * message ) : SystemError( make_error_code( {1} ), message ) {{}}
-  }};
+    (void)depth;
+{1}  }}
 )",
-                                        e.name,
-                                        value);
+                                        s.name,
+                                        body);
             });
-
-            genOptional(caseCode, e.value, [&](auto &output) { output += "        case " + value + ": throw " + e.name + "(message);\n"; });
         }
+        output += endNamespace();
 
-        output += "#endif // VULKAN_HPP_UNIFIED_EXCEPTION\n";
+        const auto genSpecializations = [&](const std::string &ns) {
+            for (const Struct &s : structs.ordered) {
+                genOptional(output, s, [&](auto &output) {
+                    output += vkgen::format("template <>\nstruct {0}::formatter<{1}::{2}, char> : {1}::detail::StructFormatter<{1}::{2}>\n{{\n}};\n", ns, m_ns, s.name);
+                });
+            }
+        };
+        output += "\n#if defined( __cpp_lib_format )\n#  include <format>\n\n";
+        genSpecializations("std");
+        output += "#endif\n";
+        output += "\n#if defined( FMT_VERSION )\n";
+        genSpecializations("fmt");
+        output += "#endif\n";
+    }
+
+    std::string Generator::generateSlotTable(const std::string &prefix, const std::string &ctype, const std::vector<int64_t> &values, std::vector<uint32_t> &slots) const {
+        // enum values are sparse (1000000000 + extension * 1000 + offset),
+        // each extension gets block of slots so lookup is two table reads
+        static constexpr int64_t extBase = 1000000000;
+
+        struct Block {
+            uint32_t base  = 0;
+            uint32_t count = 0;
+        };
+        std::vector<Block> blocks;
+        uint32_t           count = 0;
+        for (const auto &value : values) {
+            const size_t block  = value < extBase ? 0 : (value - extBase) / 1000 + 1;
+            const auto   offset = static_cast<uint32_t>(value < extBase ? value : value % 1000);
+            if (block >= blocks.size()) {
+                blocks.resize(block + 1, Block{ count, 0 });
+            }
+            auto &b = blocks[block];
+            if (b.count == 0) {
+                b.base = count;
+            }
+            count   = std::max(count, b.base + offset + 1);
+            b.count = offset + 1;
+        }
+        slots.clear();
+        for (const auto &value : values) {
+            const size_t block  = value < extBase ? 0 : (value - extBase) / 1000 + 1;
+            const auto   offset = static_cast<uint32_t>(value < extBase ? value : value % 1000);
+            slots.push_back(blocks[block].base + offset);
+        }
+
+        std::string output = vkgen::format(R"(
+    struct {1}Block
+    {{
+      uint16_t base;
+      uint16_t count;
+    }};
 
-        output += "  namespace detail {\n";
-        output += vkgen::format(R"(
-    [[noreturn]] void VULKAN_HPP_INLINE throwResultException({0} result, char const *message) {{
+    VULKAN_HPP_CONSTEXPR_INLINE uint32_t {0}SlotCount  = {2};
+    VULKAN_HPP_CONSTEXPR_INLINE uint32_t {0}BlockCount = {3};
+
+    VULKAN_HPP_CONSTEXPR_INLINE {1}Block {0}Blocks[{0}BlockCount] = {{
 )",
-                                cfg.gen.globalMode? "VkResult" : m_ns + "::Result");
-        if (cfg.gen.unifiedException) {
-            output += R"(
-#ifdef VULKAN_HPP_UNIFIED_EXCEPTION
-      throw Error( result, message );
-#else
-)";
-        }
-        output += "      switch (result) {\n";
-        output += std::move(caseCode);
-        output += "        default: throw SystemError( make_error_code( result ) );\n";
-        output += "      }\n";
-        if (cfg.gen.unifiedException) {
-            output += "#endif // VULKAN_HPP_UNIFIED_EXCEPTION\n";
+                                           prefix,
+                                           strFirstUpper(prefix),
+                                           count,
+                                           blocks.size());
+        for (const auto &b : blocks) {
+            output += "      { " + std::to_string(b.base) + ", " + std::to_string(b.count) + " },\n";
         }
-        output += "    }\n;";
-        output += "  } // namespace\n";
+        output += vkgen::format(R"(    }};
 
+    // unknown value maps to {0}SlotCount
+    VULKAN_HPP_CONSTEXPR uint32_t {0}Slot( {1} value ) VULKAN_HPP_NOEXCEPT
+    {{
+      uint32_t const v      = static_cast<uint32_t>( value );
+      uint32_t const block  = v < 1000000000 ? 0 : ( v - 1000000000 ) / 1000 + 1;
+      uint32_t const offset = v < 1000000000 ? v : v % 1000;
+      return ( block < {0}BlockCount && offset < {0}Blocks[block].count ) ? {0}Blocks[block].base + offset : {0}SlotCount;
+    }}
+)",
+                                prefix,
+                                ctype);
+        return output;
     }
 
-    std::string Generator::generateDispatchLoaderBase() {
-        std::string output;
-        output += R"(
-  class DispatchLoaderBase
-  {
-  public:
-    DispatchLoaderBase() = default;
-    DispatchLoaderBase( std::nullptr_t )
-#if !defined( NDEBUG )
-      : m_valid( false )
-#endif
-    {
-    }
-
-#if !defined( NDEBUG )
-    size_t getVkHeaderVersion() const
-    {
-      VULKAN_HPP_ASSERT( m_valid );
-      return vkHeaderVersion;
-    }
+    void Generator::generateChainVisitor(OutputBuffer &output) {
+        auto &structureTypes = enums["VkStructureType"];
+        std::map<int64_t, const Struct *> slots;
+        for (const Struct &s : structs.ordered) {
+            if (!s.hasStructType() || !s.canGenerate()) {
+                continue;
+            }
+            const auto *value = structureTypes.find(s.structTypeValue.original);
+            if (!value) {
+                std::cerr << "generateChainVisitor() unknown structure type: " << s.structTypeValue.original << '\n';
+                continue;
+            }
+            if (value->isAlias) {
+                value = structureTypes.find(value->alias);
+                if (!value) {
+                    continue;
+                }
+            }
+            slots.try_emplace(value->numericValue, &s);
+        }
 
-  private:
-    size_t vkHeaderVersion = VK_HEADER_VERSION;
-    bool   m_valid         = true;
-#endif
-  };
+        std::vector<int64_t> values;
+        for (const auto &[value, s] : slots) {
+            values.push_back(value);
+        }
+        std::vector<uint32_t>       indices;
+        const std::string           slotTable = generateSlotTable("structureType", "VkStructureType", values, indices);
+        std::vector<const Struct *> table;
+        {
+            size_t i = 0;
+            for (const auto &[value, s] : slots) {
+                const auto slot = indices[i++];
+                if (slot >= table.size()) {
+                    table.resize(slot + 1, nullptr);
+                }
+                table[slot] = s;
+            }
+        }
+
+        const auto genEntry = [&](OutputBuffer &output, const Struct *s, const std::string &entry, const std::string &fallback) {
+            if (s) {
+                const auto &protect = s->getProtect();
+                if (!protect.empty()) {
+                    output += "#if defined(";
+                    output += protect;
+                    output += ")\n";
+                    output += entry;
+                    output += "#else\n";
+                    output += fallback;
+                    output += "#endif // ";
+                    output += protect;
+                    output += "\n";
+                    return;
+                }
+                output += entry;
+                return;
+            }
+            output += fallback;
+        };
 
+        output += R"(
+  namespace detail
+  {)";
+        output += slotTable;
+        output += R"(
+    VULKAN_HPP_CONSTEXPR_INLINE uint32_t structureTypeSizes[structureTypeSlotCount + 1] = {
 )";
-        return output;
-    }
-
-    void Generator::generateDispatchLoaderStatic(OutputBuffer &output) {
-        output += "//#if !defined( VK_NO_PROTOTYPES )\n";
-        output += "  class DispatchLoaderStatic : public DispatchLoaderBase {\n";
-        output += "  public:\n";
-
-        Handle     empty{ *this };
-        for (auto &command : commands) {
-            genOptional(output, command, [&](auto &output) {
-                ClassCommand                       d{ this, &empty, command };
-                MemberContext                      ctx{ .ns = Namespace::VK, .disableDispatch = true, .disableAllocatorRemoval = true };
-                MemberResolverStaticDispatch const r{ *this, d, ctx };
-                // TODO
-                output += r.temporary();
-            });
+        for (const auto *s : table) {
+            genEntry(output, s, s ? "      sizeof( " + s->name.original + " ),\n" : "", "      0,\n");
         }
+        output += R"(      0
+    };
 
-        output += "  };\n";
-        output += "//#endif\n";
-    }
+    template <typename Visitor, typename Base, typename T>
+    void visitStructure( Base * structure, Visitor & visitor );
 
-    void Generator::generateUnit(const std::string_view file, GenOutput &out, OutputBuffer &parent, OutputBuffer &&code) {
-        if (!cfg.gen.splitFiles) {
-            parent += beginNamespace();
-            parent += std::move(code);
-            parent += endNamespace();
+    template <typename Visitor, typename Base>
+    struct StructureVisitTable
+    {
+      using Function = void ( * )( Base *, Visitor & );
+
+      static constexpr Function table[structureTypeSlotCount + 1] = {
+)";
+        for (const auto *s : table) {
+            genEntry(output, s, s ? "        &visitStructure<Visitor, Base, " + s->name + ">,\n" : "", "        &visitStructure<Visitor, Base, Base>,\n");
         }
-        else {
-            out.writeFile(*this, file, code);
-            parent += "#include \"";
-            parent += file;
-            parent += "\"\n";
+        output += R"(        &visitStructure<Visitor, Base, Base>
+      };
+    };
+  }  // namespace detail
+)";
+        output += RES_CHAIN_VISITOR;
+        if (!cfg.gen.globalMode) {
+            output += R"(
+  VULKAN_HPP_CONSTEXPR size_t sizeofStructureType( StructureType sType ) VULKAN_HPP_NOEXCEPT
+  {
+    return sizeofStructureType( static_cast<VkStructureType>( sType ) );
+  }
+)";
         }
-
-    }
-
-    void Generator::generateStructDecl(OutputBuffer &output, const Struct &d) const {
-        genOptional(output, d, [&](auto &output) {
-            output += (d.isStruct()? "  struct " : "  union ");
-            output += d.name + ";\n";
-            for (const auto &a : d.aliases) {
-                output += "  using " + a.name + " = " + d.name + ";\n";
-            }
-        });
     }
 
-    void Generator::generateClassDecl(OutputBuffer &output, const Handle &data, const std::string &name) const {
-        genOptional(output, data, [&](auto &output) { output += "  class " + name + ";\n"; });
-    }
+    void Generator::generateStructChains(vkgen::OutputBuffer &output, bool ctype) {
+        GuardedOutput out;
 
-    void Generator::generateClassDecl(OutputBuffer &output, const Handle &data) const {
-        generateClassDecl(output, data, data.name);
-    }
+        if (ctype) {
+            for (const Struct &s : structs.ordered) {
+                if (s.structTypeValue.empty()) {
+                    continue;
+                }
+                genOptional(output, s, [&](auto &output) {
+                    output += vkgen::format(R"(
+  template <>
+  struct structureType<{0}>
+  {{
+    static VULKAN_HPP_CONST_OR_CONSTEXPR VkStructureType value = {1};
+  }};
+)",
+                                            s.name.original,
+                                            s.structTypeValue.original);
 
-    /* deprecated
-    std::string Generator::generateClassString(const std::string &className, const OutputClass &from, Namespace ns) const {
-        std::string output = "  class " + className;
-        if (!from.inherits.empty()) {
-            output += " : " + from.inherits;
+                });
+            }
         }
-        output += " {\n";
 
-        const auto addSection = [&](const std::string &visibility, const GuardedOutput &segment) {
-            std::stringstream tmp;
-            segment.write(tmp);
-            if (!tmp.str().empty()) {
-                if (!visibility.empty()) {
-                    output += "  " + visibility + ":\n";
-                }
-                output += tmp.str();
-            }
-        };
 
-        addSection("public", from.sPublic);
-        addSection("", from.sFuncs);
-        addSection("private", from.sPrivate);
-        addSection("protected", from.sProtected);
-        output += "  };\n";
-        return output;
-    }
-     */
+        for (const Struct &s : structs.ordered) {
 
-    std::string Generator::generateForwardInclude(GenOutput &out) const {
-        std::string output;
-        if (!cfg.gen.globalMode) {
-            output += "#include \"" + out.getFilename("_forward") + "\"\n";
-            output += "#include \"vulkan_structs_forward.hpp\"\n";
-        }
-        output += "#include \"vulkan_handles_forward.hpp\"\n";
+            if (s.extends.empty()) {
+                continue;
+            }
+            auto p = s.getProtect();
 
-        if (cfg.gen.raii.interop) {
-            output += "#include \"" + out.getFilename("_raii_forward") + "\"\n";
+            out.add(s, [&](auto &output) {
+                for (const auto &e : s.extends) {
+                    if (!e->canGenerate()) {
+                        continue;
+                    }
+                    auto p2 = e->getProtect();
+                    // bool bypass = p == p2;
+                    genOptional(output,
+                                  *e,
+                      [&](auto &output) {
+
+                          output += "  template <>\n";
+                          output += "  struct StructExtends<";
+                          if (ctype) {
+                              output += e->name.original + ", " + s.name.original;
+                          }
+                          else {
+                              output += e->name + ", " + s.name;
+                          }
+                          // output += ">";
+                          output += R"(>
+ {
+   enum
+   {
+     value = true
+   };
+ };
+)";
+                      });
+                }
+            });
         }
-
-        return output;
+        output += "#ifndef VULKAN_HPP_NO_STRUCT_EXTENDS\n";
+        output += out.toString();
+        output += "#endif // VULKAN_HPP_NO_STRUCT_EXTENDS\n";
     }
 
-    void Generator::generateGlobalFuncs(vkgen::GuardedOutputFuncs &output, bool useC) {
-        if (cfg.gen.globalMode) {
-
-            const Handle   empty{ *this };
-            GuardedOutput decl;
-            for (const Command &s : staticCommands) {
-                output.def += "  // static cmd: " + s.name.original + "\n";
-            }
-
-            for (Command &c : commands.ordered) {
+    bool Generator::generateStructConstructor(OutputBuffer &output, const Struct &data, bool transform) {
 
-                // std::cout << c.successCodes.size() << "\n";
+        bool               hasProxy = false;
 
-                bool m = false;
-                for (const Command &s : staticCommands) {
-                    if (c.name.original == s.name.original) {
-                        m = true;
-                        break;
-                    }
-                }
-                if (m) {
-                    // continue;
-                }
-                if (c.name == "createInstance") {
-                    continue;
-                }
-                if (c.name == "createDevice") {
-                    continue;
-                }
-                if (c.name == "enumerateInstanceVersion") {
-                    continue;
-                }
+        FunctionGenerator fun(*this, "", data.name);
+        fun.className = data.name;
+        fun.base = &data;
+        fun.optionalProtect = Protect{"VULKAN_HPP_NO_STRUCT_CONSTRUCTORS", false};
+        fun.allowInline = true;
+        // proxy constructor only reads data() and size(), constexpr as well
+        fun.specifierConstexpr = true;
 
+        VariableData *pNext = nullptr;
 
-//                if (!useC) {
-//                    if (c.params.empty()) {
-//                        continue;
-//                    }
-//                }
+        for (const auto &p : data.members) {
+            std::string id = p->identifier() + "_";
+            std::string type = p->fullType(*this);
 
+            bool const toProxy = transform && p->hasLengthVar() && !p->hasArrayLength();
+            if (p->hasLengthVar() && !p->hasArrayLength()) {
+                hasProxy = true;
+            }
 
-                // outputFuncs.def += "  // cmd: " + c.name.original + "  " + std::to_string(c.successCodes.size()) + "\n";
+            if (p->type() == "StructureType") {
+                if (data.name != "BaseOutStructure" && data.name != "BaseInStructure") {
+                    continue;
+                }
 
-                ClassCommand d{ this, &empty, c };
+                fun.add(type, id, " = " + m_ns + "::StructureType::eApplicationInfo");
+            } else if (p->identifier() == "pNext") {
 
-                MemberGenerator g{ *this, d, output.def, output, true };
-                g.ctx.globalModeStatic = true;
-                g.ctx.globalUseCAPI = useC;
-                g.generate();
+                pNext = p.get();
+            } else {
+                if (toProxy) {
+                    VariableData var(*p);
+                    var.removeLastAsterisk();
+                    if (var.type() == "void" && !var.isPointer()) {
+                        var.setType("T");
+                        fun.additonalTemplate = "typename T";
+                    }
+                    fun.add(vkgen::format("{0}::ArrayProxyNoTemporaries<{1}> const &", m_ns, var.fullType(*this)), id);
+                } else {
+                    fun.add(type, id, transform? "" : " = {}");
+                }
+            }
 
+            std::string const lhs = p->identifier();
+            if (toProxy) {
+                fun.addInit(lhs, id + ".data()");
+            } else {
+                std::string rhs  = id;
+                const auto &vars = p->getArrayVars();
+                if (!vars.empty() && transform) {
+                    rhs = "static_cast<uint32_t>(";
+                    // std::cout << "> array vars: " << vars.size() << std::endl;
+                    for (size_t i = 0; i < vars.size(); ++i) {
+                        const auto        &v  = vars[i];
+                        const std::string &id = v->identifier();
+                        if (i != vars.size() - 1) {
+                            rhs += " !";
+                            rhs += id;
+                            rhs += "_";
+                            rhs += ".empty()? ";
+                            rhs += id;
+                            rhs += "_.size() :\n";
+                        } else {
+                            rhs += id;
+                            rhs += "_.size()";
+                        }
+                        if (v->type() == "void" && !v->isPointer()) {
+                            rhs += " * sizeof(T)";
+                        }
+                    }
+                    rhs += ")";
+                }
+                fun.addInit(lhs, rhs);
             }
         }
-    }
-
-    void Generator::generateHandles(OutputBuffer &output, OutputBuffer &output_smart, GenOutput &out) {
-        if (verbose) {
-            std::cout << "gen handles " << '\n';
+        if (pNext) {
+            fun.add(pNext->fullType(*this), pNext->identifier() + "_", " = nullptr");
         }
 
+        output += fun.generate(outputFuncs);
 
-        output += "#include <cstddef>\n";
-        output += "#include \"vulkan_hpp_macros.hpp\"\n";
-        if (cfg.gen.globalMode) {
-            output += "#include \"vulkan_context.hpp\"\n";
-        }
+        return hasProxy;
+    }
 
+    void Generator::generateStruct(OutputBuffer &output, const Struct &data, bool exp) {
 
-        // if (!cfg.gen.cppModules) {
-        output += generateForwardInclude(out);
-        // }
+        bool genSetters          = data.hasStructType() && !data.returnedonly;
+        bool genSettersProxy     = genSetters;
+        bool genCompareOperators = data.isStruct();
+        bool genConstructors = true;
 
-        // if (!cfg.gen.cppModules) {
-        output += beginNamespace();
-        // }
         if (cfg.gen.globalMode) {
-            output += "  struct InstanceCreateInfo;\n";
-            output += "  struct DeviceCreateInfo;\n";
+            genSetters = false;
+            genSettersProxy = false;
+            genConstructors = false;
         }
 
+        std::string structureType;
 
-
-        output += "#ifndef VULKAN_HPP_NO_STRUCT_CHAIN\n";
-        output += R"(
-  template <typename... ChainElements>
-  class StructureChain;
-)";
-        output += "#endif // VULKAN_HPP_NO_STRUCT_CHAIN\n";
-
-        gen(output, cfg.gen.handleTemplates, [&](auto &output) {
-            output += R"(
-  template <typename Type>
-  struct isVulkanHandleType
-  {
-    static VULKAN_HPP_CONST_OR_CONSTEXPR bool value = false;
-  };
-)";
-        });
-
-        if (cfg.gen.internalFunctions) {
-            std::string spec;
-            if (!cfg.gen.cppModules) {
-                spec = "static";
+        if (!data.structTypeValue.empty()) {
+            if (cfg.gen.structMock >= 5) {
+                structureType = data.structTypeValue.original;
             }
+            else {
+                structureType = "StructureType::" + data.structTypeValue;
+            }
+        }
 
-            output += R"(
-  namespace internal {
+        for (const auto &m : data.members) {
+            if (data.isStruct()) {
+                const auto &type = m->original.type();
+                const auto &s    = structs.find(type);
+                if (s != structs.end()) {
+                    if (s->isUnion()) {
+                        genCompareOperators = false;
+                    }
+                }
+            }
+            if (m->hasArrayLength() && !cfg.gen.globalMode) {
+                m->setSpecialType(VariableData::TYPE_ARRAY);
+            }
+        }
 
-    template<typename T, typename V, typename S, typename PFN, typename... Args>
-    inline std::vector<T> createArrayVoidPFN(const PFN pfn, const char *const msg, Args&&... args) {
-        std::vector<T> data;
-        S count;
-        pfn(std::forward<Args>(args)..., &count, nullptr);
+        output += "  " + data.metaTypeDeclaration() + " " + data.name + " {\n";
+        if (cfg.gen.structMock > 0) {
+            output += "#ifndef VULKAN_HPP_NO_STRUCT_TRAITS\n";
+        }
+        output += "    using NativeType = " + data.name.original + ";\n";
+        if (data.isStruct()) {
+            if (!structureType.empty()) {
+                output +=
+                  "    static const bool                               "
+                  "   allowDuplicate = false;\n";
+                output += "    static VULKAN_HPP_CONST_OR_CONSTEXPR " + m_ns + "::StructureType structureType = " + structureType + ";\n";
+            }
+        }
+        if (cfg.gen.structMock > 0) {
+            output += "#endif // VULKAN_HPP_NO_STRUCT_TRAITS\n";
+        }
 
-        data.resize( count );
+        // constructor
+        if (genConstructors) {
+            if (data.isStruct()) {
+                gen(output, cfg.gen.structConstructors, [&](auto &output) {
+                    bool const hasProxy = generateStructConstructor(output, data, false);
 
-        pfn(std::forward<Args>(args)..., &count, std::bit_cast<V*>(data.data()));
+                    if (hasProxy) {
+                        output += "#  if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )\n";
+                        generateStructConstructor(output, data, true);
+                        output += "#  endif // VULKAN_HPP_DISABLE_ENHANCED_MODE \n";
+                    }
 
-        if (count < data.size()) {
-            data.resize( count );
-        }
+                    // TODO
+                    // OutputBuffer x;
 
-        return data;
-    }
+                    // genFunction(x, "", data.name, std::move(std::string("")));
 
-    template<typename T, typename V, typename S, typename PFN, typename... Args>
-    inline typename ResultValueType<std::vector<T>>::type createArray(const PFN pfn, const char *const msg, Args&&... args) {
-        std::vector<T> data;
-        S count;
-        VkResult result;
+                    // copy constuctor
+                    output += vkgen::format(R"(
+{1} {0}( {0} const & rhs ) {2} = default;
 
-        do {
-          result = pfn(std::forward<Args>(args)..., &count, nullptr);
-          if (result == VK_SUCCESS && count) {
-            data.resize( count );
-            result = pfn(std::forward<Args>(args)..., &count, std::bit_cast<V*>(data.data()));
-          }
-        } while (result == VK_INCOMPLETE);
+)",
+                                            data.name,
+                                            m_constexpr14,
+                                            m_noexcept);
+                    {
+                        // C style copy constuctor
+                        FunctionGenerator fun(*this, "", data.name);
+                        fun.className         = data.name;
+                        fun.optionalProtect   = Protect{ "VULKAN_HPP_NO_STRUCT_CONSTRUCTORS", false };
+                        fun.specifierNoexcept = true;
+                        fun.add("Vk" + data.name + " const &", "rhs");
+                        fun.addInit(data.name, "*reinterpret_cast<" + data.name + " const *>( &rhs )");
+                        output += fun.generate(outputFuncs);
+                    }
+                    if (useUninitializedStructs()) {
+                        // arrays and nested structs are forwarded the tag, scalars are left out
+                        FunctionGenerator fun(*this, "", data.name);
+                        fun.className         = data.name;
+                        fun.base              = &data;
+                        fun.optionalProtect   = Protect{ "VULKAN_HPP_NO_STRUCT_CONSTRUCTORS", false };
+                        fun.specifierExplicit = true;
+                        fun.specifierNoexcept = true;
+                        fun.add(m_ns + "::uninitialized_t", "");
+                        for (const auto &m : data.members) {
+                            if (m->isPointer()) {
+                                continue;
+                            }
+                            const bool array1D = m->hasArrayLength() && m->arrayLength(1).empty();
+                            if (array1D || (m->isStruct() && !m->hasArrayLength())) {
+                                fun.addInit(m->identifier(), m_ns + "::uninitialized");
+                            }
+                        }
+                        output += fun.generate(outputFuncs);
+                    }
+                });
+            } else {
+                gen(output, cfg.gen.unionConstructors, [&](auto &output) {
+                    std::map<std::string, uint8_t> types;
+                    for (const auto &m : data.members) {
+                        auto it = types.find(m->type());
+                        if (it != types.end()) {
+                            it->second++;
+                            continue;
+                        }
+                        types.emplace(m->type(), 1);
+                    }
 
-        resultCheck(static_cast<Result>(result), msg);
-        if (count < data.size()) {
-            data.resize( count );
-        }
+                    bool first = true;
+                    for (const auto &m : data.members) {
+                        if (m->original.type() == "VkBool32") {
+                            continue;
+                        }
+                        const auto &type = m->type();
+                        std::string id   = m->identifier();
 
-        return createResultValueType(static_cast<Result>(result), data);
-    }
+                        auto it = types.find(type);
+                        // multiple same types, generate only once
+                        if (it != types.end()) {
+                            if (it->second == 0) {
+                                continue;
+                            }
+                            if (it->second > 1) {
+                                it->second = 0;
+                                id         = strFirstLower(type);
+                            }
+                        }
 
-  }  // namespace internal
+                        VariableData var = *m;
+                        var.setIdentifier(id + "_");
+                        id = m->identifier();
 
-)";
+                        std::string arg = var.toString(*this);
+                        std::string assignment;
+                        if (first) {
+                            assignment = " = {}";
+                            first      = false;
+                        }
+                        output += vkgen::format(R"(
+{5} {0}({1}{2}) : {3}( {4} ) {{}}
+            )",
+                                                data.name,
+                                                arg,
+                                                assignment,
+                                                id,
+                                                var.identifier(),
+                                                m_constexpr14);
+                    }
+                });
+            }
         }
 
-        if (cfg.gen.smartHandles->enabled()) {
-            generateUniqueHandles(output_smart);
-
-            output += "#ifndef  VULKAN_HPP_NO_SMART_HANDLE\n";
-            output += "#include \"" + out.getFilename("_smart") + "\"\n";
-            output += "#endif // VULKAN_HPP_NO_SMART_HANDLE\n";
-        }
+        if (genSetters || genSettersProxy) {
+            const auto &define = data.isStruct() ? cfg.gen.structSetters : cfg.gen.unionSetters;
+            gen(output, define, [&](auto &output) {
+                if (genSetters) {
+                    for (const auto &m : data.members) {
+                        if (m->type() == "StructureType") {
+                            continue;
+                        }
 
-        if (!cfg.gen.expApi && !cfg.gen.globalMode) {
-            // static commands
-            const Handle   empty{ *this };
-            GuardedOutput decl;
-            for (auto &c : staticCommands) {
-                ClassCommand d{ this, &empty, c };
-                MemberGenerator g{ *this, d, decl, outputFuncs, true };
-                g.generate();
-            }
-            std::stringstream str;
-            decl.write(str);
-            output += std::move(str.str());
-        }
+                        const auto &id   = m->identifier();
 
-        for (Handle &h : handles.ordered) {
-            if (cfg.gen.onlyC && h.isSubclass) {
-                continue;
-            }
-            // std::cout << "gen class " << e.name << '\n';
-            // if (!cfg.gen.globalMode && cfg.gen.expApi && !h.isSubclass) {
-            if ((cfg.gen.globalMode || cfg.gen.expApi) && !h.isSubclass) {
-                generateClassWithPFN(output, h);
-            } else {
-                genPlatform(output, h, [&](auto &output) { generateClass(output, h, false); });
-            }
-        }
+                        FunctionGenerator fun(*this, data.name + "&", "set" + strFirstUpper(id));
+                        fun.className = data.name;
+                        fun.base = &data;
+                        fun.optionalProtect = Protect{define.data.define, false};
+                        fun.specifierNoexcept = true;
+                        fun.specifierConstexpr14 = true;
 
-        // if (!cfg.gen.cppModules) {
-        output += endNamespace();
-        // }
+                        fun.add(m->fullType(*this), m->identifier() + "_");
+                        fun.code = vkgen::format(R"(
+      {0} = {0}_;
+      return *this;
+)",
+                                                       id);
 
-        if (verbose) {
-            std::cout << "gen handles done" << '\n';
-        }
-    }
+                        output += fun.generate(outputFuncs);
+                    }
+                }
 
-    static std::string getDeleter(const Handle &h, const std::string_view parent, const std::string &dispatch) {
-        if (h.name == "CommandBuffer") {
-            return "PoolFree<" + std::string(parent) + ", CommandPool" + dispatch + ">";
-        }
-        if (h.name == "DescriptorSet") {
-            return "PoolFree<" + std::string(parent) + ", DescriptorPool" + dispatch + ">";
-        }
-        std::string output;
-        switch (h.creationCat) {
-            case Handle::CreationCategory::ALLOCATE:
-                output += "ObjectFree<";
-                break;
-            case vkr::Handle::CreationCategory::CREATE:
-                output +=  "ObjectDestroy<";
-                break;
-            default:
-                break;
-        }
-        output += parent;
-        output += dispatch;
-        output += ">";
-        return output;
-    }
+                bool hasArrayMember = false;
+                // arrayproxy setters
+                if (genSettersProxy) {
+                    for (const auto &m : data.members) {
+                        if (m->hasLengthVar()) {
+                            hasArrayMember   = true;
+                            auto        var  = VariableData(*m);
+                            std::string name = var.identifier();
+                            // name conversion
+                            if (name.size() >= 3 && name.starts_with("pp") && (bool)std::isupper(name[2])) {
+                                name = name.substr(1);
+                            } else if (name.size() >= 2 && name.starts_with("p") && (bool)std::isupper(name[1])) {
+                                name = name.substr(1);
+                            }
+                            name = strFirstUpper(name);
 
-    void Generator::generateUniqueHandles(OutputBuffer &output) {
+                            var.setIdentifier(m->identifier() + "_");
+                            var.removeLastAsterisk();
 
-        // output += "#ifndef  VULKAN_HPP_NO_SMART_HANDLE\n";
-        for (Handle const &e : handles.ordered) {
-            if (e.uniqueVariant()) {
-                if (cfg.gen.globalMode && !e.isSubclass) {
-                    continue;
-                }
-                genOptional(output, e, [&](auto &output) {
-                    std::string templ;
-                    std::string templType;
-                    if (!cfg.gen.expApi) {
-                        output += "  template <typename Dispatch>";
-                        templ     = ", Dispatch";
-                        templType = ", VULKAN_HPP_DEFAULT_DISPATCHER_TYPE";
-                    } else {
-                        output += "  template <>";
-                    }
+                            FunctionGenerator fun(*this, data.name + "&", "set" + name);
+                            fun.className = data.name;
+                            fun.base = &data;
+                            fun.optionalProtect = Protect{define.data.define, false};
+                            fun.specifierNoexcept = true;
+                            fun.specifierConstexpr14 = true;
 
-                    std::string_view parent = e.isSubclass ? std::string_view(e.superclass) : "NoParent";
-                    output += vkgen::format(R"(
-  class UniqueHandleTraits<{0}{1}>
-  {{
-  public:
-    using deleter = {3};
-  }};
+                            std::string const id = m->identifier();
+                            std::string       modif;
+                            if (var.original.type() == "void" && !var.original.isConstSuffix()) {
+                                // output += "    template <typename DataType>\n";
+                                fun.additonalTemplate = "typename DataType";
+                                var.setType("DataType");
+                                modif = " * sizeof(DataType)";
+                            }
 
-  using Unique{0} = UniqueHandle<{0}{2}>;
+                            fun.add("ArrayProxyNoTemporaries<" + var.fullType(*this) + "> const &", var.identifier());
 
+                            fun.code = vkgen::format(R"(
+  {1} = static_cast<uint32_t>({0}.size(){3});
+  {2} = {0}.data();
+  return *this;
 )",
-                                            e.name,
-                                            templ,
-                                            templType,
-                                            getDeleter(e, parent, templ));
-                });
-            }
-        }
-        // output += "#endif // VULKAN_HPP_NO_SMART_HANDLE\n";
-    }
+                                                 var.identifier(),
+                                                 m->getLengthVar()->identifier(),
+                                                 m->identifier(),
+                                                 modif);
 
-    std::string Generator::generateStructsInclude() const {
-        std::string out =  "#include <cstring>  // strcmp\n";
-        return out;
-    }
 
-    void Generator::generateStructs(OutputBuffer &output, bool exp) {
-        output += "#include \"vulkan_hpp_macros.hpp\"\n";
-        if (cfg.gen.globalMode && cfg.gen.structMock < 5) {
-            output += "#include \"vulkan_enums.hpp\"\n";
-        }
-        output += "#include \"vulkan_structs_forward.hpp\"\n";
-        if (!cfg.gen.globalMode) {
-            output += R"(
-#ifndef VULKAN_HPP_NO_STRUCT_COMPARE
-#if defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
-#  include <compare>
-#endif
-#endif
-)";
-            if (!exp) {
-                output += "\n";
-                if (cfg.gen.importStdMacro) {
-                    output += R"(
-#include <string.h> // TODO
-#ifndef USE_IMPORT_STD
-#  ifndef VULKAN_HPP_NO_STRUCT_COMPARE
-#    include <cstring>  // strcmp
-#  endif // VULKAN_HPP_NO_STRUCT_COMPARE
-#endif
-)";
-                } else {
-                    gen(output, cfg.gen.structCompare, [&](auto &output) { output += generateStructsInclude(); });
+                            output += fun.generate(outputFuncs);
+
+                        }
+                    }
                 }
-                output += "\n";
-            }
-        }
-        output += beginNamespace();
-        for (const Struct &e : structs.ordered) {
-            genPlatform(output, e, [&](auto &output) { generateStruct(output, e, exp); });
+            });
         }
 
-//        if (cfg.gen.globalMode) {
-//            output += "#ifndef VULKAN_HPP_NO_STRUCT_CHAIN\n";
-//            generateStructChains(output);
-//            output += "#endif // VULKAN_HPP_NO_STRUCT_CHAIN\n";
-//        }
+        if (data.isStruct()) {
+            if (cfg.gen.structMock > 0) {
+                output += "#ifndef VULKAN_HPP_NO_STRUCT_ASSIGNMENT\n";
+            }
+            output += vkgen::format(R"(
+    {0} & operator=({0} const &rhs) VULKAN_HPP_NOEXCEPT = default;
 
-        output += endNamespace();
-    }
+    {0} & operator=({1} const &rhs) VULKAN_HPP_NOEXCEPT {{
+      *this = *reinterpret_cast<{2}::{0} const *>(&rhs);
+      return *this;
+    }}
+)",
+            data.name,
+            data.name.original,
+            m_ns);
 
-    void Generator::generateArrays(GenOutput &files, OutputBuffer &parent) {
-        OutputBuffer output;
-        if (cfg.gen.globalMode) {
-            output += "#include \"vulkan.h\"\n";
-            output += "#include \"vulkan_hpp_macros.hpp\"\n";
+            if (cfg.gen.structMock > 0) {
+                output += "#endif // VULKAN_HPP_NO_STRUCT_ASSIGNMENT\n";
+            }
         }
-        output += beginNamespace();
-        output += RES_ARRAY_PROXY;
-        // PROXY TEMPORARIES
-        if (!cfg.gen.globalMode) {
-            output += RES_ARRAY_WRAPPER;
+        if (cfg.gen.structMock > 0) {
+            output += "#ifndef VULKAN_HPP_NO_STRUCT_CONVERT\n";
         }
-        output += endNamespace();
-        generateUnit("vulkan_array.hpp", files, parent, std::move(output));
-    }
+        output += vkgen::format(R"(
 
-    void Generator::generateVector(GenOutput &files, OutputBuffer &parent) {
-        if (!cfg.gen.functionsVecAndArray) {
-            return;
-        }
-        OutputBuffer output;
-        if (cfg.gen.globalMode) {
-            output += R"(
-#include <memory>
-#include <stdexcept>
-#include <type_traits>
-#include "vulkan_hpp_macros.hpp"
-)";
-        }
-        output += beginNamespace();
-        output += RES_VECTOR;
-        output += endNamespace();
-        generateUnit("vulkan_vector.hpp", files, parent, std::move(output));
-    }
+    operator {1} const &() const VULKAN_HPP_NOEXCEPT {{
+      return *reinterpret_cast<const {1} *>(this);
+    }}
 
-    void Generator::generateStructChain(GenOutput &files, OutputBuffer &parent) {
-        OutputBuffer output;
+    explicit operator {1}&() VULKAN_HPP_NOEXCEPT {{
+      return *reinterpret_cast<{1} *>(this);
+    }}
 
-        bool cstyle = false; // cfg.gen.globalMode
+)",
+        data.name,
+        data.name.original);
+        if (cfg.gen.structMock > 0) {
+            output += "#endif // VULKAN_HPP_NO_STRUCT_CONVERT\n";
+        }
 
-        output += beginNamespaceStandalone();
-        if (cstyle) {
-            output += R"(
-  template <typename Type>
-  struct structureType
-  {
-    static VULKAN_HPP_CONST_OR_CONSTEXPR VkStructureType value = VK_STRUCTURE_TYPE_APPLICATION_INFO;
-  };
-)";
+        if (cfg.gen.structMock > 0) {
+            output += "#ifndef VULKAN_HPP_NO_REFLECT\n";
         }
+        if (!cfg.gen.globalMode) {
+            gen(output, cfg.gen.structReflect, [&](auto &output) {
+                ArgumentBuilder types{ false };
+                ArgumentBuilder tie{ false };
+                for (const auto &m : data.members) {
+                    types.append(m->fullType(*this), "");
+                    tie.append("", m->identifier());
+                }
 
-        output += R"(
+                std::string type = vkgen::format(R"(
+#  if 14 <= VULKAN_HPP_CPP_VERSION
+    auto
+#  else
+    std::tuple<{0}>
+#  endif
+)",
+                                                 types.string());
 
-template <typename X, typename Y>
-  struct StructExtends
-  {
-    enum
-    {
-      value = false
-    };
-  };
+                FunctionGenerator fun(*this, type, "reflect");
+                fun.className         = data.name;
+                fun.base              = &data;
+                fun.optionalProtect   = Protect{ "VULKAN_HPP_USE_REFLECT", true };
+                fun.specifierNoexcept = true;
+                fun.specifierConst    = true;
+                fun.code              = "      return std::tie(" + tie.string() + ");\n";
 
-  template <typename Type, class...>
-  struct IsPartOfStructureChain
-  {
-    static const bool valid = false;
-  };
+                output += fun.generate(outputFuncs);
+            });
+        }
+        if (cfg.gen.structMock > 0) {
+            output += "#endif // VULKAN_HPP_NO_REFLECT\n";
+        }
 
-  template <typename Type, typename Head, typename... Tail>
-  struct IsPartOfStructureChain<Type, Head, Tail...>
-  {
-    static const bool valid = std::is_same<Type, Head>::value || IsPartOfStructureChain<Type, Tail...>::valid;
-  };
+        std::string comp;
+        for (const auto &m : data.members) {
+            const std::string &id = m->identifier();
+            comp += "( " + id + " == rhs." + id +
+                    ")"
+                    " && ";
+        }
+        strStripSuffix(comp, " && ");
 
-  template <size_t Index, typename T, typename... ChainElements>
-  struct StructureChainContains
-  {
-    static const bool value = std::is_same<T, typename std::tuple_element<Index, std::tuple<ChainElements...>>::type>::value ||
-                              StructureChainContains<Index - 1, T, ChainElements...>::value;
-  };
+        if (genCompareOperators) {
 
-  template <typename T, typename... ChainElements>
-  struct StructureChainContains<0, T, ChainElements...>
-  {
-    static const bool value = std::is_same<T, typename std::tuple_element<0, std::tuple<ChainElements...>>::type>::value;
-  };
+            // hardcoded types from https://github.com/KhronosGroup/Vulkan-Hpp/blob/main/VulkanHppGenerator.cpp
+            static const std::set<std::string> simpleTypes = { "char",   "double",  "DWORD",    "float",    "HANDLE",   "HINSTANCE", "HMONITOR",
+                                                               "HWND",   "int",     "int8_t",   "int16_t",  "int32_t",  "int64_t",   "LPCWSTR",
+                                                               "size_t", "uint8_t", "uint16_t", "uint32_t", "uint64_t", "void" };
 
-  template <size_t Index, typename... ChainElements>
-  struct StructureChainValidation
-  {
-    using TestType          = typename std::tuple_element<Index, std::tuple<ChainElements...>>::type;
-    static const bool valid = StructExtends<TestType, typename std::tuple_element<0, std::tuple<ChainElements...>>::type>::value &&
-                              ( /*TestType::allowDuplicate ||*/ !StructureChainContains<Index - 1, TestType, ChainElements...>::value ) &&
-                              StructureChainValidation<Index - 1, ChainElements...>::valid;
-  };
+            std::string prefix;
+            std::string compareMembers;
+            std::string spaceshipMembers;
+            bool        nonDefaultCompare = false;
+            std::string ordering;
+            if (data.containsFloatingPoints) {
+                ordering = "std::partial_ordering";
+            } else {
+                ordering = "std::strong_ordering";
+            }
 
-  template <typename... ChainElements>
-  struct StructureChainValidation<0, ChainElements...>
-  {
-    static const bool valid = true;
-  };
+            for (const auto &m : data.members) {
+                const auto &id   = m->identifier();
+                const auto &type = m->original.type();
+                if (m->getNamespace() != Namespace::VK && simpleTypes.find(type) == simpleTypes.end() && enums.find(type) == enums.end()) {
+                    nonDefaultCompare = true;
 
-  template <typename... ChainElements>
-  class StructureChain : public std::tuple<ChainElements...>
-  {
-  public:
-    StructureChain() VULKAN_HPP_NOEXCEPT
-    {
-      static_assert( StructureChainValidation<sizeof...( ChainElements ) - 1, ChainElements...>::valid, "The structure chain is not valid!" );
-)";
-        if (cstyle) {
-            output += R"(      init<sizeof...( ChainElements ) - 1>();
-)";
-        }
+                    compareMembers += prefix + vkgen::format("( memcmp( &{0}, &rhs.{0}, sizeof( {1} ) ) == 0 )", id, type);
 
-        output += R"(
-      link<sizeof...( ChainElements ) - 1>();
-    }
+                    spaceshipMembers += "      if ( auto cmp = memcmp( &" + id + ", &rhs." + id + ", sizeof( " + type + " ) ); cmp != 0 )\n";
+                    spaceshipMembers += "        return ( cmp < 0 ) ? " + ordering + "::less : " + ordering + "::greater;\n";
+                } else if (type == "char" && !m->getLenAttrib().empty()) {
+                    nonDefaultCompare = true;
 
-    StructureChain( StructureChain const & rhs ) VULKAN_HPP_NOEXCEPT : std::tuple<ChainElements...>( rhs )
-    {
-      static_assert( StructureChainValidation<sizeof...( ChainElements ) - 1, ChainElements...>::valid, "The structure chain is not valid!" );
-      link( &std::get<0>( *this ),
-            &std::get<0>( rhs ),
-            reinterpret_cast<VkBaseOutStructure *>( &std::get<0>( *this ) ),
-            reinterpret_cast<VkBaseInStructure const *>( &std::get<0>( rhs ) ) );
-    }
+                    if (m->lenExpressions.size() == 1) {
+                        compareMembers += prefix + vkgen::format("( ( {0} == rhs.{0} ) || ( strcmp( {0}, rhs.{0} ) == 0 ) )", id, type);
 
-    StructureChain( StructureChain && rhs ) VULKAN_HPP_NOEXCEPT : std::tuple<ChainElements...>( std::forward<std::tuple<ChainElements...>>( rhs ) )
-    {
-      static_assert( StructureChainValidation<sizeof...( ChainElements ) - 1, ChainElements...>::valid, "The structure chain is not valid!" );
-      link( &std::get<0>( *this ),
-            &std::get<0>( rhs ),
-            reinterpret_cast<VkBaseOutStructure *>( &std::get<0>( *this ) ),
-            reinterpret_cast<VkBaseInStructure const *>( &std::get<0>( rhs ) ) );
-    }
+                        spaceshipMembers += "     if ( " + id + " != rhs." + id + " )\n";
+                        spaceshipMembers += "        if ( auto cmp = strcmp( " + id + ", rhs." + id + " ); cmp != 0 )\n";
+                        spaceshipMembers += "          return ( cmp < 0 ) ? " + ordering + "::less : " + ordering + "::greater;\n";
+                    } else {
 
-    StructureChain( ChainElements const &... elems ) VULKAN_HPP_NOEXCEPT : std::tuple<ChainElements...>( elems... )
-    {
-      static_assert( StructureChainValidation<sizeof...( ChainElements ) - 1, ChainElements...>::valid, "The structure chain is not valid!" );
-      link<sizeof...( ChainElements ) - 1>();
-    }
+                        compareMembers += prefix + vkgen::format("std::equal( {1}, {1} + {0}, rhs.{1}", m->lenExpressions[0], id);
+                        compareMembers += ", []( char const * left, char const * right ) { return ( left == right ) || ( strcmp( left, right ) == 0 ); } )";
+
+                        constexpr auto spaceshipMemberTemplate =
+                          R"(      for ( size_t i = 0; i < {0}; ++i )
+      {{
+        if ( {1}[i] != rhs.{1}[i] )
+          if ( auto cmp = strcmp( {1}[i], rhs.{1}[i] ); cmp != 0 )
+            return cmp < 0 ? {2}::less : {2}::greater;
+      }}
+)";
+                        spaceshipMembers += vkgen::format(spaceshipMemberTemplate, m->lenExpressions[0], id, ordering);
+                    }
+                } else if (cfg.gen.globalMode && m->hasArrayLength()) {
+                    // global mode members are plain C arrays
+                    compareMembers += prefix + vkgen::format("( memcmp( {0}, rhs.{0}, sizeof( {0} ) ) == 0 )", id);
+                } else {
+                    compareMembers += prefix + "( " + id + " == rhs." + id + " )";
+                    spaceshipMembers += "      if ( auto cmp = " + id + " <=> rhs." + id + "; cmp != 0 ) return cmp;\n";
+                }
+                prefix = "\n          && ";
+            }
 
-    StructureChain & operator=( StructureChain const & rhs ) VULKAN_HPP_NOEXCEPT
-    {
-      std::tuple<ChainElements...>::operator=( rhs );
-      link( &std::get<0>( *this ),
-            &std::get<0>( rhs ),
-            reinterpret_cast<VkBaseOutStructure *>( &std::get<0>( *this ) ),
-            reinterpret_cast<VkBaseInStructure const *>( &std::get<0>( rhs ) ) );
-      return *this;
-    }
+            std::string compareBody, spaceshipOperator;
+            const bool  useSpaceship = cfg.gen.spaceshipOperator && !containsFuncPointer(data) && !(cfg.gen.globalMode && nonDefaultCompare);
+            if (nonDefaultCompare) {
+                compareBody = "      return " + compareMembers + ";";
+                if (useSpaceship) {
+                    constexpr auto spaceshipOperatorTemplate =
+                      R"(    {2} operator<=>( {0} const & rhs ) const VULKAN_HPP_NOEXCEPT /*X*/
+    {{
+{1}
+      return {2}::equivalent;
+    }}
+)";
 
-    // StructureChain & operator=( StructureChain && rhs ) = delete;
+                    spaceshipOperator = vkgen::format(spaceshipOperatorTemplate, data.name, spaceshipMembers, ordering);
+                }
+            } else if (cfg.gen.globalMode) {
+                // aggregates without reflect(), compared member by member including C arrays
+                spaceshipOperator = useSpaceship ? "    auto operator<=>( " + data.name + " const & ) const = default;"
+                                                 : "    bool operator==( " + data.name + " const & ) const = default;";
+            } else {
+                constexpr auto compareBodyTemplate =
+                  R"(#if defined( VULKAN_HPP_USE_REFLECT )
+      return this->reflect() == rhs.reflect();
+#else
+      return {0};
+#endif // VULKAN_HPP_USE_REFLECT
+)";
+                compareBody = vkgen::format(compareBodyTemplate, compareMembers);
 
-    template <typename T = typename std::tuple_element<0, std::tuple<ChainElements...>>::type, size_t Which = 0>
-    T & get() VULKAN_HPP_NOEXCEPT
-    {
-      return std::get<ChainElementIndex<0, T, Which, void, ChainElements...>::value>( static_cast<std::tuple<ChainElements...> &>( *this ) );
-    }
+                if (useSpaceship) {
+                    spaceshipOperator = "    auto operator<=>( " + data.name + " const & ) const = default;";
+                }
+            }
 
-    template <typename T = typename std::tuple_element<0, std::tuple<ChainElements...>>::type, size_t Which = 0>
-    T const & get() const VULKAN_HPP_NOEXCEPT
-    {
-      return std::get<ChainElementIndex<0, T, Which, void, ChainElements...>::value>( static_cast<std::tuple<ChainElements...> const &>( *this ) );
-    }
+            gen(output, cfg.gen.structCompare, [&](auto &output) {
+                if (cfg.gen.globalMode && !nonDefaultCompare) {
+                    output += spaceshipOperator + "\n";
+                    return;
+                }
+                if (!spaceshipOperator.empty()) {
+                    output += "#  if defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )\n";
 
-    template <typename T0, typename T1, typename... Ts>
-    std::tuple<T0 &, T1 &, Ts &...> get() VULKAN_HPP_NOEXCEPT
-    {
-      return std::tie( get<T0>(), get<T1>(), get<Ts>()... );
-    }
+                    if (nonDefaultCompare) {
+                        FunctionGenerator fun(*this, ordering, "operator<=>");
+                        fun.className         = data.name;
+                        fun.base              = &data;
+                        fun.optionalProtect   = Protect{ "VULKAN_HPP_USE_SPACESHIP_OPERATOR", true }; // workaround
+                        fun.specifierNoexcept = true;
+                        fun.specifierConst = true;
+                        fun.code = vkgen::format(R"(
+{0}
+      return {1}::equivalent;
+)",                                 spaceshipMembers, ordering);
 
-    template <typename T0, typename T1, typename... Ts>
-    std::tuple<T0 const &, T1 const &, Ts const &...> get() const VULKAN_HPP_NOEXCEPT
-    {
-      return std::tie( get<T0>(), get<T1>(), get<Ts>()... );
-    }
+                        fun.add(data.name + " const &", "rhs");
+                        output += fun.generate(outputFuncs);
+                    }
+                    else {
+                        output += spaceshipOperator + "\n";
+                    }
 
-    template <typename ClassType, size_t Which = 0>
-    typename std::enable_if<std::is_same<ClassType, typename std::tuple_element<0, std::tuple<ChainElements...>>::type>::value && ( Which == 0 ), bool>::type
-      isLinked() const VULKAN_HPP_NOEXCEPT
-    {
-      return true;
-    }
+                    output += "#  else\n";
+                }
 
-    template <typename ClassType, size_t Which = 0>
-    typename std::enable_if<!std::is_same<ClassType, typename std::tuple_element<0, std::tuple<ChainElements...>>::type>::value || ( Which != 0 ), bool>::type
-      isLinked() const VULKAN_HPP_NOEXCEPT
-    {
-      static_assert( IsPartOfStructureChain<ClassType, ChainElements...>::valid, "Can't unlink Structure that's not part of this StructureChain!" );
-      return isLinked( reinterpret_cast<VkBaseInStructure const *>( &get<ClassType, Which>() ) );
-    }
+                {
+                    FunctionGenerator fun(*this, "bool", "operator==");
+                    fun.className         = data.name;
+                    fun.base              = &data;
+                    fun.optionalProtect   = Protect{ "VULKAN_HPP_HAS_SPACESHIP_OPERATOR", false };
+                    fun.specifierNoexcept = true;
+                    fun.specifierConst = true;
 
-    template <typename ClassType, size_t Which = 0>
-    typename std::enable_if<!std::is_same<ClassType, typename std::tuple_element<0, std::tuple<ChainElements...>>::type>::value || ( Which != 0 ), void>::type
-      relink() VULKAN_HPP_NOEXCEPT
-    {
-      static_assert( IsPartOfStructureChain<ClassType, ChainElements...>::valid, "Can't relink Structure that's not part of this StructureChain!" );
-      auto pNext = reinterpret_cast<VkBaseInStructure *>( &get<ClassType, Which>() );
-      VULKAN_HPP_ASSERT( !isLinked( pNext ) );
-      auto & headElement = std::get<0>( static_cast<std::tuple<ChainElements...> &>( *this ) );
-      pNext->pNext       = reinterpret_cast<VkBaseInStructure const *>( headElement.pNext );
-      headElement.pNext  = pNext;
-    }
+                    fun.add(data.name + " const &", "rhs");
+                    fun.code = compareBody;
+                    output += fun.generate(outputFuncs);
+                }
+                {
+                    FunctionGenerator fun(*this, "bool", "operator!=");
+                    fun.className         = data.name;
+                    fun.base              = &data;
+                    fun.optionalProtect   = Protect{ "VULKAN_HPP_HAS_SPACESHIP_OPERATOR", false };
+                    fun.specifierNoexcept = true;
+                    fun.specifierConst = true;
 
-    template <typename ClassType, size_t Which = 0>
-    typename std::enable_if<!std::is_same<ClassType, typename std::tuple_element<0, std::tuple<ChainElements...>>::type>::value || ( Which != 0 ), void>::type
-      unlink() VULKAN_HPP_NOEXCEPT
-    {
-      static_assert( IsPartOfStructureChain<ClassType, ChainElements...>::valid, "Can't unlink Structure that's not part of this StructureChain!" );
-      unlink( reinterpret_cast<VkBaseOutStructure const *>( &get<ClassType, Which>() ) );
-    }
+                    fun.add(data.name + " const &", "rhs");
+                    fun.code = "      return !operator==( rhs );\n";
+                    output += fun.generate(outputFuncs);
+                }
 
-  private:
-    template <int Index, typename T, int Which, typename, class First, class... Types>
-    struct ChainElementIndex : ChainElementIndex<Index + 1, T, Which, void, Types...>
-    {
-    };
+                if (!spaceshipOperator.empty()) {
+                    output += "#  endif\n";
+                }
+            });
+        }
 
-    template <int Index, typename T, int Which, class First, class... Types>
-    struct ChainElementIndex<Index, T, Which, typename std::enable_if<!std::is_same<T, First>::value, void>::type, First, Types...>
-      : ChainElementIndex<Index + 1, T, Which, void, Types...>
-    {
-    };
+        const bool cstyle = cfg.gen.structMock >= 5;
+        bool cmock = cfg.gen.globalMode; // && cfg.gen.structMock >= 4;
+        for (const auto &m : data.members) {
+            if (data.isStruct()) {
+                std::string assignment = "{}";
+                const auto &type       = m->original.type();
+                if (type == "VkStructureType") {
+                    assignment = structureType.empty() ?
+                                                       (cfg.gen.structMock >= 5? "VK_STRUCTURE_TYPE_APPLICATION_INFO" : "StructureType::eApplicationInfo")
+                                                       : structureType;
+                }
+                if (cfg.gen.structMock >= 2) {
+                    if (cfg.gen.structMock != 3 && (type == "VkStructureType" || m->original.identifier() == "pNext")) {
+                        m->setAssignment(" = " + assignment);
+                    }
+                    else {
+                        assignment = "";
+                        m->setAssignment("");
+                    }
+                }
+                else if (useUninitializedStructs() && type != "VkStructureType" && m->original.identifier() != "pNext") {
+                    // global mode structs are aggregates without constructors, default initialization is the uninitialized one
+                    assignment = "";
+                    m->setAssignment(cfg.gen.globalMode ? "" : " VULKAN_HPP_STRUCT_MEMBER_INITIALIZER");
+                }
+                else {
+                    m->setAssignment(" = " + assignment);
+                }
+                if ((cmock && ((!m->isStructOrUnion() && !m->isEnum() && !m->isHandle()) || m->hasArrayLength())) && !cstyle) {
+                    output += "    " + m->fullType(*this) + "    " + m->identifier() + m->optionalArraySuffix() + m->getNameSuffix();
+                    if (!assignment.empty()) {
+                        output += " = ";
+                        output += assignment;
+                    }
+                    output += ";\n";
+                }
+                else {
+                    output += "    " + m->toStructStringWithAssignment(*this, cstyle) + ";\n";
+                }
 
-    template <int Index, typename T, int Which, class First, class... Types>
-    struct ChainElementIndex<Index, T, Which, typename std::enable_if<std::is_same<T, First>::value, void>::type, First, Types...>
-      : ChainElementIndex<Index + 1, T, Which - 1, void, Types...>
-    {
-    };
+            } else {
+                if ((cmock && (!m->isStruct() && !m->isEnum() || m->hasArrayLength())) && !cstyle) {
+                    output += "    " + m->fullType(*this) + "    " + m->identifier() + m->optionalArraySuffix() + m->getNameSuffix() + ";\n";
+                }
+                else {
+                    output += "    " + m->toStructString(*this, cstyle) + ";\n";
+                }
+            }
+        }
 
-    template <int Index, typename T, class First, class... Types>
-    struct ChainElementIndex<Index, T, 0, typename std::enable_if<std::is_same<T, First>::value, void>::type, First, Types...>
-      : std::integral_constant<int, Index>
-    {
-    };
+        output += "  };\n\n";
 
-    bool isLinked( VkBaseInStructure const * pNext ) const VULKAN_HPP_NOEXCEPT
-    {
-      VkBaseInStructure const * elementPtr =
-        reinterpret_cast<VkBaseInStructure const *>( &std::get<0>( static_cast<std::tuple<ChainElements...> const &>( *this ) ) );
-      while ( elementPtr )
-      {
-        if ( elementPtr->pNext == pNext )
-        {
-          return true;
-        }
-        elementPtr = elementPtr->pNext;
-      }
-      return false;
-    }
-)";
-        if (cstyle) {
-            output += R"(
-    template <size_t Index>
-    void init() VULKAN_HPP_NOEXCEPT
-    {
-        auto &x = std::get<Index>( static_cast<std::tuple<ChainElements...> &>( *this ) );
-        x.sType = vk::structureType<typename std::tuple_element<Index, std::tuple<ChainElements...>>::type>::value;
-        if constexpr (Index != 0) {
-            init<Index - 1>();
-        }
-    }
-)";
+        if (data.isStruct() && !structureType.empty() && !cfg.gen.globalMode) {
+            gen(output, cfg.gen.handleTemplates, [&](auto &output) {
+                output += vkgen::format(R"(
+  template <>
+  struct CppType<StructureType, {0}> {{
+    using Type = {1};
+  }};
+)",
+                                        structureType,
+                                        data.name);
+            });
         }
-        output += R"(
-    template <size_t Index>
-    typename std::enable_if<Index != 0, void>::type link() VULKAN_HPP_NOEXCEPT
-    {
-      auto & x = std::get<Index - 1>( static_cast<std::tuple<ChainElements...> &>( *this ) );
-      x.pNext  = &std::get<Index>( static_cast<std::tuple<ChainElements...> &>( *this ) );
-      link<Index - 1>();
-    }
 
-    template <size_t Index>
-    typename std::enable_if<Index == 0, void>::type link() VULKAN_HPP_NOEXCEPT
-    {
-    }
+        for (const auto &a : data.aliases) {
+            output += "  using " + a.name + " = " + data.name + ";\n";
+        }
 
-    void link( void * dstBase, void const * srcBase, VkBaseOutStructure * dst, VkBaseInStructure const * src )
-    {
-      while ( src->pNext )
-      {
-        std::ptrdiff_t offset = reinterpret_cast<char const *>( src->pNext ) - reinterpret_cast<char const *>( srcBase );
-        dst->pNext            = reinterpret_cast<VkBaseOutStructure *>( reinterpret_cast<char *>( dstBase ) + offset );
-        dst                   = dst->pNext;
-        src                   = src->pNext;
-      }
-      dst->pNext = nullptr;
     }
 
-    void unlink( VkBaseOutStructure const * pNext ) VULKAN_HPP_NOEXCEPT
-    {
-      VkBaseOutStructure * elementPtr = reinterpret_cast<VkBaseOutStructure *>( &std::get<0>( static_cast<std::tuple<ChainElements...> &>( *this ) ) );
-      while ( elementPtr && ( elementPtr->pNext != pNext ) )
-      {
-        elementPtr = elementPtr->pNext;
-      }
-      if ( elementPtr )
-      {
-        elementPtr->pNext = pNext->pNext;
-      }
-      else
-      {
-        VULKAN_HPP_ASSERT( false );  // fires, if the ClassType member has already been unlinked !
-      }
-    }
-  };
+    std::string Generator::generateIncludeRAII(GenOutput &out) const {
+        std::string output;
+        if (cfg.gen.importStdMacro) {
+            output += R"(
+#ifndef USE_IMPORT_STD
 )";
+        }
 
-        generateStructChains(output, false && cfg.gen.globalMode);
-        output += endNamespaceStandalone();
+        output += R"(
+#include <memory>
+#include <vector>
+#include <utility>  // std::exchange, std::forward
+)";
 
-        if (cfg.gen.globalMode) {
+        if (cfg.gen.importStdMacro) {
             output += R"(
-namespace std {
-  template<typename... ChainElements>
-  class tuple_size<vk::StructureChain<ChainElements...>>:public std::integral_constant<std::size_t, sizeof...(ChainElements)>{};
-
-  template<std::size_t I, typename... ChainElements>
-  class tuple_element<I,vk::StructureChain<ChainElements...>>:public tuple_element<I, std::tuple<ChainElements...>>{};
-}
+#endif
 )";
         }
 
-        generateUnit("vulkan_struct_chains.hpp", files, parent, std::move(output));
+        output += vkgen::format(R"(
+#include "{0}"
+#include "{1}"
+)",
+                                out.getFilename(""),
+                                out.getFilename("_raii_forward"));
+
+        return output;
     }
 
-    void Generator::generateStructChains(vkgen::OutputBuffer &output, bool ctype) {
-        GuardedOutput out;
+    void Generator::generateClassWithPFN(OutputBuffer &output, Handle &h) {
+        OutputClass out {
+            .name = h.name
+        };
+        const auto       &name     = out.name;
+        const std::string dispatch = name + "Dispatcher";
+        const auto       &handle   = h.vkhandle.identifier();
 
-        if (ctype) {
-            for (const Struct &s : structs.ordered) {
-                if (s.structTypeValue.empty()) {
-                    continue;
-                }
-                genOptional(output, s, [&](auto &output) {
-                    output += vkgen::format(R"(
-  template <>
-  struct structureType<{0}>
-  {{
-    static VULKAN_HPP_CONST_OR_CONSTEXPR VkStructureType value = {1};
-  }};
-)",
-                                            s.name.original,
-                                            s.structTypeValue.original);
+        generateClassTypeInfo(h, output, out);
 
-                });
+        output += "  class " + name + " {\n";
+        output += "  protected:\n";
+        output += "    Vk" + name + " " + handle + " = {};\n";
+        output += "    " + dispatch + " m_dispatcher = {};\n";
+        output += "  public:\n";
+
+        output += out.sPublic.toString();
+        output += "    explicit " + name + "(std::nullptr_t) VULKAN_HPP_NOEXCEPT {}\n";
+
+        GuardedOutput ctors;
+        // GuardedOutput members{};
+
+        for (auto &d : h.ctorCmds) {
+            MemberContext ctx{ .ns = Namespace::VK };
+            ctx.insertSuperclassVar = true;
+            // ctx.generateInline      = true;
+            ctx.disableDispatch     = true;
+            ctx.exp                 = true;
+            MemberResolverCtor resolver{ *this, d, ctx };
+            if (!resolver.hasDependencies) {
+                std::cout << "[EXP] ctor skipped: class " << h.name
+                          << ", p: "
+                          // parent->type() << ", s: " << superclass
+                          << '\n';
+                continue;
             }
+            resolver.generate(ctors, outputFuncs);
+
+            MemberResolverInit init{ *this, d, ctx };
+            init.generate(ctors, outputFuncs);
+        }
+
+        /*
+        const bool indirect = cfg.gen.classMethods & 2;
+        for (auto &d : h.members) {
+            if (!indirect && d.src->isIndirect()) {
+                continue;
+            }
+            MemberGenerator g{ *this, d, members, outputFuncs };
+            g.generate();
+        }
+        */
+        {
+            std::stringstream temp;
+            ctors.write(temp);  // TODO
+            output += temp.str();
         }
 
+        output += "    " + name + "() = default;\n";
+        output += "    " + name + "(" + name + " const&) = delete;\n";
 
-        for (const Struct &s : structs.ordered) {
+        output += "    " + name + "(" + name + "&& rhs) VULKAN_HPP_NOEXCEPT\n";
 
-            if (s.extends.empty()) {
-                continue;
+        output += "      : " + handle + "(rhs." + handle + "),\n";
+        output += "        m_dispatcher(rhs.m_dispatcher)\n";
+        output += "      {}\n";
+
+        output += "    " + name + "& operator=(" + name + " const &) = delete;\n";
+
+        output += "    " + name + "& operator=(" + name + "&& rhs) VULKAN_HPP_NOEXCEPT\n";
+        output += "    {\n";
+
+        output += "      " + handle + " = rhs." + handle + ";\n";
+        output += "      m_dispatcher = rhs.m_dispatcher;\n";
+        output += "      return *this;\n";
+        output += "    }\n";
+
+        output += "    operator Vk" + name + "() const {\n";
+        output += "      return " + handle + ";\n";
+        output += "    }\n";
+
+        output += "    Vk" + name + " const &operator*() const VULKAN_HPP_NOEXCEPT {\n";
+        output += "      return " + handle + ";\n";
+        output += "    }\n";
+
+        output += "    VULKAN_HPP_INLINE " + dispatch + " const * getDispatcher() const VULKAN_HPP_NOEXCEPT \n";
+        output += "    {\n";
+        output += "      return &m_dispatcher;\n";
+        output += "    }\n";
+        /*
+        if (!h.isSubclass) {
+            std::string src = "m_dispatcher";
+            if (cfg.gen.dispatchTableAsUnique) {
+                src += "->";
+            } else {
+                src += ".";
             }
-            auto p = s.getProtect();
+            output += "    VULKAN_HPP_INLINE PFN_vkVoidFunction getProcAddr(const char* name) const {\n";
+            output += "      return " + src + "vkGet" + name + "ProcAddr(" + handle + ", name);\n";
+            output += "    }\n";
 
-            out.add(s, [&](auto &output) {
-                for (const auto &e : s.extends) {
-                    if (!e->canGenerate()) {
-                        continue;
-                    }
-                    auto p2 = e->getProtect();
-                    // bool bypass = p == p2;
-                    genOptional(output,
-                                  *e,
-                      [&](auto &output) {
+            output += "    template<typename T>\n";
+            output += "    VULKAN_HPP_INLINE T getProcAddr(const char* name) const {\n";
+            output += "      return " + m_cast + "<T>(getProcAddr(name));\n";
+            output += "    }\n";
 
-                          output += "  template <>\n";
-                          output += "  struct StructExtends<";
-                          if (ctype) {
-                              output += e->name.original + ", " + s.name.original;
-                          }
-                          else {
-                              output += e->name + ", " + s.name;
-                          }
-                          // output += ">";
-                          output += R"(>
- {
-   enum
-   {
-     value = true
-   };
- };
+            output += "    template<typename T>\n";
+            output += "    VULKAN_HPP_INLINE T getProcAddr(const std::string& name) const {\n";
+            output += "      return " + m_cast + "<T>(getProcAddr(name.c_str()));\n";
+            output += "    }\n";
+        }
+        */
+        /*
+        {
+            std::stringstream temp;
+            members.write(temp);
+            output += temp.str();  // TODO
+        }
+        */
+        output += "  };\n";
+    }
+
+    void Generator::generateContext(OutputBuffer &output) {
+        if (cfg.gen.integrateVma) {
+            output += "#include <vma/vk_mem_alloc.h>\n";
+        }
+        if (cfg.gen.globalMode) {
+
+            if (cfg.gen.cppStd >= 20) {
+                output += "#include <bit>\n";
+            }
+            if (cfg.gen.functionsVecAndArray) {
+                output += "#include \"vulkan_vector.hpp\"\n";
+            }
+        }
+
+        output += R"(
+#if VULKAN_HPP_ENABLE_DYNAMIC_LOADER_TOOL == 1
+#  if defined( __unix__ ) || defined( __APPLE__ ) || defined( __QNXNTO__ ) || defined( __Fuchsia__ )
+#    include <dlfcn.h>
+#  elif defined( _WIN32 )
+typedef struct HINSTANCE__ * HINSTANCE;
+#    if defined( _WIN64 )
+typedef int64_t( __stdcall * FARPROC )();
+#    else
+typedef int( __stdcall * FARPROC )();
+#    endif
+extern "C" __declspec( dllimport ) HINSTANCE __stdcall LoadLibraryA( char const * lpLibFileName );
+extern "C" __declspec( dllimport ) int __stdcall FreeLibrary( HINSTANCE hLibModule );
+extern "C" __declspec( dllimport ) FARPROC __stdcall GetProcAddress( HINSTANCE hModule, const char * lpProcName );
+#  endif
+#endif
 )";
-                      });
-                }
-            });
+
+        if (cfg.gen.stubDriver) {
+            output += "#include \"vulkan_stub.hpp\"\n";
+        }
+        if (useHostAllocators()) {
+            output += "#include <atomic>\n";
         }
-        output += "#ifndef VULKAN_HPP_NO_STRUCT_EXTENDS\n";
-        output += out.toString();
-        output += "#endif // VULKAN_HPP_NO_STRUCT_EXTENDS\n";
-    }
 
-    bool Generator::generateStructConstructor(OutputBuffer &output, const Struct &data, bool transform) {
+        output += beginNamespace();
+        generateDispatchRAII(output);
+        generateLoader(output, true);
+        output += endNamespace();
 
-        bool               hasProxy = false;
+        if (cfg.gen.globalMode && useHostAllocators()) {
+            // allocator argument default of global wrappers and Instance/Device init, see setDefaultAllocator
+            output += vkgen::format(R"(
+#if !defined( VULKAN_HPP_GLOBAL_DEFAULT_ALLOCATOR_ASSIGNMENT )
+#  define VULKAN_HPP_GLOBAL_DEFAULT_ALLOCATOR_ASSIGNMENT = reinterpret_cast<{0}::AllocationCallbacks const *>( {0}::{1}::getDefaultAllocator() )
+#endif
+)",
+                                    m_ns,
+                                    loader.name);
+        }
+    }
 
-        FunctionGenerator fun(*this, "", data.name);
-        fun.className = data.name;
-        fun.base = &data;
-        fun.optionalProtect = Protect{"VULKAN_HPP_NO_STRUCT_CONSTRUCTORS", false};
-        fun.allowInline = true;
-        fun.specifierConstexpr = !transform;
+    void Generator::generateExperimentalRAII(OutputBuffer &output, GenOutput &out) {
+        output += genNamespaceMacro(cfg.macro.mNamespaceRAII);
+        output += generateIncludeRAII(out);
 
-        VariableData *pNext = nullptr;
+        output += beginNamespace();
+        output += "  " + beginNamespaceRAII(true);
 
-        for (const auto &p : data.members) {
-            std::string id = p->identifier() + "_";
-            std::string type = p->fullType(*this);
+        output += RES_RAII;
 
-            bool const toProxy = transform && p->hasLengthVar() && !p->hasArrayLength();
-            if (p->hasLengthVar() && !p->hasArrayLength()) {
-                hasProxy = true;
-            }
+        generateClassesRAII(output, true);
 
-            if (p->type() == "StructureType") {
-                if (data.name != "BaseOutStructure" && data.name != "BaseInStructure") {
-                    continue;
-                }
+        output += "  " + endNamespaceRAII();
+        output += endNamespace();
+    }
 
-                fun.add(type, id, " = " + m_ns + "::StructureType::eApplicationInfo");
-            } else if (p->identifier() == "pNext") {
+    void Generator::generateRAII(OutputBuffer &output, OutputBuffer &output_forward, GenOutput &out) {
+        output_forward += genNamespaceMacro(cfg.macro.mNamespaceRAII);
 
-                pNext = p.get();
-            } else {
-                if (toProxy) {
-                    VariableData var(*p);
-                    var.removeLastAsterisk();
-                    if (var.type() == "void" && !var.isPointer()) {
-                        var.setType("T");
-                        fun.additonalTemplate = "typename T";
-                    }
-                    fun.add(vkgen::format("{0}::ArrayProxyNoTemporaries<{1}> const &", m_ns, var.fullType(*this)), id);
-                } else {
-                    fun.add(type, id, transform? "" : " = {}");
-                }
-            }
+        output_forward += beginNamespace();
+        output_forward += "  " + beginNamespaceRAII(true);
 
-            std::string const lhs = p->identifier();
-            if (toProxy) {
-                fun.addInit(lhs, id + ".data()");
-            } else {
-                std::string rhs  = id;
-                const auto &vars = p->getArrayVars();
-                if (!vars.empty() && transform) {
-                    rhs = "static_cast<uint32_t>(";
-                    // std::cout << "> array vars: " << vars.size() << std::endl;
-                    for (size_t i = 0; i < vars.size(); ++i) {
-                        const auto        &v  = vars[i];
-                        const std::string &id = v->identifier();
-                        if (i != vars.size() - 1) {
-                            rhs += " !";
-                            rhs += id;
-                            rhs += "_";
-                            rhs += ".empty()? ";
-                            rhs += id;
-                            rhs += "_.size() :\n";
-                        } else {
-                            rhs += id;
-                            rhs += "_.size()";
-                        }
-                        if (v->type() == "void" && !v->isPointer()) {
-                            rhs += " * sizeof(T)";
-                        }
-                    }
-                    rhs += ")";
-                }
-                fun.addInit(lhs, rhs);
-            }
+        output += generateIncludeRAII(out);
+
+        output += "#include \"vulkan_context.hpp\"\n";
+        if (cfg.gen.raii.deferredDestroy && !cfg.gen.expApi) {
+            output += "#include <atomic>\n";
+            output += "#include <new>\n";
         }
-        if (pNext) {
-            fun.add(pNext->fullType(*this), pNext->identifier() + "_", " = nullptr");
+        if ((cfg.gen.raii.deferredDestroy || cfg.gen.raii.commandStream) && !cfg.gen.expApi) {
+            output += "#include <cstring>\n";
+        }
+        if ((cfg.gen.raii.commandStream || cfg.gen.raii.submitBatcher) && !cfg.gen.expApi) {
+            output += "#include <memory>\n";
+        }
+        if (cfg.gen.raii.submitBatcher && !cfg.gen.expApi) {
+            output += "#include <atomic>\n";
+        }
+        if (cfg.gen.raii.memoizedQueries && !cfg.gen.expApi) {
+            output += "#include <atomic>\n";
+            output += "#include <mutex>\n";
+        }
+        if (cfg.gen.raii.hostAllocators && cfg.gen.allocatorParam && !cfg.gen.expApi) {
+            output += "#include <atomic>\n";
+            output += "#include <cstdlib>\n";
+            output += "#include <mutex>\n";
         }
 
-        output += fun.generate(outputFuncs);
-
-        return hasProxy;
-    }
-
-    void Generator::generateStruct(OutputBuffer &output, const Struct &data, bool exp) {
+        output += beginNamespace();
+        output += "  " + beginNamespaceRAII();
 
-        bool genSetters          = data.hasStructType() && !data.returnedonly;
-        bool genSettersProxy     = genSetters;
-        bool genCompareOperators = data.isStruct();
-        bool genConstructors = true;
+        output += RES_RAII;
 
-        if (cfg.gen.globalMode) {
-            genSetters = false;
-            genSettersProxy = false;
-            genCompareOperators = false;
-            genConstructors = false;
+        if (cfg.gen.raii.deferredDestroy && !cfg.gen.expApi) {
+            output += RES_RETIRE_QUEUE;
         }
 
-        std::string structureType;
-
-        if (!data.structTypeValue.empty()) {
-            if (cfg.gen.structMock >= 5) {
-                structureType = data.structTypeValue.original;
-            }
-            else {
-                structureType = "StructureType::" + data.structTypeValue;
-            }
-        }
+        if (cfg.gen.raii.hostAllocators && cfg.gen.allocatorParam && !cfg.gen.expApi) {
+            output += vkgen::format(R"(
+  // allocator argument default of constructors and create functions, see {0}::setDefaultAllocator
+  VULKAN_HPP_INLINE AllocationCallbacks const * defaultAllocator() VULKAN_HPP_NOEXCEPT
+  {{
+    return reinterpret_cast<AllocationCallbacks const *>( {0}::getDefaultAllocator() );
+  }}
 
-        if (!cfg.gen.globalMode) {
-            for (const auto &m : data.members) {
-                if (data.isStruct()) {
-                    const auto &type = m->original.type();
-                    const auto &s    = structs.find(type);
-                    if (s != structs.end()) {
-                        if (s->isUnion()) {
-                            genCompareOperators = false;
-                        }
-                    }
-                }
-                if (m->hasArrayLength()) {
-                    m->setSpecialType(VariableData::TYPE_ARRAY);
-                }
-            }
+#if !defined( VULKAN_HPP_RAII_DEFAULT_ALLOCATOR_ASSIGNMENT )
+#  define VULKAN_HPP_RAII_DEFAULT_ALLOCATOR_ASSIGNMENT = defaultAllocator()
+#endif
+)",
+                                    loader.name);
+            output += RES_HOST_ALLOCATORS;
         }
 
-        output += "  " + data.metaTypeDeclaration() + " " + data.name + " {\n";
-        if (cfg.gen.structMock > 0) {
-            output += "#ifndef VULKAN_HPP_NO_STRUCT_TRAITS\n";
-        }
-        output += "    using NativeType = " + data.name.original + ";\n";
-        if (data.isStruct()) {
-            if (!structureType.empty()) {
-                output +=
-                  "    static const bool                               "
-                  "   allowDuplicate = false;\n";
-                output += "    static VULKAN_HPP_CONST_OR_CONSTEXPR " + m_ns + "::StructureType structureType = " + structureType + ";\n";
+        if (cfg.gen.internalFunctions) {
+            std::string spec;
+            if (!cfg.gen.cppModules) {
+                spec = "static";
             }
-        }
-        if (cfg.gen.structMock > 0) {
-            output += "#endif // VULKAN_HPP_NO_STRUCT_TRAITS\n";
-        }
 
-        // constructor
-        if (genConstructors) {
-            if (data.isStruct()) {
-                gen(output, cfg.gen.structConstructors, [&](auto &output) {
-                    bool const hasProxy = generateStructConstructor(output, data, false);
+            output += vkgen::format(R"(
+  namespace internal {{
 
-                    if (hasProxy) {
-                        output += "#  if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )\n";
-                        generateStructConstructor(output, data, true);
-                        output += "#  endif // VULKAN_HPP_DISABLE_ENHANCED_MODE \n";
-                    }
+    template<typename T, typename V, typename S, typename PFN, typename... Args>
+    inline std::vector<T> createArrayVoidPFN(const PFN pfn, const char *const msg, Args&&... args) {{
+        std::vector<T> data;
+        S count;
+        pfn(std::forward<Args>(args)..., &count, nullptr);
 
-                    // TODO
-                    // OutputBuffer x;
+        if (count) {{
+          data.resize( count );
+          pfn(std::forward<Args>(args)..., &count, {0}<V*>(data.data()));
+        }}
+        if (count < data.size()) {{
+            data.resize( count );
+        }}
 
-                    // genFunction(x, "", data.name, std::move(std::string("")));
+        return data;
+    }}
 
-                    // copy constuctor
-                    output += vkgen::format(R"(
-{1} {0}( {0} const & rhs ) {2} = default;
+    template<typename T, typename V, typename S, typename PFN, typename... Args>
+    inline std::vector<T> createArray(const PFN pfn, const char *const msg, Args&&... args) {{
+        std::vector<T> data;
+        S count;
+        VkResult result;
 
-)",
-                                            data.name,
-                                            m_constexpr14,
-                                            m_noexcept);
-                    {
-                        // C style copy constuctor
-                        FunctionGenerator fun(*this, "", data.name);
-                        fun.className         = data.name;
-                        fun.optionalProtect   = Protect{ "VULKAN_HPP_NO_STRUCT_CONSTRUCTORS", false };
-                        fun.specifierNoexcept = true;
-                        fun.add("Vk" + data.name + " const &", "rhs");
-                        fun.addInit(data.name, "*reinterpret_cast<" + data.name + " const *>( &rhs )");
-                        output += fun.generate(outputFuncs);
-                    }
-                });
-            } else {
-                gen(output, cfg.gen.unionConstructors, [&](auto &output) {
-                    std::map<std::string, uint8_t> types;
-                    for (const auto &m : data.members) {
-                        auto it = types.find(m->type());
-                        if (it != types.end()) {
-                            it->second++;
-                            continue;
-                        }
-                        types.emplace(m->type(), 1);
-                    }
+        do {{
+          result = pfn(std::forward<Args>(args)..., &count, nullptr);
+          if (result == VK_SUCCESS && count) {{
+            data.resize( count );
+            result = pfn(std::forward<Args>(args)..., &count, {0}<V*>(data.data()));
+          }}
+        }} while (result == VK_INCOMPLETE);
 
-                    bool first = true;
-                    for (const auto &m : data.members) {
-                        if (m->original.type() == "VkBool32") {
-                            continue;
-                        }
-                        const auto &type = m->type();
-                        std::string id   = m->identifier();
+        resultCheck(static_cast<Result>(result), msg);
+        if (count < data.size()) {{
+            data.resize( count );
+        }}
 
-                        auto it = types.find(type);
-                        // multiple same types, generate only once
-                        if (it != types.end()) {
-                            if (it->second == 0) {
-                                continue;
-                            }
-                            if (it->second > 1) {
-                                it->second = 0;
-                                id         = strFirstLower(type);
-                            }
-                        }
+        return data;
+    }}
+  }}  // namespace internal
+)",
+                                    m_cast);
+        }
 
-                        VariableData var = *m;
-                        var.setIdentifier(id + "_");
-                        id = m->identifier();
+        for (Handle &e : handles.ordered) {
+            generateClassDecl(output_forward, e);
+        }
 
-                        std::string arg = var.toString(*this);
-                        std::string assignment;
-                        if (first) {
-                            assignment = " = {}";
-                            first      = false;
-                        }
-                        output += vkgen::format(R"(
-{5} {0}({1}{2}) : {3}( {4} ) {{}}
-            )",
-                                                data.name,
-                                                arg,
-                                                assignment,
-                                                id,
-                                                var.identifier(),
-                                                m_constexpr14);
-                    }
-                });
-            }
+        output += "  using " + m_ns + "::" + loader.name + ";\n";
+        for (const Handle &h : topLevelHandles) {
+            // output += "  using " + m_ns + "::" + h.name + ";\n";
+            output += "  using " + m_ns + "::" + h.name + "Dispatcher;\n";
         }
 
-        if (genSetters || genSettersProxy) {
-            const auto &define = data.isStruct() ? cfg.gen.structSetters : cfg.gen.unionSetters;
-            gen(output, define, [&](auto &output) {
-                if (genSetters) {
-                    for (const auto &m : data.members) {
-                        if (m->type() == "StructureType") {
-                            continue;
-                        }
+        generateClassesRAII(output);
 
-                        const auto &id   = m->identifier();
+        if (cfg.gen.raii.commandStream && !cfg.gen.expApi) {
+            generateCommandStreamRAII(output);
+        }
 
-                        FunctionGenerator fun(*this, data.name + "&", "set" + strFirstUpper(id));
-                        fun.className = data.name;
-                        fun.base = &data;
-                        fun.optionalProtect = Protect{define.data.define, false};
-                        fun.specifierNoexcept = true;
-                        fun.specifierConstexpr14 = true;
+        if (cfg.gen.raii.submitBatcher && !cfg.gen.expApi) {
+            generateSubmitBatcherRAII(output);
+        }
 
-                        fun.add(m->fullType(*this), m->identifier() + "_");
-                        fun.code = vkgen::format(R"(
-      {0} = {0}_;
-      return *this;
-)",
-                                                       id);
+        output_forward += "  " + endNamespaceRAII();
+        output_forward += endNamespace();
 
-                        output += fun.generate(outputFuncs);
-                    }
-                }
+        output += "  " + endNamespaceRAII();
+        output += endNamespace();
 
-                bool hasArrayMember = false;
-                // arrayproxy setters
-                if (genSettersProxy) {
-                    for (const auto &m : data.members) {
-                        if (m->hasLengthVar()) {
-                            hasArrayMember   = true;
-                            auto        var  = VariableData(*m);
-                            std::string name = var.identifier();
-                            // name conversion
-                            if (name.size() >= 3 && name.starts_with("pp") && (bool)std::isupper(name[2])) {
-                                name = name.substr(1);
-                            } else if (name.size() >= 2 && name.starts_with("p") && (bool)std::isupper(name[1])) {
-                                name = name.substr(1);
-                            }
-                            name = strFirstUpper(name);
+        output += "#include \"" + out.getFilename("_raii_funcs") + "\"\n";
+    }
 
-                            var.setIdentifier(m->identifier() + "_");
-                            var.removeLastAsterisk();
+    void Generator::generateFuncsRAII(OutputBuffer &output) {
+        output += beginNamespace();
+        output += "  " + beginNamespaceRAII();
+        output += std::move(outputFuncsRAII.def);
 
-                            FunctionGenerator fun(*this, data.name + "&", "set" + name);
-                            fun.className = data.name;
-                            fun.base = &data;
-                            fun.optionalProtect = Protect{define.data.define, false};
-                            fun.specifierNoexcept = true;
+        // output += std::move(outputFuncsRAII.platform);
+        // output += "#ifndef VULKAN_HPP_DISABLE_ENHANCED_MODE\n";
+        // output += outputFuncsEnhancedRAII.get();
+        // output += "#endif // VULKAN_HPP_DISABLE_ENHANCED_MODE\n";
+        output += "  " + endNamespaceRAII();
+        /*
+        if (cfg.gen.raii.interop) {
+            output += "#ifndef VULKAN_HPP_EXPERIMENTAL_NO_INTEROP\n";
+            // output += outputFuncsInterop.get();
+            output += "#endif // VULKAN_HPP_EXPERIMENTAL_NO_INTEROP\n";
+        }
+        */
+        output += endNamespace();
+    }
 
-                            std::string const id = m->identifier();
-                            std::string       modif;
-                            if (var.original.type() == "void" && !var.original.isConstSuffix()) {
-                                // output += "    template <typename DataType>\n";
-                                fun.additonalTemplate = "typename DataType";
-                                var.setType("DataType");
-                                modif = " * sizeof(DataType)";
-                            }
+    static void initVmaMap(std::unordered_map<std::string, std::pair<const char *, bool>> &vma) {
+        vma.emplace("vkGetInstanceProcAddr", std::make_pair(nullptr, false));
+        vma.emplace("vkGetDeviceProcAddr", std::make_pair(nullptr, false));
+        vma.emplace("vkGetPhysicalDeviceProperties", std::make_pair(nullptr, false));
+        vma.emplace("vkGetPhysicalDeviceMemoryProperties", std::make_pair(nullptr, false));
+        vma.emplace("vkAllocateMemory", std::make_pair(nullptr, false));
+        vma.emplace("vkFreeMemory", std::make_pair(nullptr, false));
+        vma.emplace("vkMapMemory", std::make_pair(nullptr, false));
+        vma.emplace("vkUnmapMemory", std::make_pair(nullptr, false));
+        vma.emplace("vkFlushMappedMemoryRanges", std::make_pair(nullptr, false));
+        vma.emplace("vkInvalidateMappedMemoryRanges", std::make_pair(nullptr, false));
+        vma.emplace("vkBindBufferMemory", std::make_pair(nullptr, false));
+        vma.emplace("vkBindImageMemory", std::make_pair(nullptr, false));
+        vma.emplace("vkGetBufferMemoryRequirements", std::make_pair(nullptr, false));
+        vma.emplace("vkGetImageMemoryRequirements", std::make_pair(nullptr, false));
+        vma.emplace("vkCreateBuffer", std::make_pair(nullptr, false));
+        vma.emplace("vkDestroyBuffer", std::make_pair(nullptr, false));
+        vma.emplace("vkCreateImage", std::make_pair(nullptr, false));
+        vma.emplace("vkDestroyImage", std::make_pair(nullptr, false));
+        vma.emplace("vkCmdCopyBuffer", std::make_pair(nullptr, false));
+        vma.emplace("vkGetBufferMemoryRequirements2KHR", std::make_pair("VMA_DEDICATED_ALLOCATION || VMA_VULKAN_VERSION >= 1001000", false));
+        vma.emplace("vkGetImageMemoryRequirements2KHR", std::make_pair("VMA_DEDICATED_ALLOCATION || VMA_VULKAN_VERSION >= 1001000", false));
+        vma.emplace("vkBindBufferMemory2KHR", std::make_pair("VMA_BIND_MEMORY2 || VMA_VULKAN_VERSION >= 1001000", false));
+        vma.emplace("vkBindImageMemory2KHR", std::make_pair("VMA_BIND_MEMORY2 || VMA_VULKAN_VERSION >= 1001000", false));
+        vma.emplace("vkGetPhysicalDeviceMemoryProperties2KHR", std::make_pair("VMA_MEMORY_BUDGET || VMA_VULKAN_VERSION >= 1001000", false));
+        vma.emplace("vkGetDeviceBufferMemoryRequirements", std::make_pair("VMA_KHR_MAINTENANCE4 || VMA_VULKAN_VERSION >= 1003000", false));
+        vma.emplace("vkGetDeviceImageMemoryRequirements", std::make_pair("VMA_KHR_MAINTENANCE4 || VMA_VULKAN_VERSION >= 1003000", false));
+    }
 
-                            fun.add("ArrayProxyNoTemporaries<" + var.fullType(*this) + "> const &", var.identifier());
+    // 0 recording, 1 submission and synchronization, 2 object lifecycle, 3 rest
+    static int dispatchUsageClass(const std::string &name) {
+        static constexpr std::array<std::string_view, 3> recording{ "vkBeginCommandBuffer", "vkEndCommandBuffer", "vkResetCommandBuffer" };
+        static constexpr std::array<std::string_view, 12> queue{ "vkQueue",        "vkAcquireNextImage",  "vkWaitForFences", "vkResetFences",
+                                                                 "vkGetFenceStatus", "vkWaitSemaphores", "vkSignalSemaphore", "vkGetSemaphoreCounterValue",
+                                                                 "vkSetEvent",       "vkResetEvent",     "vkGetEventStatus",  "vkWaitForPresent" };
+        static constexpr std::array<std::string_view, 11> lifecycle{ "vkCreate", "vkDestroy", "vkAllocate", "vkFree",       "vkReset", "vkBind",
+                                                                     "vkMap",    "vkUnmap",   "vkFlush",    "vkInvalidate", "vkUpdate" };
 
-                            fun.code = vkgen::format(R"(
-  {1} = static_cast<uint32_t>({0}.size(){3});
-  {2} = {0}.data();
-  return *this;
-)",
-                                                 var.identifier(),
-                                                 m->getLengthVar()->identifier(),
-                                                 m->identifier(),
-                                                 modif);
+        const auto matches = [&](const auto &prefixes) {
+            return std::any_of(prefixes.begin(), prefixes.end(), [&](std::string_view p) { return name.starts_with(p); });
+        };
+        if (name.starts_with("vkCmd") || matches(recording)) {
+            return 0;
+        }
+        if (matches(queue)) {
+            return 1;
+        }
+        if (matches(lifecycle)) {
+            return 2;
+        }
+        return 3;
+    }
 
+    class DispatchGenerator
+    {
+        const Generator &gen;
+        const Handle    &h;
+        std::string      getAddr;
+        std::string      handle;
+        OutputBuffer      init;
+        OutputBuffer      init2;
+        bool             isContext;
 
-                            output += fun.generate(outputFuncs);
+        // PFN order, grouped by usage when dispatch_grouping is enabled
+        std::vector<ClassCommand *> orderedMembers() const {
+            std::vector<ClassCommand *> members = h.filteredMembers;
+            const auto                 &cfg     = gen.getConfig();
+            if (!cfg.gen.dispatchGrouping) {
+                return members;
+            }
 
+            // hot list goes first in given order
+            std::unordered_map<std::string, size_t> hot;
+            {
+                std::string name;
+                for (char c : cfg.gen.dispatchHotList.data + ',') {
+                    if (c == ',' || std::isspace(static_cast<unsigned char>(c))) {
+                        if (!name.empty()) {
+                            hot.emplace(std::move(name), hot.size());
+                            name.clear();
                         }
+                    } else {
+                        name += c;
                     }
                 }
-            });
+            }
+
+            const auto rank = [&](const ClassCommand *c) {
+                const std::string &name = c->name.original;
+                if (auto it = hot.find(name); it != hot.end()) {
+                    return it->second;
+                }
+                return hot.size() + dispatchUsageClass(name);
+            };
+            std::stable_sort(members.begin(), members.end(), [&](const ClassCommand *a, const ClassCommand *b) { return rank(a) < rank(b); });
+            return members;
         }
 
-        if (data.isStruct()) {
-            if (cfg.gen.structMock > 0) {
-                output += "#ifndef VULKAN_HPP_NO_STRUCT_ASSIGNMENT\n";
-            }
-            output += vkgen::format(R"(
-    {0} & operator=({0} const &rhs) VULKAN_HPP_NOEXCEPT = default;
+        void generateContextMembers(bool useVma, OutputClass &out, OutputBuffer &output) {
+            std::unordered_map<std::string, std::pair<const char *, bool>> vma;
 
-    {0} & operator=({1} const &rhs) VULKAN_HPP_NOEXCEPT {{
-      *this = *reinterpret_cast<{2}::{0} const *>(&rhs);
-      return *this;
-    }}
-)",
-            data.name,
-            data.name.original,
-            m_ns);
+            if (useVma) {
+                out.inherits += "public VmaVulkanFunctions";
+                initVmaMap(vma);
 
-            if (cfg.gen.structMock > 0) {
-                output += "#endif // VULKAN_HPP_NO_STRUCT_ASSIGNMENT\n";
+                // init += "      vkGetDeviceProcAddr = source.vkGetDeviceProcAddr;\n";
+
+                for (auto *d : h.filteredMembers) {
+                    const std::string &name = d->name.original;
+                    auto               it   = vma.find(name);
+                    if (it != vma.end()) {
+                        it->second.second = true;
+                    }
+                }
+
+                for (auto &v : vma) {
+                    if (!v.second.second) {
+                        // init += "/**/";
+                        // init += vkgen::format("      {0} = source.{0};\n", v.first);
+                        init += vkgen::format("      {0} = PFN_{0}(vkGetDeviceProcAddr(device, \"{0}\"));\n", v.first);
+                    } else {
+                        init += "/*" + v.first + "*/\n";
+                    }
+                }
             }
-        }
-        if (cfg.gen.structMock > 0) {
-            output += "#ifndef VULKAN_HPP_NO_STRUCT_CONVERT\n";
-        }
-        output += vkgen::format(R"(
 
-    operator {1} const &() const VULKAN_HPP_NOEXCEPT {{
-      return *reinterpret_cast<const {1} *>(this);
-    }}
+            // PFN function pointers
+            for (auto *d : orderedMembers()) {
+                const std::string &name = d->name.original;
 
-    explicit operator {1}&() VULKAN_HPP_NOEXCEPT {{
-      return *reinterpret_cast<{1} *>(this);
-    }}
+                const char *vmaGuard = nullptr;
+                bool        isVma    = false;
+                if (useVma) {
+                    auto it = vma.find(name);
+                    if (it != vma.end()) {
+                        isVma    = !it->second.first;
+                        vmaGuard = it->second.first;
+                    }
+                }
+
+                if (!isVma) {
+                    gen.genOptional(out.sPublic.get(), *d, [&](auto &output) {
+                        if (vmaGuard) {
+                            // oupuut += "/*G*/\n";
+                            output += "#if !(";
+                            output += vmaGuard;
+                            output += ")\n";
+                        }
+                        output += vkgen::format("    PFN_{0} {0} = {{}};\n", name);
+                        if (vmaGuard) {
+                            output += "#endif\n";
+                        }
+                    });
+                }
+
+                gen.genOptional(init,
+                  *d, [&](auto &output) { output += vkgen::format("      {0} = PFN_{0}( {1}({2}, \"{0}\") );\n", name, getAddr, handle); });
+
+                gen.genOptional(init2, *d, [&](auto &output) {
+                    for (const auto &alias : d->src->aliases) {
+                        const auto *cmd = gen.findCommand(alias.name.original);
+                        if (!cmd) {
+                            std::cerr << "generateContextMembers() cmd not found: " << alias.name << "\n";
+                            continue;
+                        }
+                        std::string str = cmd->canGenerate() ? std::string(alias.name) : vkgen::format("PFN_{0}( {1}({2}, \"{3}\") )", name, getAddr, handle, alias.name);
 
+                        output += vkgen::format(R"(      if ( !{0} )
+        {0} = {1};
 )",
-        data.name,
-        data.name.original);
-        if (cfg.gen.structMock > 0) {
-            output += "#endif // VULKAN_HPP_NO_STRUCT_CONVERT\n";
+                                                name,
+                                                str);
+                    }
+                });
+            }
         }
 
-        if (cfg.gen.structMock > 0) {
-            output += "#ifndef VULKAN_HPP_NO_REFLECT\n";
-        }
-        if (!cfg.gen.globalMode) {
-            gen(output, cfg.gen.structReflect, [&](auto &output) {
-                ArgumentBuilder types{ false };
-                ArgumentBuilder tie{ false };
-                for (const auto &m : data.members) {
-                    types.append(m->fullType(*this), "");
-                    tie.append("", m->identifier());
-                }
+      public:
+        DispatchGenerator(const Generator &gen, const Handle &h, bool isContext = false) : gen(gen), h(h), isContext(isContext) {}
 
-                std::string type = vkgen::format(R"(
-#  if 14 <= VULKAN_HPP_CPP_VERSION
-    auto
-#  else
-    std::tuple<{0}>
-#  endif
-)",
-                                                 types.string());
+        void generate(OutputBuffer &output) {
+            init.clear();
+            init2.clear();
+            OutputClass out {
+                .name = h.name + "Dispatcher"
+            };
+            const auto &name = out.name;
 
-                FunctionGenerator fun(*this, type, "reflect");
-                fun.className         = data.name;
-                fun.base              = &data;
-                fun.optionalProtect   = Protect{ "VULKAN_HPP_USE_REFLECT", true };
-                fun.specifierNoexcept = true;
-                fun.specifierConst    = true;
-                fun.code              = "      return std::tie(" + tie.string() + ");\n";
+            std::string src;
+            if (isContext) {
+                getAddr = "vkGetInstanceProcAddr";
+                handle  = "NULL";
+            } else if (h.getAddrCmd.has_value()) {
+                getAddr = h.getAddrCmd->name.original;
+                handle  = strFirstLower(h.name);
+                src     = h.name.original + " " + handle;
+            }
 
-                output += fun.generate(outputFuncs);
-            });
-        }
-        if (cfg.gen.structMock > 0) {
-            output += "#endif // VULKAN_HPP_NO_REFLECT\n";
-        }
+            const bool useVma = h.name == "Device" && gen.getConfig().gen.integrateVma;
 
-        std::string comp;
-        for (const auto &m : data.members) {
-            const std::string &id = m->identifier();
-            comp += "( " + id + " == rhs." + id +
-                    ")"
-                    " && ";
-        }
-        strStripSuffix(comp, " && ");
+            generateContextMembers(useVma, out, output);
 
-        if (genCompareOperators) {
+            if (!useVma) {
+                out.sPublic += "    PFN_" + getAddr + " " + getAddr + " = {};\n";
+            }
+            out.sPublic += "\n";
 
-            // hardcoded types from https://github.com/KhronosGroup/Vulkan-Hpp/blob/main/VulkanHppGenerator.cpp
-            static const std::set<std::string> simpleTypes = { "char",   "double",  "DWORD",    "float",    "HANDLE",   "HINSTANCE", "HMONITOR",
-                                                               "HWND",   "int",     "int8_t",   "int16_t",  "int32_t",  "int64_t",   "LPCWSTR",
-                                                               "size_t", "uint8_t", "uint16_t", "uint32_t", "uint64_t", "void" };
+            out.sPublic += "    " + name + "() = default;\n";
 
-            std::string prefix;
-            std::string compareMembers;
-            std::string spaceshipMembers;
-            bool        nonDefaultCompare = false;
-            std::string ordering;
-            if (data.containsFloatingPoints) {
-                ordering = "std::partial_ordering";
-            } else {
-                ordering = "std::strong_ordering";
+            if (h.name == "Instance") {
+                std::string name = "vkGetDeviceProcAddr";
+                out.sPublic += "    PFN_" + name + " " + name + " = {};\n";
+                init += vkgen::format("      {0} = PFN_{0}( {1}({2}, \"{0}\") );\n", name, getAddr, handle);
             }
 
-            for (const auto &m : data.members) {
-                const auto &id   = m->identifier();
-                const auto &type = m->original.type();
-                if (m->getNamespace() != Namespace::VK && simpleTypes.find(type) == simpleTypes.end() && enums.find(type) == enums.end()) {
-                    nonDefaultCompare = true;
-
-                    compareMembers += prefix + vkgen::format("( memcmp( &{0}, &rhs.{0}, sizeof( {1} ) ) == 0 )", id, type);
+//            std::string ctorInit = "VmaVulkanFunctions()";
+//            if (!useVma) {
+//                ctorInit = getAddr;
+//                ctorInit += isContext ? "(getProcAddr)" : "(source.vkGet" + h.name + "ProcAddr)";
+//            }
 
-                    spaceshipMembers += "      if ( auto cmp = memcmp( &" + id + ", &rhs." + id + ", sizeof( " + type + " ) ); cmp != 0 )\n";
-                    spaceshipMembers += "        return ( cmp < 0 ) ? " + ordering + "::less : " + ordering + "::greater;\n";
-                } else if (type == "char" && !m->getLenAttrib().empty()) {
-                    nonDefaultCompare = true;
+            std::string addrInit = "      " + getAddr + " = getProcAddr;\n";
+            // std::string addrInit = "      " + getAddr + " = ";
+            // addrInit += isContext ? "getProcAddr" : "source.vkGet" + h.name + "ProcAddr";
+            // addrInit += ";\n";
 
-                    if (m->lenExpressions.size() == 1) {
-                        compareMembers += prefix + vkgen::format("( ( {0} == rhs.{0} ) || ( strcmp( {0}, rhs.{0} ) == 0 ) )", id, type);
+            {
+                std::string args = "PFN_" + getAddr + " getProcAddr";
+                std::string loadArgs = "getProcAddr";
+                if (!isContext) {
+                    args     += ", " + src;
+                    loadArgs += ", " + handle;
+                }
+                // else {
+                    // args     = "const " + h.superclass + "Dispatcher &source, " + src;
+                    // loadArgs = "source, " + handle;
+                // }
+                out.sPublic += vkgen::format(R"(
+    {0}({1}) {{
+      load({2});
+    }}
+)",
+                                             name,
+                                             args,
+                                             loadArgs);
 
-                        spaceshipMembers += "     if ( " + id + " != rhs." + id + " )\n";
-                        spaceshipMembers += "        if ( auto cmp = strcmp( " + id + ", rhs." + id + " ); cmp != 0 )\n";
-                        spaceshipMembers += "          return ( cmp < 0 ) ? " + ordering + "::less : " + ordering + "::greater;\n";
-                    } else {
+                if (!isContext) {
+                    std::string dispatchArgs = "const " + h.superclass + "Dispatcher &source, " + src;
+                    std::string dispatchLoadArgs = "source.vkGet" + h.name + "ProcAddr, " + handle;
 
-                        compareMembers += prefix + vkgen::format("std::equal( {1}, {1} + {0}, rhs.{1}", m->lenExpressions[0], id);
-                        compareMembers += ", []( char const * left, char const * right ) { return ( left == right ) || ( strcmp( left, right ) == 0 ); } )";
+                    out.sPublic += vkgen::format(R"(
+    {0}({1}) {{
+      load({2});
+    }}
 
-                        constexpr auto spaceshipMemberTemplate =
-                          R"(      for ( size_t i = 0; i < {0}; ++i )
-      {{
-        if ( {1}[i] != rhs.{1}[i] )
-          if ( auto cmp = strcmp( {1}[i], rhs.{1}[i] ); cmp != 0 )
-            return cmp < 0 ? {2}::less : {2}::greater;
-      }}
-)";
-                        spaceshipMembers += vkgen::format(spaceshipMemberTemplate, m->lenExpressions[0], id, ordering);
-                    }
-                } else {
-                    compareMembers += prefix + "( " + id + " == rhs." + id + " )";
-                    spaceshipMembers += "      if ( auto cmp = " + id + " <=> rhs." + id + "; cmp != 0 ) return cmp;\n";
+    void load({1}) {{
+      load({2});
+    }}
+)",
+                    name,
+                    dispatchArgs,
+                    dispatchLoadArgs );
                 }
-                prefix = "\n          && ";
+
+                out.sPublic += "    void load(" + args + ") {\n";
+                out.sPublic += std::move(addrInit);
+                out.sPublic += std::move(init);
+                out.sPublic += std::move(init2);
+                out.sPublic += "    }\n";
             }
 
-            std::string compareBody, spaceshipOperator;
-            const bool  useSpaceship = cfg.gen.spaceshipOperator && !containsFuncPointer(data);
-            if (nonDefaultCompare) {
-                compareBody = "      return " + compareMembers + ";";
-                if (useSpaceship) {
-                    constexpr auto spaceshipOperatorTemplate =
-                      R"(    {2} operator<=>( {0} const & rhs ) const VULKAN_HPP_NOEXCEPT /*X*/
-    {{
-{1}
-      return {2}::equivalent;
-    }}
-)";
 
-                    spaceshipOperator = vkgen::format(spaceshipOperatorTemplate, data.name, spaceshipMembers, ordering);
-                }
-            } else {
-                constexpr auto compareBodyTemplate =
-                  R"(#if defined( VULKAN_HPP_USE_REFLECT )
-      return this->reflect() == rhs.reflect();
-#else
-      return {0};
-#endif // VULKAN_HPP_USE_REFLECT
+            if (useVma) {
+                out.sPublic += R"(
+    VULKAN_HPP_NODISCARD const VmaVulkanFunctions* vma() const {
+      return this;
+    }
 )";
-                compareBody = vkgen::format(compareBodyTemplate, compareMembers);
-
-                if (useSpaceship) {
-                    spaceshipOperator = "    auto operator<=>( " + data.name + " const & ) const = default;";
-                }
             }
 
-            gen(output, cfg.gen.structCompare, [&](auto &output) {
-                if (!spaceshipOperator.empty()) {
-                    output += "#  if defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )\n";
+            output += std::move(out);
 
-                    if (nonDefaultCompare) {
-                        FunctionGenerator fun(*this, ordering, "operator<=>");
-                        fun.className         = data.name;
-                        fun.base              = &data;
-                        fun.optionalProtect   = Protect{ "VULKAN_HPP_USE_SPACESHIP_OPERATOR", true }; // workaround
-                        fun.specifierNoexcept = true;
-                        fun.specifierConst = true;
-                        fun.code = vkgen::format(R"(
-{0}
-      return {1}::equivalent;
-)",                                 spaceshipMembers, ordering);
+            //        if (h.name == "Instance" && cfg.gen.staticInstancePFN) {
+            //            output += "    static " + name + " instanceDispatcher;\n";
+            //        }
+            //        else if (h.name == "Device" && cfg.gen.staticDevicePFN) {
+            //            output += "    static " + name + " deviceDispatcher;\n";
+            //        }
+        }
+    };
 
-                        fun.add(data.name + " const &", "rhs");
-                        output += fun.generate(outputFuncs);
-                    }
-                    else {
-                        output += spaceshipOperator + "\n";
-                    }
+    void Generator::generateDispatchRAII(OutputBuffer &output) {
+        auto &instance = findHandle("VkInstance");
+        auto &device   = findHandle("VkDevice");
+
+        DispatchGenerator(*this, loader, true).generate(output);
+        DispatchGenerator(*this, instance).generate(output);
+        DispatchGenerator(*this, device).generate(output);
+
+        output += "\nstruct Dispatch : public InstanceDispatcher, DeviceDispatcher {};\n";
+    }
+
+    void Generator::generateStubDriver(OutputBuffer &output) {
+        output += "#include \"vulkan.h\"\n";
+        output += "#include \"vulkan_hpp_macros.hpp\"\n";
+        output += R"(
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+)";
+        output += beginNamespace();
+        output += "  namespace stub {\n";
+        output += RES_STUB_DRIVER;
 
-                    output += "#  else\n";
-                }
+        OutputBuffer table;
+        table += "      { \"vkGetInstanceProcAddr\", reinterpret_cast<PFN_vkVoidFunction>( &vkGetInstanceProcAddr ) },\n";
+        table += "      { \"vkGetDeviceProcAddr\", reinterpret_cast<PFN_vkVoidFunction>( &vkGetDeviceProcAddr ) },\n";
 
-                {
-                    FunctionGenerator fun(*this, "bool", "operator==");
-                    fun.className         = data.name;
-                    fun.base              = &data;
-                    fun.optionalProtect   = Protect{ "VULKAN_HPP_HAS_SPACESHIP_OPERATOR", false };
-                    fun.specifierNoexcept = true;
-                    fun.specifierConst = true;
+        std::unordered_set<std::string> generated{ "vkGetInstanceProcAddr", "vkGetDeviceProcAddr" };
+        static const std::set<std::string> scalarTypes = { "char",    "double",   "float",    "int",      "int8_t",  "int16_t", "int32_t",
+                                                           "int64_t", "size_t",   "uint8_t",  "uint16_t", "uint32_t", "uint64_t" };
 
-                    fun.add(data.name + " const &", "rhs");
-                    fun.code = compareBody;
-                    output += fun.generate(outputFuncs);
-                }
-                {
-                    FunctionGenerator fun(*this, "bool", "operator!=");
-                    fun.className         = data.name;
-                    fun.base              = &data;
-                    fun.optionalProtect   = Protect{ "VULKAN_HPP_HAS_SPACESHIP_OPERATOR", false };
-                    fun.specifierNoexcept = true;
-                    fun.specifierConst = true;
+        const auto genCommand = [&](const Command &cmd) {
+            const std::string &name = cmd.name.original;
+            if (!generated.emplace(name).second) {
+                return;
+            }
 
-                    fun.add(data.name + " const &", "rhs");
-                    fun.code = "      return !operator==( rhs );\n";
-                    output += fun.generate(outputFuncs);
+            // count parameters referenced by an output array, filled together with the array
+            std::unordered_map<std::string, const VariableData *> arrays;
+            for (const auto &p : cmd._params) {
+                std::string len = p->getLenAttrib();
+                if (!len.empty() && p->original.isPointer() && !p->original.isConst()) {
+                    arrays.emplace(len.substr(0, len.find(',')), p.get());
                 }
+            }
 
-                if (!spaceshipOperator.empty()) {
-                    output += "#  endif\n";
+            // zero value of one output element, chained structures keep sType and pNext of the caller
+            // platform types (wl_display, Display, ...) are opaque inputs and stay untouched
+            const auto clear = [&](const VariableData &p, const std::string &element) -> std::string {
+                const std::string &type = p.original.type();
+                if (p.isHandle()) {
+                    return vkgen::format("{0} = fabricate<{1}>();", element, type);
                 }
-            });
-        }
+                const auto s = structs.find(type);
+                if (s != structs.end() && s->hasStructType()) {
+                    return vkgen::format("clearChained( {0} );", element);
+                }
+                if (p.isStructOrUnion() || p.isEnum() || type.starts_with("Vk") || scalarTypes.contains(type)) {
+                    return element + " = {};";
+                }
+                return "";
+            };
 
-        const bool cstyle = cfg.gen.structMock >= 5;
-        bool cmock = cfg.gen.globalMode; // && cfg.gen.structMock >= 4;
-        for (const auto &m : data.members) {
-            if (data.isStruct()) {
-                std::string assignment = "{}";
-                const auto &type       = m->original.type();
-                if (type == "VkStructureType") {
-                    assignment = structureType.empty() ?
-                                                       (cfg.gen.structMock >= 5? "VK_STRUCTURE_TYPE_APPLICATION_INFO" : "StructureType::eApplicationInfo")
-                                                       : structureType;
+            std::string body;
+            for (const auto &p : cmd._params) {
+                const bool out = p->original.isPointer() && !p->original.isConst();
+                if (!out) {
+                    continue;
                 }
-                if (cfg.gen.structMock >= 2) {
-                    if (cfg.gen.structMock != 3 && (type == "VkStructureType" || m->original.identifier() == "pNext")) {
-                        m->setAssignment(" = " + assignment);
+                const std::string &id   = p->original.identifier();
+                const std::string &type = p->original.type();
+
+                const auto array = arrays.find(id);
+                if (array != arrays.end()) {
+                    if (array->second->original.type() == "void") {
+                        // opaque data, report empty
+                        body += vkgen::format("      *{0} = 0;\n", id);
                     }
-                    else {
-                        assignment = "";
-                        m->setAssignment("");
+                    continue;
+                }
+
+                std::string len = p->getLenAttrib();
+                if (len.empty()) {
+                    if (type == "void") {
+                        if (p->original.suffix().find("**") != std::string::npos) {
+                            body += vkgen::format("      *{0} = nullptr;\n", id);
+                        }
+                    } else if (const std::string value = clear(*p, "*" + id); !value.empty()) {
+                        body += "      " + value + "\n";
                     }
+                    continue;
                 }
-                else {
-                    m->setAssignment(" = " + assignment);
+                len = len.substr(0, len.find(','));
+                if (len == "null-terminated" || len.starts_with("latexmath")) {
+                    continue;
                 }
-                if ((cmock && ((!m->isStructOrUnion() && !m->isEnum() && !m->isHandle()) || m->hasArrayLength())) && !cstyle) {
-                    output += "    " + m->fullType(*this) + "    " + m->identifier() + m->optionalArraySuffix() + m->getNameSuffix();
-                    if (!assignment.empty()) {
-                        output += " = ";
-                        output += assignment;
+
+                const VariableData *count = {};
+                for (const auto &c : cmd._params) {
+                    if (c->original.identifier() == len) {
+                        count = c.get();
                     }
-                    output += ";\n";
                 }
-                else {
-                    output += "    " + m->toStructStringWithAssignment(*this, cstyle) + ";\n";
+                if (type == "void") {
+                    if (count && !count->original.isPointer()) {
+                        body += vkgen::format("      std::memset( {0}, 0, {1} );\n", id, len);
+                    }
+                    continue;
+                }
+                const std::string value = clear(*p, id + "[i]");
+                if (value.empty()) {
+                    continue;
+                }
+                if (count && count->original.isPointer()) {
+                    // enumerate pattern, report one element
+                    body += vkgen::format(R"(      if ( !{0} ) {{
+        *{1} = 1;
+      }} else {{
+        *{1} = std::min<{2}>( *{1}, 1 );
+        for ( {2} i = 0; i < *{1}; ++i ) {{
+          {3}
+        }}
+      }}
+)",
+                                          id,
+                                          len,
+                                          count->original.type(),
+                                          value);
+                } else {
+                    body += vkgen::format("      for ( uint64_t i = 0; i < {0}; ++i ) {{\n        {1}\n      }}\n", len, value);
                 }
+            }
 
-            } else {
-                if ((cmock && (!m->isStruct() && !m->isEnum() || m->hasArrayLength())) && !cstyle) {
-                    output += "    " + m->fullType(*this) + "    " + m->identifier() + m->optionalArraySuffix() + m->getNameSuffix() + ";\n";
+            // inputs and skipped outputs are not read by the body
+            const auto isIdentifierChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+            const auto isUsed           = [&](const std::string &id) {
+                for (size_t pos = body.find(id); pos != std::string::npos; pos = body.find(id, pos + 1)) {
+                    const size_t end = pos + id.size();
+                    if ((pos == 0 || !isIdentifierChar(body[pos - 1])) && (end == body.size() || !isIdentifierChar(body[end]))) {
+                        return true;
+                    }
                 }
-                else {
-                    output += "    " + m->toStructString(*this, cstyle) + ";\n";
+                return false;
+            };
+            std::string params;
+            for (const auto &p : cmd._params) {
+                if (!params.empty()) {
+                    params += ", ";
+                }
+                if (!isUsed(p->original.identifier())) {
+                    params += "[[maybe_unused]] ";
                 }
+                params += p->originalToString();
             }
-        }
 
-        output += "  };\n\n";
+            std::string ret;
+            if (cmd.type == "VkResult") {
+                ret = "      return VK_SUCCESS;\n";
+            } else if (cmd.type == "VkBool32") {
+                ret = "      return VK_TRUE;\n";
+            } else if (cmd.type != "void") {
+                ret = "      return {};\n";
+            }
 
-        if (data.isStruct() && !structureType.empty() && !cfg.gen.globalMode) {
-            gen(output, cfg.gen.handleTemplates, [&](auto &output) {
+            genOptional(output, cmd, [&](auto &output) {
                 output += vkgen::format(R"(
-  template <>
-  struct CppType<StructureType, {0}> {{
-    using Type = {1};
-  }};
+    inline VKAPI_ATTR {0} VKAPI_CALL {1}( {2} ) {{
+{3}{4}    }}
 )",
-                                        structureType,
-                                        data.name);
+                                        cmd.type,
+                                        name,
+                                        params,
+                                        body,
+                                        ret);
             });
-        }
-
-        for (const auto &a : data.aliases) {
-            output += "  using " + a.name + " = " + data.name + ";\n";
-        }
-
-    }
+            genOptional(table, cmd, [&](auto &output) {
+                output += vkgen::format("      {{ \"{0}\", reinterpret_cast<PFN_vkVoidFunction>( &{0} ) }},\n", name);
+            });
+        };
 
-    std::string Generator::generateIncludeRAII(GenOutput &out) const {
-        std::string output;
-        if (cfg.gen.importStdMacro) {
-            output += R"(
-#ifndef USE_IMPORT_STD
-)";
+        const Handle *sources[] = { &loader, &findHandle("VkInstance"), &findHandle("VkDevice") };
+        for (const Handle *h : sources) {
+            for (const ClassCommand *d : h->filteredMembers) {
+                genCommand(*d->src);
+            }
         }
 
         output += R"(
-#include <memory>
-#include <vector>
-#include <utility>  // std::exchange, std::forward
-)";
-
-        if (cfg.gen.importStdMacro) {
-            output += R"(
-#endif
+    inline PFN_vkVoidFunction getProcAddr( const char * pName ) VULKAN_HPP_NOEXCEPT {
+      struct Entry {
+        const char *       name;
+        PFN_vkVoidFunction pfn;
+      };
+      static const Entry entries[] = {
 )";
+        output += std::move(table);
+        output += R"(      };
+      for ( const auto & e : entries ) {
+        if ( std::strcmp( e.name, pName ) == 0 ) {
+          return e.pfn;
         }
+      }
+      return nullptr;
+    }
+)";
+        output += "  }  // namespace stub\n";
+        output += endNamespace();
+    }
 
-        output += vkgen::format(R"(
-#include "{0}"
-#include "{1}"
-)",
-                                out.getFilename(""),
-                                out.getFilename("_raii_forward"));
-
-        return output;
+    void Generator::evalCommand(Command &cmd) const {
+        std::string const name = cmd.name;
+        std::string const tag  = strWithoutTag(name);
+        cmd.nameCat            = evalNameCategory(name);
     }
 
-    void Generator::generateClassWithPFN(OutputBuffer &output, Handle &h) {
-        OutputClass out {
-            .name = h.name
-        };
-        const auto       &name     = out.name;
-        const std::string dispatch = name + "Dispatcher";
-        const auto       &handle   = h.vkhandle.identifier();
+    vkgen::vkr::Command::NameCategory Generator::evalNameCategory(const std::string &name) {
+        using enum Command::NameCategory;
+        if (name.starts_with("get")) {
+            return GET;
+        }
+        if (name.starts_with("allocate")) {
+            return ALLOCATE;
+        }
+        if (name.starts_with("acquire")) {
+            return ACQUIRE;
+        }
+        if (name.starts_with("create")) {
+            return CREATE;
+        }
+        if (name.starts_with("enumerate")) {
+            return ENUMERATE;
+        }
+        if (name.starts_with("write")) {
+            return WRITE;
+        }
+        if (name.starts_with("destroy")) {
+            return DESTROY;
+        }
+        if (name.starts_with("free")) {
+            return FREE;
+        }
+        return UNKNOWN;
+    }
 
-        generateClassTypeInfo(h, output, out);
+    void Generator::generateClassMember(ClassCommand &m, MemberContext &ctx, OutputClass &out, GuardedOutputFuncs &outFuncs, bool inlineFuncs) {
 
-        output += "  class " + name + " {\n";
-        output += "  protected:\n";
-        output += "    Vk" + name + " " + handle + " = {};\n";
-        output += "    " + dispatch + " m_dispatcher = {};\n";
-        output += "  public:\n";
+        GuardedOutput tmp;
 
-        output += out.sPublic.toString();
-        output += "    explicit " + name + "(std::nullptr_t) VULKAN_HPP_NOEXCEPT {}\n";
+        MemberGenerator g{ *this, m, tmp, outFuncs };
+        if (ctx.globalUseCAPI) {
+            g.ctx.globalUseCAPI = true;
+        }
+        g.generate();
 
-        GuardedOutput ctors;
-        // GuardedOutput members{};
+        // TODO
+        {
+            std::stringstream str;
+            tmp.write(str);
+            out.sFuncs += str.str();
+        }
+    }
 
-        for (auto &d : h.ctorCmds) {
-            MemberContext ctx{ .ns = Namespace::VK };
-            ctx.insertSuperclassVar = true;
-            // ctx.generateInline      = true;
-            ctx.disableDispatch     = true;
-            ctx.exp                 = true;
-            MemberResolverCtor resolver{ *this, d, ctx };
-            if (!resolver.hasDependencies) {
-                std::cout << "[EXP] ctor skipped: class " << h.name
-                          << ", p: "
-                          // parent->type() << ", s: " << superclass
-                          << '\n';
-                continue;
+    std::string Generator::generateRetireArgs(const Handle &data) const {
+        // arguments of the destroy command called from RetireQueue::Entry::destroy, empty when it can't be retired
+        const Command *dtor = data.dtorCmd;
+        if (!dtor || !data.ownerRaii || data.superclass.original != "VkDevice") {
+            return "";
+        }
+
+        std::string args;
+        for (const auto &p : dtor->_params) {
+            const auto &type = p->original.type();
+            std::string arg;
+            if (type == "VkAllocationCallbacks") {
+                arg = "e.allocator";
+            } else if (type == data.name.original) {
+                arg = p->original.isPointer() ? "&handle" : "handle";
+            } else if (type == data.superclass.original) {
+                arg = "RetireQueue::fromEntryHandle<" + type + ">( e.owner )";
+            } else if (data.secondOwner && type == data.secondOwner->original.type()) {
+                arg = "RetireQueue::fromEntryHandle<" + type + ">( e.pool )";
+            } else if (type == "uint32_t") {
+                arg = "1";
+            } else {
+                return "";
             }
-            resolver.generate(ctors, outputFuncs);
+            if (!args.empty()) {
+                args += ", ";
+            }
+            args += arg;
+        }
+        return args;
+    }
 
-            MemberResolverInit init{ *this, d, ctx };
-            init.generate(ctors, outputFuncs);
+    std::string Generator::generateRetireRAII(const Handle &data, const std::string &destroyCall) const {
+        // Device children with destroy command go through RetireQueue, other handles are destroyed immediately
+        const std::string args = generateRetireArgs(data);
+        if (args.empty()) {
+            return "";
         }
 
-        /*
-        const bool indirect = cfg.gen.classMethods & 2;
-        for (auto &d : h.members) {
-            if (!indirect && d.src->isIndirect()) {
+        const Command     *dtor   = data.dtorCmd;
+        const std::string &handle = data.vkhandle.identifier();
+        std::string entry = vkgen::format(R"(        if ( {0} && {1}->getRetireQueue() ) {{
+          RetireQueue::Entry entry;
+          entry.destroy = []( RetireQueue::Entry const & e ) {{
+            {2} const handle = RetireQueue::fromEntryHandle<{2}>( e.handle );
+            reinterpret_cast<PFN_{3}>( e.pfn )( {4} );
+          }};
+          entry.pfn    = reinterpret_cast<PFN_vkVoidFunction>( getDispatcher()->{3} );
+          entry.owner  = RetireQueue::toEntryHandle( static_cast<{5}>( **{1} ) );
+          entry.handle = RetireQueue::toEntryHandle( static_cast<{2}>( {0} ) );
+)",
+                                          handle,
+                                          data.ownerRaii->identifier(),
+                                          data.name.original,
+                                          dtor->name.original,
+                                          args,
+                                          data.superclass.original);
+        if (data.secondOwner) {
+            entry += vkgen::format("          entry.pool   = RetireQueue::toEntryHandle( static_cast<{0}>( {1} ) );\n",
+                                   data.secondOwner->original.type(),
+                                   data.secondOwner->identifier());
+        }
+        if (cfg.gen.allocatorParam) {
+            entry += "          entry.allocator = reinterpret_cast<VkAllocationCallbacks const *>( " + cvars.raiiAllocator.identifier() + " );\n";
+        }
+        entry += vkgen::format(R"(          if ( {0}->getRetireQueue()->push( entry ) ) {{
+            {1} = nullptr;
+          }}
+        }}
+)",
+                               data.ownerRaii->identifier(),
+                               handle);
+        return entry + destroyCall;
+    }
+
+    void Generator::generateRetireQueue(OutputBuffer &output) const {
+        // global mode has no RAII clear(), Device children are handed to the queue with retire()
+        output += RES_RETIRE_QUEUE;
+        // same allocator default as destroy functions
+        const std::string assignment = useHostAllocators() ? "VULKAN_HPP_GLOBAL_DEFAULT_ALLOCATOR_ASSIGNMENT" : "VULKAN_HPP_DEFAULT_ALLOCATOR_ASSIGNMENT";
+        for (const Handle &h : handles) {
+            const std::string args = generateRetireArgs(h);
+            if (args.empty() || !h.dtorCmd->canGenerate()) {
                 continue;
             }
-            MemberGenerator g{ *this, d, members, outputFuncs };
-            g.generate();
-        }
-        */
-        {
-            std::stringstream temp;
-            ctors.write(temp);  // TODO
-            output += temp.str();
-        }
-
-        output += "    " + name + "() = default;\n";
-        output += "    " + name + "(" + name + " const&) = delete;\n";
-
-        output += "    " + name + "(" + name + "&& rhs) VULKAN_HPP_NOEXCEPT\n";
-
-        output += "      : " + handle + "(rhs." + handle + "),\n";
-        output += "        m_dispatcher(rhs.m_dispatcher)\n";
-        output += "      {}\n";
-
-        output += "    " + name + "& operator=(" + name + " const &) = delete;\n";
-
-        output += "    " + name + "& operator=(" + name + "&& rhs) VULKAN_HPP_NOEXCEPT\n";
-        output += "    {\n";
+            genOptional(output, h, [&](OutputBuffer &output) {
+                const std::string handle = strFirstLower(h.name);
+                std::string       params = m_ns + "::" + h.name + " " + handle;
+                std::string entry;
+                if (h.secondOwner) {
+                    const auto &pool = *h.secondOwner;
+                    const std::string id = strFirstLower(pool.type());
+                    params = m_ns + "::" + pool.type() + " " + id + ", " + params;
+                    entry += vkgen::format("    entry.pool   = RetireQueue::toEntryHandle( static_cast<{0}>( {1} ) );\n", pool.original.type(), id);
+                }
+                for (const auto &p : h.dtorCmd->_params) {
+                    if (p->original.type() == "VkAllocationCallbacks") {
+                        params += ", Optional<const " + m_ns + "::AllocationCallbacks> allocator " + assignment;
+                        entry += "    entry.allocator = reinterpret_cast<VkAllocationCallbacks const *>( static_cast<" + m_ns + "::AllocationCallbacks const *>( allocator ) );\n";
+                    }
+                }
+                output += vkgen::format(R"(
+  // destroyed by queue.collect() once the GPU timeline reaches the current retire value
+  VULKAN_HPP_INLINE void retire( RetireQueue & queue, {0} ) VULKAN_HPP_NOEXCEPT
+  {{
+    RetireQueue::Entry entry;
+    entry.destroy = []( RetireQueue::Entry const & e ) {{
+      {1} const handle = RetireQueue::fromEntryHandle<{1}>( e.handle );
+      reinterpret_cast<PFN_{2}>( e.pfn )( {3} );
+    }};
+    entry.pfn    = reinterpret_cast<PFN_vkVoidFunction>( device.getDispatcher()->{2} );
+    entry.owner  = RetireQueue::toEntryHandle( static_cast<VkDevice>( device ) );
+    entry.handle = RetireQueue::toEntryHandle( static_cast<{1}>( {4} ) );
+{5}    if ( !queue.push( entry ) )
+    {{
+      entry.destroy( entry );
+    }}
+  }}
+)",
+                                        params,
+                                        h.name.original,
+                                        h.dtorCmd->name.original,
+                                        args,
+                                        handle,
+                                        entry);
+            });
+        }
+    }
 
-        output += "      " + handle + " = rhs." + handle + ";\n";
-        output += "      m_dispatcher = rhs.m_dispatcher;\n";
-        output += "      return *this;\n";
-        output += "    }\n";
+    void Generator::generateClassClearRAII(const Handle &data) {
+        const auto &className = data.name;
+        const auto &handle    = data.vkhandle.identifier();
 
-        output += "    operator Vk" + name + "() const {\n";
-        output += "      return " + handle + ";\n";
-        output += "    }\n";
+        std::string call;
+        if (data.dtorCmd) {
+            MemberContext                 ctx{ .ns = Namespace::RAII };
+            ClassCommand                  d(this, &data, *data.dtorCmd);
+            MemberResolverClearRAII const r{ *this, d, ctx };
+            call = r.temporary(handle);
+        }
 
-        output += "    Vk" + name + " const &operator*() const VULKAN_HPP_NOEXCEPT {\n";
-        output += "      return " + handle + ";\n";
-        output += "    }\n";
+        std::string clear;
+        std::string swap;
+        data.foreachVars(VariableData::Flags::CLASS_VAR_RAII, [&](const VariableData &v) {
+            clear += "      " + v.identifier() + " = nullptr;\n";
+            swap += "      std::swap( " + v.identifier() + ", rhs." + v.identifier() + " );\n";
+        });
 
-        output += "    VULKAN_HPP_INLINE " + dispatch + " const * getDispatcher() const VULKAN_HPP_NOEXCEPT \n";
-        output += "    {\n";
-        output += "      return &m_dispatcher;\n";
-        output += "    }\n";
-        /*
-        if (!h.isSubclass) {
-            std::string src = "m_dispatcher";
-            if (cfg.gen.dispatchTableAsUnique) {
-                src += "->";
+        if (cfg.gen.raii.deferredDestroy && !cfg.gen.expApi) {
+            if (data.name.original == "VkDevice") {
+                // pending handles reference device
+                call = "        if (m_retireQueue) {\n          m_retireQueue->flush();\n        }\n" + call;
+                clear += "      m_retireQueue = nullptr;\n";
+                swap += "      std::swap( m_retireQueue, rhs.m_retireQueue );\n";
             } else {
-                src += ".";
+                const std::string retire = generateRetireRAII(data, call);
+                if (!retire.empty()) {
+                    call = retire;
+                }
             }
-            output += "    VULKAN_HPP_INLINE PFN_vkVoidFunction getProcAddr(const char* name) const {\n";
-            output += "      return " + src + "vkGet" + name + "ProcAddr(" + handle + ", name);\n";
-            output += "    }\n";
+        }
 
-            output += "    template<typename T>\n";
-            output += "    VULKAN_HPP_INLINE T getProcAddr(const char* name) const {\n";
-            output += "      return " + m_cast + "<T>(getProcAddr(name));\n";
-            output += "    }\n";
+        const std::string output = vkgen::format(R"(
+    inline void {0}::clear() VULKAN_HPP_NOEXCEPT {{
+{1}{2}
+    }}
 
-            output += "    template<typename T>\n";
-            output += "    VULKAN_HPP_INLINE T getProcAddr(const std::string& name) const {\n";
-            output += "      return " + m_cast + "<T>(getProcAddr(name.c_str()));\n";
-            output += "    }\n";
-        }
-        */
-        /*
-        {
-            std::stringstream temp;
-            members.write(temp);
-            output += temp.str();  // TODO
-        }
-        */
-        output += "  };\n";
+    inline void {0}::swap({4}::{0} &rhs) VULKAN_HPP_NOEXCEPT {{
+{3}
+    }}
+)",
+                                                 className,
+                                                 call,
+                                                 clear,
+                                                 swap,
+                                                 m_ns_raii);
+
+        genOptional(outputFuncsRAII.def.get(), data, [&](auto &out) { out += output; });
     }
 
-    void Generator::generateContext(OutputBuffer &output) {
-        if (cfg.gen.integrateVma) {
-            output += "#include <vma/vk_mem_alloc.h>\n";
+    void Generator::generateClassMembers(const Handle &data, OutputClass &out, GuardedOutputFuncs &outFuncs, Namespace ns, bool inlineFuncs) {
+        if (ns == Namespace::RAII) {
+            generateClassClearRAII(data);
         }
-        if (cfg.gen.globalMode) {
 
-            if (cfg.gen.cppStd >= 20) {
-                output += "#include <bit>\n";
-            }
-            if (cfg.gen.functionsVecAndArray) {
-                output += "#include \"vulkan_vector.hpp\"\n";
+        // wrapper functions
+        for (ClassCommand &m : const_cast<Handle &>(data).members) {
+            if (ns == Namespace::VK && m.src->isIndirect()) {
+                continue;
             }
+            MemberContext ctx{ .ns = ns };
+            generateClassMember(m, ctx, out, outFuncs, inlineFuncs);
         }
+    }
 
-        output += R"(
-#if VULKAN_HPP_ENABLE_DYNAMIC_LOADER_TOOL == 1
-#  if defined( __unix__ ) || defined( __APPLE__ ) || defined( __QNXNTO__ ) || defined( __Fuchsia__ )
-#    include <dlfcn.h>
-#  elif defined( _WIN32 )
-typedef struct HINSTANCE__ * HINSTANCE;
-#    if defined( _WIN64 )
-typedef int64_t( __stdcall * FARPROC )();
-#    else
-typedef int( __stdcall * FARPROC )();
-#    endif
-extern "C" __declspec( dllimport ) HINSTANCE __stdcall LoadLibraryA( char const * lpLibFileName );
-extern "C" __declspec( dllimport ) int __stdcall FreeLibrary( HINSTANCE hLibModule );
-extern "C" __declspec( dllimport ) FARPROC __stdcall GetProcAddress( HINSTANCE hModule, const char * lpProcName );
-#  endif
-#endif
-)";
+    void Generator::generateClassConstructors(const Handle &data, OutputClass &out) {
+        const std::string &superclass = data.superclass;
 
-        output += beginNamespace();
-        generateDispatchRAII(output);
-        generateLoader(output, true);
-        output += endNamespace();
-    }
+        out.sPublic += vkgen::format(R"(
+    VULKAN_HPP_CONSTEXPR {0}() = default;
+)",
+                                     data.name);
 
-    void Generator::generateExperimentalRAII(OutputBuffer &output, GenOutput &out) {
-        output += genNamespaceMacro(cfg.macro.mNamespaceRAII);
-        output += generateIncludeRAII(out);
+//        std::string body;
+//        if (!dispatchInit.empty()) {
+//            body = ", m_dispatcher(" + dispatchInit + ")";
+//        }
 
-        output += beginNamespace();
-        output += "  " + beginNamespaceRAII(true);
+        out.sPublic += vkgen::format(R"(
+    VULKAN_HPP_CONSTEXPR {0}(std::nullptr_t) VULKAN_HPP_NOEXCEPT {{}}
+)",
+                                     data.name,
+                                     strFirstLower(data.name));
 
-        output += RES_RAII;
+        if (!data.isSubclass && cfg.gen.globalMode) {
+            out.sPublic += vkgen::format(R"(
+    VULKAN_HPP_TYPESAFE_EXPLICIT {0}(Vk{0} {1}) VULKAN_HPP_NOEXCEPT {{
+      {2} = {1};
+    }}
+)",
+                                         data.name,
+                                         strFirstLower(data.name),
+                                         data.vkhandle.identifier());
+        }
+        else {
+            out.sPublic += vkgen::format(R"(
+    VULKAN_HPP_TYPESAFE_EXPLICIT {0}(Vk{0} {1}) VULKAN_HPP_NOEXCEPT  : {2}({1}) {{}}
+)",
+                                         data.name,
+                                         strFirstLower(data.name),
+                                         data.vkhandle.identifier());
+        }
 
-        generateClassesRAII(output, true);
+        if (!cfg.gen.globalMode) {
+            const auto &superclass = data.superclass;
 
-        output += "  " + endNamespaceRAII();
-        output += endNamespace();
-    }
+            for (auto &m : const_cast<Handle &>(data).vectorCmds) {
 
-    void Generator::generateRAII(OutputBuffer &output, OutputBuffer &output_forward, GenOutput &out) {
-        output_forward += genNamespaceMacro(cfg.macro.mNamespaceRAII);
+                if (m.name.original == "vkCreateSharedSwapchainsKHR") {
+                    continue;
+                }
 
-        output_forward += beginNamespace();
-        output_forward += "  " + beginNamespaceRAII(true);
+                MemberContext ctx{ .ns = Namespace::VK };
+                ctx.insertSuperclassVar = true;
+                ctx.disableDispatch     = true;
+                ctx.exp                 = true;
+                ctx.returnSingle = true;
+                MemberResolverCtor resolver{ *this, m, ctx };
 
-        output += generateIncludeRAII(out);
+                resolver.generate(out.sPublic, outputFuncs);
+            }
 
-        output += "#include \"vulkan_context.hpp\"\n";
+            for (auto &m : const_cast<Handle &>(data).ctorCmds) {
 
-        output += beginNamespace();
-        output += "  " + beginNamespaceRAII();
+                if (cfg.dbg.methodTags) {
+                    out.sPublic += "    /* exp ctor: " + m.name.original + " */\n";
+                }
+                const auto genCtor = [&](ClassCommand &d) {
+                    MemberContext ctx{ .ns = Namespace::VK };
+                    ctx.insertSuperclassVar = true;
+                    ctx.disableDispatch     = true;
+                    ctx.exp                 = true;
+                    MemberResolverCtor resolver{ *this, d, ctx };
 
-        output += RES_RAII;
+                    if (!resolver.hasDependencies) {
+                        // std::cout << "ctor skipped: class " << data.name << ", s: " << superclass << '\n';
+                        return;
+                    }
 
-        if (cfg.gen.internalFunctions) {
-            std::string spec;
-            if (!cfg.gen.cppModules) {
-                spec = "static";
+                    resolver.generate(out.sPublic, outputFuncs);
+                };
+
+                genCtor(m);
             }
+        }
 
-            output += vkgen::format(R"(
-  namespace internal {{
+    }
 
-    template<typename T, typename V, typename S, typename PFN, typename... Args>
-    inline std::vector<T> createArrayVoidPFN(const PFN pfn, const char *const msg, Args&&... args) {{
-        std::vector<T> data;
-        S count;
-        pfn(std::forward<Args>(args)..., &count, nullptr);
+    void Generator::generateClassConstructorsRAII(const Handle &data, OutputClass &out) {
+        static constexpr Namespace ns = Namespace::RAII;
 
-        if (count) {{
-          data.resize( count );
-          pfn(std::forward<Args>(args)..., &count, {0}<V*>(data.data()));
-        }}
-        if (count < data.size()) {{
-            data.resize( count );
-        }}
+        const auto        &superclass = data.superclass;
+        const std::string &owner      = data.ownerhandle;
 
-        return data;
-    }}
+        const auto genCtor = [&](ClassCommand &d, auto &parent, bool insert = false) {
+            MemberContext ctx{ .ns = ns };
+            ctx.insertSuperclassVar = insert;
+            {
+                MemberResolverCtor resolver{ *this, d, ctx };
 
-    template<typename T, typename V, typename S, typename PFN, typename... Args>
-    inline std::vector<T> createArray(const PFN pfn, const char *const msg, Args&&... args) {{
-        std::vector<T> data;
-        S count;
-        VkResult result;
+                if (!resolver.hasDependencies) {
+                    // std::cout << "ctor skipped: class " << data.name << ", p: " <<
+                    // parent->type() << ", s: " << superclass << '\n';
+                    return;
+                }
 
-        do {{
-          result = pfn(std::forward<Args>(args)..., &count, nullptr);
-          if (result == VK_SUCCESS && count) {{
-            data.resize( count );
-            result = pfn(std::forward<Args>(args)..., &count, {0}<V*>(data.data()));
-          }}
-        }} while (result == VK_INCOMPLETE);
+                resolver.generate(out.sPublic, outputFuncsRAII);
+            }
 
-        resultCheck(static_cast<Result>(result), msg);
-        if (count < data.size()) {{
-            data.resize( count );
-        }}
+            if (cfg.gen.expectedResult && d.src->pfnReturn == Command::PFNReturnCategory::VK_RESULT) {
+                {
+                    MemberResolverCtorNoThrow resolver{ *this, d, ctx };
+                    resolver.generate(out.sPublic, outputFuncsRAII);
+                }
+                {
+                    MemberResolverCtorFactory resolver{ *this, d, ctx };
+                    resolver.generate(out.sPublic, outputFuncsRAII);
+                }
+            }
+        };
 
-        return data;
-    }}
-  }}  // namespace internal
-)",
-                                    m_cast);
-        }
+        for (auto &m : const_cast<Handle &>(data).ctorCmds) {
+            //        if (cfg.dbg.methodTags) {
+            //            out.sPublic += "    /*ctor: " + m.name.original + " */\n";
+            //        }
 
-        for (Handle &e : handles.ordered) {
-            generateClassDecl(output_forward, e);
-        }
+            const auto &parent = *m.src->_params.begin()->get();
+            if (!data.isSubclass && parent.original.type() != superclass.original) {
+                genCtor(m, parent, true);
+            }
 
-        output += "  using " + m_ns + "::" + loader.name + ";\n";
-        for (const Handle &h : topLevelHandles) {
-            // output += "  using " + m_ns + "::" + h.name + ";\n";
-            output += "  using " + m_ns + "::" + h.name + "Dispatcher;\n";
+            if (parent.isHandle()) {
+                genCtor(m, parent);
+            }
         }
 
-        generateClassesRAII(output);
+        {
+            if (cfg.dbg.methodTags) {
+                out.sPublic += "    /*handle constructor*/\n";
+            }
 
-        output_forward += "  " + endNamespaceRAII();
-        output_forward += endNamespace();
+            std::string        parent = strFirstLower(superclass);
+            std::string        handle = strFirstLower(data.name);
+            InitializerBuilder init("        ");
 
-        output += "  " + endNamespaceRAII();
-        output += endNamespace();
+            init.append(data.vkhandle.identifier(), handle);
+            if (data.ownerRaii) {
+                init.append(data.ownerRaii->identifier(), "&" + parent);
+            }
 
-        output += "#include \"" + out.getFilename("_raii_funcs") + "\"\n";
-    }
+            std::string argDecl;
+            std::string argDef;
+            std::string dispatcherInit;
+            if (!data.isSubclass) {
+                if ((cfg.gen.raii.staticInstancePFN && data.name == "Instance") /*|| !cfg.gen.dispatchTableAsUnique*/) {
+                    dispatcherInit = "    m_dispatcher = " + data.name;
+                    dispatcherInit += "Dispatcher( " + parent;
+                    dispatcherInit += ".getDispatcher()->vkGet" + data.name + "ProcAddr, " + handle + " );\n";
+                } else if ((cfg.gen.raii.staticDevicePFN && data.name == "Device") /*|| !cfg.gen.dispatchTableAsUnique*/) {
+                    dispatcherInit = "    m_dispatcher = " + data.name;
+                    dispatcherInit += "Dispatcher( " + parent;
+                    dispatcherInit += ".getDispatcher()->vkGet" + data.name + "ProcAddr, " + handle + " );\n";
+                } else {
+                    dispatcherInit = "    m_dispatcher.reset( new " + data.name;
+                    dispatcherInit += "Dispatcher( " + parent;
+                    dispatcherInit += ".getDispatcher()->vkGet" + data.name + "ProcAddr, " + handle + " ) );\n";
+                }
+            }
+            if (data.secondOwner) {
+                std::string id = strFirstLower(data.secondOwner->type());
+                argDecl += vkgen::format(", Vk{0} {1}", data.secondOwner->type(), id);
+                argDef += vkgen::format(", Vk{0} {1}", data.secondOwner->type(), id);
+                init.append(data.secondOwner->identifier(), id);
+            }
+            if (cfg.gen.allocatorParam && data.creationCat != Handle::CreationCategory::NONE) {
+                argDecl += ", " + m_ns + "::Optional<const " + m_ns + "::AllocationCallbacks> allocator = nullptr";
+                argDef += ", " + m_ns + "::Optional<const " + m_ns + "::AllocationCallbacks> allocator";
+                init.append(cvars.raiiAllocator.identifier(), "static_cast<const " + m_ns + "::AllocationCallbacks *>( allocator )");
+            }
+            if (data.ownerRaii && cfg.gen.raii.cachedDispatcher && !cfg.gen.expApi) {
+                init.append("m_dispatcher", parent + ".getDispatcher()");
+            }
+            if (false) {  // TODO add class var
+                init.append("m_dispacher", "& //getDispatcher()");
+            }
 
-    void Generator::generateFuncsRAII(OutputBuffer &output) {
-        output += beginNamespace();
-        output += "  " + beginNamespaceRAII();
-        output += std::move(outputFuncsRAII.def);
+            out.sPublic += vkgen::format(R"(
+    VULKAN_HPP_INLINE {0}( {5}::{1} const & {2},
+      Vk{0} {3}{4} );
+)",
+                                         data.name,
+                                         superclass,
+                                         parent,
+                                         handle,
+                                         argDecl,
+                                         m_ns_raii);
 
-        // output += std::move(outputFuncsRAII.platform);
-        // output += "#ifndef VULKAN_HPP_DISABLE_ENHANCED_MODE\n";
-        // output += outputFuncsEnhancedRAII.get();
-        // output += "#endif // VULKAN_HPP_DISABLE_ENHANCED_MODE\n";
-        output += "  " + endNamespaceRAII();
-        /*
-        if (cfg.gen.raii.interop) {
-            output += "#ifndef VULKAN_HPP_EXPERIMENTAL_NO_INTEROP\n";
-            // output += outputFuncsInterop.get();
-            output += "#endif // VULKAN_HPP_EXPERIMENTAL_NO_INTEROP\n";
+            outputFuncsRAII.def.add(
+              data,
+              [&](auto &output) {
+                  output += vkgen::format(
+                    "  {0}::{0}( {6}::{1} const & {2}, Vk{0} {3}{4} ){5}\n", data.name, superclass, parent, handle, argDef, init.string(), m_ns_raii);
+                  output += "  {\n";
+                  output += dispatcherInit;
+                  output += "  }\n";
+              });
         }
-        */
-        output += endNamespace();
-    }
 
-    static void initVmaMap(std::unordered_map<std::string, std::pair<const char *, bool>> &vma) {
-        vma.emplace("vkGetInstanceProcAddr", std::make_pair(nullptr, false));
-        vma.emplace("vkGetDeviceProcAddr", std::make_pair(nullptr, false));
-        vma.emplace("vkGetPhysicalDeviceProperties", std::make_pair(nullptr, false));
-        vma.emplace("vkGetPhysicalDeviceMemoryProperties", std::make_pair(nullptr, false));
-        vma.emplace("vkAllocateMemory", std::make_pair(nullptr, false));
-        vma.emplace("vkFreeMemory", std::make_pair(nullptr, false));
-        vma.emplace("vkMapMemory", std::make_pair(nullptr, false));
-        vma.emplace("vkUnmapMemory", std::make_pair(nullptr, false));
-        vma.emplace("vkFlushMappedMemoryRanges", std::make_pair(nullptr, false));
-        vma.emplace("vkInvalidateMappedMemoryRanges", std::make_pair(nullptr, false));
-        vma.emplace("vkBindBufferMemory", std::make_pair(nullptr, false));
-        vma.emplace("vkBindImageMemory", std::make_pair(nullptr, false));
-        vma.emplace("vkGetBufferMemoryRequirements", std::make_pair(nullptr, false));
-        vma.emplace("vkGetImageMemoryRequirements", std::make_pair(nullptr, false));
-        vma.emplace("vkCreateBuffer", std::make_pair(nullptr, false));
-        vma.emplace("vkDestroyBuffer", std::make_pair(nullptr, false));
-        vma.emplace("vkCreateImage", std::make_pair(nullptr, false));
-        vma.emplace("vkDestroyImage", std::make_pair(nullptr, false));
-        vma.emplace("vkCmdCopyBuffer", std::make_pair(nullptr, false));
-        vma.emplace("vkGetBufferMemoryRequirements2KHR", std::make_pair("VMA_DEDICATED_ALLOCATION || VMA_VULKAN_VERSION >= 1001000", false));
-        vma.emplace("vkGetImageMemoryRequirements2KHR", std::make_pair("VMA_DEDICATED_ALLOCATION || VMA_VULKAN_VERSION >= 1001000", false));
-        vma.emplace("vkBindBufferMemory2KHR", std::make_pair("VMA_BIND_MEMORY2 || VMA_VULKAN_VERSION >= 1001000", false));
-        vma.emplace("vkBindImageMemory2KHR", std::make_pair("VMA_BIND_MEMORY2 || VMA_VULKAN_VERSION >= 1001000", false));
-        vma.emplace("vkGetPhysicalDeviceMemoryProperties2KHR", std::make_pair("VMA_MEMORY_BUDGET || VMA_VULKAN_VERSION >= 1001000", false));
-        vma.emplace("vkGetDeviceBufferMemoryRequirements", std::make_pair("VMA_KHR_MAINTENANCE4 || VMA_VULKAN_VERSION >= 1003000", false));
-        vma.emplace("vkGetDeviceImageMemoryRequirements", std::make_pair("VMA_KHR_MAINTENANCE4 || VMA_VULKAN_VERSION >= 1003000", false));
     }
 
-    class DispatchGenerator
-    {
-        const Generator &gen;
-        const Handle    &h;
-        std::string      getAddr;
-        std::string      handle;
-        OutputBuffer      init;
-        OutputBuffer      init2;
-        bool             isContext;
+    void Generator::generateUniqueClassStr(OutputBuffer &output, const Handle &data, bool inlineFuncs) {
+        if (!data.dtorCmd) {
+            std::cerr << "class has no destructor info!" << '\n';
+            return;
+        }
 
-        void generateContextMembers(bool useVma, OutputClass &out, OutputBuffer &output) {
-            std::unordered_map<std::string, std::pair<const char *, bool>> vma;
+        bool const         isSubclass = data.isSubclass;
+        const std::string &base       = data.name;
+        const std::string &handle     = data.vkhandle.identifier();
+        const std::string &superclass = data.superclass;
+        OutputClass     out{
+            .name = "Unique" + base
+        };
+        const auto &className  = out.name;
 
-            if (useVma) {
-                out.inherits += "public VmaVulkanFunctions";
-                initVmaMap(vma);
+        ClassCommand             d{ this, &data, *data.dtorCmd };
+        MemberContext            ctx{ .ns = Namespace::VK, .inUnique = true };
+        MemberResolverUniqueCtor r{ *this, d, ctx };
 
-                // init += "      vkGetDeviceProcAddr = source.vkGetDeviceProcAddr;\n";
+        bool hasAllocation = false;
+        for (VariableData &p : r.cmd->params) {
+            p.setIgnoreFlag(true);
+            p.setIgnoreProto(true);
+            if (p.original.type() == "VkAllocationCallbacks") {
+                hasAllocation = true;
+            }
+        }
 
-                for (auto *d : h.filteredMembers) {
-                    const std::string &name = d->name.original;
-                    auto               it   = vma.find(name);
-                    if (it != vma.end()) {
-                        it->second.second = true;
-                    }
-                }
+        std::string       destroyCall;
+        std::string const destroyMethod = data.creationCat == Handle::CreationCategory::CREATE ? "destroy" : "free";
 
-                for (auto &v : vma) {
-                    if (!v.second.second) {
-                        // init += "/**/";
-                        // init += vkgen::format("      {0} = source.{0};\n", v.first);
-                        init += vkgen::format("      {0} = PFN_{0}(vkGetDeviceProcAddr(device, \"{0}\"));\n", v.first);
-                    } else {
-                        init += "/*" + v.first + "*/\n";
-                    }
+        if (data.ownerUnique) {
+            destroyCall = data.ownerUnique->identifier() + "." + destroyMethod + "(";
+            if (data.secondOwner) {
+                destroyCall += data.secondOwner->identifier() + ", ";
+            }
+            destroyCall += "static_cast<" + base + ">(*this)";
+            if (cfg.gen.allocatorParam && hasAllocation) {
+                destroyCall += ", " + cvars.uniqueAllocator.identifier();
+            }
+            if (cfg.gen.dispatchParam) {
+                destroyCall += ", *" + cvars.uniqueDispatch.identifier();
+            }
+            destroyCall += ");";
+        } else {
+            destroyCall = base + "::" + destroyMethod + "(";
+            std::string args;
+            if (cfg.gen.allocatorParam && hasAllocation) {
+                args += cvars.uniqueAllocator.identifier();
+            }
+            if (cfg.gen.dispatchParam) {
+                if (!args.empty()) {
+                    args += ", ";
                 }
+                args += "*" + cvars.uniqueDispatch.identifier();
             }
+            destroyCall += args;
+            destroyCall += ");";
+        }
 
-            // PFN function pointers
-            for (auto *d : h.filteredMembers) {
-                const std::string &name = d->name.original;
+        auto &var = r.addVar(r.cmd->params.begin());
+        var.setFullType("", base, " const &");
+        var.setIdentifier("value");
 
-                const char *vmaGuard = nullptr;
-                bool        isVma    = false;
-                if (useVma) {
-                    auto it = vma.find(name);
-                    if (it != vma.end()) {
-                        isVma    = !it->second.first;
-                        vmaGuard = it->second.first;
-                    }
-                }
+        ctx.generateInline = true;
+        for (VariableData &p : r.cmd->params) {
+            if (p.original.type() == data.name.original) {
+                p.setIgnoreFlag(true);
+                p.setIgnoreProto(true);
+            } else {
+                p.setIgnoreFlag(false);
+                p.setIgnoreProto(false);
+            }
+            if (p.isHandle()) {
+                p.setConst(true);
+                p.convertToReference();
+            }
+        }
+
+        std::string const pass;
+        out.inherits = "public " + base;
+
+        InitializerBuilder copyCtor("        ");
+        copyCtor.append(base, "other.release()");
+
+        std::string assignemntOp;
+        data.foreachVars(VariableData::Flags::CLASS_VAR_UNIQUE, [&](const VariableData &v) {
+            //        if (v.type() == data.name) {
+            //            return;
+            //        }
+            out.sPrivate += "    " + v.toClassVar(*this);
+            assignemntOp += "\n      " + v.identifier() + " = std::move(other." + v.identifier() + ");";
+            copyCtor.append(v.identifier(), "std::move(other." + v.identifier() + ")");
+        });
+
+        out.sPublic += "    " + className + "() = default;\n";
+
+        r.generate(out.sPublic, outputFuncs);
+
+        out.sPublic += vkgen::format(R"(
+    {0}({0} const &) = delete;
 
-                if (!isVma) {
-                    gen.genOptional(out.sPublic.get(), *d, [&](auto &output) {
-                        if (vmaGuard) {
-                            // oupuut += "/*G*/\n";
-                            output += "#if !(";
-                            output += vmaGuard;
-                            output += ")\n";
-                        }
-                        output += vkgen::format("    PFN_{0} {0} = {{}};\n", name);
-                        if (vmaGuard) {
-                            output += "#endif\n";
-                        }
-                    });
-                }
+    {0}({0} && other) VULKAN_HPP_NOEXCEPT{2}
+    {{
+    }}
 
-                gen.genOptional(init,
-                  *d, [&](auto &output) { output += vkgen::format("      {0} = PFN_{0}( {1}({2}, \"{0}\") );\n", name, getAddr, handle); });
+    ~{0}() VULKAN_HPP_NOEXCEPT {{
+      if ({1}) {{
+        this->destroy();
+      }}
+    }}
 
-                gen.genOptional(init2, *d, [&](auto &output) {
-                    for (const auto &alias : d->src->aliases) {
-                        const auto *cmd = gen.findCommand(alias.name.original);
-                        if (!cmd) {
-                            std::cerr << "generateContextMembers() cmd not found: " << alias.name << "\n";
-                            continue;
-                        }
-                        std::string str = cmd->canGenerate() ? std::string(alias.name) : vkgen::format("PFN_{0}( {1}({2}, \"{3}\") )", name, getAddr, handle, alias.name);
+    {0}& operator=({0} const&) = delete;
 
-                        output += vkgen::format(R"(      if ( !{0} )
-        {0} = {1};
 )",
-                                                name,
-                                                str);
-                    }
-                });
-            }
-        }
-
-      public:
-        DispatchGenerator(const Generator &gen, const Handle &h, bool isContext = false) : gen(gen), h(h), isContext(isContext) {}
+                                     className,
+                                     handle,
+                                     copyCtor.string());
 
-        void generate(OutputBuffer &output) {
-            init.clear();
-            init2.clear();
-            OutputClass out {
-                .name = h.name + "Dispatcher"
-            };
-            const auto &name = out.name;
+        out.sPublic += vkgen::format(R"(
+    {0}& operator=({0} && other) VULKAN_HPP_NOEXCEPT {{
+      reset(other.release());{1}
+      return *this;
+    }}
+)",
+                                     className,
+                                     assignemntOp);
 
-            std::string src;
-            if (isContext) {
-                getAddr = "vkGetInstanceProcAddr";
-                handle  = "NULL";
-            } else if (h.getAddrCmd.has_value()) {
-                getAddr = h.getAddrCmd->name.original;
-                handle  = strFirstLower(h.name);
-                src     = h.name.original + " " + handle;
-            }
+        out.sPublic += vkgen::format(R"(
 
-            const bool useVma = h.name == "Device" && gen.getConfig().gen.integrateVma;
+    explicit operator bool() const VULKAN_HPP_NOEXCEPT {{
+      return {1}::operator bool();
+    }}
 
-            generateContextMembers(useVma, out, output);
+    {1} const * operator->() const VULKAN_HPP_NOEXCEPT {{
+      return this;
+    }}
 
-            if (!useVma) {
-                out.sPublic += "    PFN_" + getAddr + " " + getAddr + " = {};\n";
-            }
-            out.sPublic += "\n";
+    {1} * operator->() VULKAN_HPP_NOEXCEPT {{
+      return this;
+    }}
 
-            out.sPublic += "    " + name + "() = default;\n";
+    {1} const & operator*() const VULKAN_HPP_NOEXCEPT {{
+      return *this;
+    }}
 
-            if (h.name == "Instance") {
-                std::string name = "vkGetDeviceProcAddr";
-                out.sPublic += "    PFN_" + name + " " + name + " = {};\n";
-                init += vkgen::format("      {0} = PFN_{0}( {1}({2}, \"{0}\") );\n", name, getAddr, handle);
-            }
+    {1} & operator*() VULKAN_HPP_NOEXCEPT {{
+      return *this;
+    }}
 
-//            std::string ctorInit = "VmaVulkanFunctions()";
-//            if (!useVma) {
-//                ctorInit = getAddr;
-//                ctorInit += isContext ? "(getProcAddr)" : "(source.vkGet" + h.name + "ProcAddr)";
-//            }
+    const {1}& get() const VULKAN_HPP_NOEXCEPT {{
+      return *this;
+    }}
 
-            std::string addrInit = "      " + getAddr + " = getProcAddr;\n";
-            // std::string addrInit = "      " + getAddr + " = ";
-            // addrInit += isContext ? "getProcAddr" : "source.vkGet" + h.name + "ProcAddr";
-            // addrInit += ";\n";
+    {1}& get() VULKAN_HPP_NOEXCEPT {{
+      return *this;
+    }}
 
-            {
-                std::string args = "PFN_" + getAddr + " getProcAddr";
-                std::string loadArgs = "getProcAddr";
-                if (!isContext) {
-                    args     += ", " + src;
-                    loadArgs += ", " + handle;
-                }
-                // else {
-                    // args     = "const " + h.superclass + "Dispatcher &source, " + src;
-                    // loadArgs = "source, " + handle;
-                // }
-                out.sPublic += vkgen::format(R"(
-    {0}({1}) {{
-      load({2});
+    void reset({1} const &value = {1}()) {{
+      if ({2} != static_cast<Vk{1}>(value) ) {{
+        if ({2}) {{
+          {3}
+        }}
+        {2} = value;
+      }}
     }}
-)",
-                                             name,
-                                             args,
-                                             loadArgs);
 
-                if (!isContext) {
-                    std::string dispatchArgs = "const " + h.superclass + "Dispatcher &source, " + src;
-                    std::string dispatchLoadArgs = "source.vkGet" + h.name + "ProcAddr, " + handle;
+    {1} release() VULKAN_HPP_NOEXCEPT {{
+      {1} value = *this;
+      {2} = nullptr;
+      return value;
+    }}
 
-                    out.sPublic += vkgen::format(R"(
-    {0}({1}) {{
-      load({2});
+    void destroy() {{
+      {3}
+      {2} = nullptr;
     }}
 
-    void load({1}) {{
-      load({2});
+    void swap({0} &rhs) VULKAN_HPP_NOEXCEPT {{
+      std::swap(*this, rhs);
     }}
+
 )",
-                    name,
-                    dispatchArgs,
-                    dispatchLoadArgs );
-                }
+                                     className,
+                                     base,
+                                     handle,
+                                     destroyCall);
 
-                out.sPublic += "    void load(" + args + ") {\n";
-                out.sPublic += std::move(addrInit);
-                out.sPublic += std::move(init);
-                out.sPublic += std::move(init2);
-                out.sPublic += "    }\n";
-            }
+        output += std::move(out);
+
+        output += vkgen::format(R"(
+  VULKAN_HPP_INLINE void swap({0} &lhs, {0} &rhs) VULKAN_HPP_NOEXCEPT {{
+    lhs.swap(rhs);
+  }}
 
+)",
+                                className);
+    }
 
-            if (useVma) {
-                out.sPublic += R"(
-    VULKAN_HPP_NODISCARD const VmaVulkanFunctions* vma() const {
-      return this;
+    void Generator::generateUniqueClass(OutputBuffer &output, const Handle &data) {
+        genPlatform(output, data, [&](auto &output) { generateUniqueClassStr(output, data, false); });
     }
-)";
+
+//    std::string Generator::generateUniqueClass(const Handle &data) {
+//        std::string output;
+//        if (!data.getProtect().empty()) {
+//            outputFuncs.platform.add(data, [&](std::string &output) { output += generateUniqueClassStr(data, true); });
+//        } else {
+//            output += genOptional(data, [&](std::string &output) { output += generateUniqueClassStr(data, false); });
+//        }
+//        return output;
+//    }
+
+    void Generator::generateClassTypeInfo(const Handle &h, OutputBuffer &output, OutputClass &out) {
+        std::string debugReportValue;
+        bool unknown = false;
+        {
+            auto en = enums.find("VkDebugReportObjectTypeEXT");
+            if (en != enums.end()) {
+                auto it = en->find("e" + out.name);
+                if (it) {
+                    debugReportValue = cfg.gen.globalMode? it->name.original : it->name;
+                }
+            }
+            if (debugReportValue.empty()) {
+                unknown = true;
+                debugReportValue = cfg.gen.globalMode? "VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT" : "eUnknown";
             }
+        }
+
+        out.sPublic += vkgen::format(R"(
+    using CType      = Vk{0};
+    using NativeType = Vk{0};
+)",
+                                     out.name);
+
+
+        if (!cfg.gen.globalMode) {
+            out.sPublic += vkgen::format(R"(
+    static {3} {2}::ObjectType objectType =
+      {2}::ObjectType::{0};
+    static {3} {2}::DebugReportObjectTypeEXT debugReportObjectType =
+      {2}::DebugReportObjectTypeEXT::{1};
+)",
+            h.objType,
+            debugReportValue,
+            m_ns,
+            cfg.gen.expandMacros? "constexpr" : "VULKAN_HPP_CONST_OR_CONSTEXPR");
+        }
+        else {
+            out.sPublic += vkgen::format(R"(
+    static {0} VkObjectType objectType = {1};
+    static {0} VkDebugReportObjectTypeEXT debugReportObjectType = {2};
+)",
+                cfg.gen.expandMacros? "constexpr" : "VULKAN_HPP_CONST_OR_CONSTEXPR",
+                h.objType.original,
+                debugReportValue
+            );
+        }
+
+        if (!cfg.gen.globalMode) {
+            gen(output, cfg.gen.handleTemplates, [&](auto &output) {
+                output += vkgen::format(R"(
+  template <>
+  struct CppType<{0}::ObjectType, {0}::ObjectType::e{1}>
+  {{
+    using Type = {0}::{1};
+  }};
+
+)",
+                                        m_ns,
+                                        out.name);
 
-            output += std::move(out);
+                if (!unknown) {
+                    output += vkgen::format(R"(
+  template <>
+  struct CppType<{0}::DebugReportObjectTypeEXT,
+                 {0}::DebugReportObjectTypeEXT::{2}>
+  {{
+    using Type = {0}::{1};
+  }};
 
-            //        if (h.name == "Instance" && cfg.gen.staticInstancePFN) {
-            //            output += "    static " + name + " instanceDispatcher;\n";
-            //        }
-            //        else if (h.name == "Device" && cfg.gen.staticDevicePFN) {
-            //            output += "    static " + name + " deviceDispatcher;\n";
-            //        }
+)",
+                                            m_ns,
+                                            out.name,
+                                            debugReportValue);
+                }
+
+                output += vkgen::format(R"(
+  template <>
+  struct isVulkanHandleType<{0}::{1}>
+  {{
+    static VULKAN_HPP_CONST_OR_CONSTEXPR bool value = true;
+  }};
+)",
+                                        m_ns,
+                                        out.name);
+            });
         }
-    };
 
-    void Generator::generateDispatchRAII(OutputBuffer &output) {
-        auto &instance = findHandle("VkInstance");
-        auto &device   = findHandle("VkDevice");
+    }
 
-        DispatchGenerator(*this, loader, true).generate(output);
-        DispatchGenerator(*this, instance).generate(output);
-        DispatchGenerator(*this, device).generate(output);
+    void Generator::generateClass(OutputBuffer &output, const Handle &data, bool inlineFuncs, bool noFuncs) {
+        OutputClass out {
+            .name = data.name
+        };
+        const auto &className      = out.name;
+        const std::string &classNameLower = strFirstLower(className);
+        const std::string &handle         = data.vkhandle.identifier();
+        const std::string &superclass     = data.superclass;
 
-        output += "\nstruct Dispatch : public InstanceDispatcher, DeviceDispatcher {};\n";
-    }
+        // std::cout << "Gen class: " << className << '\n';
+        // std::cout << "  ->superclass: " << superclass << '\n';
 
-    void Generator::evalCommand(Command &cmd) const {
-        std::string const name = cmd.name;
-        std::string const tag  = strWithoutTag(name);
-        cmd.nameCat            = evalNameCategory(name);
-    }
+        generateClassTypeInfo(data, output, out);
 
-    vkgen::vkr::Command::NameCategory Generator::evalNameCategory(const std::string &name) {
-        using enum Command::NameCategory;
-        if (name.starts_with("get")) {
-            return GET;
-        }
-        if (name.starts_with("allocate")) {
-            return ALLOCATE;
-        }
-        if (name.starts_with("acquire")) {
-            return ACQUIRE;
-        }
-        if (name.starts_with("create")) {
-            return CREATE;
-        }
-        if (name.starts_with("enumerate")) {
-            return ENUMERATE;
-        }
-        if (name.starts_with("write")) {
-            return WRITE;
-        }
-        if (name.starts_with("destroy")) {
-            return DESTROY;
-        }
-        if (name.starts_with("free")) {
-            return FREE;
+        std::string dispatchInit;
+        std::string dispatchInitArg;
+        /*
+        if (!data.isSubclass && cfg.gen.globalMode) {
+            dispatchInitArg =  "*" + m_ns + "::" + strFirstLower(superclass) + ".getDispatcher(), " + classNameLower;
+            dispatchInit = "\n      m_dispatcher.load(" + dispatchInitArg + ");\n";
         }
-        return UNKNOWN;
-    }
-
-    void Generator::generateClassMember(ClassCommand &m, MemberContext &ctx, OutputClass &out, GuardedOutputFuncs &outFuncs, bool inlineFuncs) {
+        */
 
-        GuardedOutput tmp;
+        generateClassConstructors(data, out);
 
-        MemberGenerator g{ *this, m, tmp, outFuncs };
-        if (ctx.globalUseCAPI) {
-            g.ctx.globalUseCAPI = true;
-        }
-        g.generate();
+        if (cfg.gen.raii.interop && false) {
+            const auto &superclass = data.superclass;
 
-        // TODO
-        {
-            std::stringstream str;
-            tmp.write(str);
-            out.sFuncs += str.str();
-        }
-    }
+            const auto genCtor = [&](ClassCommand &d, auto &parent, bool insert = false) {
+                MemberContext ctx{ .ns = Namespace::RAII };
+                ctx.insertSuperclassVar = insert;
 
-    void Generator::generateClassMembers(const Handle &data, OutputClass &out, GuardedOutputFuncs &outFuncs, Namespace ns, bool inlineFuncs) {
-        std::string output;
-        if (ns == Namespace::RAII) {
-            const auto        &className = data.name;
-            const auto        &handle    = data.vkhandle.identifier();
-            const std::string &ldr       = loader.name;
+                MemberResolverCtor resolver{ *this, d, ctx };
 
-            const auto  &superclass = findHandle("Vk" + data.superclass);
-            VariableData super(superclass.name);
-            super.setConst(true);
+                if (!resolver.hasDependencies) {
+                    // std::cout << "ctor skipped: class " << data.name << ", s: " << superclass << '\n';
+                    return;
+                }
 
-            std::string call;
-            if (data.dtorCmd) {
-                MemberContext                 ctx{ .ns = ns };
-                ClassCommand                  d(this, &data, *data.dtorCmd);
-                MemberResolverClearRAII const r{ *this, d, ctx };
-                call = r.temporary(handle);
-            }
-
-            std::string clear;
-            std::string swap;
-            data.foreachVars(VariableData::Flags::CLASS_VAR_RAII, [&](const VariableData &v) {
-                clear += "      " + v.identifier() + " = nullptr;\n";
-                swap += "      std::swap( " + v.identifier() + ", rhs." + v.identifier() + " );\n";
-            });
+                out.sPublic += "// INTER:\n";
+                resolver.guard              = "VULKAN_HPP_EXPERIMENTAL_INTEROP";
+                resolver.constructorInterop = true;
+                resolver.generate(out.sPublic, outputFuncsRAII);
+            };
 
-            output += vkgen::format(R"(
-    inline void {0}::clear() VULKAN_HPP_NOEXCEPT {{
-{1}{2}
-    }}
+            for (auto &m : const_cast<Handle &>(data).ctorCmds) {
 
-    inline void {0}::swap({4}::{0} &rhs) VULKAN_HPP_NOEXCEPT {{
-{3}
-    }}
-)",
-                                    className,
-                                    call,
-                                    clear,
-                                    swap,
-                                    m_ns_raii);
-        }
+                const auto &parent = *m.src->_params.begin()->get();
+                if (parent.original.type() != superclass.original) {
+                    // out.sPublic += "  // RAII CTOR 2\n";
+                    genCtor(m, parent, true);
 
-        if (!output.empty()) {
-            genOptional(outputFuncsRAII.def.get(), data, [&](auto &out) { out += output; });
-        }
+                    if (parent.isHandle()) {
+                        const auto &handle = findHandle(parent.original.type());
+                        if (handle.superclass.original != superclass.original) {
+                            std::cerr << "ctor: impossible combination" << '\n';
+                            continue;
+                        }
+                    }
+                }
 
-        // wrapper functions
-        for (ClassCommand &m : const_cast<Handle &>(data).members) {
-            if (ns == Namespace::VK && m.src->isIndirect()) {
-                continue;
+                // out.sPublic += "  // RAII CTOR\n";
+                if (parent.isHandle()) {
+                    genCtor(m, parent);
+                }
             }
-            MemberContext ctx{ .ns = ns };
-            generateClassMember(m, ctx, out, outFuncs, inlineFuncs);
         }
-    }
-
-    void Generator::generateClassConstructors(const Handle &data, OutputClass &out) {
-        const std::string &superclass = data.superclass;
 
-        out.sPublic += vkgen::format(R"(
-    VULKAN_HPP_CONSTEXPR {0}() = default;
-)",
-                                     data.name);
 
-//        std::string body;
-//        if (!dispatchInit.empty()) {
-//            body = ", m_dispatcher(" + dispatchInit + ")";
+        out.sProtected += "    ";
+//        if (!data.isSubclass && cfg.gen.globalMode) {
+//            out.sProtected += "static ";
 //        }
-
-        out.sPublic += vkgen::format(R"(
-    VULKAN_HPP_CONSTEXPR {0}(std::nullptr_t) VULKAN_HPP_NOEXCEPT {{}}
-)",
-                                     data.name,
-                                     strFirstLower(data.name));
-
+        out.sProtected += data.name.original + " " + handle;
+        if (data.isSubclass || !cfg.gen.globalMode) {
+            out.sProtected += " = {}";
+        }
+        out.sProtected += ";\n";
+        /*
         if (!data.isSubclass && cfg.gen.globalMode) {
+            // out.sProtected += "    static " + data.name + "Dispatcher m_dispatcher;\n";
+
             out.sPublic += vkgen::format(R"(
-    VULKAN_HPP_TYPESAFE_EXPLICIT {0}(Vk{0} {1}) VULKAN_HPP_NOEXCEPT {{
-      {2} = {1};
+    static {0}Dispatcher* getDispatcher() noexcept {{
+      return &m_dispatcher;
     }}
-)",
-                                         data.name,
-                                         strFirstLower(data.name),
-                                         data.vkhandle.identifier());
-        }
-        else {
-            out.sPublic += vkgen::format(R"(
-    VULKAN_HPP_TYPESAFE_EXPLICIT {0}(Vk{0} {1}) VULKAN_HPP_NOEXCEPT  : {2}({1}) {{}}
-)",
-                                         data.name,
-                                         strFirstLower(data.name),
-                                         data.vkhandle.identifier());
+)",         data.name);
         }
+        */
 
-        if (!cfg.gen.globalMode) {
-            const auto &superclass = data.superclass;
-
-            for (auto &m : const_cast<Handle &>(data).vectorCmds) {
-
-                if (m.name.original == "vkCreateSharedSwapchainsKHR") {
-                    continue;
-                }
+        out.sPublic += vkgen::format(R"(
+    operator Vk{0}() const {{
+      return {2};
+    }}
 
-                MemberContext ctx{ .ns = Namespace::VK };
-                ctx.insertSuperclassVar = true;
-                ctx.disableDispatch     = true;
-                ctx.exp                 = true;
-                ctx.returnSingle = true;
-                MemberResolverCtor resolver{ *this, m, ctx };
+    explicit operator bool() const VULKAN_HPP_NOEXCEPT {{
+      return {2} != VK_NULL_HANDLE;
+    }}
 
-                resolver.generate(out.sPublic, outputFuncs);
-            }
+    bool operator!() const VULKAN_HPP_NOEXCEPT {{
+      return {2} == VK_NULL_HANDLE;
+    }}
 
-            for (auto &m : const_cast<Handle &>(data).ctorCmds) {
+#if defined( VULKAN_HPP_TYPESAFE_CONVERSION )
+    {0} & operator=( Vk{0} {1} ) VULKAN_HPP_NOEXCEPT
+    {{
+      {2} = {1};{5}
+      return *this;
+    }}
+#endif
 
-                if (cfg.dbg.methodTags) {
-                    out.sPublic += "    /* exp ctor: " + m.name.original + " */\n";
-                }
-                const auto genCtor = [&](ClassCommand &d) {
-                    MemberContext ctx{ .ns = Namespace::VK };
-                    ctx.insertSuperclassVar = true;
-                    ctx.disableDispatch     = true;
-                    ctx.exp                 = true;
-                    MemberResolverCtor resolver{ *this, d, ctx };
+    {0} & operator=( std::nullptr_t ) VULKAN_HPP_NOEXCEPT
+    {{
+      {2} = {{}};
+      return *this;
+    }}
 
-                    if (!resolver.hasDependencies) {
-                        // std::cout << "ctor skipped: class " << data.name << ", s: " << superclass << '\n';
-                        return;
-                    }
+{3}
+#   if defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
+    auto operator<=>( {0} const & ) const = default;
+#  else
+    bool operator==( {0} const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {{
+      return {2} == rhs.{2};
+    }}
 
-                    resolver.generate(out.sPublic, outputFuncs);
-                };
+    bool operator!=( {0} const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {{
+      return {2} != rhs.{2};
+    }}
 
-                genCtor(m);
+    bool operator<( {0} const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {{
+      return {2} < rhs.{2};
+    }}
+#  endif
+{4}
+)",
+                                     className,
+                                     classNameLower,
+                                     handle,
+                                     expIfndef("VULKAN_HPP_EXPERIMENTAL_NO_CLASS_COMPARE"),
+                                     expEndif("VULKAN_HPP_EXPERIMENTAL_NO_CLASS_COMPARE"),
+                                     dispatchInit);
+
+        noFuncs = cfg.gen.globalMode;
+        if (!noFuncs) {
+            if (cfg.gen.expApi || cfg.gen.globalMode) {
+                for (ClassCommand &m : const_cast<Handle &>(data).members) {
+                    MemberGenerator g{ *this, m, out.sPublic, outputFuncs };
+                    g.generate();
+                }
+            } else {
+                generateClassMembers(data, out, outputFuncs, Namespace::VK, inlineFuncs);
             }
         }
 
+        output += std::move(out);
     }
 
-    void Generator::generateClassConstructorsRAII(const Handle &data, OutputClass &out) {
-        static constexpr Namespace ns = Namespace::RAII;
-
-        const auto        &superclass = data.superclass;
-        const std::string &owner      = data.ownerhandle;
-
-        const auto genCtor = [&](ClassCommand &d, auto &parent, bool insert = false) {
-            MemberContext ctx{ .ns = ns };
-            ctx.insertSuperclassVar = insert;
-            MemberResolverCtor resolver{ *this, d, ctx };
-
-            if (!resolver.hasDependencies) {
-                // std::cout << "ctor skipped: class " << data.name << ", p: " <<
-                // parent->type() << ", s: " << superclass << '\n';
-                return;
+    bool Generator::generateMemoizedQueriesRAII(OutputBuffer &output, const Handle &data, OutputClass &out) {
+        std::set<std::string> selected;
+        {
+            std::string name;
+            for (char c : cfg.gen.raii.memoizedCommands.data + ',') {
+                if (c == ',' || std::isspace(static_cast<unsigned char>(c))) {
+                    if (!name.empty()) {
+                        selected.emplace(std::move(name));
+                        name.clear();
+                    }
+                } else {
+                    name += c;
+                }
             }
+        }
 
-            resolver.generate(out.sPublic, outputFuncsRAII);
+        enum class Kind
+        {
+            eValue,
+            eEnumerate,
+            eFormat
         };
+        struct Query
+        {
+            const ClassCommand *m;
+            Kind                kind;
+            std::string         type;
+            std::string         ctype;
+            std::string         field;
+        };
+        std::vector<Query> queries;
 
-        for (auto &m : const_cast<Handle &>(data).ctorCmds) {
-            //        if (cfg.dbg.methodTags) {
-            //            out.sPublic += "    /*ctor: " + m.name.original + " */\n";
-            //        }
-
-            const auto &parent = *m.src->_params.begin()->get();
-            if (!data.isSubclass && parent.original.type() != superclass.original) {
-                genCtor(m, parent, true);
-            }
-
-            if (parent.isHandle()) {
-                genCtor(m, parent);
+        for (const auto &m : data.members) {
+            const Command     &cmd  = *m.src;
+            const std::string &name = cmd.name.original;
+            if (cmd.isAlias() || !cmd.canGenerate()) {
+                continue;
             }
-        }
-
-        {
-            if (cfg.dbg.methodTags) {
-                out.sPublic += "    /*handle constructor*/\n";
+            if (selected.empty() ? !name.starts_with("vkGetPhysicalDevice") : !selected.contains(name)) {
+                continue;
             }
 
-            std::string        parent = strFirstLower(superclass);
-            std::string        handle = strFirstLower(data.name);
-            InitializerBuilder init("        ");
-
-            init.append(data.vkhandle.identifier(), handle);
-            if (data.ownerRaii) {
-                init.append(data.ownerRaii->identifier(), "&" + parent);
+            // immutable queries: void return, single non-handle output struct
+            std::vector<const VariableData *> params;
+            for (const auto &p : cmd._params) {
+                params.push_back(p.get());
             }
-
-            std::string argDecl;
-            std::string argDef;
-            std::string dispatcherInit;
-            if (!data.isSubclass) {
-                if ((cfg.gen.raii.staticInstancePFN && data.name == "Instance") /*|| !cfg.gen.dispatchTableAsUnique*/) {
-                    dispatcherInit = "    m_dispatcher = " + data.name;
-                    dispatcherInit += "Dispatcher( " + parent;
-                    dispatcherInit += ".getDispatcher()->vkGet" + data.name + "ProcAddr, " + handle + " );\n";
-                } else if ((cfg.gen.raii.staticDevicePFN && data.name == "Device") /*|| !cfg.gen.dispatchTableAsUnique*/) {
-                    dispatcherInit = "    m_dispatcher = " + data.name;
-                    dispatcherInit += "Dispatcher( " + parent;
-                    dispatcherInit += ".getDispatcher()->vkGet" + data.name + "ProcAddr, " + handle + " );\n";
+            const VariableData *result = params.empty() ? nullptr : params.back();
+            Kind kind = Kind::eValue;
+            bool supported = cmd.type == "void" && result && result->original.isPointer() && !result->original.isConst() && !result->isHandle();
+            if (supported) {
+                if (params.size() == 3 && params[1]->original.type() == "uint32_t" && params[1]->original.isPointer() && !params[1]->original.isConst()) {
+                    kind = Kind::eEnumerate;
+                } else if (params.size() == 3 && params[1]->original.type() == "VkFormat" && !params[1]->original.isPointer()) {
+                    kind = Kind::eFormat;
                 } else {
-                    dispatcherInit = "    m_dispatcher.reset( new " + data.name;
-                    dispatcherInit += "Dispatcher( " + parent;
-                    dispatcherInit += ".getDispatcher()->vkGet" + data.name + "ProcAddr, " + handle + " ) );\n";
+                    supported = params.size() == 2;
                 }
             }
-            if (data.secondOwner) {
-                std::string id = strFirstLower(data.secondOwner->type());
-                argDecl += vkgen::format(", Vk{0} {1}", data.secondOwner->type(), id);
-                argDef += vkgen::format(", Vk{0} {1}", data.secondOwner->type(), id);
-                init.append(data.secondOwner->identifier(), id);
-            }
-            if (cfg.gen.allocatorParam && data.creationCat != Handle::CreationCategory::NONE) {
-                argDecl += ", " + m_ns + "::Optional<const " + m_ns + "::AllocationCallbacks> allocator = nullptr";
-                argDef += ", " + m_ns + "::Optional<const " + m_ns + "::AllocationCallbacks> allocator";
-                init.append(cvars.raiiAllocator.identifier(), "static_cast<const " + m_ns + "::AllocationCallbacks *>( allocator )");
-            }
-            if (false) {  // TODO add class var
-                init.append("m_dispacher", "& //getDispatcher()");
+            const auto s = supported ? structs.find(result->original.type()) : structs.end();
+            if (s == structs.end() || !s->canGenerate()) {
+                if (!selected.empty()) {
+                    std::cerr << "memoized query not supported: " << name << '\n';
+                }
+                continue;
             }
 
-            out.sPublic += vkgen::format(R"(
-    VULKAN_HPP_INLINE {0}( {5}::{1} const & {2},
-      Vk{0} {3}{4} );
-)",
-                                         data.name,
-                                         superclass,
-                                         parent,
-                                         handle,
-                                         argDecl,
-                                         m_ns_raii);
-
-            outputFuncsRAII.def.add(
-              data,
-              [&](auto &output) {
-                  output += vkgen::format(
-                    "  {0}::{0}( {6}::{1} const & {2}, Vk{0} {3}{4} ){5}\n", data.name, superclass, parent, handle, argDef, init.string(), m_ns_raii);
-                  output += "  {\n";
-                  output += dispatcherInit;
-                  output += "  }\n";
-              });
+            std::string field = m.name;
+            if (field.starts_with("get")) {
+                field = strFirstLower(field.substr(3));
+            }
+            queries.push_back(Query{ &m, kind, m_ns + "::" + std::string(s->name), result->original.type(), field });
         }
 
-    }
-
-    void Generator::generateUniqueClassStr(OutputBuffer &output, const Handle &data, bool inlineFuncs) {
-        if (!data.dtorCmd) {
-            std::cerr << "class has no destructor info!" << '\n';
-            return;
+        if (queries.empty()) {
+            return false;
         }
 
-        bool const         isSubclass = data.isSubclass;
-        const std::string &base       = data.name;
-        const std::string &handle     = data.vkhandle.identifier();
-        const std::string &superclass = data.superclass;
-        OutputClass     out{
-            .name = "Unique" + base
-        };
-        const auto &className  = out.name;
-
-        ClassCommand             d{ this, &data, *data.dtorCmd };
-        MemberContext            ctx{ .ns = Namespace::VK, .inUnique = true };
-        MemberResolverUniqueCtor r{ *this, d, ctx };
+        const std::string &handle = data.vkhandle.identifier();
 
-        bool hasAllocation = false;
-        for (VariableData &p : r.cmd->params) {
-            p.setIgnoreFlag(true);
-            p.setIgnoreProto(true);
-            if (p.original.type() == "VkAllocationCallbacks") {
-                hasAllocation = true;
+        bool        formats = false;
+        std::string cache   = R"(
+    // filled lazily on first query, each entry once (std::call_once), safe to query from several threads
+    struct QueryCache
+    {
+)";
+        for (const auto &q : queries) {
+            std::string field;
+            std::string method;
+            const std::string &pfn = q.m->src->name.original;
+            switch (q.kind) {
+                case Kind::eValue:
+                    field  = vkgen::format("      {0} {1};\n      std::once_flag {1}Once;\n", q.type, q.field);
+                    method = vkgen::format(R"(
+    VULKAN_HPP_NODISCARD {0} const & {1}() const
+    {{
+      QueryCache & cache = getQueryCache();
+      std::call_once( cache.{5}Once,
+                      [&] {{ getDispatcher()->{2}( static_cast<VkPhysicalDevice>( {3} ), reinterpret_cast<{4} *>( &cache.{5} ) ); }} );
+      return cache.{5};
+    }}
+)",
+                                           q.type,
+                                           q.m->name,
+                                           pfn,
+                                           handle,
+                                           q.ctype,
+                                           q.field);
+                    break;
+                case Kind::eEnumerate:
+                    field  = vkgen::format("      std::vector<{0}> {1};\n      std::once_flag {1}Once;\n", q.type, q.field);
+                    method = vkgen::format(R"(
+    VULKAN_HPP_NODISCARD std::vector<{0}> const & {1}() const
+    {{
+      QueryCache & cache = getQueryCache();
+      std::call_once( cache.{5}Once,
+                      [&]
+                      {{
+                        uint32_t count = 0;
+                        getDispatcher()->{2}( static_cast<VkPhysicalDevice>( {3} ), &count, nullptr );
+                        cache.{5}.resize( count );
+                        getDispatcher()->{2}( static_cast<VkPhysicalDevice>( {3} ), &count, reinterpret_cast<{4} *>( cache.{5}.data() ) );
+                        cache.{5}.resize( count );
+                      }} );
+      return cache.{5};
+    }}
+)",
+                                           q.type,
+                                           q.m->name,
+                                           pfn,
+                                           handle,
+                                           q.ctype,
+                                           q.field);
+                    break;
+                case Kind::eFormat:
+                    formats = true;
+                    field   = vkgen::format(R"(      {0} {1}[query_detail::formatSlotCount];
+      std::once_flag {1}Once[query_detail::formatSlotCount];
+)",
+                                          q.type,
+                                          q.field);
+                    // returned by value: formats without a slot (unknown to this registry) are queried each time
+                    method = vkgen::format(R"(
+    VULKAN_HPP_NODISCARD {0} {1}( {6}::Format format ) const
+    {{
+      uint32_t const slot = query_detail::formatSlot( static_cast<VkFormat>( format ) );
+      if ( slot == query_detail::formatSlotCount )
+      {{
+        {0} uncached;
+        getDispatcher()->{2}( static_cast<VkPhysicalDevice>( {3} ), static_cast<VkFormat>( format ), reinterpret_cast<{4} *>( &uncached ) );
+        return uncached;
+      }}
+      QueryCache & cache = getQueryCache();
+      std::call_once( cache.{5}Once[slot],
+                      [&] {{ getDispatcher()->{2}( static_cast<VkPhysicalDevice>( {3} ), static_cast<VkFormat>( format ), reinterpret_cast<{4} *>( &cache.{5}[slot] ) ); }} );
+      return cache.{5}[slot];
+    }}
+)",
+                                            q.type,
+                                            q.m->name,
+                                            pfn,
+                                            handle,
+                                            q.ctype,
+                                            q.field,
+                                            m_ns);
+                    break;
+            }
+            const auto &protect = q.m->src->getProtect();
+            if (!protect.empty()) {
+                cache += "#if defined(";
+                cache += protect;
+                cache += ")\n" + field + "#endif // ";
+                cache += protect;
+                cache += "\n";
+            } else {
+                cache += field;
             }
+            out.sPublic.add(*q.m->src, [&](OutputBuffer &output) { output += method; });
         }
+        cache += R"(    };
 
-        std::string       destroyCall;
-        std::string const destroyMethod = data.creationCat == Handle::CreationCategory::CREATE ? "destroy" : "free";
+    // owns cache, first query from any thread publishes it, losing threads drop their copy
+    struct QueryCacheHolder
+    {
+      std::atomic<QueryCache *> cache = {};
 
-        if (data.ownerUnique) {
-            destroyCall = data.ownerUnique->identifier() + "." + destroyMethod + "(";
-            if (data.secondOwner) {
-                destroyCall += data.secondOwner->identifier() + ", ";
-            }
-            destroyCall += "static_cast<" + base + ">(*this)";
-            if (cfg.gen.allocatorParam && hasAllocation) {
-                destroyCall += ", " + cvars.uniqueAllocator.identifier();
-            }
-            if (cfg.gen.dispatchParam) {
-                destroyCall += ", *" + cvars.uniqueDispatch.identifier();
-            }
-            destroyCall += ");";
-        } else {
-            destroyCall = base + "::" + destroyMethod + "(";
-            std::string args;
-            if (cfg.gen.allocatorParam && hasAllocation) {
-                args += cvars.uniqueAllocator.identifier();
-            }
-            if (cfg.gen.dispatchParam) {
-                if (!args.empty()) {
-                    args += ", ";
-                }
-                args += "*" + cvars.uniqueDispatch.identifier();
-            }
-            destroyCall += args;
-            destroyCall += ");";
-        }
+      QueryCacheHolder() = default;
 
-        auto &var = r.addVar(r.cmd->params.begin());
-        var.setFullType("", base, " const &");
-        var.setIdentifier("value");
+      QueryCacheHolder( QueryCacheHolder && rhs ) VULKAN_HPP_NOEXCEPT : cache( rhs.cache.exchange( nullptr ) ) {}
 
-        ctx.generateInline = true;
-        for (VariableData &p : r.cmd->params) {
-            if (p.original.type() == data.name.original) {
-                p.setIgnoreFlag(true);
-                p.setIgnoreProto(true);
-            } else {
-                p.setIgnoreFlag(false);
-                p.setIgnoreProto(false);
-            }
-            if (p.isHandle()) {
-                p.setConst(true);
-                p.convertToReference();
-            }
-        }
+      QueryCacheHolder & operator=( QueryCacheHolder && rhs ) VULKAN_HPP_NOEXCEPT
+      {
+        delete cache.exchange( rhs.cache.exchange( nullptr ) );
+        return *this;
+      }
 
-        std::string const pass;
-        out.inherits = "public " + base;
+      ~QueryCacheHolder()
+      {
+        delete cache.load();
+      }
+    };
 
-        InitializerBuilder copyCtor("        ");
-        copyCtor.append(base, "other.release()");
+    mutable QueryCacheHolder m_queryCache;
 
-        std::string assignemntOp;
-        data.foreachVars(VariableData::Flags::CLASS_VAR_UNIQUE, [&](const VariableData &v) {
-            //        if (v.type() == data.name) {
-            //            return;
-            //        }
-            out.sPrivate += "    " + v.toClassVar(*this);
-            assignemntOp += "\n      " + v.identifier() + " = std::move(other." + v.identifier() + ");";
-            copyCtor.append(v.identifier(), "std::move(other." + v.identifier() + ")");
-        });
+    QueryCache & getQueryCache() const
+    {
+      QueryCache * cache = m_queryCache.cache.load( std::memory_order_acquire );
+      if ( !cache )
+      {
+        QueryCache * created = new QueryCache;
+        if ( m_queryCache.cache.compare_exchange_strong( cache, created, std::memory_order_acq_rel, std::memory_order_acquire ) )
+        {
+          cache = created;
+        }
+        else
+        {
+          delete created;
+        }
+      }
+      return *cache;
+    }
+)";
+        out.sPrivate += cache;
 
-        out.sPublic += "    " + className + "() = default;\n";
+        if (formats) {
+            std::vector<int64_t> values;
+            for (const auto &e : enums["VkFormat"].members) {
+                if (!e.isAlias) {
+                    values.push_back(e.numericValue);
+                }
+            }
+            std::sort(values.begin(), values.end());
+            values.erase(std::unique(values.begin(), values.end()), values.end());
 
-        r.generate(out.sPublic, outputFuncs);
+            std::vector<uint32_t> slots;
+            // own namespace, detail inside raii would hide VULKAN_HPP_NAMESPACE::detail
+            output += R"(
+  namespace query_detail
+  {)";
+            output += generateSlotTable("format", "VkFormat", values, slots);
+            output += R"(  }  // namespace query_detail
+)";
+        }
+        return true;
+    }
 
-        out.sPublic += vkgen::format(R"(
-    {0}({0} const &) = delete;
+    void Generator::generateClassRAII(OutputBuffer &output, const Handle &data, bool asUnique) {
+        std::string className = data.name;
+        if (asUnique) {
+            className += "Unique";
+        }
+        OutputClass out {
+            .name = className
+        };
 
-    {0}({0} && other) VULKAN_HPP_NOEXCEPT{2}
-    {{
-    }}
+        const std::string &classNameLower = strFirstLower(className);
+        const std::string &handle         = data.vkhandle.identifier();
+        const auto        &superclass     = data.superclass;
+        const std::string &owner          = data.ownerhandle;
+        const bool         exp            = cfg.gen.expApi;
+        bool inherit = false;
 
-    ~{0}() VULKAN_HPP_NOEXCEPT {{
-      if ({1}) {{
-        this->destroy();
-      }}
-    }}
+        if (inherit) {
+            out.inherits += "public " + m_ns + "::" + className;
+        } else {
+            std::string debugReportValue = "Unknown";
+            auto        en               = enums.find("VkDebugReportObjectTypeEXT");
+            if (en != enums.end() && en->containsValue("e" + className)) {
+                debugReportValue = className;
+            }
 
-    {0}& operator=({0} const&) = delete;
+            // out.sPublic += " // " + owner + "\n";
+            out.sPublic += vkgen::format(R"(
+    using CType      = Vk{1};
 
-)",
-                                     className,
-                                     handle,
-                                     copyCtor.string());
+    static VULKAN_HPP_CONST_OR_CONSTEXPR {0}::ObjectType objectType =
+      {0}::ObjectType::e{1};
+    static VULKAN_HPP_CONST_OR_CONSTEXPR {0}::DebugReportObjectTypeEXT debugReportObjectType =
+      {0}::DebugReportObjectTypeEXT::e{2};
 
-        out.sPublic += vkgen::format(R"(
-    {0}& operator=({0} && other) VULKAN_HPP_NOEXCEPT {{
-      reset(other.release());{1}
-      return *this;
-    }}
 )",
-                                     className,
-                                     assignemntOp);
+                                         m_ns,
+                                         className,
+                                         debugReportValue);
+        }
 
-        out.sPublic += vkgen::format(R"(
+        generateClassConstructorsRAII(data, out);
 
-    explicit operator bool() const VULKAN_HPP_NOEXCEPT {{
-      return {1}::operator bool();
-    }}
+        InitializerBuilder init("        ");
+        std::string        assign = "\n";
 
-    {1} const * operator->() const VULKAN_HPP_NOEXCEPT {{
-      return this;
-    }}
+        if (inherit) {
+            init.append(m_ns + "::" + className + "::" + className, "std::forward<" + className + ">(rhs)");
+            assign += "      " + m_ns + "::" + className + "::operator=(std::forward<" + className + ">(rhs));\n";
+        }
+        data.foreachVars(VariableData::Flags::CLASS_VAR_RAII, [&](const VariableData &v) {
+            if (inherit && v.type() == className) {
+                return;
+            }
+            if (v.identifier() == "m_dispatcher" && !data.isSubclass) {
+                if (exp) {
+                    return;
+                }
+                init.append(v.identifier(), vkgen::format("rhs.{0}.release()", v.identifier()));
+                assign += vkgen::format("        {0}.reset( rhs.{0}.release() );\n", v.identifier());
+            } else {
+                init.append(v.identifier(), vkgen::format("{0}::exchange(rhs.{1}, {{}})", m_ns_raii, v.identifier()));
+                assign += vkgen::format("        {1} = {0}::exchange(rhs.{1}, {{}});\n", m_ns_raii, v.identifier());
+            }
+        });
 
-    {1} * operator->() VULKAN_HPP_NOEXCEPT {{
-      return this;
-    }}
+        bool memoized = false;
+        if (!exp && cfg.gen.raii.memoizedQueries && data.name.original == "VkPhysicalDevice") {
+            memoized = generateMemoizedQueriesRAII(output, data, out);
+            if (memoized) {
+                init.append("m_queryCache", "std::move(rhs.m_queryCache)");
+                assign += "        m_queryCache = std::move(rhs.m_queryCache);\n";
+            }
+        }
 
-    {1} const & operator*() const VULKAN_HPP_NOEXCEPT {{
-      return *this;
-    }}
+        const bool retire = !exp && cfg.gen.raii.deferredDestroy && data.name.original == "VkDevice";
+        if (retire) {
+            init.append("m_retireQueue", vkgen::format("{0}::exchange(rhs.m_retireQueue, {{}})", m_ns_raii));
+            assign += vkgen::format("        m_retireQueue = {0}::exchange(rhs.m_retireQueue, {{}});\n", m_ns_raii);
+        }
 
-    {1} & operator*() VULKAN_HPP_NOEXCEPT {{
-      return *this;
-    }}
+        if (inherit && false) {
+            out.sPublic += "    explicit " + data.name + "    (std::nullptr_t) VULKAN_HPP_NOEXCEPT\n";
+            out.sPublic += "      : " + m_ns + "::" + data.name + "(nullptr)\n";
+            out.sPublic += "    {}\n";
+        } else {
+            out.sPublic += "    explicit " + data.name + "(std::nullptr_t) VULKAN_HPP_NOEXCEPT {}\n";
+        }
 
-    const {1}& get() const VULKAN_HPP_NOEXCEPT {{
-      return *this;
+        out.sPublic += vkgen::format(R"(
+    ~{0}() {{
+        clear();
     }}
 
-    {1}& get() VULKAN_HPP_NOEXCEPT {{
-      return *this;
+    {0}() = default;
+    {0}({0} const&) = delete;
+    {0}({0}&& rhs) VULKAN_HPP_NOEXCEPT {1}
+    {{}}
+    {0}& operator=({0} const &) = delete;
+    {0}& operator=({0}&& rhs) VULKAN_HPP_NOEXCEPT {{
+        if ( this != &rhs ) {{
+            clear();
+        }}{2}
+        return *this;
     }}
+    )",
+                                     data.name,
+                                     init.string(),
+                                     assign);
 
-    void reset({1} const &value = {1}()) {{
-      if ({2} != static_cast<Vk{1}>(value) ) {{
-        if ({2}) {{
-          {3}
-        }}
-        {2} = value;
-      }}
-    }}
+        std::string release;
 
-    {1} release() VULKAN_HPP_NOEXCEPT {{
-      {1} value = *this;
-      {2} = nullptr;
-      return value;
-    }}
+        data.foreachVars(VariableData::Flags::CLASS_VAR_RAII, [&](const VariableData &v) {
+            if (inherit && v.type() == className) {
+                return;
+            }
+            if (exp && v.identifier() == "m_dispatcher") {
+                return;
+            }
+            out.sPrivate += "    " + v.toClassVar(*this);
+            if (v.identifier() != handle) {
+                release += "      " + v.identifier() + " = nullptr;\n";
+            }
+        });
+        if (memoized) {
+            release += "      m_queryCache.reset();\n";
+        }
+        if (retire) {
+            out.sPrivate += "    RetireQueue * m_retireQueue = nullptr;\n";
+            release += "      m_retireQueue = nullptr;\n";
+            out.sPublic += R"(
+    // destroyed children are queued to RetireQueue instead of being destroyed immediately, queue must outlive device
+    void setRetireQueue( RetireQueue * queue ) VULKAN_HPP_NOEXCEPT
+    {
+      m_retireQueue = queue;
+    }
 
-    void destroy() {{
-      {3}
-      {2} = nullptr;
-    }}
+    RetireQueue * getRetireQueue() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_retireQueue;
+    }
+)";
+        }
 
-    void swap({0} &rhs) VULKAN_HPP_NOEXCEPT {{
-      std::swap(*this, rhs);
+        out.sPublic += vkgen::format(R"(
+    {0}::{2} const &operator*() const VULKAN_HPP_NOEXCEPT {{
+        return {3};
     }}
-
+    void clear() VULKAN_HPP_NOEXCEPT;
+    void swap({1}::{2} &) VULKAN_HPP_NOEXCEPT;
 )",
+                                     m_ns,
+                                     m_ns_raii,
                                      className,
-                                     base,
-                                     handle,
-                                     destroyCall);
-
-        output += std::move(out);
+                                     inherit? "*this" : handle
+                                    );
 
-        output += vkgen::format(R"(
-  VULKAN_HPP_INLINE void swap({0} &lhs, {0} &rhs) VULKAN_HPP_NOEXCEPT {{
-    lhs.swap(rhs);
-  }}
+        std::string releaseType = (cfg.gen.expApi && !data.isSubclass) ? "Vk" + className : m_ns + "::" + className;
+        out.sPublic += vkgen::format(R"(
 
+    {0} release()
+    {{
+{2}      return {4}::{5}{{{1}::exchange( {3}, nullptr )}};
+    }}
 )",
-                                className);
-    }
-
-    void Generator::generateUniqueClass(OutputBuffer &output, const Handle &data) {
-        genPlatform(output, data, [&](auto &output) { generateUniqueClassStr(output, data, false); });
-    }
-
-//    std::string Generator::generateUniqueClass(const Handle &data) {
-//        std::string output;
-//        if (!data.getProtect().empty()) {
-//            outputFuncs.platform.add(data, [&](std::string &output) { output += generateUniqueClassStr(data, true); });
-//        } else {
-//            output += genOptional(data, [&](std::string &output) { output += generateUniqueClassStr(data, false); });
-//        }
-//        return output;
-//    }
+                                     releaseType,
+                                     m_ns_raii,
+                                     release,
+                                     handle,
+                                     m_ns,
+                                     className);
 
-    void Generator::generateClassTypeInfo(const Handle &h, OutputBuffer &output, OutputClass &out) {
-        std::string debugReportValue;
-        bool unknown = false;
-        {
-            auto en = enums.find("VkDebugReportObjectTypeEXT");
-            if (en != enums.end()) {
-                auto it = en->find("e" + out.name);
-                if (it) {
-                    debugReportValue = cfg.gen.globalMode? it->name.original : it->name;
-                }
-            }
-            if (debugReportValue.empty()) {
-                unknown = true;
-                debugReportValue = cfg.gen.globalMode? "VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT" : "eUnknown";
-            }
-        }
+        if (!exp) {
+            outputFuncsRAII.def.add(
+              data,
+              [&](auto &output) {
+                  std::string dispatchSrc;
+                  std::string type = data.name;
+                  if (cfg.gen.raii.staticInstancePFN && data.name.original == "VkInstance") {
+                      dispatchSrc = "      return &" + m_ns_raii + "::Instance::m_dispatcher;\n";
+                      out.sPublic += "    inline static " + type + "Dispatcher m_dispatcher;\n";
+                  } else if (cfg.gen.raii.staticDevicePFN && data.name.original == "VkDevice") {
+                      dispatchSrc = "      return &" + m_ns_raii + "::Device::m_dispatcher;\n";
+                      out.sPublic += "    inline static " + type + "Dispatcher m_dispatcher;\n";
+                  } else if (data.name.original == "VkInstance" || data.name.original == "VkDevice") {
+                      dispatchSrc = "      return &*m_dispatcher;\n";
+                  } else {
+                      type = superclass;
+                      if (data.ownerRaii && cfg.gen.raii.cachedDispatcher && !cfg.gen.expApi) {
+                          dispatchSrc = "      return m_dispatcher;\n";
+                      } else if (data.ownerRaii) {
+                          dispatchSrc = "      return " + data.ownerRaii->identifier() + "->getDispatcher();\n";
+                      }
+                  }
 
-        out.sPublic += vkgen::format(R"(
-    using CType      = Vk{0};
-    using NativeType = Vk{0};
-)",
-                                     out.name);
+                  std::string spec;
+                  if (!cfg.gen.cppModules) {
+                      spec = cfg.macro.mInline.get() + " ";
+                  }
+                  out.sPublic += vkgen::format(R"(
+    {2}{0}::{1}Dispatcher const * getDispatcher() const;
+    )",
+                                               m_ns_raii,
+                                               type,
+                                               spec);
 
+                  output += vkgen::format(R"(
+    {4}{0}::{1}Dispatcher const * {2}::getDispatcher() const
+    {{
+      //VULKAN_HPP_ASSERT( m_dispatcher->getVkHeaderVersion() == VK_HEADER_VERSION );
+{3}
+    }}
+    )",
+                                          m_ns_raii,
+                                          type,
+                                          data.name,
+                                          dispatchSrc,
+                                          spec);
+              });
+        }
 
-        if (!cfg.gen.globalMode) {
+        if (data.ownerRaii) {
             out.sPublic += vkgen::format(R"(
-    static {3} {2}::ObjectType objectType =
-      {2}::ObjectType::{0};
-    static {3} {2}::DebugReportObjectTypeEXT debugReportObjectType =
-      {2}::DebugReportObjectTypeEXT::{1};
+    VULKAN_HPP_INLINE {0}::{1} const & get{1}() const
+    {{
+      return *{2};
+    }}
 )",
-            h.objType,
-            debugReportValue,
-            m_ns,
-            cfg.gen.expandMacros? "constexpr" : "VULKAN_HPP_CONST_OR_CONSTEXPR");
+                                         m_ns_raii,
+                                         data.ownerRaii->type(),
+                                         data.ownerRaii->identifier());
         }
-        else {
-            out.sPublic += vkgen::format(R"(
-    static {0} VkObjectType objectType = {1};
-    static {0} VkDebugReportObjectTypeEXT debugReportObjectType = {2};
-)",
-                cfg.gen.expandMacros? "constexpr" : "VULKAN_HPP_CONST_OR_CONSTEXPR",
-                h.objType.original,
-                debugReportValue
-            );
+
+        if (!exp) {
+            // generateClassMembers(data, out, outputFuncsRAII, Namespace::RAII);
         }
 
-        if (!cfg.gen.globalMode) {
-            gen(output, cfg.gen.handleTemplates, [&](auto &output) {
-                output += vkgen::format(R"(
-  template <>
-  struct CppType<{0}::ObjectType, {0}::ObjectType::e{1}>
-  {{
-    using Type = {0}::{1};
-  }};
+        if (!exp && cfg.gen.raii.deferredDestroy) {
+            generateClassClearRAII(data);
+        }
 
-)",
-                                        m_ns,
-                                        out.name);
+        output += std::move(out);
 
-                if (!unknown) {
-                    output += vkgen::format(R"(
-  template <>
-  struct CppType<{0}::DebugReportObjectTypeEXT,
-                 {0}::DebugReportObjectTypeEXT::{2}>
-  {{
-    using Type = {0}::{1};
-  }};
+        if (!exp && !data.vectorCmds.empty()) {
+            OutputClass out {
+                .name = className + "s"
+            };
+            const auto &name = out.name;
 
-)",
-                                            m_ns,
-                                            out.name,
-                                            debugReportValue);
-                }
+            out.inherits += vkgen::format("public std::vector<{0}::{1}>", m_ns_raii, className);
 
-                output += vkgen::format(R"(
-  template <>
-  struct isVulkanHandleType<{0}::{1}>
-  {{
-    static VULKAN_HPP_CONST_OR_CONSTEXPR bool value = true;
-  }};
-)",
-                                        m_ns,
-                                        out.name);
-            });
-        }
+            int passed = 0;
+            for (const auto &m : data.vectorCmds) {
+                if (m.src->_params.empty()) {
+                    std::cerr << "RAII vector constructor: no params" << '\n';
+                    continue;
+                }
 
-    }
+                MemberContext ctx{ .ns = Namespace::RAII };
+                const auto   &parent = *m.src->_params.begin()->get();
+                if (parent.original.type() != superclass.original) {
+                    ctx.insertSuperclassVar = true;
+                }
 
-    void Generator::generateClass(OutputBuffer &output, const Handle &data, bool inlineFuncs, bool noFuncs) {
-        OutputClass out {
-            .name = data.name
-        };
-        const auto &className      = out.name;
-        const std::string &classNameLower = strFirstLower(className);
-        const std::string &handle         = data.vkhandle.identifier();
-        const std::string &superclass     = data.superclass;
+                MemberResolverVectorCtor r{ *this, const_cast<ClassCommand &>(m), ctx };
+                if (!r.hasDependencies) {
+                    std::cout << "vector ctor skipped: class " << data.name << ", p: " << parent.type() << ", s: " << superclass << '\n';
+                    continue;
+                }
+                r.generate(out.sPublic, outputFuncsRAII);
+                passed++;
+            }
 
-        // std::cout << "Gen class: " << className << '\n';
-        // std::cout << "  ->superclass: " << superclass << '\n';
+            if (passed > 0) {
+                out.sPublic += vkgen::format(R"(
+    {0}( std::nullptr_t ) {{}}
 
-        generateClassTypeInfo(data, output, out);
+    {0}()                          = delete;
+    {0}( {0} const & )             = delete;
+    {0}( {0} && rhs )              = default;
+    {0} & operator=( {0} const & ) = delete;
+    {0} & operator=( {0} && rhs )  = default;
+)",
+                                             name);
 
-        std::string dispatchInit;
-        std::string dispatchInitArg;
-        /*
-        if (!data.isSubclass && cfg.gen.globalMode) {
-            dispatchInitArg =  "*" + m_ns + "::" + strFirstLower(superclass) + ".getDispatcher(), " + classNameLower;
-            dispatchInit = "\n      m_dispatcher.load(" + dispatchInitArg + ");\n";
+                output += std::move(out);
+            } else {
+                std::cout << "no suitable constructors for class: " << data.name << '\n';
+            }
         }
-        */
-
-        generateClassConstructors(data, out);
 
-        if (cfg.gen.raii.interop && false) {
-            const auto &superclass = data.superclass;
+        if (!exp && cfg.gen.raii.pooledArrays && data.poolFlag) {
+            generatePooledArrayRAII(output, data);
+        }
+    }
 
-            const auto genCtor = [&](ClassCommand &d, auto &parent, bool insert = false) {
-                MemberContext ctx{ .ns = Namespace::RAII };
-                ctx.insertSuperclassVar = insert;
+    void Generator::generatePooledArrayRAII(OutputBuffer &output, const Handle &data) {
+        // owns whole allocation from pool, freed with one call instead of per handle
+        const Command *dtor = data.dtorCmd;
+        if (!dtor || !data.parent || !data.ownerRaii || !data.secondOwner || data.vectorCmds.empty()) {
+            return;
+        }
 
-                MemberResolverCtor resolver{ *this, d, ctx };
+        const auto &poolType = data.parent->name.original;
+        if (dtor->_params.size() != 4 || dtor->_params[1]->original.type() != poolType || dtor->_params[2]->original.type() != "uint32_t") {
+            return;
+        }
 
-                if (!resolver.hasDependencies) {
-                    // std::cout << "ctor skipped: class " << data.name << ", s: " << superclass << '\n';
-                    return;
+        const Command *alloc = nullptr;
+        std::string    infoType;
+        std::string    poolMember;
+        std::string    countMember;
+        for (const auto &m : data.vectorCmds) {
+            const auto &params = m.src->_params;
+            if (params.size() != 3 || params[0]->original.type() != data.superclass.original) {
+                continue;
+            }
+            const auto it = structs.find(params[1]->original.type());
+            if (it == structs.end()) {
+                continue;
+            }
+            for (const auto &v : it->members) {
+                if (v->original.type() == poolType) {
+                    poolMember = v->identifier();
+                } else if (v->original.type() == "uint32_t" && v->identifier().ends_with("Count")) {
+                    countMember = v->identifier();
                 }
+            }
+            if (!poolMember.empty() && !countMember.empty()) {
+                alloc    = m.src;
+                infoType = it->name;
+                break;
+            }
+        }
+        if (!alloc) {
+            return;
+        }
 
-                out.sPublic += "// INTER:\n";
-                resolver.guard              = "VULKAN_HPP_EXPERIMENTAL_INTEROP";
-                resolver.constructorInterop = true;
-                resolver.generate(out.sPublic, outputFuncsRAII);
-            };
-
-            for (auto &m : const_cast<Handle &>(data).ctorCmds) {
-
-                const auto &parent = *m.src->_params.begin()->get();
-                if (parent.original.type() != superclass.original) {
-                    // out.sPublic += "  // RAII CTOR 2\n";
-                    genCtor(m, parent, true);
+        // global mode emits it into vulkan_funcs.hpp, allocating from vk::device
+        const bool         global     = cfg.gen.globalMode;
+        const std::string &owner      = data.ownerRaii->identifier();
+        const std::string &superclass = data.superclass;
+        const std::string  className  = "Pooled" + data.name + "s";
+        const std::string  pool       = data.parent->name;
+        const std::string  exchange   = global ? "std::exchange" : m_ns_raii + "::exchange";
+        const std::string  dispatcher = global ? "device.getDispatcher()" : owner + "->getDispatcher()";
+        const std::string  ownerArg   = "static_cast<" + data.superclass.original + ">( " + (global ? "device" : "**" + owner) + " )";
+
+        const auto &ns = global ? cfg.macro.mNamespace.data : cfg.macro.mNamespaceRAII.data;
+        std::string message = ns.usesDefine ? ns.define + "_STRING \"::" : "\"" + ns.value + "::";
+        message += className + "\"";
+
+        std::string reset;
+        std::string resetDecl;
+        const Command *resetCmd = findCommand("vkReset" + pool);
+        if (resetCmd && resetCmd->canGenerate() && resetCmd->_params.size() == 3 && resetCmd->_params[1]->original.type() == poolType) {
+            // command pool reset keeps buffers allocated, other pool resets free everything allocated from them
+            const bool keeps = data.name.original == "VkCommandBuffer";
+            resetDecl = vkgen::format(R"(
+    // resets whole pool with one call, affects everything allocated from it
+    void resetPool( {0}::{1} flags = {{}} );
+)",
+                                      m_ns,
+                                      resetCmd->_params[2]->type());
+            reset = vkgen::format(R"(
+    inline void {0}::resetPool( {1}::{2} flags )
+    {{
+      VkResult result = {3}->{4}( {5}, static_cast<{6}>( m_pool ), static_cast<{7}>( flags ) );
+      {1}::resultCheck( result, {8} );{9}
+    }}
+)",
+                                  className,
+                                  m_ns,
+                                  resetCmd->_params[2]->type(),
+                                  dispatcher,
+                                  resetCmd->name.original,
+                                  ownerArg,
+                                  poolType,
+                                  resetCmd->_params[2]->original.type(),
+                                  message,
+                                  keeps ? "" : "\n      m_handles.clear();");
+        }
+
+        // global mode has no owner member, m_pool tells whether handles are owned
+        const std::string ctorParams = global ? "" : m_ns_raii + "::" + data.ownerRaii->type() + " const & " + strFirstLower(superclass) + ", ";
+        const std::string ownerMove  = global ? "" : owner + "( " + exchange + "( rhs." + owner + ", {} ) )\n      , ";
+        const std::string ownerSwap  = global ? "" : owner + " = " + exchange + "( rhs." + owner + ", {} );\n        ";
+        const std::string ownerClear = global ? "" : "      " + owner + " = nullptr;\n";
+
+        OutputClass out{ .name = className };
+        out.sPublic += vkgen::format(R"(
+    {0}( std::nullptr_t ) VULKAN_HPP_NOEXCEPT {{}}
 
-                    if (parent.isHandle()) {
-                        const auto &handle = findHandle(parent.original.type());
-                        if (handle.superclass.original != superclass.original) {
-                            std::cerr << "ctor: impossible combination" << '\n';
-                            continue;
-                        }
-                    }
-                }
+    {10}{0}( {1}{4}::{5} const & allocateInfo );
 
-                // out.sPublic += "  // RAII CTOR\n";
-                if (parent.isHandle()) {
-                    genCtor(m, parent);
-                }
-            }
-        }
+    ~{0}()
+    {{
+      clear();
+    }}
 
+    {0}()                          = delete;
+    {0}( {0} const & )             = delete;
+    {0} & operator=( {0} const & ) = delete;
 
-        out.sProtected += "    ";
-//        if (!data.isSubclass && cfg.gen.globalMode) {
-//            out.sProtected += "static ";
-//        }
-        out.sProtected += data.name.original + " " + handle;
-        if (data.isSubclass || !cfg.gen.globalMode) {
-            out.sProtected += " = {}";
-        }
-        out.sProtected += ";\n";
-        /*
-        if (!data.isSubclass && cfg.gen.globalMode) {
-            // out.sProtected += "    static " + data.name + "Dispatcher m_dispatcher;\n";
+    {0}( {0} && rhs ) VULKAN_HPP_NOEXCEPT
+      : {2}m_pool( {3}( rhs.m_pool, {{}} ) )
+      , m_handles( std::move( rhs.m_handles ) )
+    {{
+    }}
 
-            out.sPublic += vkgen::format(R"(
-    static {0}Dispatcher* getDispatcher() noexcept {{
-      return &m_dispatcher;
+    {0} & operator=( {0} && rhs ) VULKAN_HPP_NOEXCEPT
+    {{
+      if ( this != &rhs )
+      {{
+        clear();
+        {6}m_pool = {3}( rhs.m_pool, {{}} );
+        m_handles = std::move( rhs.m_handles );
+      }}
+      return *this;
     }}
-)",         data.name);
-        }
-        */
 
-        out.sPublic += vkgen::format(R"(
-    operator Vk{0}() const {{
-      return {2};
+    {4}::{7} const & operator[]( size_t index ) const VULKAN_HPP_NOEXCEPT
+    {{
+      return m_handles[index];
     }}
 
-    explicit operator bool() const VULKAN_HPP_NOEXCEPT {{
-      return {2} != VK_NULL_HANDLE;
+    {4}::{7} const * data() const VULKAN_HPP_NOEXCEPT
+    {{
+      return m_handles.data();
     }}
 
-    bool operator!() const VULKAN_HPP_NOEXCEPT {{
-      return {2} == VK_NULL_HANDLE;
+    {4}::{7} const * begin() const VULKAN_HPP_NOEXCEPT
+    {{
+      return m_handles.data();
     }}
 
-#if defined( VULKAN_HPP_TYPESAFE_CONVERSION )
-    {0} & operator=( Vk{0} {1} ) VULKAN_HPP_NOEXCEPT
+    {4}::{7} const * end() const VULKAN_HPP_NOEXCEPT
     {{
-      {2} = {1};{5}
-      return *this;
+      return m_handles.data() + m_handles.size();
     }}
-#endif
 
-    {0} & operator=( std::nullptr_t ) VULKAN_HPP_NOEXCEPT
+    size_t size() const VULKAN_HPP_NOEXCEPT
     {{
-      {2} = {{}};
-      return *this;
+      return m_handles.size();
     }}
 
-{3}
-#   if defined( VULKAN_HPP_HAS_SPACESHIP_OPERATOR )
-    auto operator<=>( {0} const & ) const = default;
-#  else
-    bool operator==( {0} const & rhs ) const VULKAN_HPP_NOEXCEPT
+    bool empty() const VULKAN_HPP_NOEXCEPT
     {{
-      return {2} == rhs.{2};
+      return m_handles.empty();
     }}
 
-    bool operator!=( {0} const & rhs ) const VULKAN_HPP_NOEXCEPT
+    {4}::{8} get{8}() const VULKAN_HPP_NOEXCEPT
     {{
-      return {2} != rhs.{2};
+      return m_pool;
     }}
 
-    bool operator<( {0} const & rhs ) const VULKAN_HPP_NOEXCEPT
+    // frees all handles with single call
+    void clear() VULKAN_HPP_NOEXCEPT;
+
+    // gives up ownership, handles are reclaimed when pool is reset or destroyed
+    std::vector<{4}::{7}> release() VULKAN_HPP_NOEXCEPT
     {{
-      return {2} < rhs.{2};
+{11}      m_pool = nullptr;
+      return std::move( m_handles );
     }}
-#  endif
-{4}
-)",
+{9})",
                                      className,
-                                     classNameLower,
-                                     handle,
-                                     expIfndef("VULKAN_HPP_EXPERIMENTAL_NO_CLASS_COMPARE"),
-                                     expEndif("VULKAN_HPP_EXPERIMENTAL_NO_CLASS_COMPARE"),
-                                     dispatchInit);
+                                     ctorParams,
+                                     ownerMove,
+                                     exchange,
+                                     m_ns,
+                                     infoType,
+                                     ownerSwap,
+                                     data.name,
+                                     pool,
+                                     resetDecl,
+                                     global ? "explicit " : "",
+                                     ownerClear);
 
-        noFuncs = cfg.gen.globalMode;
-        if (!noFuncs) {
-            if (cfg.gen.expApi || cfg.gen.globalMode) {
-                for (ClassCommand &m : const_cast<Handle &>(data).members) {
-                    MemberGenerator g{ *this, m, out.sPublic, outputFuncs };
-                    g.generate();
-                }
-            } else {
-                generateClassMembers(data, out, outputFuncs, Namespace::VK, inlineFuncs);
-            }
+        if (!global) {
+            out.sPrivate += vkgen::format("\n    {0}::{1} const * {2} = {{}};", m_ns_raii, data.ownerRaii->type(), owner);
         }
+        out.sPrivate += vkgen::format(R"(
+    {0}::{1} m_pool = {{}};
+    std::vector<{0}::{2}> m_handles;
+)",
+                                      m_ns,
+                                      pool,
+                                      data.name);
+
+        const std::string ctorInit = global ? "" : owner + "( &" + strFirstLower(superclass) + " ), ";
+        const std::string def = vkgen::format(R"(
+    inline {0}::{0}( {1}{4}::{5} const & allocateInfo )
+      : {2}m_pool( allocateInfo.{7} )
+    {{
+      m_handles.resize( allocateInfo.{8} );
+      VkResult result = {3}getDispatcher()->{9}( static_cast<{10}>( {6} ),
+                                                   reinterpret_cast<Vk{5} const *>( &allocateInfo ),
+                                                   reinterpret_cast<{11} *>( m_handles.data() ) );
+      if ( result != VK_SUCCESS )
+      {{
+        m_handles.clear();
+        {4}::resultCheck( result, {12} );
+      }}
+    }}
 
-        output += std::move(out);
+    inline void {0}::clear() VULKAN_HPP_NOEXCEPT
+    {{
+      if ( !m_handles.empty() )
+      {{
+        {16}->{13}( {17},
+                                    static_cast<{14}>( m_pool ),
+                                    static_cast<uint32_t>( m_handles.size() ),
+                                    reinterpret_cast<{11} const *>( m_handles.data() ) );
+        m_handles.clear();
+      }}
+{18}      m_pool = nullptr;
+    }}
+{15})",
+                                              className,
+                                              ctorParams,
+                                              ctorInit,
+                                              global ? "device." : strFirstLower(superclass) + ".",
+                                              m_ns,
+                                              infoType,
+                                              global ? "device" : "*" + strFirstLower(superclass),
+                                              poolMember,
+                                              countMember,
+                                              alloc->name.original,
+                                              data.superclass.original,
+                                              data.name.original,
+                                              message,
+                                              dtor->name.original,
+                                              poolType,
+                                              reset,
+                                              dispatcher,
+                                              ownerArg,
+                                              ownerClear);
+
+        if (global) {
+            genOptional(output, data, [&](auto &output) {
+                output += "\n";
+                output += std::move(out);
+                output += def;
+            });
+        } else {
+            output += std::move(out);
+            genOptional(outputFuncsRAII.def.get(), data, [&](auto &out) { out += def; });
+        }
     }
 
-    void Generator::generateClassRAII(OutputBuffer &output, const Handle &data, bool asUnique) {
-        std::string className = data.name;
-        if (asUnique) {
-            className += "Unique";
+    void Generator::generateCommandStreamRAII(OutputBuffer &output) {
+        // one encoder method per vkCmd* with raii::CommandBuffer arguments,
+        // commands with pointers that can't be deep copied (chains, nested pointer arrays, strings) are left out
+        // global mode emits it into vulkan_funcs.hpp, replayed through vk::device by default
+        const bool        global   = cfg.gen.globalMode;
+        const std::string exchange = global ? "std" : m_ns;
+        const auto cmdBuffer = handles.find("VkCommandBuffer");
+        if (cmdBuffer == handles.end()) {
+            return;
         }
-        OutputClass out {
-            .name = className
+
+        const auto structType = [&](const std::string &type) -> const Struct * {
+            const GenericType *t = find(type);
+            if (t && t->isStructOrUnion()) {
+                return static_cast<const Struct *>(t);
+            }
+            return nullptr;
         };
 
-        const std::string &classNameLower = strFirstLower(className);
-        const std::string &handle         = data.vkhandle.identifier();
-        const auto        &superclass     = data.superclass;
-        const std::string &owner          = data.ownerhandle;
-        const bool         exp            = cfg.gen.expApi;
-        bool inherit = false;
+        const auto cppType = [&](const std::string &type) {
+            const GenericType *t = find(type);
+            if (t && (t->isStructOrUnion() || t->isEnum() || t->isHandle())) {
+                return m_ns + "::" + strStripVk(type);
+            }
+            return type;
+        };
 
-        if (inherit) {
-            out.inherits += "public " + m_ns + "::" + className;
-        } else {
-            std::string debugReportValue = "Unknown";
-            auto        en               = enums.find("VkDebugReportObjectTypeEXT");
-            if (en != enums.end() && en->containsValue("e" + className)) {
-                debugReportValue = className;
+        const auto hasChain = [&](const std::string &type) {
+            const Struct *s = structType(type);
+            if (s) {
+                for (const auto &m : s->members) {
+                    if (m->original.identifier() == "pNext") {
+                        return true;
+                    }
+                }
             }
+            return false;
+        };
 
-            // out.sPublic += " // " + owner + "\n";
-            out.sPublic += vkgen::format(R"(
-    using CType      = Vk{1};
+        // no pointers apart from pNext, which must be null when recorded
+        std::map<std::string, bool>              flatTypes;
+        std::function<bool(const std::string &)> isFlat = [&](const std::string &type) {
+            const Struct *s = structType(type);
+            if (!s) {
+                return true;
+            }
+            if (const auto it = flatTypes.find(type); it != flatTypes.end()) {
+                return it->second;
+            }
+            bool flat = true;
+            for (const auto &m : s->members) {
+                if (m->original.isPointer() ? m->original.identifier() != "pNext" : !isFlat(m->original.type())) {
+                    flat = false;
+                    break;
+                }
+            }
+            flatTypes.emplace(type, flat);
+            return flat;
+        };
 
-    static VULKAN_HPP_CONST_OR_CONSTEXPR {0}::ObjectType objectType =
-      {0}::ObjectType::e{1};
-    static VULKAN_HPP_CONST_OR_CONSTEXPR {0}::DebugReportObjectTypeEXT debugReportObjectType =
-      {0}::DebugReportObjectTypeEXT::e{2};
+        struct Param
+        {
+            enum Kind
+            {
+                VALUE,
+                COUNT,
+                ARRAY,
+                STRUCT,
+                FIXED
+            };
 
-)",
-                                         m_ns,
-                                         className,
-                                         debugReportValue);
-        }
+            Kind                kind  = VALUE;
+            const VariableData *var   = {};
+            std::string         name  = {};
+            std::string         type  = {};
+            std::string         templ = {};
+            const VariableData *count = {};
+            // pointer members of STRUCT with their length member, empty for single element
+            std::vector<std::pair<const VariableData *, std::string>> nested = {};
+        };
 
-        generateClassConstructorsRAII(data, out);
+        const auto guarded = [](const Command &cmd, const std::string &code) {
+            const std::string protect{ cmd.getProtect() };
+            if (protect.empty()) {
+                return code;
+            }
+            return "#if defined(" + protect + ")\n" + code + "#endif // " + protect + "\n";
+        };
 
-        InitializerBuilder init("        ");
-        std::string        assign = "\n";
+        std::string           ops;
+        std::string           args;
+        std::string           methods;
+        std::string           cases;
+        std::set<std::string> seen;
+        for (const auto &m : cmdBuffer->members) {
+            const Command *cmd = m.src;
+            if (!cmd || !cmd->canGenerate() || !cmd->name.original.starts_with("vkCmd") || !seen.emplace(cmd->name.original).second) {
+                continue;
+            }
+            const auto &params = cmd->_params;
+            if (params.empty() || params[0]->original.type() != "VkCommandBuffer") {
+                continue;
+            }
 
-        if (inherit) {
-            init.append(m_ns + "::" + className + "::" + className, "std::forward<" + className + ">(rhs)");
-            assign += "      " + m_ns + "::" + className + "::operator=(std::forward<" + className + ">(rhs));\n";
-        }
-        data.foreachVars(VariableData::Flags::CLASS_VAR_RAII, [&](const VariableData &v) {
-            if (inherit && v.type() == className) {
-                return;
+            const auto findCount = [&](const std::string &id) -> const VariableData * {
+                for (size_t i = 1; i < params.size(); ++i) {
+                    if (params[i]->original.identifier() == id && !params[i]->original.isPointer()) {
+                        return params[i].get();
+                    }
+                }
+                return nullptr;
+            };
+
+            std::vector<Param> list;
+            bool               ok = true;
+            for (size_t i = 1; i < params.size() && ok; ++i) {
+                const VariableData &v = *params[i];
+                const auto         &o = v.original;
+                Param               p{ .var = &v, .name = o.identifier(), .type = cppType(o.type()) };
+                if (o.isPointer()) {
+                    if (!o.isConst() || countPointers(o.suffix()) != 1) {
+                        ok = false;
+                        break;
+                    }
+                    if (p.name.size() >= 2 && p.name[0] == 'p' && std::isupper(p.name[1])) {
+                        p.name = strFirstLower(p.name.substr(1));
+                    }
+                    if (!v.getLenAttrib().empty()) {
+                        p.kind  = Param::ARRAY;
+                        p.count = findCount(v.getLenAttrib());
+                        ok      = p.count && (o.type() == "void" || isFlat(o.type()));
+                        if (o.type() == "void") {
+                            p.templ = strFirstUpper(p.name) + "Type";
+                            p.type  = p.templ;
+                        }
+                    } else {
+                        const Struct *s = structType(o.type());
+                        p.kind          = Param::STRUCT;
+                        ok              = s && !v.isOptional();
+                        for (size_t j = 0; ok && j < s->members.size(); ++j) {
+                            const auto &member = *s->members[j];
+                            const auto &mo     = member.original;
+                            if (!mo.isPointer()) {
+                                ok = isFlat(mo.type());
+                                continue;
+                            }
+                            if (mo.identifier() == "pNext") {
+                                continue;
+                            }
+                            ok = countPointers(mo.suffix()) == 1 && mo.type() != "void" && isFlat(mo.type());
+                            const auto &len = member.getLenAttrib();
+                            if (ok && !len.empty()) {
+                                ok = std::any_of(s->members.begin(), s->members.end(), [&](const auto &c) {
+                                    return c->original.identifier() == len && !c->original.isPointer();
+                                });
+                            }
+                            p.nested.emplace_back(&member, len);
+                        }
+                    }
+                } else if (v.hasArrayLength()) {
+                    p.kind = Param::FIXED;
+                    ok     = v.arrayLength(1).empty();
+                }
+                list.push_back(std::move(p));
             }
-            if (v.identifier() == "m_dispatcher") {
-                if (exp) {
-                    return;
+            if (!ok) {
+                continue;
+            }
+            for (auto &p : list) {
+                for (const auto &a : list) {
+                    if (a.kind == Param::ARRAY && a.count == p.var) {
+                        p.kind = Param::COUNT;
+                    }
                 }
-                init.append(v.identifier(), vkgen::format("rhs.{0}.release()", v.identifier()));
-                assign += vkgen::format("        {0}.reset( rhs.{0}.release() );\n", v.identifier());
-            } else {
-                init.append(v.identifier(), vkgen::format("{0}::exchange(rhs.{1}, {{}})", m_ns_raii, v.identifier()));
-                assign += vkgen::format("        {1} = {0}::exchange(rhs.{1}, {{}});\n", m_ns_raii, v.identifier());
             }
-        });
 
-        if (inherit && false) {
-            out.sPublic += "    explicit " + data.name + "    (std::nullptr_t) VULKAN_HPP_NOEXCEPT\n";
-            out.sPublic += "      : " + m_ns + "::" + data.name + "(nullptr)\n";
-            out.sPublic += "    {}\n";
-        } else {
-            out.sPublic += "    explicit " + data.name + "(std::nullptr_t) VULKAN_HPP_NOEXCEPT {}\n";
+            // array which provides value of count, others have to match its size
+            const auto sizeSource = [&](const Param &count) -> const Param * {
+                const Param *source = nullptr;
+                for (const auto &a : list) {
+                    if (a.kind == Param::ARRAY && a.count == count.var && (!source || (source->var->isOptional() && !a.var->isOptional()))) {
+                        source = &a;
+                    }
+                }
+                return source;
+            };
+
+            const std::string name     = strStripVk(cmd->name.original);
+            const std::string op       = "e" + name;
+            const std::string argsType = name + "Args";
+
+            std::string fields;
+            std::string templ;
+            std::string decl;
+            std::string body;
+            std::string patch;
+            std::string call;
+
+            size_t defaults = list.size();
+            while (defaults > 0) {
+                const Param &p = list[defaults - 1];
+                if (p.kind == Param::COUNT || (p.kind == Param::ARRAY && p.var->isOptional())) {
+                    --defaults;
+                    continue;
+                }
+                break;
+            }
+
+            for (size_t i = 0; i < list.size(); ++i) {
+                const Param &p  = list[i];
+                const auto  &o  = p.var->original;
+                const auto  &id = o.identifier();
+                const auto   t  = find(o.type());
+
+                std::string arg;
+                switch (p.kind) {
+                    case Param::VALUE:
+                        fields += "      " + o.type() + " " + id + ";\n";
+                        arg = p.type + " " + p.name;
+                        if (t && t->isStructOrUnion()) {
+                            body += "      std::memcpy( &a." + id + ", &" + p.name + ", sizeof( a." + id + " ) );\n";
+                        } else if (t && (t->isEnum() || t->isHandle())) {
+                            body += "      a." + id + " = static_cast<" + o.type() + ">( " + p.name + " );\n";
+                        } else {
+                            body += "      a." + id + " = " + p.name + ";\n";
+                        }
+                        call += ", a." + id;
+                        break;
+                    case Param::FIXED:
+                        fields += "      " + o.type() + " " + id + "[" + p.var->arrayLength() + "];\n";
+                        arg = "const " + p.type + " " + p.name + "[" + p.var->arrayLength() + "]";
+                        body += "      std::memcpy( a." + id + ", " + p.name + ", sizeof( a." + id + " ) );\n";
+                        call += ", a." + id;
+                        break;
+                    case Param::COUNT:
+                        fields += "      " + o.type() + " " + id + ";\n";
+                        if (const Param *source = sizeSource(p)) {
+                            std::string size = source->name + ".size()";
+                            if (!source->templ.empty()) {
+                                size += " * sizeof( " + source->templ + " )";
+                            }
+                            body += "      a." + id + " = static_cast<" + o.type() + ">( " + size + " );\n";
+                            for (const auto &a : list) {
+                                if (&a == source || a.kind != Param::ARRAY || a.count != p.var) {
+                                    continue;
+                                }
+                                std::string check = a.name + ".size() == " + source->name + ".size()";
+                                if (a.var->isOptional()) {
+                                    check = a.name + ".empty() || " + check;
+                                }
+                                body += "      VULKAN_HPP_ASSERT( " + check + " );\n";
+                            }
+                        }
+                        call += ", a." + id;
+                        break;
+                    case Param::ARRAY:
+                        fields += "      size_t " + id + ";\n";
+                        arg = m_ns + "::ArrayProxy<const " + p.type + "> const & " + p.name;
+                        if (!p.templ.empty()) {
+                            templ += templ.empty() ? "typename " : ", typename ";
+                            templ += p.templ;
+                        } else if (hasChain(o.type())) {
+                            body += "      VULKAN_HPP_ASSERT( unchained( " + p.name + ".data(), " + p.name + ".size() ) );\n";
+                        }
+                        body += "      a." + id + " = store( " + p.name + ".data(), " + p.name + ".size() );\n";
+                        call += ", load<" + o.type() + ">( a." + id + " )";
+                        break;
+                    case Param::STRUCT:
+                        fields += "      " + o.type() + " " + id + ";\n";
+                        arg = "const " + p.type + " & " + p.name;
+                        body += "      std::memcpy( &a." + id + ", &" + p.name + ", sizeof( a." + id + " ) );\n";
+                        if (hasChain(o.type())) {
+                            body += "      VULKAN_HPP_ASSERT( !a." + id + ".pNext );\n";
+                        }
+                        for (const auto &[member, len] : p.nested) {
+                            const auto &mid    = member->original.identifier();
+                            const auto  field  = id + "_" + mid;
+                            const auto  src    = "a." + id + "." + mid;
+                            const auto  count  = len.empty() ? std::string{ "1" } : "a." + id + "." + len;
+                            fields += "      size_t " + field + ";\n";
+                            if (hasChain(member->original.type())) {
+                                body += "      VULKAN_HPP_ASSERT( unchained( " + src + ", " + count + " ) );\n";
+                            }
+                            body += "      a." + field + " = store( " + src + ", " + count + " );\n";
+                            patch += "          " + src + " = load<" + member->original.type() + ">( a." + field + " );\n";
+                        }
+                        call += ", &a." + id;
+                        break;
+                }
+                if (!arg.empty()) {
+                    if (i >= defaults) {
+                        arg += " = nullptr";
+                    }
+                    decl += decl.empty() ? arg : ", " + arg;
+                }
+            }
+
+            ops += guarded(*cmd, "      " + op + ",\n");
+
+            args += guarded(*cmd, vkgen::format(R"(
+    struct {0}
+    {{
+{1}    }};
+)",
+                                                argsType,
+                                                fields));
+
+            methods += guarded(*cmd, vkgen::format(R"(
+    {0}void {1}( {2} )
+    {{
+      {3} a;
+      size_t const record = beginRecord( sizeof( a ) );
+{4}      endRecord( record, Op::{5}, &a, sizeof( a ) );
+    }}
+)",
+                                                   templ.empty() ? "" : "template <" + templ + ">\n    ",
+                                                   m.name,
+                                                   decl,
+                                                   argsType,
+                                                   body,
+                                                   op));
+
+            cases += guarded(*cmd, vkgen::format(R"(          case Op::{0}:
+          {{
+            {1} a;
+            std::memcpy( &a, args, sizeof( a ) );
+{2}            d.{3}( commandBuffer{4} );
+            break;
+          }}
+)",
+                                                 op,
+                                                 argsType,
+                                                 patch,
+                                                 cmd->name.original,
+                                                 call));
         }
 
+        OutputClass out{ .name = "CommandStream" };
         out.sPublic += vkgen::format(R"(
-    ~{0}() {{
-        clear();
+    CommandStream() = default;
+
+    CommandStream( CommandStream const & )             = delete;
+    CommandStream & operator=( CommandStream const & ) = delete;
+
+    CommandStream( CommandStream && rhs ) VULKAN_HPP_NOEXCEPT
+      : m_data( std::move( rhs.m_data ) )
+      , m_size( {0}::exchange( rhs.m_size, {{}} ) )
+      , m_capacity( {0}::exchange( rhs.m_capacity, {{}} ) )
+      , m_count( {0}::exchange( rhs.m_count, {{}} ) )
+    {{
     }}
 
-    {0}() = default;
-    {0}({0} const&) = delete;
-    {0}({0}&& rhs) VULKAN_HPP_NOEXCEPT {1}
-    {{}}
-    {0}& operator=({0} const &) = delete;
-    {0}& operator=({0}&& rhs) VULKAN_HPP_NOEXCEPT {{
-        if ( this != &rhs ) {{
-            clear();
-        }}{2}
-        return *this;
+    CommandStream & operator=( CommandStream && rhs ) VULKAN_HPP_NOEXCEPT
+    {{
+      if ( this != &rhs )
+      {{
+        m_data     = std::move( rhs.m_data );
+        m_size     = {0}::exchange( rhs.m_size, {{}} );
+        m_capacity = {0}::exchange( rhs.m_capacity, {{}} );
+        m_count    = {0}::exchange( rhs.m_count, {{}} );
+      }}
+      return *this;
     }}
-    )",
-                                     data.name,
-                                     init.string(),
-                                     assign);
 
-        std::string release;
+    // keeps allocated memory for next recording
+    void clear() VULKAN_HPP_NOEXCEPT
+    {{
+      m_size  = 0;
+      m_count = 0;
+    }}
 
-        data.foreachVars(VariableData::Flags::CLASS_VAR_RAII, [&](const VariableData &v) {
-            if (inherit && v.type() == className) {
-                return;
-            }
-            if (exp && v.identifier() == "m_dispatcher") {
-                return;
-            }
-            out.sPrivate += "    " + v.toClassVar(*this);
-            if (v.identifier() != handle) {
-                release += "      " + v.identifier() + " = nullptr;\n";
-            }
-        });
+    void reserve( size_t bytes )
+    {{
+      if ( bytes > m_capacity )
+      {{
+        grow( bytes );
+      }}
+    }}
+
+    // encoded bytes, including copied arrays
+    size_t size() const VULKAN_HPP_NOEXCEPT
+    {{
+      return m_size;
+    }}
+
+    uint32_t commandCount() const VULKAN_HPP_NOEXCEPT
+    {{
+      return m_count;
+    }}
+
+    bool empty() const VULKAN_HPP_NOEXCEPT
+    {{
+      return m_count == 0;
+    }}
+
+    void replay( VkCommandBuffer commandBuffer, DeviceDispatcher const & d ) const
+    {{
+      size_t pos = 0;
+      while ( pos < m_size )
+      {{
+        Header header;
+        std::memcpy( &header, m_data.get() + pos, sizeof( header ) );
+        unsigned char const * args = m_data.get() + pos + sizeof( header );
+        switch ( header.op )
+        {{
+{1}          default: break;
+        }}
+        pos += header.size;
+      }}
+    }}
+{3}{2})",
+                                     exchange,
+                                     cases,
+                                     methods,
+                                     global ? R"(
+    void replay( CommandBuffer commandBuffer ) const
+    {
+      replay( static_cast<VkCommandBuffer>( commandBuffer ), *device.getDispatcher() );
+    }
+)"
+                                            : R"(
+    void replay( CommandBuffer const & commandBuffer ) const
+    {
+      replay( static_cast<VkCommandBuffer>( *commandBuffer ), *commandBuffer.getDispatcher() );
+    }
+)");
 
-        out.sPublic += vkgen::format(R"(
-    {0}::{2} const &operator*() const VULKAN_HPP_NOEXCEPT {{
-        return {3};
+        out.sPrivate += vkgen::format(R"(
+    enum class Op : uint32_t
+    {{
+{0}    }};
+
+    struct Header
+    {{
+      Op       op;
+      uint32_t size;  // distance to next header
+    }};
+{1}
+    static constexpr size_t alignment  = 8;
+    static constexpr size_t nullOffset = ~size_t( 0 );
+
+    void grow( size_t bytes )
+    {{
+      size_t capacity = m_capacity ? m_capacity * 2 : 4096;
+      while ( capacity < bytes )
+      {{
+        capacity *= 2;
+      }}
+      std::unique_ptr<unsigned char[]> data( new unsigned char[capacity] );
+      if ( m_size )
+      {{
+        std::memcpy( data.get(), m_data.get(), m_size );
+      }}
+      m_data     = std::move( data );
+      m_capacity = capacity;
     }}
-    void clear() VULKAN_HPP_NOEXCEPT;
-    void swap({1}::{2} &) VULKAN_HPP_NOEXCEPT;
-)",
-                                     m_ns,
-                                     m_ns_raii,
-                                     className,
-                                     inherit? "*this" : handle
-                                    );
 
-        std::string releaseType = (cfg.gen.expApi && !data.isSubclass) ? "Vk" + className : m_ns + "::" + className;
-        out.sPublic += vkgen::format(R"(
+    size_t allocate( size_t bytes )
+    {{
+      size_t const offset = ( m_size + alignment - 1 ) & ~( alignment - 1 );
+      if ( offset + bytes > m_capacity )
+      {{
+        grow( offset + bytes );
+      }}
+      m_size = offset + bytes;
+      return offset;
+    }}
 
-    {0} release()
+    // space for header and arguments, arrays are stored after them
+    size_t beginRecord( size_t argsSize )
     {{
-{2}      return {4}::{5}{{{1}::exchange( {3}, nullptr )}};
+      return allocate( sizeof( Header ) + argsSize );
     }}
-)",
-                                     releaseType,
-                                     m_ns_raii,
-                                     release,
-                                     handle,
-                                     m_ns,
-                                     className);
 
-        if (!exp) {
-            outputFuncsRAII.def.add(
-              data,
-              [&](auto &output) {
-                  std::string dispatchSrc;
-                  std::string type = data.name;
-                  if (cfg.gen.raii.staticInstancePFN && data.name.original == "VkInstance") {
-                      dispatchSrc = "      return &" + m_ns_raii + "::Instance::m_dispatcher;\n";
-                      out.sPublic += "    inline static " + type + "Dispatcher m_dispatcher;\n";
-                  } else if (cfg.gen.raii.staticDevicePFN && data.name.original == "VkDevice") {
-                      dispatchSrc = "      return &" + m_ns_raii + "::Device::m_dispatcher;\n";
-                      out.sPublic += "    inline static " + type + "Dispatcher m_dispatcher;\n";
-                  } else if (data.name.original == "VkInstance" || data.name.original == "VkDevice") {
-                      dispatchSrc = "      return &*m_dispatcher;\n";
-                  } else {
-                      type = superclass;
-                      if (data.ownerRaii) {
-                          dispatchSrc = "      return " + data.ownerRaii->identifier() + "->getDispatcher();\n";
-                      }
-                  }
+    void endRecord( size_t record, Op op, void const * args, size_t argsSize )
+    {{
+      Header const header{{ op, static_cast<uint32_t>( ( ( m_size + alignment - 1 ) & ~( alignment - 1 ) ) - record ) }};
+      std::memcpy( m_data.get() + record, &header, sizeof( header ) );
+      std::memcpy( m_data.get() + record + sizeof( header ), args, argsSize );
+      ++m_count;
+    }}
 
-                  std::string spec;
-                  if (!cfg.gen.cppModules) {
-                      spec = cfg.macro.mInline.get() + " ";
-                  }
-                  out.sPublic += vkgen::format(R"(
-    {2}{0}::{1}Dispatcher const * getDispatcher() const;
-    )",
-                                               m_ns_raii,
-                                               type,
-                                               spec);
+    template <typename T>
+    size_t store( T const * data, size_t count )
+    {{
+      static_assert( alignof( T ) <= alignment, "unsupported alignment" );
+      if ( !data || !count )
+      {{
+        return nullOffset;
+      }}
+      size_t const offset = allocate( sizeof( T ) * count );
+      std::memcpy( m_data.get() + offset, data, sizeof( T ) * count );
+      return offset;
+    }}
 
-                  output += vkgen::format(R"(
-    {4}{0}::{1}Dispatcher const * {2}::getDispatcher() const
+    template <typename T>
+    T const * load( size_t offset ) const VULKAN_HPP_NOEXCEPT
     {{
-      //VULKAN_HPP_ASSERT( m_dispatcher->getVkHeaderVersion() == VK_HEADER_VERSION );
-{3}
+      return offset == nullOffset ? nullptr : reinterpret_cast<T const *>( m_data.get() + offset );
     }}
-    )",
-                                          m_ns_raii,
-                                          type,
-                                          data.name,
-                                          dispatchSrc,
-                                          spec);
-              });
-        }
 
-        if (data.ownerRaii) {
-            out.sPublic += vkgen::format(R"(
-    VULKAN_HPP_INLINE {0}::{1} const & get{1}() const
+    template <typename T>
+    static bool unchained( T const * data, size_t count ) VULKAN_HPP_NOEXCEPT
     {{
-      return *{2};
+      for ( size_t i = 0; data && i < count; ++i )
+      {{
+        if ( data[i].pNext )
+        {{
+          return false;
+        }}
+      }}
+      return true;
     }}
+
+    std::unique_ptr<unsigned char[]> m_data;
+    size_t                           m_size     = 0;
+    size_t                           m_capacity = 0;
+    uint32_t                         m_count    = 0;
 )",
-                                         m_ns_raii,
-                                         data.ownerRaii->type(),
-                                         data.ownerRaii->identifier());
+                                      ops,
+                                      args);
+
+        output += R"(
+  // Records vkCmd* calls with CommandBuffer arguments into one growing buffer, arrays are copied behind each command.
+  // Replayed later onto any command buffer through DeviceDispatcher. Not synchronized, use one stream per thread.
+  // Extension chains are not recorded, pNext of recorded structures must be null.
+)";
+        output += std::move(out);
+    }
+
+    void Generator::generateSubmitBatcherRAII(OutputBuffer &output) {
+        // VkQueue of vkQueueSubmit2 is externally synchronized, batches from many threads are submitted by the queue owner
+        const auto queue = handles.find("VkQueue");
+        if (queue == handles.end()) {
+            return;
         }
 
-        if (!exp) {
-            // generateClassMembers(data, out, outputFuncsRAII, Namespace::RAII);
+        const Command *cmd = nullptr;
+        for (const auto &m : queue->members) {
+            const Command *c = m.src;
+            if (!c || !c->canGenerate() || (c->name.original != "vkQueueSubmit2" && c->name.original != "vkQueueSubmit2KHR")) {
+                continue;
+            }
+            const auto &params = c->_params;
+            if (params.size() == 4 && params[0]->original.type() == "VkQueue" && params[0]->isExternSync()) {
+                cmd = c;
+                if (c->name.original == "vkQueueSubmit2") {
+                    break;
+                }
+            }
+        }
+        if (!cmd) {
+            return;
         }
 
-        output += std::move(out);
+        // global mode emits it into vulkan_funcs.hpp, submitting through vk::device by default
+        const bool global = cfg.gen.globalMode;
+        const auto &ns    = global ? cfg.macro.mNamespace.data : cfg.macro.mNamespaceRAII.data;
+        std::string message = ns.usesDefine ? ns.define + "_STRING \"" : "\"" + ns.value;
+        message += "::SubmitBatcher::flush\"";
 
-        if (!exp && !data.vectorCmds.empty()) {
-            OutputClass out {
-                .name = className + "s"
-            };
-            const auto &name = out.name;
+        const std::string ctor = global ? R"(
+    explicit SubmitBatcher( Queue queue, DeviceDispatcher const * dispatcher = device.getDispatcher() ) VULKAN_HPP_NOEXCEPT
+      : m_queue( static_cast<VkQueue>( queue ) )
+      , m_dispatcher( dispatcher )
+    {
+    }
+)"
+                                        : R"(
+    explicit SubmitBatcher( Queue const & queue ) VULKAN_HPP_NOEXCEPT
+      : m_queue( static_cast<VkQueue>( *queue ) )
+      , m_dispatcher( queue.getDispatcher() )
+    {
+    }
+)";
 
-            out.inherits += vkgen::format("public std::vector<{0}::{1}>", m_ns_raii, className);
+        const std::string protect{ cmd->getProtect() };
+        if (!protect.empty()) {
+            output += "#if defined( " + protect + " )\n";
+        }
 
-            int passed = 0;
-            for (const auto &m : data.vectorCmds) {
-                if (m.src->_params.empty()) {
-                    std::cerr << "RAII vector constructor: no params" << '\n';
-                    continue;
-                }
+        output += vkgen::format(R"(
+  // Collects SubmitInfo2 batches from any thread without locking, flush() hands all of them to one {1} call.
+  // VkQueue is externally synchronized, flush() must only be called by the thread that owns the queue.
+  // Arrays referenced by SubmitInfo2 are copied on enqueue, extension chains are not and must stay valid until flush() returns.
+  class SubmitBatcher
+  {{
+  public:{3}
+    SubmitBatcher( SubmitBatcher const & )             = delete;
+    SubmitBatcher & operator=( SubmitBatcher const & ) = delete;
 
-                MemberContext ctx{ .ns = Namespace::RAII };
-                const auto   &parent = *m.src->_params.begin()->get();
-                if (parent.original.type() != superclass.original) {
-                    ctx.insertSuperclassVar = true;
-                }
+    ~SubmitBatcher()
+    {{
+      release( m_head.exchange( nullptr, std::memory_order_acquire ) );
+    }}
 
-                MemberResolverVectorCtor r{ *this, const_cast<ClassCommand &>(m), ctx };
-                if (!r.hasDependencies) {
-                    std::cout << "vector ctor skipped: class " << data.name << ", p: " << parent.type() << ", s: " << superclass << '\n';
-                    continue;
-                }
-                r.generate(out.sPublic, outputFuncsRAII);
-                passed++;
-            }
+    // any thread
+    void enqueue( {0}::ArrayProxy<const {0}::SubmitInfo2> const & submits )
+    {{
+      if ( submits.empty() )
+      {{
+        return;
+      }}
+      std::unique_ptr<Batch> batch( new Batch );
+      batch->assign( submits );
+      batch->next = m_head.load( std::memory_order_relaxed );
+      while ( !m_head.compare_exchange_weak( batch->next, batch.get(), std::memory_order_release, std::memory_order_relaxed ) )
+      {{
+      }}
+      batch.release();
+    }}
 
-            if (passed > 0) {
-                out.sPublic += vkgen::format(R"(
-    {0}( std::nullptr_t ) {{}}
+    bool empty() const VULKAN_HPP_NOEXCEPT
+    {{
+      return m_head.load( std::memory_order_acquire ) == nullptr;
+    }}
 
-    {0}()                          = delete;
-    {0}( {0} const & )             = delete;
-    {0}( {0} && rhs )              = default;
-    {0} & operator=( {0} const & ) = delete;
-    {0} & operator=( {0} && rhs )  = default;
+    // queue owner thread only, submits everything enqueued so far in enqueue order, returns number of SubmitInfo2
+    // fence is signaled even when nothing was enqueued
+    uint32_t flush( {0}::Fence fence = {{}} )
+    {{
+      Batch * batch   = m_head.exchange( nullptr, std::memory_order_acquire );
+      Batch * ordered = nullptr;
+      while ( batch )
+      {{
+        Batch * next = batch->next;
+        batch->next  = ordered;
+        ordered      = batch;
+        batch        = next;
+      }}
+      struct Release
+      {{
+        Batch * batches;
+        ~Release()
+        {{
+          release( batches );
+        }}
+      }} const guard{{ ordered }};
+
+      m_submits.clear();
+      for ( Batch * b = ordered; b; b = b->next )
+      {{
+        m_submits.insert( m_submits.end(), b->submits.begin(), b->submits.end() );
+      }}
+
+      VkResult result = VK_SUCCESS;
+      if ( !m_submits.empty() || static_cast<VkFence>( fence ) != VK_NULL_HANDLE )
+      {{
+        result = m_dispatcher->{1}(
+          m_queue, static_cast<uint32_t>( m_submits.size() ), reinterpret_cast<const VkSubmitInfo2 *>( m_submits.data() ), static_cast<VkFence>( fence ) );
+      }}
+      resultCheck( result, {2} );
+      return static_cast<uint32_t>( m_submits.size() );
+    }}
+
+  private:
+    struct Batch
+    {{
+      Batch * next = nullptr;
+      std::vector<{0}::SubmitInfo2> submits;
+      std::vector<{0}::SemaphoreSubmitInfo> semaphores;
+      std::vector<{0}::CommandBufferSubmitInfo> commandBuffers;
+
+      void assign( {0}::ArrayProxy<const {0}::SubmitInfo2> const & infos )
+      {{
+        size_t semaphoreCount     = 0;
+        size_t commandBufferCount = 0;
+        for ( auto const & info : infos )
+        {{
+          semaphoreCount += info.waitSemaphoreInfoCount + info.signalSemaphoreInfoCount;
+          commandBufferCount += info.commandBufferInfoCount;
+        }}
+        // no reallocation below, copied pointers stay valid
+        submits.reserve( infos.size() );
+        semaphores.reserve( semaphoreCount );
+        commandBuffers.reserve( commandBufferCount );
+        for ( auto info : infos )
+        {{
+          info.pWaitSemaphoreInfos   = append( semaphores, info.pWaitSemaphoreInfos, info.waitSemaphoreInfoCount );
+          info.pCommandBufferInfos   = append( commandBuffers, info.pCommandBufferInfos, info.commandBufferInfoCount );
+          info.pSignalSemaphoreInfos = append( semaphores, info.pSignalSemaphoreInfos, info.signalSemaphoreInfoCount );
+          submits.push_back( info );
+        }}
+      }}
+
+      template <typename T>
+      static T const * append( std::vector<T> & dst, T const * src, uint32_t count )
+      {{
+        if ( !src || !count )
+        {{
+          return src;
+        }}
+        size_t const offset = dst.size();
+        dst.insert( dst.end(), src, src + count );
+        return dst.data() + offset;
+      }}
+    }};
+
+    static void release( Batch * batch ) VULKAN_HPP_NOEXCEPT
+    {{
+      while ( batch )
+      {{
+        Batch * next = batch->next;
+        delete batch;
+        batch = next;
+      }}
+    }}
+
+    VkQueue                  m_queue      = {{}};
+    DeviceDispatcher const * m_dispatcher = nullptr;
+    std::atomic<Batch *>     m_head{{ nullptr }};
+    // owner thread only
+    std::vector<{0}::SubmitInfo2> m_submits;
+  }};
 )",
-                                             name);
+                                m_ns,
+                                cmd->name.original,
+                                message,
+                                ctor);
 
-                output += std::move(out);
-            } else {
-                std::cout << "no suitable constructors for class: " << data.name << '\n';
-            }
+        if (!protect.empty()) {
+            output += "#endif // " + protect + "\n";
         }
     }
 
@@ -8504,11 +13452,38 @@ extern "C" __declspec( dllimport ) FARPROC __stdcall GetProcAddress( HINSTANCE h
         out.sPublic += R"(
       return true;
     }
+)";
+        if (cfg.gen.stubDriver) {
+            out.sProtected += "    bool stub = false;\n";
+            out.sPublic += R"(
+    VULKAN_HPP_NODISCARD bool loadStub() VULKAN_HPP_NOEXCEPT {
+      unload();
+      stub = true;
+)";
+            if (cfg.gen.dispatchTableAsUnique) {
+                out.sPublic += "      m_dispatcher.reset( new " + dispatcher + "( stub::vkGetInstanceProcAddr ) );\n";
+            } else {
+                out.sPublic += "      m_dispatcher.load( stub::vkGetInstanceProcAddr );\n";
+            }
+            out.sPublic += R"(      return true;
+    }
 
     VULKAN_HPP_NODISCARD bool load() VULKAN_HPP_NOEXCEPT {
+#if defined( VULKAN_HPP_USE_STUB_DRIVER )
+      return loadStub();
+#else
       return load(defaultLibpath);
+#endif
     }
-
+)";
+        } else {
+            out.sPublic += R"(
+    VULKAN_HPP_NODISCARD bool load() VULKAN_HPP_NOEXCEPT {
+      return load(defaultLibpath);
+    }
+)";
+        }
+        out.sPublic += R"(
     void unload() {
       if (lib) {
 #ifdef _WIN32
@@ -8518,16 +13493,69 @@ extern "C" __declspec( dllimport ) FARPROC __stdcall GetProcAddress( HINSTANCE h
 #endif
         lib = nullptr;
       }
-    }
+)";
+        if (cfg.gen.stubDriver) {
+            out.sPublic += "      stub = false;\n";
+        }
+        out.sPublic += R"(    }
 
     VULKAN_HPP_INLINE bool isLoaded() const {
-        return lib;
+)";
+        out.sPublic += cfg.gen.stubDriver ? "        return lib || stub;\n" : "        return lib;\n";
+        out.sPublic += R"(    }
+
+)";
+        if (useHostAllocators()) {
+            out.sPublic += R"(
+    // process wide default of raii handle and global wrapper allocator arguments, the callbacks must outlive every handle created with them
+    static void setDefaultAllocator(VkAllocationCallbacks const *allocator) VULKAN_HPP_NOEXCEPT {
+      defaultAllocatorStorage().store(allocator, std::memory_order_release);
     }
 
+    static void setDefaultAllocator(std::nullptr_t) VULKAN_HPP_NOEXCEPT {
+      defaultAllocatorStorage().store(nullptr, std::memory_order_release);
+    }
+
+    // ArenaAllocator, PoolAllocator, CountingAllocator
+    template<typename T>
+    static void setDefaultAllocator(T const &allocator) VULKAN_HPP_NOEXCEPT {
+      setDefaultAllocator(reinterpret_cast<VkAllocationCallbacks const *>(&allocator.callbacks()));
+    }
+
+    static VkAllocationCallbacks const *getDefaultAllocator() VULKAN_HPP_NOEXCEPT {
+      return defaultAllocatorStorage().load(std::memory_order_acquire);
+    }
+
+)";
+            out.sProtected += R"(
+    static std::atomic<VkAllocationCallbacks const *> &defaultAllocatorStorage() VULKAN_HPP_NOEXCEPT {
+      static std::atomic<VkAllocationCallbacks const *> allocator{ nullptr };
+      return allocator;
+    }
 )";
+        }
 
         auto &funcs = (cfg.gen.expApi || cfg.gen.globalMode) ? outputFuncs : outputFuncsRAII;
-        if (cfg.gen.globalMode) {
+        if (cfg.gen.globalMode && cfg.gen.expectedResult) {
+            funcs.decl += R"(
+    typename ResultValueType<uint32_t>::type enumerateInstanceVersion();
+
+)";
+            funcs.def += vkgen::format(R"(
+    {0} typename ResultValueType<uint32_t>::type enumerateInstanceVersion() {{
+      const auto &pfn = vk::context.getDispatcher()->vkEnumerateInstanceVersion;
+      uint32_t version = VK_API_VERSION_1_0;
+      if (pfn == nullptr) {{
+        return createResultValueType(VK_SUCCESS, version);
+      }}
+      auto result = pfn(&version);
+      return createResultValueType(result, version);
+    }}
+
+)",
+                                       cfg.macro.mInline.define);
+        }
+        else if (cfg.gen.globalMode) {
             funcs.decl += R"(
     uint32_t enumerateInstanceVersion();
 
@@ -8759,9 +13787,10 @@ extern "C" __declspec( dllimport ) FARPROC __stdcall GetProcAddress( HINSTANCE h
             p = ".";
         }
 
-        std::filesystem::path const path = std::filesystem::absolute(p + "\\");
-        const auto vulkanPath = std::filesystem::absolute(p + "\\vulkan\\");
-        const auto videoPath = std::filesystem::absolute(p + "\\vk_video\\");
+        // trailing separators, output files replace the filename part
+        std::filesystem::path const path = std::filesystem::absolute(p) / "";
+        const auto vulkanPath = path / "vulkan" / "";
+        const auto videoPath = path / "vk_video" / "";
 
         std::cout << "generating to: " << path << '\n';
         createPath(path);
@@ -23,6 +23,9 @@
 #include "Members.hpp"
 #include "Output.hpp"
 #include "Registry.hpp"
+#ifdef INST
+#  include "Inst.hpp"
+#endif
 
 #include <string>
 #include <optional>
@@ -188,6 +191,19 @@ namespace vkgen
 
         void generateForwardHandles(OutputBuffer &output);
 
+        struct EnumStringEntry
+        {
+            int64_t          value;
+            std::string      name;
+            const EnumValue *member;
+        };
+
+        std::vector<EnumStringEntry> getEnumStringEntries(const Enum &data, bool originalNames) const;
+
+        std::string generateEnumNameTable(const std::vector<EnumStringEntry> &entries) const;
+
+        void generateEnumStringTables(const Enum &data, std::string &to_string_code, std::string &decl, std::string &def) const;
+
         void generateEnumStr(const Enum &data, OutputBuffer &output);
 
         void generateEnum(const Enum &data, OutputBuffer &output, OutputBuffer &output_forward);
@@ -204,6 +220,8 @@ namespace vkgen
 
         void generateDispatch(OutputBuffer &output);
 
+        void generateSuccessBits(OutputBuffer &output);
+
         void generateErrorClasses(OutputBuffer &output);
 
         void generateResultValue(OutputBuffer &output);
@@ -219,6 +237,24 @@ namespace vkgen
             return cfg.gen.dispatchLoaderStatic && !cfg.gen.useStaticCommands;
         }
 
+        // struct members are left without default initializers, constructors initialize them
+        bool useCompactFlags() const {
+            const auto &cfg = getConfig();
+            return cfg.gen.compactFlags && cfg.gen.cppStd >= 20 && cfg.gen.enumMock == 0;
+        }
+
+        // Context::setDefaultAllocator and allocator adapters, defaults of RAII handles or global mode wrappers
+        bool useHostAllocators() const {
+            const auto &cfg = getConfig();
+            return cfg.gen.raii.hostAllocators && cfg.gen.allocatorParam && (cfg.gen.globalMode || !cfg.gen.expApi);
+        }
+
+        bool useUninitializedStructs() const {
+            const auto &cfg = getConfig();
+            return cfg.gen.structUninitialized && cfg.gen.structMock == 0 &&
+                   (cfg.gen.globalMode || cfg.gen.structConstructors.data.state != Define::DISABLED);
+        }
+
         std::string getDispatchArgument(bool assignment) const {
             if (!cfg.gen.dispatchParam) {
                 return "";
@@ -291,6 +327,14 @@ namespace vkgen
 
         void generateStructChains(OutputBuffer &output, bool ctype = false);
 
+        std::string generateSlotTable(const std::string &prefix, const std::string &ctype, const std::vector<int64_t> &values, std::vector<uint32_t> &slots) const;
+
+        void generateChainVisitor(OutputBuffer &output);
+
+        void generateHash(OutputBuffer &output);
+
+        void generateFormat(OutputBuffer &output);
+
         bool generateStructConstructor(OutputBuffer &output, const Struct &data, bool transform);
 
         void generateStruct(OutputBuffer &output, const Struct &data, bool exp);
@@ -311,6 +355,8 @@ namespace vkgen
 
         void generateDispatchRAII(OutputBuffer &output);
 
+        void generateStubDriver(OutputBuffer &output);
+
         void evalCommand(Command &ctx) const;
 
         static Command::NameCategory evalNameCategory(const std::string &name);
@@ -376,8 +422,25 @@ namespace vkgen
                                      bool                     inlineFuncs,
                                      bool                     noFuncs = false);
 
+        bool generateMemoizedQueriesRAII(OutputBuffer &output, const Handle &data, OutputClass &out);
+
         void generateClassRAII(OutputBuffer &output, const Handle &data, bool asUnique = false);
 
+        std::string generateRetireArgs(const Handle &data) const;
+
+        std::string generateRetireRAII(const Handle &data, const std::string &destroyCall) const;
+
+        void generateRetireQueue(OutputBuffer &output) const;
+
+        void generateClassClearRAII(const Handle &data);
+
+        void generatePooledArrayRAII(OutputBuffer &output, const Handle &data);
+
+        void generateCommandStreamRAII(OutputBuffer &output);
+
+        void generateSubmitBatcherRAII(OutputBuffer &output);
+
+
         void generateClassesRAII(OutputBuffer &output, bool exp = false);
 
         // std::string generatePFNs(const Handle &data, OutputClass &out) const;
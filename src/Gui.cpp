@@ -1121,7 +1121,7 @@ vkgen::GUI::GUI(vkgen::Generator &gen) {
       "##TableNS",
       "General",
       0,
-      std::make_unique<RenderableColumn<11>>(
+      std::make_unique<RenderableColumn<24>>(
         0,
         std::make_unique<RenderableText>("Variant"),
         make_config_option(0, BoolGUI{ &cfg.gen.globalMode.data, "vkg mode" }, "Vulkan with global functions"),
@@ -1129,24 +1129,39 @@ vkgen::GUI::GUI(vkgen::Generator &gen) {
         make_config_option(0, BoolGUI{ &cfg.gen.cppModules.data, "C++ module" }, "Generate C++20 module (vulkan.cppm)"),
         make_config_option(0, BoolGUI{ &cfg.gen.functionsVecAndArray.data, "Small vector" }, "Functions returning vk::Vector instead of std::vector"),
         make_config_option(Level::L2, BoolGUI{ &cfg.gen.raii.enabled.data, "RAII header" }, "Generate vk::raii header (vulkan_raii.hpp)"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.raii.memoizedQueries.data, "Memoized queries" }, "RAII PhysicalDevice caches immutable queries (properties, features, format properties)"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.raii.deferredDestroy.data, "Deferred destroy" }, "RAII Device children are destroyed through RetireQueue after GPU timeline passes, global mode hands them over with vk::retire"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.raii.pooledArrays.data, "Pooled arrays" }, "RAII PooledCommandBuffers/PooledDescriptorSets freed or reset with single call, global mode allocates them from vk::device"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.raii.cachedDispatcher.data, "Cached dispatcher" }, "RAII child handles keep dispatcher pointer, getDispatcher() and raii member commands skip the owner, global vkCmd* wrappers take a dispatcher pointer defaulting to vk::device"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.raii.commandStream.data, "Command stream" }, "CommandStream records vkCmd* calls into buffer, replayed later onto command buffer (vk::raii, vulkan_funcs.hpp in global mode)"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.raii.submitBatcher.data, "Submit batcher" }, "SubmitBatcher collects SubmitInfo2 from any thread lock-free, owner thread submits them in one call (vk::raii, vulkan_funcs.hpp in global mode)"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.raii.externSyncCheck.data, "Extern sync check" }, "Global wrappers report externsync handles used from two threads at once when VULKAN_HPP_EXTERN_SYNC_CHECK is defined, lock free handle table (VULKAN_HPP_EXTERN_SYNC_TABLE_SIZE)"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.raii.hostAllocators.data, "Host allocators" }, "Arena/Pool/Counting AllocationCallbacks adapters, default allocator of raii handles or global wrappers set by Context::setDefaultAllocator"),
         make_config_option(0, BoolGUI{ &cfg.gen.expandMacros.data, "Expand macros" }, "Expand preprocessor macros whenever possible"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.enumStringTables.data, "Enum string tables" }, "to_string_view, from_string and std::format/fmt formatters backed by generated tables"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.compactFlags.data, "Compact flags" }, "C++20 Flags with one concept constrained operator set, consteval allFlagsOf instead of FlagTraits"),
         // make_config_option(0, BoolGUI{&cfg.gen.exceptions.data, "exceptions"}, "enable vulkan exceptions"),
         // make_config_option(0, BoolGUI{ &cfg.gen.expApi.data, "Dynamic PFN linking" }, "PFN dispatcher will be embedded to Device and Instance"),
         make_config_option(Level::L2, 0, NestedOption<BoolGUI>{ &cfg.gen.integrateVma.data, "Integrate VMA" }, "PFN dispatcher can be used with VMA"),
         make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.proxyPassByCopy.data, "Pass ArrayProxy as copy" }, "Pass ArrayProxy parameter as copy instead of reference"),
         make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.unifiedException.data, "Unified exception" }, "Generates only vk::Error exeption"),
-        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.branchHint.data, "Branch hints" }, "Add compiler C++20 hints (likely, unlikely)")),
-      std::make_unique<RenderableColumn<8>>(
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.expectedResult.data, "Expected results" }, "Functions return ResultValue instead of throwing, also global init functions, RAII handles get static create()"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.branchHint.data, "Branch hints" }, "Add compiler C++20 hints (likely, unlikely)"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.coldErrorPaths.data, "Cold error paths" }, "Success codes checked as bitmask, also for commands returning Result, throwing moved to cold noinline functions"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.stubDriver.data, "Stub driver" }, "Generates no-op implementation of commands (vulkan_stub.hpp)")),
+      std::make_unique<RenderableColumn<10>>(
         1,
         std::make_unique<RenderableText>("Handles"),
         make_config_option(Level::L0, 0, BoolDefineGUI(&cfg.gen.handleConstructors.data, "constructors", "Removes handle constructors")),
         make_config_option(Level::L1, 0, BoolDefineGUI(&cfg.gen.smartHandles.data, "smart handles", "Removes smart (unique) handles")),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.uniqueCompact.data, "compact unique" }, "Unique handle deleters do not store default dispatcher, or owner in global mode, size checked by static_assert"),
         make_config_option(Level::L1, 0, BoolDefineGUI(&cfg.gen.handleTemplates.data, "type traits", "Removes CppType and isVulkanHandleType")),
         std::make_unique<RenderableText>("Functions"),
         make_config_option(0, BoolGUI{ &cfg.gen.dispatchParam.data, "Dispatch parameter" }, "Removes dispatch from handles and functions"),
         make_config_option(0, BoolGUI{ &cfg.gen.allocatorParam.data, "Allocator parameter" }, "Removes allocationcallbacks from handles and functions"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.dispatchGrouping.data, "Dispatch grouping" }, "Dispatcher PFNs ordered by usage, vkCmd* first, hot list ahead of them"),
         make_config_option(Level::L2, 0, BitSelector{ cfg.gen.classMethods.data, 1, "Methods from subobjects" }, "Methods from subobjects will be added to top level handle")),
-      std::make_unique<RenderableColumn<9>>(
+      std::make_unique<RenderableColumn<14>>(
         2,
         Level::L1,
         std::make_unique<RenderableText>("C++ Structs"),
@@ -1155,6 +1170,11 @@ vkgen::GUI::GUI(vkgen::Generator &gen) {
         make_config_option(Level::L1, 0, BoolDefineGUI(&cfg.gen.structCompare.data, "compares", "Removes struct compare operator")),
         make_config_option(Level::L1, 0, BoolDefineGUI(&cfg.gen.structReflect.data, "reflect", "Removes struct reflection")),
         make_config_option(Level::L1, 0, NestedOption<BoolGUI>{ &cfg.gen.spaceshipOperator.data, "spaceship operator" }, "Removes spaceship operator from API"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.flatStructChain.data, "flat struct chain" }, "Adds FlatStructureChain, chain stored in one buffer without std::tuple"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.structChainVisitor.data, "chain visitor" }, "Adds visitChain, sizeofStructureType and deepCopyChain for pNext chains"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.structHash.data, "hash" }, "Generates std::hash and hashCombine for structs (vulkan_hash.hpp)"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.structUninitialized.data, "uninitialized" }, "Adds vk::uninitialized_t constructors to structs, ArrayWrapper1D, Vector and StructureChain, only sType and pNext are set. In global mode structs stay aggregates and default initialization sets only sType and pNext"),
+        make_config_option(Level::L2, 0, BoolGUI{ &cfg.gen.structFormat.data, "format" }, "Generates std::formatter and fmt::formatter for structs (vulkan_format.hpp)"),
         std::make_unique<RenderableText>("C++ Unions"),
         make_config_option(Level::L1, 0, BoolDefineGUI(&cfg.gen.unionConstructors.data, "union constructors","Removes union constructors")),
         make_config_option(Level::L1, 0, BoolDefineGUI(&cfg.gen.unionSetters.data, "union setters", "Removes union setter functions")))
@@ -1367,6 +1387,8 @@ void vkgen::GUI::mainScreen() {
             InputText("Namespace", &cfg.macro.mNamespace.data.value);
             InputText("vk::Context name", &cfg.gen.contextClassName.data);
             InputText("Module name", &cfg.gen.moduleName.data);
+            InputText("Memoized commands", &cfg.gen.raii.memoizedCommands.data);
+            InputText("Dispatch hot list", &cfg.gen.dispatchHotList.data);
             PopItemWidth();
         }
 
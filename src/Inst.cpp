@@ -0,0 +1,507 @@
+// MIT License
+// Copyright (c) 2021-2023  @guritchi
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Inst.hpp"
+
+#include "Format.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+
+// runtime of instrumented wrappers, every wrapper body starts with VULKAN_HPP_INST_SCOPE( <command id> )
+// records are kept per thread and written to the log when the buffer is full or the thread exits,
+// the log is a ring of VULKAN_HPP_INST_LOG_SIZE bytes, oldest chunks are overwritten
+static constexpr char const *RES_INST_BEGIN{ R"(
+#if defined( VULKAN_HPP_INSTRUMENT )
+#  include <atomic>
+#  include <chrono>
+#  include <cstdint>
+#  include <cstdio>
+#  include <cstdlib>
+#  include <cstring>
+#  include <memory>
+#  include <mutex>
+#  if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#    include <intrin.h>
+#    define VULKAN_HPP_INST_TSC
+#  elif defined( __x86_64__ ) || defined( __i386__ )
+#    include <x86intrin.h>
+#    define VULKAN_HPP_INST_TSC
+#  endif
+#  if !defined( VULKAN_HPP_INST_BUFFER_SIZE )
+#    define VULKAN_HPP_INST_BUFFER_SIZE 4096
+#  endif
+#  if !defined( VULKAN_HPP_INST_LOG_SIZE )
+#    define VULKAN_HPP_INST_LOG_SIZE ( 64ull << 20 )
+#  endif
+
+namespace vk_inst
+{
+  struct Record
+  {
+    uint64_t begin;
+    uint32_t duration;
+    uint32_t command;
+  };
+
+  inline uint64_t nanoseconds() noexcept
+  {
+    return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+  }
+
+  inline uint64_t ticks() noexcept
+  {
+#  if defined( VULKAN_HPP_INST_TSC )
+    return __rdtsc();
+#  else
+    return nanoseconds();
+#  endif
+  }
+
+  // taken at static initialization, the reader calibrates ticks against the time of the last chunk
+  inline const uint64_t startTicks       = ticks();
+  inline const uint64_t startNanoseconds = nanoseconds();
+
+  // appends records of one thread to the log, defined at the end of vulkan.hpp
+  inline void writeChunk( uint32_t thread, Record const * records, uint32_t count ) noexcept;
+
+  inline uint32_t nextThreadIndex() noexcept
+  {
+    static std::atomic<uint32_t> next{ 0 };
+    return next.fetch_add( 1, std::memory_order_relaxed );
+  }
+
+  // written only by the owning thread, no synchronization until a full buffer is handed to the log
+  class ThreadBuffer
+  {
+  public:
+    ThreadBuffer() : m_records( new Record[VULKAN_HPP_INST_BUFFER_SIZE] ), m_thread( nextThreadIndex() ) {}
+
+    ThreadBuffer( ThreadBuffer const & )             = delete;
+    ThreadBuffer & operator=( ThreadBuffer const & ) = delete;
+
+    ~ThreadBuffer()
+    {
+      flush();
+    }
+
+    void push( uint32_t command, uint64_t begin, uint64_t end ) noexcept
+    {
+      const uint64_t duration = end - begin;
+      m_records[m_count++]    = { begin, duration > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>( duration ), command };
+      if ( m_count == VULKAN_HPP_INST_BUFFER_SIZE )
+      {
+        flush();
+      }
+    }
+
+    void flush() noexcept
+    {
+      if ( m_count != 0 )
+      {
+        writeChunk( m_thread, m_records.get(), m_count );
+        m_count = 0;
+      }
+    }
+
+  private:
+    std::unique_ptr<Record[]> m_records;
+    uint32_t                  m_count = 0;
+    uint32_t                  m_thread;
+  };
+
+  inline ThreadBuffer & threadBuffer()
+  {
+    static thread_local ThreadBuffer buffer;
+    return buffer;
+  }
+
+  // writes pending records of the calling thread, e.g. before a long running thread idles
+  inline void flush()
+  {
+    threadBuffer().flush();
+  }
+
+  class Scope
+  {
+  public:
+    explicit Scope( uint32_t command ) noexcept : m_begin( ticks() ), m_command( command ) {}
+
+    Scope( Scope const & )             = delete;
+    Scope & operator=( Scope const & ) = delete;
+
+    ~Scope()
+    {
+      const uint64_t end = ticks();
+      threadBuffer().push( m_command, m_begin, end );
+    }
+
+  private:
+    uint64_t m_begin;
+    uint32_t m_command;
+  };
+}  // namespace vk_inst
+
+#  define VULKAN_HPP_INST_SCOPE( id ) ::vk_inst::Scope const vulkanInstScope( id )
+#else
+#  define VULKAN_HPP_INST_SCOPE( id )
+#endif
+)" };
+
+// log layout, native byte order:
+//   header: "VKINST01", u32 version, u32 command count, u64 start ticks, u64 start ns,
+//           u32 records per slot, u32 slot count, u64 overwritten records, per command u16 length + name
+//   slots:  fixed size ring, slot = u32 thread, u32 record count, u64 ticks, u64 ns, u64 sequence,
+//           records { u64 begin, u32 duration, u32 command }, slots past the last one written are missing
+static constexpr char const *RES_INST_END{ R"(
+#if defined( VULKAN_HPP_INSTRUMENT )
+namespace vk_inst
+{{
+  inline constexpr uint32_t     commandCount                = {0};
+  inline constexpr char const * commandNames[commandCount] = {{
+{1}  }};
+
+  // opened on the first chunk, never destroyed so that threads outliving static destructors can still write;
+  // chunks go to fixed size slots in turn, once all slots are used the oldest one is overwritten
+  class Log
+  {{
+  public:
+    static constexpr uint32_t version          = 2;
+    static constexpr long     overwrittenOffset = 40;
+    static constexpr uint64_t slotSize          = 32 + sizeof( Record ) * uint64_t( VULKAN_HPP_INST_BUFFER_SIZE );
+    static constexpr uint32_t slotCount         = VULKAN_HPP_INST_LOG_SIZE / slotSize > 0 ? uint32_t( VULKAN_HPP_INST_LOG_SIZE / slotSize ) : 1;
+
+    static Log & get()
+    {{
+      static Log * log = new Log;
+      return *log;
+    }}
+
+    void write( uint32_t thread, Record const * records, uint32_t count ) noexcept
+    {{
+      std::lock_guard<std::mutex> lock( m_mutex );
+      if ( !m_opened )
+      {{
+        open();
+      }}
+      if ( !m_file )
+      {{
+        return;
+      }}
+      uint32_t const slot = static_cast<uint32_t>( m_written % slotCount );
+      m_overwritten += m_slotRecords[slot];
+      m_slotRecords[slot] = count;
+
+      std::fseek( m_file, static_cast<long>( m_slotsOffset + slot * slotSize ), SEEK_SET );
+      put<uint32_t>( thread );
+      put<uint32_t>( count );
+      put<uint64_t>( ticks() );
+      put<uint64_t>( nanoseconds() );
+      put<uint64_t>( m_written++ );
+      std::fwrite( records, sizeof( Record ), count, m_file );
+
+      std::fseek( m_file, overwrittenOffset, SEEK_SET );
+      put<uint64_t>( m_overwritten );
+      std::fflush( m_file );
+    }}
+
+  private:
+    template <typename T>
+    void put( T value ) noexcept
+    {{
+      std::fwrite( &value, sizeof( T ), 1, m_file );
+    }}
+
+    void open() noexcept
+    {{
+      m_opened         = true;
+      char const * env = std::getenv( "VULKAN_HPP_INST_LOG" );
+      m_file           = std::fopen( env ? env : "vulkan_inst.bin", "wb" );
+      if ( !m_file )
+      {{
+        return;
+      }}
+      std::fwrite( "VKINST01", 1, 8, m_file );
+      put<uint32_t>( version );
+      put<uint32_t>( commandCount );
+      put<uint64_t>( startTicks );
+      put<uint64_t>( startNanoseconds );
+      put<uint32_t>( VULKAN_HPP_INST_BUFFER_SIZE );
+      put<uint32_t>( slotCount );
+      put<uint64_t>( 0 );
+      for ( char const * name : commandNames )
+      {{
+        const uint16_t size = static_cast<uint16_t>( std::strlen( name ) );
+        put<uint16_t>( size );
+        std::fwrite( name, 1, size, m_file );
+      }}
+      m_slotsOffset = static_cast<uint64_t>( std::ftell( m_file ) );
+      m_slotRecords.reset( new uint32_t[slotCount]() );
+    }}
+
+    std::mutex                  m_mutex;
+    std::FILE *                 m_file        = nullptr;
+    bool                        m_opened      = false;
+    uint64_t                    m_slotsOffset = 0;
+    uint64_t                    m_written     = 0;
+    uint64_t                    m_overwritten = 0;
+    std::unique_ptr<uint32_t[]> m_slotRecords;
+  }};
+
+  inline void writeChunk( uint32_t thread, Record const * records, uint32_t count ) noexcept
+  {{
+    Log::get().write( thread, records, count );
+  }}
+}}  // namespace vk_inst
+#endif
+)" };
+
+namespace vkgen::Inst
+{
+
+    namespace
+    {
+        std::vector<std::string>                  names;
+        std::unordered_map<std::string, uint32_t> ids;
+
+        struct Record
+        {
+            uint64_t begin;
+            uint32_t duration;
+            uint32_t command;
+        };
+        static_assert(sizeof(Record) == 16);
+
+        class LogReader
+        {
+          public:
+            explicit LogReader(const std::string &path) : in(path, std::ios::binary) {
+                if (!in) {
+                    throw std::runtime_error("readlog: can't open " + path);
+                }
+            }
+
+            template <typename T>
+            bool get(T &value) {
+                return static_cast<bool>(in.read(reinterpret_cast<char *>(&value), sizeof(T)));
+            }
+
+            bool get(char *data, size_t size) {
+                return static_cast<bool>(in.read(data, static_cast<std::streamsize>(size)));
+            }
+
+            uint64_t position() {
+                return static_cast<uint64_t>(in.tellg());
+            }
+
+            bool seek(uint64_t offset) {
+                return static_cast<bool>(in.seekg(static_cast<std::streamoff>(offset)));
+            }
+
+          private:
+            std::ifstream in;
+        };
+
+        struct CommandStats
+        {
+            std::string           name;
+            std::vector<uint32_t> durations;  // ticks
+            uint64_t              total = 0;
+        };
+
+        std::string formatTime(double ns) {
+            if (ns < 1e3) {
+                return vkgen::format("{:.0f} ns", ns);
+            }
+            if (ns < 1e6) {
+                return vkgen::format("{:.1f} us", ns / 1e3);
+            }
+            if (ns < 1e9) {
+                return vkgen::format("{:.1f} ms", ns / 1e6);
+            }
+            return vkgen::format("{:.2f} s", ns / 1e9);
+        }
+
+    }  // namespace
+
+    void processCommands(const std::vector<std::string> &commands) {
+        names = commands;
+        ids.clear();
+        for (size_t i = 0; i < names.size(); ++i) {
+            ids.emplace(names[i], static_cast<uint32_t>(i));
+        }
+    }
+
+    std::string bodyStart(const std::string &command) {
+        const auto it = ids.find(command);
+        if (it == ids.end()) {
+            return "";
+        }
+        return "      VULKAN_HPP_INST_SCOPE( " + std::to_string(it->second) + " );\n";
+    }
+
+    std::string mainFileBegin() {
+        return RES_INST_BEGIN;
+    }
+
+    std::string mainFileEnd() {
+        std::string table;
+        for (const auto &n : names) {
+            table += "    \"" + n + "\",\n";
+        }
+        return vkgen::format(RES_INST_END, names.size(), table);
+    }
+
+    void readLog(const std::string &path) {
+        LogReader log{ path };
+
+        std::array<char, 8> magic;
+        uint32_t            version      = 0;
+        uint32_t            commandCount = 0;
+        uint64_t            startTicks   = 0;
+        uint64_t            startNs      = 0;
+        uint32_t            slotCapacity = 0;
+        uint32_t            slotCount    = 0;
+        uint64_t            overwritten  = 0;
+        if (!log.get(magic.data(), magic.size()) || std::string_view{ magic.data(), magic.size() } != "VKINST01" || !log.get(version)) {
+            throw std::runtime_error("readlog: " + path + " is not an instrumentation log");
+        }
+        if (version != 2) {
+            throw std::runtime_error("readlog: " + path + " has unsupported version " + std::to_string(version));
+        }
+        if (!log.get(commandCount) || !log.get(startTicks) || !log.get(startNs) || !log.get(slotCapacity) || !log.get(slotCount) || !log.get(overwritten)) {
+            throw std::runtime_error("readlog: truncated header");
+        }
+
+        std::vector<CommandStats> commands(commandCount);
+        for (auto &c : commands) {
+            uint16_t size = 0;
+            if (!log.get(size)) {
+                throw std::runtime_error("readlog: truncated command table");
+            }
+            c.name.resize(size);
+            if (!log.get(c.name.data(), size)) {
+                throw std::runtime_error("readlog: truncated command table");
+            }
+        }
+
+        // slots are in ring order, the newest chunk (highest sequence) calibrates ticks
+        const uint64_t        slotsOffset = log.position();
+        const uint64_t        slotSize    = 32 + sizeof(Record) * uint64_t(slotCapacity);
+        uint64_t              lastTicks   = startTicks;
+        uint64_t              lastNs      = startNs;
+        uint64_t              newest      = 0;
+        uint64_t              records     = 0;
+        uint64_t              unknown     = 0;
+        uint32_t              threads     = 0;
+        std::vector<Record>   chunk;
+        for (uint32_t slot = 0; slot < slotCount; ++slot) {
+            uint32_t thread   = 0;
+            uint32_t count    = 0;
+            uint64_t ticks    = 0;
+            uint64_t ns       = 0;
+            uint64_t sequence = 0;
+            if (!log.seek(slotsOffset + slot * slotSize) || !log.get(thread)) {
+                break;
+            }
+            if (!log.get(count) || !log.get(ticks) || !log.get(ns) || !log.get(sequence) || count > slotCapacity) {
+                std::cerr << "readlog: truncated chunk header, ignored\n";
+                break;
+            }
+            chunk.resize(count);
+            if (!log.get(reinterpret_cast<char *>(chunk.data()), count * sizeof(Record))) {
+                std::cerr << "readlog: truncated chunk, ignored\n";
+                break;
+            }
+            if (sequence >= newest) {
+                newest    = sequence;
+                lastTicks = ticks;
+                lastNs    = ns;
+            }
+            threads = std::max(threads, thread + 1);
+            records += count;
+            for (const auto &r : chunk) {
+                if (r.command >= commands.size()) {
+                    unknown++;
+                    continue;
+                }
+                auto &c = commands[r.command];
+                c.durations.push_back(r.duration);
+                c.total += r.duration;
+            }
+        }
+
+        // ticks are TSC cycles on x86, nanoseconds elsewhere
+        double ticksPerNs = 1.0;
+        if (lastNs > startNs && lastTicks > startTicks) {
+            ticksPerNs = double(lastTicks - startTicks) / double(lastNs - startNs);
+        }
+        const auto toNs = [&](uint64_t t) { return double(t) / ticksPerNs; };
+
+        std::cout << vkgen::format("{}: {} records, {} threads, {}, {:.3f} ticks/ns\n", path, records, threads, formatTime(double(lastNs - startNs)), ticksPerNs);
+        if (overwritten) {
+            std::cout << vkgen::format("{} older records overwritten, log keeps {} chunks of {} records\n", overwritten, slotCount, slotCapacity);
+        }
+        if (unknown) {
+            std::cout << vkgen::format("{} records with unknown command id\n", unknown);
+        }
+
+        std::erase_if(commands, [](const CommandStats &c) { return c.durations.empty(); });
+        std::sort(commands.begin(), commands.end(), [](const CommandStats &a, const CommandStats &b) { return a.total > b.total; });
+
+        for (auto &c : commands) {
+            auto      &d     = c.durations;
+            const auto count = d.size();
+            std::sort(d.begin(), d.end());
+            const auto at = [&](double q) { return toNs(d[std::min(count - 1, size_t(q * double(count)))]); };
+
+            std::cout << vkgen::format("\n{}\n  calls {}  total {}  mean {}  min {}  p50 {}  p99 {}  max {}\n",
+                                       c.name,
+                                       count,
+                                       formatTime(toNs(c.total)),
+                                       formatTime(toNs(c.total) / double(count)),
+                                       formatTime(toNs(d.front())),
+                                       formatTime(at(0.5)),
+                                       formatTime(at(0.99)),
+                                       formatTime(toNs(d.back())));
+
+            // power of two buckets in nanoseconds, bucket b holds [2^(b-1), 2^b)
+            std::array<uint64_t, 65> histogram{};
+            for (uint32_t t : d) {
+                histogram[std::bit_width(uint64_t(toNs(t)))]++;
+            }
+            const uint64_t peak = *std::max_element(histogram.begin(), histogram.end());
+            for (size_t b = 0; b < histogram.size(); ++b) {
+                if (histogram[b] == 0) {
+                    continue;
+                }
+                const double lo  = b == 0 ? 0.0 : double(uint64_t(1) << (b - 1));
+                const double hi  = double(uint64_t(1) << std::min<size_t>(b, 63));
+                const size_t bar = size_t(40 * histogram[b] / peak);
+                std::cout << vkgen::format("  [{:>8}, {:>8}) {:>10} {}\n", formatTime(lo), formatTime(hi), histogram[b], std::string(std::max<size_t>(bar, 1), '#'));
+            }
+        }
+    }
+
+}  // namespace vkgen::Inst
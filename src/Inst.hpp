@@ -0,0 +1,48 @@
+// MIT License
+// Copyright (c) 2021-2023  @guritchi
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef INST_HPP
+#define INST_HPP
+
+#include <string>
+#include <vector>
+
+// Instrumentation of generated bindings (GENERATOR_INST builds).
+// Wrappers record command id and timestamps when VULKAN_HPP_INSTRUMENT is defined,
+// records are written to a binary log decoded by --readlog.
+namespace vkgen::Inst
+{
+
+    // assigns command ids, order of registry
+    void processCommands(const std::vector<std::string> &commands);
+
+    // first statement of wrapper body, empty for unknown commands
+    std::string bodyStart(const std::string &command);
+
+    // runtime used by wrappers, emitted before any wrapper definition
+    std::string mainFileBegin();
+
+    // command name table and log writer
+    std::string mainFileEnd();
+
+    // prints call counts and latency histograms of a log
+    void readLog(const std::string &path);
+
+}  // namespace vkgen::Inst
+
+#endif  // INST_HPP
@@ -108,6 +108,8 @@ namespace vkgen
                 std::cerr << "Error: can't generate function: class has "
                              "no owner ("
                           << cls->name << ", " << name << ")" << '\n';
+            } else if (gen.getConfig().gen.raii.cachedDispatcher && !gen.getConfig().gen.expApi) {
+                pfnSourceOverride = "m_dispatcher->";
             } else {
                 pfnSourceOverride = cls->ownerhandle + "->getDispatcher()->";
             }
@@ -125,9 +127,26 @@ namespace vkgen
             }
         }
 
+        // global wrappers, handle arguments with externsync="true" are owned by the calling thread for the duration of the call
+        if (gen.getConfig().gen.globalMode && gen.getConfig().gen.raii.externSyncCheck && !constructor) {
+            std::string scopes;
+            for (const VariableData &p : cmd->params) {
+                if (p.getIgnoreFlag() || !p.isHandle() || p.original.isPointer() || !p.isExternSyncSelf()) {
+                    continue;
+                }
+                scopes += vkgen::format("      {0}::detail::ExternSyncScope const externSync_{1}( {0}::detail::externSyncKey( static_cast<{2}>( {1} ) ), \"{3}\" );\n",
+                                        gen.m_ns,
+                                        p.identifier(),
+                                        p.original.type(),
+                                        cmd->name.original);
+            }
+            if (!scopes.empty()) {
+                output += "#if defined( VULKAN_HPP_EXTERN_SYNC_CHECK )\n" + scopes + "#endif\n";
+            }
+        }
+
 #ifdef INST
-        std::cout << "Inst::bodyStart" << '\n';
-        output += Inst::bodyStart(ctx.ns, name.original);
+        output += Inst::bodyStart(cmd->name.original);
 #endif
 
         output += generateMemberBody();
@@ -407,7 +426,9 @@ namespace vkgen
                 } else if (cls->name == "Device" && gen.getConfig().gen.raii.staticDevicePFN) {
                     output += gen.m_ns_raii + "::Device::m_dispatcher.";
                 } else {
-                    if (!cls->ownerhandle.empty()) {
+                    if (!cls->ownerhandle.empty() && gen.getConfig().gen.raii.cachedDispatcher && !gen.getConfig().gen.expApi) {
+                        output += "m_dispatcher->";
+                    } else if (!cls->ownerhandle.empty()) {
                         output += cls->ownerhandle + "->getDispatcher()->";
                     } else {
                         output += "m_dispatcher->";
@@ -491,6 +512,16 @@ namespace vkgen
                 }
                 return "std::make_pair( " + result + ", " + identifier + " )";
             }
+            if (gen.getConfig().gen.expectedResult && usesResultValueType()) {
+                std::string result = resultVar.identifier();
+                if (gen.getConfig().gen.internalVkResult && !gen.getConfig().gen.globalMode) {
+                    result = "static_cast<Result>(" + result + ")";
+                }
+                if (identifier.empty()) {
+                    return "createResultValueType( " + result + " )";
+                }
+                return "createResultValueType( " + result + ", std::move( " + identifier + " ) )";
+            }
             return identifier;
         }
 
@@ -499,6 +530,10 @@ namespace vkgen
             out += "ResultValue<" + returnType + ">";
         } else if (usesResultValueType()) {
             out += "createResultValueType";
+            if (gen.getConfig().gen.globalMode) {
+                // global wrappers may hold the value in its C type
+                out += "<" + returnType + ">";
+            }
         } else {
             return identifier;
         }
@@ -542,9 +577,31 @@ namespace vkgen
         if (cmd->pfnReturn != Command::PFNReturnCategory::VK_RESULT || resultVar.isInvalid()) {
             return "";
         }
+        if (propagatesResult()) {
+            return "";
+        }
 
         std::string message = createCheckMessageString();
         std::string codes;
+        if (gen.getConfig().gen.coldErrorPaths) {
+            for (const auto &c : cmd->successCodes) {
+                if (c == "VK_INCOMPLETE") {
+                    continue;
+                }
+                codes += (gen.getConfig().gen.internalVkResult ? c : "Result::" + gen.enumConvertCamel("Result", c)) + ", ";
+            }
+            strStripSuffix(codes, ", ");
+            if (codes.empty()) {
+                codes = gen.getConfig().gen.internalVkResult ? "VK_SUCCESS" : "Result::eSuccess";
+            }
+            return vkgen::format(R"(
+      resultCheck<VULKAN_HPP_NAMESPACE::detail::successMask( {2} )>({0},
+                {1});
+)",
+                                 resultVar.identifier(),
+                                 message,
+                                 codes);
+        }
         if (returnSuccessCodes() > 1) {
             codes = successCodesList("                ");
         }
@@ -576,15 +633,32 @@ namespace vkgen
 
     bool MemberResolver::usesResultValueType() const {
         const auto &cfg = gen.getConfig();
-        if (!cfg.gen.resultValueType) {
+        if (!cfg.gen.resultValueType && !cfg.gen.expectedResult) {
             return false;
         }
-        if (ctx.exp) {
+        // global wrappers hand the value out with its result in expected mode
+        if (ctx.exp && !(cfg.gen.expectedResult && cfg.gen.globalMode)) {
             return false;
         }
         return !returnType.empty() && returnType != "Result" && returnType != "VkResult" && cmd->pfnReturn == Command::PFNReturnCategory::VK_RESULT;
     }
 
+    bool MemberResolver::propagatesResult() const {
+        // expected mode: result is returned to caller instead of checked
+        if (!gen.getConfig().gen.expectedResult || returnType.empty()) {
+            return false;
+        }
+        return usesResultValue() || usesResultValueType() || returnType == "Result" || returnType == "VkResult";
+    }
+
+    bool MemberResolver::checksReturnedResult() const {
+        // cold error paths: Result returned for several success codes is checked against their mask first
+        if (!gen.getConfig().gen.coldErrorPaths || !enhanced || propagatesResult() || !cmd->outParams.empty()) {
+            return false;
+        }
+        return cmd->pfnReturn == Command::PFNReturnCategory::VK_RESULT && returnSuccessCodes() > 1;
+    }
+
     std::string MemberResolver::generateReturnType() const {
         if (ctx.ns == Namespace::VK) {
             if (usesResultValue()) {
@@ -597,6 +671,9 @@ namespace vkgen
             if (usesResultValue()) {
                 return vkgen::format("std::pair<{0}::Result, {1}>", gen.m_ns, returnType);
             }
+            if (gen.getConfig().gen.expectedResult && usesResultValueType()) {
+                return "typename ResultValueType<" + returnType + ">::type";
+            }
         }
         return returnType;
     }
@@ -634,7 +711,8 @@ namespace vkgen
             type = "std::pair<" + str + ">";
         }
 
-        if (returnSuccessCodes() > 1) {
+        const auto &cfg = gen.getConfig();
+        if (returnSuccessCodes() > 1 || (cfg.gen.expectedResult && cfg.gen.globalMode && cmd->pfnReturn == Command::PFNReturnCategory::VK_RESULT)) {
             if (type.empty() || type == "void") {
                 // type = gen.getConfig().gen.globalMode? "VkResult" : "Result";
                 type = "Result";
@@ -669,6 +747,9 @@ namespace vkgen
         if (specifierExplicit && decl) {
             output += cfg.macro.mExplicit.get() + " ";
         }
+        if (specifierStatic && decl) {
+            output += "static ";
+        }
         if (specifierConstexpr) {
             output += gen.m_constexpr + " ";
         } else if (specifierConstexpr14) {
@@ -752,7 +833,7 @@ namespace vkgen
         if (specifierConst && !ctx.isStatic && !constructor && !ctx.globalModeStatic) {
             output += " const";
         }
-        if (returnType == "void" || returnType == "Result" || returnType == "VkResult") {
+        if ((returnType == "void" || returnType == "Result" || returnType == "VkResult") && !checksReturnedResult()) {
             output += " " + gen.m_noexcept;
         }
         if (ctx.ns == Namespace::RAII && !temp.empty()) {
@@ -949,6 +1030,23 @@ namespace vkgen
             }
         }
 
+        // global command buffer wrappers take the device dispatcher, recording loops pass one they keep in a register,
+        // with dispatch_template any type with the PFN members they call
+        if (cfg.gen.globalMode && cfg.gen.raii.cachedDispatcher && ctx.ns == Namespace::VK && cmd->top && cmd->top->name == "Device" &&
+            !cmd->params.empty() && cmd->params.begin()->get().original.type() == "VkCommandBuffer") {
+            VariableData &var = addVar(cmd->params.end());
+            var.setSpecialType(VariableData::TYPE_DISPATCH);
+            var.setFullType("", cfg.gen.dispatchTemplate ? "Dispatch" : "DeviceDispatcher", " const *");
+            var.setIdentifier("dispatcher");
+            var.setIgnorePFN(true);
+            var.setOptional(true);
+            var.setDbgTag("(D)");
+            var.setAssignment(" = " + gen.m_ns + "::device.getDispatcher()");
+            if (cfg.gen.dispatchTemplate) {
+                var.dataTemplate = {"typename ", "Dispatch", " = DeviceDispatcher"};
+            }
+            pfnSourceOverride = "dispatcher->";
+        }
 
         if (ctx.globalModeStatic) {
             VariableData &first = *cmd->params.begin();
@@ -1288,7 +1386,12 @@ namespace vkgen
                 }
                 if (v.type() == "AllocationCallbacks") {
                     if (!v.isPointer()) {
-                        v.setAssignment(" VULKAN_HPP_DEFAULT_ALLOCATOR_ASSIGNMENT");
+                        const bool hostDefault   = gen.useHostAllocators();
+                        const bool raiiDefault   = hostDefault && ctx.ns == Namespace::RAII && !gen.getConfig().gen.expApi;
+                        const bool globalDefault = hostDefault && ctx.ns == Namespace::VK && gen.getConfig().gen.globalMode;
+                        v.setAssignment(raiiDefault     ? " VULKAN_HPP_RAII_DEFAULT_ALLOCATOR_ASSIGNMENT"
+                                        : globalDefault ? " VULKAN_HPP_GLOBAL_DEFAULT_ALLOCATOR_ASSIGNMENT"
+                                                        : " VULKAN_HPP_DEFAULT_ALLOCATOR_ASSIGNMENT");
                     }
                     else {
                         v.setAssignment("");
@@ -2161,7 +2264,8 @@ namespace vkgen
         if (dbg) {
             output += "// MemberResolverDefault \n";
         }
-        bool immediate = returnType != "void" && cmd->pfnReturn != Command::PFNReturnCategory::VOID && cmd->outParams.empty() && !usesResultValueType();
+        bool immediate = returnType != "void" && cmd->pfnReturn != Command::PFNReturnCategory::VOID && cmd->outParams.empty() && !usesResultValueType() &&
+                         !checksReturnedResult();
 
         bool          returnsRAII    = false;
         std::string   returnId;
@@ -2270,6 +2374,10 @@ for (auto const &{2} : {3}) {
                 // output += "/*.R*/";
             }
             output += '\n';
+        } else if (returnType == "void" && !constructor && propagatesResult()) {
+            output += "      return " + generateReturnValue("") + ";\n";
+        } else if (checksReturnedResult()) {
+            output += "      return " + castTo(returnType, resultVar.identifier()) + ";\n";
         }
 
         const auto createInternalCall = [&]() {
@@ -2600,12 +2708,28 @@ for (auto const &{2} : {3}) {
         const std::string &owner = cls->ownerhandle;
         if (!owner.empty() && !constructorInterop && !ctx.exp) {
             output += "      " + owner + " = " + superclassSource.getSuperclassAssignment() + ";\n";
+            if (gen.getConfig().gen.raii.cachedDispatcher) {
+                output += "      m_dispatcher = " + owner + "->getDispatcher();\n";
+            }
         }
 
         std::string call = generatePFNcall();
 
         output += "      " + call + "\n";
-        output += generateCheck();
+        if (resultOut.empty()) {
+            output += generateCheck();
+        } else {
+            output += vkgen::format(R"(      {0} = static_cast<Result>( {1} );
+      if ( {0} != Result::eSuccess )
+      {{
+        {2} = {{}};
+        return;
+      }}
+)",
+                                    resultOut,
+                                    resultVar.identifier(),
+                                    cls->vkhandle.identifier());
+        }
 
         if (!cls->isSubclass && !constructorInterop) {
             const auto &superclass = cls->superclass;
@@ -2631,6 +2755,47 @@ for (auto const &{2} : {3}) {
         return output;
     }
 
+    MemberResolverCtorNoThrow::MemberResolverCtorNoThrow(const Generator &gen, ClassCommand &d, MemberContext &refCtx)
+      : MemberResolverCtor(gen, d, refCtx)
+    {
+        // same as constructor, but reports result through first parameter
+        resultOut = "createResult";
+
+        auto &var = addVar(cmd->params.begin());
+        var.setFullType("", "Result", " &");
+        var.setIdentifier(resultOut);
+        var.setIgnorePFN(true);
+        var.setDbgTag("(R)");
+
+        specifierExplicit = false;
+        dbgtag            = "raii nothrow constructor";
+    }
+
+    MemberResolverCtorFactory::MemberResolverCtorFactory(const Generator &gen, ClassCommand &d, MemberContext &refCtx)
+      : MemberResolverCtor(gen, d, refCtx)
+    {
+        name.assign("create");
+        returnType = cls->name;
+
+        specifierExplicit = false;
+        specifierStatic   = true;
+        dbgtag            = "raii create";
+    }
+
+    std::string MemberResolverCtorFactory::generateMemberBody() {
+        std::string args;
+        for (const VariableData &v : getFilteredProtoVars()) {
+            args += ", " + v.identifier();
+        }
+
+        return vkgen::format(R"(      Result result = Result::eSuccess;
+      {0} handle( result{1} );
+      return ResultValue<{0}>( result, std::move( handle ) );
+)",
+                             cls->name,
+                             args);
+    }
+
     MemberResolverInit::MemberResolverInit(const Generator &gen, ClassCommand &d, MemberContext &refCtx) :
         MemberResolverCtor(gen, d, refCtx)
     {
@@ -2750,6 +2915,11 @@ for (auto const &{2} : {3}) {
                                  returnType,
                                  cls->ownerhandle,
                                  createPassArgumentsRAII());
+        } else if (propagatesResult()) {
+            return vkgen::format(R"(      return {0}::create({1});
+)",
+                                 returnType,
+                                 createPassArgumentsRAII());
         } else {
             return vkgen::format(R"(      return {0}({1});
 )",
@@ -2839,7 +3009,9 @@ for (auto const &{2} : {3}) {
         const auto &id = last->identifier();
         output += "      " + last->original.type() + " " + id + ";\n";
         output += "      " + generatePFNcall();
-        output += "      " + generateCheck();
+        if (!propagatesResult()) {
+            output += "      " + generateCheck();
+        }
 
         if (gen.getConfig().gen.globalMode) {
             returnValue = id;
@@ -2847,6 +3019,9 @@ for (auto const &{2} : {3}) {
         else {
             returnValue = last->fullType(gen) + "(" + id + ")";
         }
+        if (propagatesResult()) {
+            returnValue = generateReturnValue(returnValue);
+        }
         return output;
 
         if (ctx.isStatic) {
@@ -2947,6 +3122,9 @@ for (auto const &{2} : {3}) {
 
             returnType = uniqueVector->fullType(gen);
             returnValue = "std::move(" + uniqueVector->identifier() + ")";
+            if (propagatesResult()) {
+                returnValue = generateReturnValue(returnValue);
+            }
 
         }
 
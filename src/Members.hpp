@@ -89,6 +89,7 @@ namespace vkgen
         bool          specifierConst       = {};
         bool          specifierConstexpr   = {};
         bool          specifierConstexpr14 = {};
+        bool          specifierStatic      = {};
 
         static bool filterProto(const VariableData &v, bool same) {
             return !v.getIgnoreProto();
@@ -159,6 +160,10 @@ namespace vkgen
 
         bool usesResultValueType() const;
 
+        bool propagatesResult() const;
+
+        bool checksReturnedResult() const;
+
         std::string generateReturnType() const;
 
         std::string createReturnType() const;
@@ -359,6 +364,7 @@ namespace vkgen
       protected:
         // String      _name;
         std::string src;
+        std::string resultOut;
         bool        ownerInParent;
 
         struct SuperclassSource
@@ -397,6 +403,20 @@ namespace vkgen
         std::string generateMemberBody() override;
     };
 
+    class MemberResolverCtorNoThrow final : public MemberResolverCtor
+    {
+      public:
+        MemberResolverCtorNoThrow(const Generator &gen, ClassCommand &d, MemberContext &refCtx);
+    };
+
+    class MemberResolverCtorFactory final : public MemberResolverCtor
+    {
+      public:
+        MemberResolverCtorFactory(const Generator &gen, ClassCommand &d, MemberContext &refCtx);
+
+        std::string generateMemberBody() override;
+    };
+
     class MemberResolverInit : public MemberResolverCtor
     {
       public:
@@ -117,12 +117,12 @@ namespace vkgen
         //: sFuncs(gen), sFuncsEnhanced(gen), sPublic(gen), sPrivate(gen), sProtected(gen)
         // {}
 
-        GuardedOutput sFuncs;
-        GuardedOutput sPublic;
-        GuardedOutput sPrivate;
-        GuardedOutput sProtected;
-        std::string   name;
-        std::string   inherits;
+        GuardedOutput sFuncs     = {};
+        GuardedOutput sPublic    = {};
+        GuardedOutput sPrivate   = {};
+        GuardedOutput sProtected = {};
+        std::string   name       = {};
+        std::string   inherits   = {};
 
         size_t size() const {
             return name.size() + sFuncs.size() + sPublic.size() + sPrivate.size() + sProtected.size();
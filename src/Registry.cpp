@@ -28,6 +28,7 @@
 #include <string>
 #include <functional>
 #include <cassert>
+#include <cstdlib>
 
 static constexpr auto no_ver = "";
 
@@ -115,6 +116,7 @@ namespace vkgen
     }
 
     void Registry::loadSystemRegistryPath() {
+#ifdef _MSC_VER
         size_t size = 0;
         getenv_s(&size, nullptr, 0, "VULKAN_SDK");
         // std::cout << "getenv_s: " << size << "\n";
@@ -127,6 +129,13 @@ namespace vkgen
         getenv_s(&size, sdk.data(), sdk.size(), "VULKAN_SDK");
         // std::cout << "sdk path: " << sdk << "\n";
         sdk.resize(size - 1);
+#else
+        const char *env = std::getenv("VULKAN_SDK");
+        if (!env || !*env) {
+            return;
+        }
+        std::string sdk = env;
+#endif
 
         auto regPath = fs::path{ sdk } / fs::path{ "share/vulkan/registry/vk.xml" };
         if (fs::exists(regPath)) {
@@ -883,6 +892,13 @@ namespace vkgen
         return 1000000000 + 1000 * (extnumber - 1);
     }
 
+    // value attribute of <enum>: decimal or hex, optionally negative and with U/L suffixes
+    static int64_t parseEnumLiteral(const std::string &str) {
+        const bool negative = str.starts_with('-');
+        const uint64_t v = std::stoull(negative? str.substr(1) : str, nullptr, 0);
+        return negative? -static_cast<int64_t>(v) : static_cast<int64_t>(v);
+    }
+
     void Registry::parseEnumValue(const xml::Element &elem, vkr::Enum &e, vkr::Feature *feature, vkr::Extension *ext, const std::string_view protect) {
 
         const auto name = elem["name"];
@@ -908,6 +924,7 @@ namespace vkgen
         if (value) {
             type->value = neg? "-" : "";
             type->value += value.value();
+            type->numericValue = parseEnumLiteral(type->value);
         }
         else  {
             uint64_t eval = 0;
@@ -1501,7 +1518,8 @@ namespace vkgen
                 if (!m.alias.empty()) {
                     auto *src = e.find(m.alias);
                     if (src) {
-                        m.value = src->value;
+                        m.value        = src->value;
+                        m.numericValue = src->numericValue;
                         // m.value += " // " + m.alias;
                     }
                 }
@@ -1862,6 +1880,14 @@ namespace vkgen::vkr
                                                                          .ns         = Namespace::RAII,
                                                                          .flag       = VariableData::Flags::CLASS_VAR_RAII,
                                                                          .metaType   = MetaType::Handle });
+
+            // copy of owner's dispatcher pointer, used with raii.cached_dispatcher
+            dispatchRaii = std::make_unique<VariableData>(VariableDataInfo{ .stdtype    = superclass + "Dispatcher",
+                                                                            .suffix     = " const *",
+                                                                            .identifier = "m_dispatcher",
+                                                                            .assigment  = " = nullptr",
+                                                                            .ns         = Namespace::NONE,
+                                                                            .flag       = VariableData::Flags::CLASS_VAR_RAII });
         }
         // std::cout << "Handle init done " << '\n';
     }
@@ -1965,6 +1991,8 @@ namespace vkgen::vkr
             vars.emplace_back(std::ref(gen.cvars.raiiInstanceDispatch));
         } else if (name.original == "VkDevice" && !cfg.gen.raii.staticDevicePFN) {
             vars.emplace_back(std::ref(gen.cvars.raiiDeviceDispatch));
+        } else if (dispatchRaii && cfg.gen.raii.cachedDispatcher && !cfg.gen.expApi) {
+            vars.emplace_back(std::ref(*dispatchRaii));
         }
     }
 
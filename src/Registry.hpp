@@ -352,6 +352,7 @@ namespace vkgen
             VariableData                  vkhandle;
             std::string                   ownerhandle;
             std::unique_ptr<VariableData> ownerRaii;
+            std::unique_ptr<VariableData> dispatchRaii;
             std::unique_ptr<VariableData> ownerUnique;
             std::unique_ptr<VariableData> secondOwner;
             std::string      code;
@@ -32,9 +32,10 @@ void vkgen::VariableFields::set(size_t index, const std::string &str) {
 vkgen::VariableData::VariableData(Registry &reg, xml::Element elem) {
     XMLVariableParser p(*this, elem.toElement());
 
-    const auto len      = elem.optional("len");
-    const auto altlen   = elem.optional("altlen");
-    const auto optional = elem.optional("optional");
+    const auto len        = elem.optional("len");
+    const auto altlen     = elem.optional("altlen");
+    const auto optional   = elem.optional("optional");
+    const auto externsync = elem.optional("externsync");
     if (len) {
         lenExpressions = split(std::string(len.value()), ",");
         for (const auto &str : lenExpressions) {
@@ -57,6 +58,9 @@ vkgen::VariableData::VariableData(Registry &reg, xml::Element elem) {
     if (optional) {
         this->optional = optional == "true";
     }
+    if (externsync) {
+        externSyncStr = externsync.value();
+    }
 
     trim();
     original = *reinterpret_cast<VariableFields *>(this);
@@ -168,6 +168,7 @@ namespace vkgen
         std::string arraySizes[2];
         std::string lenAttribStr;
         std::string altlenAttribStr;
+        std::string externSyncStr;
 
       public:
         VariableFields           original;
@@ -351,6 +352,20 @@ namespace vkgen
             return altlenAttribStr;
         }
 
+        // "true" or the externally synchronized members ("pAllocateInfo->commandPool", "maybe:..."), empty when absent
+        std::string getExternSync() const {
+            return externSyncStr;
+        }
+
+        bool isExternSync() const {
+            return !externSyncStr.empty() && externSyncStr != "false";
+        }
+
+        // the handle itself, not only some of its members
+        bool isExternSyncSelf() const {
+            return externSyncStr == "true";
+        }
+
         std::string getLenAttribIdentifier() const;
 
         std::string getLenAttribRhs() const;
@@ -783,12 +798,12 @@ namespace vkgen
 
     struct VariableDataInfo
     {
-        std::string         prefix;
-        std::string         vktype;
-        std::string         stdtype;
-        std::string         suffix;
-        std::string         identifier;
-        std::string         assigment;
+        std::string         prefix      = {};
+        std::string         vktype      = {};
+        std::string         stdtype     = {};
+        std::string         suffix      = {};
+        std::string         identifier  = {};
+        std::string         assigment   = {};
         Namespace           ns          = {};
         VariableData::Flags flag        = {};
         VariableData::Type  specialType = VariableData::TYPE_DEFAULT;